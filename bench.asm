@@ -0,0 +1,3572 @@
+
+_bench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         nblock ? kc * 64 / nblock * 32 : 0);
+}
+
+int
+main(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 e4 f0             	and    $0xfffffff0,%esp
+  forksbrkbench();
+       6:	e8 b5 01 00 00       	call   1c0 <forksbrkbench>
+  forkexecbench();
+       b:	e8 d0 02 00 00       	call   2e0 <forkexecbench>
+  smallexecbench();
+      10:	e8 cb 03 00 00       	call   3e0 <smallexecbench>
+  sparsesbrkbench();
+      15:	e8 76 04 00 00       	call   490 <sparsesbrkbench>
+  switchbench();
+      1a:	e8 21 07 00 00       	call   740 <switchbench>
+  wakebench();
+      1f:	e8 5c 07 00 00       	call   780 <wakebench>
+  burnbench();
+      24:	e8 c7 08 00 00       	call   8f0 <burnbench>
+  latencybench();
+      29:	e8 c2 09 00 00       	call   9f0 <latencybench>
+  stridebench();
+      2e:	e8 2d 0b 00 00       	call   b60 <stridebench>
+  nanosleepbench();
+      33:	e8 f8 0c 00 00       	call   d30 <nanosleepbench>
+  threadbench();
+      38:	e8 83 0d 00 00       	call   dc0 <threadbench>
+  mutexbench();
+      3d:	e8 fe 0e 00 00       	call   f40 <mutexbench>
+  affinitybench();
+      42:	e8 e9 10 00 00       	call   1130 <affinitybench>
+  readbench();
+      47:	e8 34 11 00 00       	call   1180 <readbench>
+  seqreadbench();
+      4c:	e8 2f 13 00 00       	call   1380 <seqreadbench>
+  commitbench();
+      51:	e8 fa 13 00 00       	call   1450 <commitbench>
+  seqiobench();
+      56:	e8 05 15 00 00       	call   1560 <seqiobench>
+  randiobench();
+      5b:	e8 00 16 00 00       	call   1660 <randiobench>
+  diskcpubench();
+      60:	e8 0b 18 00 00       	call   1870 <diskcpubench>
+  exit();
+      65:	e8 84 1b 00 00       	call   1bee <exit>
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    nu = 4096;
+  p = sbrk(nu * sizeof(Header));
+      6a:	66 90                	xchg   %ax,%ax
+      6c:	66 90                	xchg   %ax,%ax
+  if(p == (char*)-1)
+      6e:	66 90                	xchg   %ax,%ax
+
+00000070 <threadwork>:
+{
+      70:	55                   	push   %ebp
+      71:	89 e5                	mov    %esp,%ebp
+      73:	83 ec 10             	sub    $0x10,%esp
+  for(i = 0; i < (uint)arg; i++)
+      76:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+{
+      7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(i = 0; i < (uint)arg; i++)
+      80:	8b 45 fc             	mov    -0x4(%ebp),%eax
+      83:	39 d0                	cmp    %edx,%eax
+      85:	73 19                	jae    a0 <threadwork+0x30>
+      87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      8e:	66 90                	xchg   %ax,%ax
+      90:	8b 45 fc             	mov    -0x4(%ebp),%eax
+      93:	83 c0 01             	add    $0x1,%eax
+      96:	89 45 fc             	mov    %eax,-0x4(%ebp)
+      99:	8b 45 fc             	mov    -0x4(%ebp),%eax
+      9c:	39 d0                	cmp    %edx,%eax
+      9e:	72 f0                	jb     90 <threadwork+0x20>
+}
+      a0:	c9                   	leave
+      a1:	c3                   	ret
+      a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <spinner>:
+{
+      b0:	55                   	push   %ebp
+      b1:	89 e5                	mov    %esp,%ebp
+      b3:	53                   	push   %ebx
+      b4:	bb 20 4e 00 00       	mov    $0x4e20,%ebx
+      b9:	83 ec 04             	sub    $0x4,%esp
+      bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    lock_acquire(&spin);
+      c0:	83 ec 0c             	sub    $0xc,%esp
+      c3:	68 b0 2d 00 00       	push   $0x2db0
+      c8:	e8 83 18 00 00       	call   1950 <lock_acquire>
+    locked++;
+      cd:	83 05 a4 2d 00 00 01 	addl   $0x1,0x2da4
+    lock_release(&spin);
+      d4:	c7 04 24 b0 2d 00 00 	movl   $0x2db0,(%esp)
+      db:	e8 90 18 00 00       	call   1970 <lock_release>
+  for(i = 0; i < NLOCK; i++){
+      e0:	83 c4 10             	add    $0x10,%esp
+      e3:	83 eb 01             	sub    $0x1,%ebx
+      e6:	75 d8                	jne    c0 <spinner+0x10>
+}
+      e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      eb:	c9                   	leave
+      ec:	c3                   	ret
+      ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000f0 <mutexer>:
+{
+      f0:	55                   	push   %ebp
+      f1:	89 e5                	mov    %esp,%ebp
+      f3:	53                   	push   %ebx
+      f4:	bb 20 4e 00 00       	mov    $0x4e20,%ebx
+      f9:	83 ec 04             	sub    $0x4,%esp
+      fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&mutex);
+     100:	83 ec 0c             	sub    $0xc,%esp
+     103:	68 ac 2d 00 00       	push   $0x2dac
+     108:	e8 83 18 00 00       	call   1990 <mutex_lock>
+    locked++;
+     10d:	83 05 a4 2d 00 00 01 	addl   $0x1,0x2da4
+    mutex_unlock(&mutex);
+     114:	c7 04 24 ac 2d 00 00 	movl   $0x2dac,(%esp)
+     11b:	e8 c0 18 00 00       	call   19e0 <mutex_unlock>
+  for(i = 0; i < NLOCK; i++){
+     120:	83 c4 10             	add    $0x10,%esp
+     123:	83 eb 01             	sub    $0x1,%ebx
+     126:	75 d8                	jne    100 <mutexer+0x10>
+}
+     128:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     12b:	c9                   	leave
+     12c:	c3                   	ret
+     12d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000130 <ponger>:
+{
+     130:	55                   	push   %ebp
+     131:	89 e5                	mov    %esp,%ebp
+     133:	57                   	push   %edi
+     134:	56                   	push   %esi
+    turn = !me;
+     135:	be 10 27 00 00       	mov    $0x2710,%esi
+{
+     13a:	53                   	push   %ebx
+     13b:	83 ec 18             	sub    $0x18,%esp
+     13e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  mutex_lock(&mutex);
+     141:	68 ac 2d 00 00       	push   $0x2dac
+     146:	e8 45 18 00 00       	call   1990 <mutex_lock>
+    turn = !me;
+     14b:	31 c0                	xor    %eax,%eax
+     14d:	83 c4 10             	add    $0x10,%esp
+     150:	85 db                	test   %ebx,%ebx
+     152:	0f 94 c0             	sete   %al
+     155:	89 c7                	mov    %eax,%edi
+     157:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     15e:	66 90                	xchg   %ax,%ax
+    while(turn != me)
+     160:	3b 1d a0 2d 00 00    	cmp    0x2da0,%ebx
+     166:	74 25                	je     18d <ponger+0x5d>
+     168:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     16f:	90                   	nop
+      cond_wait(&cond, &mutex);
+     170:	83 ec 08             	sub    $0x8,%esp
+     173:	68 ac 2d 00 00       	push   $0x2dac
+     178:	68 a8 2d 00 00       	push   $0x2da8
+     17d:	e8 9e 18 00 00       	call   1a20 <cond_wait>
+    while(turn != me)
+     182:	83 c4 10             	add    $0x10,%esp
+     185:	39 1d a0 2d 00 00    	cmp    %ebx,0x2da0
+     18b:	75 e3                	jne    170 <ponger+0x40>
+    cond_broadcast(&cond);
+     18d:	83 ec 0c             	sub    $0xc,%esp
+    turn = !me;
+     190:	89 3d a0 2d 00 00    	mov    %edi,0x2da0
+    cond_broadcast(&cond);
+     196:	68 a8 2d 00 00       	push   $0x2da8
+     19b:	e8 00 19 00 00       	call   1aa0 <cond_broadcast>
+  for(i = 0; i < NSWITCH; i++){
+     1a0:	83 c4 10             	add    $0x10,%esp
+     1a3:	83 ee 01             	sub    $0x1,%esi
+     1a6:	75 b8                	jne    160 <ponger+0x30>
+  mutex_unlock(&mutex);
+     1a8:	c7 45 08 ac 2d 00 00 	movl   $0x2dac,0x8(%ebp)
+}
+     1af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     1b2:	5b                   	pop    %ebx
+     1b3:	5e                   	pop    %esi
+     1b4:	5f                   	pop    %edi
+     1b5:	5d                   	pop    %ebp
+  mutex_unlock(&mutex);
+     1b6:	e9 25 18 00 00       	jmp    19e0 <mutex_unlock>
+     1bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1bf:	90                   	nop
+
+000001c0 <forksbrkbench>:
+{
+     1c0:	55                   	push   %ebp
+     1c1:	89 e5                	mov    %esp,%ebp
+     1c3:	56                   	push   %esi
+     1c4:	53                   	push   %ebx
+  start = uptime();
+     1c5:	bb 08 00 00 00       	mov    $0x8,%ebx
+  printf(stdout, "fork+sbrk bench\n");
+     1ca:	83 ec 08             	sub    $0x8,%esp
+     1cd:	68 40 1f 00 00       	push   $0x1f40
+     1d2:	ff 35 74 2d 00 00    	push   0x2d74
+     1d8:	e8 b3 1b 00 00       	call   1d90 <printf>
+  start = uptime();
+     1dd:	e8 a4 1a 00 00       	call   1c86 <uptime>
+     1e2:	83 c4 10             	add    $0x10,%esp
+     1e5:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < NBENCHPROC; i++){
+     1e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ee:	66 90                	xchg   %ax,%ax
+    pid = fork();
+     1f0:	e8 f1 19 00 00       	call   1be6 <fork>
+    if(pid < 0){
+     1f5:	85 c0                	test   %eax,%eax
+     1f7:	0f 88 c5 00 00 00    	js     2c2 <forksbrkbench+0x102>
+    if(pid == 0){
+     1fd:	74 42                	je     241 <forksbrkbench+0x81>
+  for(i = 0; i < NBENCHPROC; i++){
+     1ff:	83 eb 01             	sub    $0x1,%ebx
+     202:	75 ec                	jne    1f0 <forksbrkbench+0x30>
+     204:	bb 08 00 00 00       	mov    $0x8,%ebx
+     209:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    wait();
+     210:	e8 e1 19 00 00       	call   1bf6 <wait>
+  for(i = 0; i < NBENCHPROC; i++)
+     215:	83 eb 01             	sub    $0x1,%ebx
+     218:	75 f6                	jne    210 <forksbrkbench+0x50>
+         NBENCHPROC*100, uptime() - start);
+     21a:	e8 67 1a 00 00       	call   1c86 <uptime>
+  printf(stdout, "fork+sbrk bench: %d ops in %d ticks\n",
+     21f:	29 f0                	sub    %esi,%eax
+     221:	50                   	push   %eax
+     222:	68 20 03 00 00       	push   $0x320
+     227:	68 24 22 00 00       	push   $0x2224
+     22c:	ff 35 74 2d 00 00    	push   0x2d74
+     232:	e8 59 1b 00 00       	call   1d90 <printf>
+}
+     237:	83 c4 10             	add    $0x10,%esp
+     23a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     23d:	5b                   	pop    %ebx
+     23e:	5e                   	pop    %esi
+     23f:	5d                   	pop    %ebp
+     240:	c3                   	ret
+     241:	bb 64 00 00 00       	mov    $0x64,%ebx
+     246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     24d:	8d 76 00             	lea    0x0(%esi),%esi
+        a = sbrk(16*4096);
+     250:	83 ec 0c             	sub    $0xc,%esp
+     253:	68 00 00 01 00       	push   $0x10000
+     258:	e8 19 1a 00 00       	call   1c76 <sbrk>
+        if(a == (char*)0xffffffff){
+     25d:	83 c4 10             	add    $0x10,%esp
+     260:	83 f8 ff             	cmp    $0xffffffff,%eax
+     263:	74 45                	je     2aa <forksbrkbench+0xea>
+        for(k = 0; k < 16; k++)
+     265:	31 d2                	xor    %edx,%edx
+     267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     26e:	66 90                	xchg   %ax,%ax
+          a[k*4096] = k;
+     270:	89 d1                	mov    %edx,%ecx
+     272:	c1 e1 0c             	shl    $0xc,%ecx
+     275:	88 14 08             	mov    %dl,(%eax,%ecx,1)
+        for(k = 0; k < 16; k++)
+     278:	83 c2 01             	add    $0x1,%edx
+     27b:	83 fa 10             	cmp    $0x10,%edx
+     27e:	75 f0                	jne    270 <forksbrkbench+0xb0>
+        sbrk(-16*4096);
+     280:	83 ec 0c             	sub    $0xc,%esp
+     283:	68 00 00 ff ff       	push   $0xffff0000
+     288:	e8 e9 19 00 00       	call   1c76 <sbrk>
+        pid = fork();
+     28d:	e8 54 19 00 00       	call   1be6 <fork>
+        if(pid == 0)
+     292:	83 c4 10             	add    $0x10,%esp
+     295:	85 c0                	test   %eax,%eax
+     297:	74 0c                	je     2a5 <forksbrkbench+0xe5>
+        if(pid > 0)
+     299:	7e 05                	jle    2a0 <forksbrkbench+0xe0>
+          wait();
+     29b:	e8 56 19 00 00       	call   1bf6 <wait>
+      for(j = 0; j < 100; j++){
+     2a0:	83 eb 01             	sub    $0x1,%ebx
+     2a3:	75 ab                	jne    250 <forksbrkbench+0x90>
+          exit();
+     2a5:	e8 44 19 00 00       	call   1bee <exit>
+          printf(stdout, "sbrk failed\n");
+     2aa:	83 ec 08             	sub    $0x8,%esp
+     2ad:	68 5e 1f 00 00       	push   $0x1f5e
+     2b2:	ff 35 74 2d 00 00    	push   0x2d74
+     2b8:	e8 d3 1a 00 00       	call   1d90 <printf>
+          exit();
+     2bd:	e8 2c 19 00 00       	call   1bee <exit>
+      printf(stdout, "fork failed\n");
+     2c2:	83 ec 08             	sub    $0x8,%esp
+     2c5:	68 51 1f 00 00       	push   $0x1f51
+     2ca:	ff 35 74 2d 00 00    	push   0x2d74
+     2d0:	e8 bb 1a 00 00       	call   1d90 <printf>
+      exit();
+     2d5:	e8 14 19 00 00       	call   1bee <exit>
+     2da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000002e0 <forkexecbench>:
+{
+     2e0:	55                   	push   %ebp
+     2e1:	89 e5                	mov    %esp,%ebp
+     2e3:	57                   	push   %edi
+     2e4:	56                   	push   %esi
+     2e5:	53                   	push   %ebx
+     2e6:	83 ec 14             	sub    $0x14,%esp
+  printf(stdout, "fork+exec bench\n");
+     2e9:	68 76 1f 00 00       	push   $0x1f76
+     2ee:	ff 35 74 2d 00 00    	push   0x2d74
+     2f4:	e8 97 1a 00 00       	call   1d90 <printf>
+  oldbrk = sbrk(0);
+     2f9:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     300:	e8 71 19 00 00       	call   1c76 <sbrk>
+  a = sbrk(4*1024*1024);
+     305:	c7 04 24 00 00 40 00 	movl   $0x400000,(%esp)
+  oldbrk = sbrk(0);
+     30c:	89 c3                	mov    %eax,%ebx
+  a = sbrk(4*1024*1024);
+     30e:	e8 63 19 00 00       	call   1c76 <sbrk>
+  if(a == (char*)0xffffffff){
+     313:	83 c4 10             	add    $0x10,%esp
+     316:	83 f8 ff             	cmp    $0xffffffff,%eax
+     319:	0f 84 aa 00 00 00    	je     3c9 <forkexecbench+0xe9>
+     31f:	8d 90 00 00 40 00    	lea    0x400000(%eax),%edx
+     325:	8d 76 00             	lea    0x0(%esi),%esi
+    a[i] = 1;
+     328:	c6 00 01             	movb   $0x1,(%eax)
+  for(i = 0; i < 4*1024*1024; i += 4096)
+     32b:	05 00 10 00 00       	add    $0x1000,%eax
+     330:	39 c2                	cmp    %eax,%edx
+     332:	75 f4                	jne    328 <forkexecbench+0x48>
+  start = uptime();
+     334:	e8 4d 19 00 00       	call   1c86 <uptime>
+     339:	be 32 00 00 00       	mov    $0x32,%esi
+     33e:	89 c7                	mov    %eax,%edi
+    pid = fork();
+     340:	e8 a1 18 00 00       	call   1be6 <fork>
+    if(pid < 0){
+     345:	85 c0                	test   %eax,%eax
+     347:	78 48                	js     391 <forkexecbench+0xb1>
+    if(pid == 0){
+     349:	74 5e                	je     3a9 <forkexecbench+0xc9>
+    wait();
+     34b:	e8 a6 18 00 00       	call   1bf6 <wait>
+  for(i = 0; i < 50; i++){
+     350:	83 ee 01             	sub    $0x1,%esi
+     353:	75 eb                	jne    340 <forkexecbench+0x60>
+         uptime() - start);
+     355:	e8 2c 19 00 00       	call   1c86 <uptime>
+  printf(stdout, "fork+exec bench: 50 fork+exec of a 4MB process in %d ticks\n",
+     35a:	83 ec 04             	sub    $0x4,%esp
+     35d:	29 f8                	sub    %edi,%eax
+     35f:	50                   	push   %eax
+     360:	68 4c 22 00 00       	push   $0x224c
+     365:	ff 35 74 2d 00 00    	push   0x2d74
+     36b:	e8 20 1a 00 00       	call   1d90 <printf>
+  sbrk(-(sbrk(0) - oldbrk));
+     370:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     377:	e8 fa 18 00 00       	call   1c76 <sbrk>
+     37c:	29 c3                	sub    %eax,%ebx
+     37e:	89 1c 24             	mov    %ebx,(%esp)
+     381:	e8 f0 18 00 00       	call   1c76 <sbrk>
+}
+     386:	83 c4 10             	add    $0x10,%esp
+     389:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     38c:	5b                   	pop    %ebx
+     38d:	5e                   	pop    %esi
+     38e:	5f                   	pop    %edi
+     38f:	5d                   	pop    %ebp
+     390:	c3                   	ret
+      printf(stdout, "fork failed\n");
+     391:	83 ec 08             	sub    $0x8,%esp
+     394:	68 51 1f 00 00       	push   $0x1f51
+     399:	ff 35 74 2d 00 00    	push   0x2d74
+     39f:	e8 ec 19 00 00       	call   1d90 <printf>
+      exit();
+     3a4:	e8 45 18 00 00       	call   1bee <exit>
+      close(1);
+     3a9:	83 ec 0c             	sub    $0xc,%esp
+     3ac:	6a 01                	push   $0x1
+     3ae:	e8 63 18 00 00       	call   1c16 <close>
+      exec("echo", echoargv);
+     3b3:	58                   	pop    %eax
+     3b4:	5a                   	pop    %edx
+     3b5:	68 78 2d 00 00       	push   $0x2d78
+     3ba:	68 6b 1f 00 00       	push   $0x1f6b
+     3bf:	e8 62 18 00 00       	call   1c26 <exec>
+      exit();
+     3c4:	e8 25 18 00 00       	call   1bee <exit>
+    printf(stdout, "sbrk failed\n");
+     3c9:	51                   	push   %ecx
+     3ca:	51                   	push   %ecx
+     3cb:	68 5e 1f 00 00       	push   $0x1f5e
+     3d0:	ff 35 74 2d 00 00    	push   0x2d74
+     3d6:	e8 b5 19 00 00       	call   1d90 <printf>
+    exit();
+     3db:	e8 0e 18 00 00       	call   1bee <exit>
+
+000003e0 <smallexecbench>:
+{
+     3e0:	55                   	push   %ebp
+     3e1:	89 e5                	mov    %esp,%ebp
+     3e3:	56                   	push   %esi
+     3e4:	53                   	push   %ebx
+  start = uptime();
+     3e5:	bb 64 00 00 00       	mov    $0x64,%ebx
+  printf(stdout, "small fork+exec bench\n");
+     3ea:	83 ec 08             	sub    $0x8,%esp
+     3ed:	68 70 1f 00 00       	push   $0x1f70
+     3f2:	ff 35 74 2d 00 00    	push   0x2d74
+     3f8:	e8 93 19 00 00       	call   1d90 <printf>
+  start = uptime();
+     3fd:	e8 84 18 00 00       	call   1c86 <uptime>
+     402:	83 c4 10             	add    $0x10,%esp
+     405:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     407:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     40e:	66 90                	xchg   %ax,%ax
+    pid = fork();
+     410:	e8 d1 17 00 00       	call   1be6 <fork>
+    if(pid < 0){
+     415:	85 c0                	test   %eax,%eax
+     417:	78 31                	js     44a <smallexecbench+0x6a>
+    if(pid == 0){
+     419:	74 47                	je     462 <smallexecbench+0x82>
+    wait();
+     41b:	e8 d6 17 00 00       	call   1bf6 <wait>
+  for(i = 0; i < 100; i++){
+     420:	83 eb 01             	sub    $0x1,%ebx
+     423:	75 eb                	jne    410 <smallexecbench+0x30>
+         uptime() - start);
+     425:	e8 5c 18 00 00       	call   1c86 <uptime>
+  printf(stdout, "small fork+exec bench: 100 fork+exec in %d ticks\n",
+     42a:	83 ec 04             	sub    $0x4,%esp
+     42d:	29 f0                	sub    %esi,%eax
+     42f:	50                   	push   %eax
+     430:	68 88 22 00 00       	push   $0x2288
+     435:	ff 35 74 2d 00 00    	push   0x2d74
+     43b:	e8 50 19 00 00       	call   1d90 <printf>
+}
+     440:	83 c4 10             	add    $0x10,%esp
+     443:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     446:	5b                   	pop    %ebx
+     447:	5e                   	pop    %esi
+     448:	5d                   	pop    %ebp
+     449:	c3                   	ret
+      printf(stdout, "fork failed\n");
+     44a:	83 ec 08             	sub    $0x8,%esp
+     44d:	68 51 1f 00 00       	push   $0x1f51
+     452:	ff 35 74 2d 00 00    	push   0x2d74
+     458:	e8 33 19 00 00       	call   1d90 <printf>
+      exit();
+     45d:	e8 8c 17 00 00       	call   1bee <exit>
+      close(1);
+     462:	83 ec 0c             	sub    $0xc,%esp
+     465:	6a 01                	push   $0x1
+     467:	e8 aa 17 00 00       	call   1c16 <close>
+      exec("echo", echoargv);
+     46c:	58                   	pop    %eax
+     46d:	5a                   	pop    %edx
+     46e:	68 78 2d 00 00       	push   $0x2d78
+     473:	68 6b 1f 00 00       	push   $0x1f6b
+     478:	e8 a9 17 00 00       	call   1c26 <exec>
+      exit();
+     47d:	e8 6c 17 00 00       	call   1bee <exit>
+     482:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <sparsesbrkbench>:
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	56                   	push   %esi
+     494:	53                   	push   %ebx
+  start = uptime();
+     495:	bb 14 00 00 00       	mov    $0x14,%ebx
+  printf(stdout, "sparse sbrk bench\n");
+     49a:	83 ec 08             	sub    $0x8,%esp
+     49d:	68 87 1f 00 00       	push   $0x1f87
+     4a2:	ff 35 74 2d 00 00    	push   0x2d74
+     4a8:	e8 e3 18 00 00       	call   1d90 <printf>
+  start = uptime();
+     4ad:	e8 d4 17 00 00       	call   1c86 <uptime>
+     4b2:	83 c4 10             	add    $0x10,%esp
+     4b5:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+     4b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4be:	66 90                	xchg   %ax,%ax
+    a = sbrk(64*1024*1024);
+     4c0:	83 ec 0c             	sub    $0xc,%esp
+     4c3:	68 00 00 00 04       	push   $0x4000000
+     4c8:	e8 a9 17 00 00       	call   1c76 <sbrk>
+    if(a == (char*)0xffffffff){
+     4cd:	83 c4 10             	add    $0x10,%esp
+     4d0:	83 f8 ff             	cmp    $0xffffffff,%eax
+     4d3:	74 55                	je     52a <sparsesbrkbench+0x9a>
+    for(j = 0; j < 64; j++)
+     4d5:	31 d2                	xor    %edx,%edx
+     4d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4de:	66 90                	xchg   %ax,%ax
+      a[j*1024*1024] = j;
+     4e0:	89 d1                	mov    %edx,%ecx
+     4e2:	c1 e1 14             	shl    $0x14,%ecx
+     4e5:	88 14 08             	mov    %dl,(%eax,%ecx,1)
+    for(j = 0; j < 64; j++)
+     4e8:	83 c2 01             	add    $0x1,%edx
+     4eb:	83 fa 40             	cmp    $0x40,%edx
+     4ee:	75 f0                	jne    4e0 <sparsesbrkbench+0x50>
+    sbrk(-64*1024*1024);
+     4f0:	83 ec 0c             	sub    $0xc,%esp
+     4f3:	68 00 00 00 fc       	push   $0xfc000000
+     4f8:	e8 79 17 00 00       	call   1c76 <sbrk>
+  for(i = 0; i < 20; i++){
+     4fd:	83 c4 10             	add    $0x10,%esp
+     500:	83 eb 01             	sub    $0x1,%ebx
+     503:	75 bb                	jne    4c0 <sparsesbrkbench+0x30>
+         uptime() - start);
+     505:	e8 7c 17 00 00       	call   1c86 <uptime>
+  printf(stdout, "sparse sbrk bench: 20 x 64MB sbrk in %d ticks\n",
+     50a:	83 ec 04             	sub    $0x4,%esp
+     50d:	29 f0                	sub    %esi,%eax
+     50f:	50                   	push   %eax
+     510:	68 bc 22 00 00       	push   $0x22bc
+     515:	ff 35 74 2d 00 00    	push   0x2d74
+     51b:	e8 70 18 00 00       	call   1d90 <printf>
+}
+     520:	83 c4 10             	add    $0x10,%esp
+     523:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     526:	5b                   	pop    %ebx
+     527:	5e                   	pop    %esi
+     528:	5d                   	pop    %ebp
+     529:	c3                   	ret
+      printf(stdout, "sbrk failed\n");
+     52a:	83 ec 08             	sub    $0x8,%esp
+     52d:	68 5e 1f 00 00       	push   $0x1f5e
+     532:	ff 35 74 2d 00 00    	push   0x2d74
+     538:	e8 53 18 00 00       	call   1d90 <printf>
+      exit();
+     53d:	e8 ac 16 00 00       	call   1bee <exit>
+     542:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     549:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <pingpong>:
+{
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	57                   	push   %edi
+     554:	56                   	push   %esi
+  if(pipe(ping) < 0 || pipe(pong) < 0){
+     555:	8d 45 d8             	lea    -0x28(%ebp),%eax
+{
+     558:	53                   	push   %ebx
+     559:	83 ec 38             	sub    $0x38,%esp
+  if(pipe(ping) < 0 || pipe(pong) < 0){
+     55c:	50                   	push   %eax
+     55d:	e8 9c 16 00 00       	call   1bfe <pipe>
+     562:	83 c4 10             	add    $0x10,%esp
+     565:	85 c0                	test   %eax,%eax
+     567:	0f 88 43 01 00 00    	js     6b0 <pingpong+0x160>
+     56d:	83 ec 0c             	sub    $0xc,%esp
+     570:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     573:	50                   	push   %eax
+     574:	e8 85 16 00 00       	call   1bfe <pipe>
+     579:	83 c4 10             	add    $0x10,%esp
+     57c:	85 c0                	test   %eax,%eax
+     57e:	0f 88 2c 01 00 00    	js     6b0 <pingpong+0x160>
+  pid = fork();
+     584:	e8 5d 16 00 00       	call   1be6 <fork>
+  if(pid < 0){
+     589:	85 c0                	test   %eax,%eax
+     58b:	0f 88 08 01 00 00    	js     699 <pingpong+0x149>
+  if(pid == 0){
+     591:	75 4b                	jne    5de <pingpong+0x8e>
+     593:	bb 88 13 00 00       	mov    $0x1388,%ebx
+     598:	8d 75 d7             	lea    -0x29(%ebp),%esi
+     59b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     59f:	90                   	nop
+      if(read(ping[0], &c, 1) != 1 || write(pong[1], &c, 1) != 1){
+     5a0:	83 ec 04             	sub    $0x4,%esp
+     5a3:	6a 01                	push   $0x1
+     5a5:	56                   	push   %esi
+     5a6:	ff 75 d8             	push   -0x28(%ebp)
+     5a9:	e8 58 16 00 00       	call   1c06 <read>
+     5ae:	83 c4 10             	add    $0x10,%esp
+     5b1:	83 f8 01             	cmp    $0x1,%eax
+     5b4:	0f 85 a9 00 00 00    	jne    663 <pingpong+0x113>
+     5ba:	83 ec 04             	sub    $0x4,%esp
+     5bd:	6a 01                	push   $0x1
+     5bf:	56                   	push   %esi
+     5c0:	ff 75 e4             	push   -0x1c(%ebp)
+     5c3:	e8 46 16 00 00       	call   1c0e <write>
+     5c8:	83 c4 10             	add    $0x10,%esp
+     5cb:	83 f8 01             	cmp    $0x1,%eax
+     5ce:	0f 85 8f 00 00 00    	jne    663 <pingpong+0x113>
+    for(i = 0; i < NSWITCH/2; i++){
+     5d4:	83 eb 01             	sub    $0x1,%ebx
+     5d7:	75 c7                	jne    5a0 <pingpong+0x50>
+    exit();
+     5d9:	e8 10 16 00 00       	call   1bee <exit>
+  start = uptime();
+     5de:	e8 a3 16 00 00       	call   1c86 <uptime>
+     5e3:	bb 88 13 00 00       	mov    $0x1388,%ebx
+    if(write(ping[1], "x", 1) != 1 || read(pong[0], &c, 1) != 1){
+     5e8:	8d 75 d7             	lea    -0x29(%ebp),%esi
+  start = uptime();
+     5eb:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < NSWITCH/2; i++){
+     5ed:	8d 76 00             	lea    0x0(%esi),%esi
+    if(write(ping[1], "x", 1) != 1 || read(pong[0], &c, 1) != 1){
+     5f0:	83 ec 04             	sub    $0x4,%esp
+     5f3:	6a 01                	push   $0x1
+     5f5:	68 2a 21 00 00       	push   $0x212a
+     5fa:	ff 75 dc             	push   -0x24(%ebp)
+     5fd:	e8 0c 16 00 00       	call   1c0e <write>
+     602:	83 c4 10             	add    $0x10,%esp
+     605:	83 f8 01             	cmp    $0x1,%eax
+     608:	75 74                	jne    67e <pingpong+0x12e>
+     60a:	83 ec 04             	sub    $0x4,%esp
+     60d:	6a 01                	push   $0x1
+     60f:	56                   	push   %esi
+     610:	ff 75 e0             	push   -0x20(%ebp)
+     613:	e8 ee 15 00 00       	call   1c06 <read>
+     618:	83 c4 10             	add    $0x10,%esp
+     61b:	83 f8 01             	cmp    $0x1,%eax
+     61e:	75 5e                	jne    67e <pingpong+0x12e>
+  for(i = 0; i < NSWITCH/2; i++){
+     620:	83 eb 01             	sub    $0x1,%ebx
+     623:	75 cb                	jne    5f0 <pingpong+0xa0>
+  ticks = uptime() - start;
+     625:	e8 5c 16 00 00       	call   1c86 <uptime>
+     62a:	89 c3                	mov    %eax,%ebx
+  wait();
+     62c:	e8 c5 15 00 00       	call   1bf6 <wait>
+  close(ping[0]);
+     631:	83 ec 0c             	sub    $0xc,%esp
+     634:	ff 75 d8             	push   -0x28(%ebp)
+     637:	e8 da 15 00 00       	call   1c16 <close>
+  close(ping[1]);
+     63c:	58                   	pop    %eax
+     63d:	ff 75 dc             	push   -0x24(%ebp)
+     640:	e8 d1 15 00 00       	call   1c16 <close>
+  close(pong[0]);
+     645:	5a                   	pop    %edx
+     646:	ff 75 e0             	push   -0x20(%ebp)
+     649:	e8 c8 15 00 00       	call   1c16 <close>
+  close(pong[1]);
+     64e:	59                   	pop    %ecx
+     64f:	ff 75 e4             	push   -0x1c(%ebp)
+     652:	e8 bf 15 00 00       	call   1c16 <close>
+}
+     657:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  ticks = uptime() - start;
+     65a:	89 d8                	mov    %ebx,%eax
+     65c:	29 f8                	sub    %edi,%eax
+}
+     65e:	5b                   	pop    %ebx
+     65f:	5e                   	pop    %esi
+     660:	5f                   	pop    %edi
+     661:	5d                   	pop    %ebp
+     662:	c3                   	ret
+        printf(stdout, "%s: child pipe failed\n", name);
+     663:	83 ec 04             	sub    $0x4,%esp
+     666:	ff 75 08             	push   0x8(%ebp)
+     669:	68 a9 1f 00 00       	push   $0x1fa9
+     66e:	ff 35 74 2d 00 00    	push   0x2d74
+     674:	e8 17 17 00 00       	call   1d90 <printf>
+        exit();
+     679:	e8 70 15 00 00       	call   1bee <exit>
+      printf(stdout, "%s: pipe failed\n", name);
+     67e:	83 ec 04             	sub    $0x4,%esp
+     681:	ff 75 08             	push   0x8(%ebp)
+     684:	68 c0 1f 00 00       	push   $0x1fc0
+     689:	ff 35 74 2d 00 00    	push   0x2d74
+     68f:	e8 fc 16 00 00       	call   1d90 <printf>
+      exit();
+     694:	e8 55 15 00 00       	call   1bee <exit>
+    printf(stdout, "fork failed\n");
+     699:	53                   	push   %ebx
+     69a:	53                   	push   %ebx
+     69b:	68 51 1f 00 00       	push   $0x1f51
+     6a0:	ff 35 74 2d 00 00    	push   0x2d74
+     6a6:	e8 e5 16 00 00       	call   1d90 <printf>
+    exit();
+     6ab:	e8 3e 15 00 00       	call   1bee <exit>
+    printf(stdout, "pipe() failed\n");
+     6b0:	56                   	push   %esi
+     6b1:	56                   	push   %esi
+     6b2:	68 9a 1f 00 00       	push   $0x1f9a
+     6b7:	ff 35 74 2d 00 00    	push   0x2d74
+     6bd:	e8 ce 16 00 00       	call   1d90 <printf>
+    exit();
+     6c2:	e8 27 15 00 00       	call   1bee <exit>
+     6c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ce:	66 90                	xchg   %ax,%ax
+
+000006d0 <printrate>:
+{
+     6d0:	55                   	push   %ebp
+     6d1:	89 e5                	mov    %esp,%ebp
+     6d3:	56                   	push   %esi
+     6d4:	53                   	push   %ebx
+     6d5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     6d8:	8b 75 10             	mov    0x10(%ebp),%esi
+  printf(stdout, "%s: %d switches in %d ticks", name, n, ticks);
+     6db:	83 ec 0c             	sub    $0xc,%esp
+     6de:	56                   	push   %esi
+     6df:	53                   	push   %ebx
+     6e0:	ff 75 08             	push   0x8(%ebp)
+     6e3:	68 d1 1f 00 00       	push   $0x1fd1
+     6e8:	ff 35 74 2d 00 00    	push   0x2d74
+     6ee:	e8 9d 16 00 00       	call   1d90 <printf>
+  if(ticks > 0)
+     6f3:	83 c4 20             	add    $0x20,%esp
+     6f6:	85 f6                	test   %esi,%esi
+     6f8:	7e 1d                	jle    717 <printrate+0x47>
+    printf(stdout, ", %d per second", n * 100 / ticks);
+     6fa:	6b c3 64             	imul   $0x64,%ebx,%eax
+     6fd:	83 ec 04             	sub    $0x4,%esp
+     700:	99                   	cltd
+     701:	f7 fe                	idiv   %esi
+     703:	50                   	push   %eax
+     704:	68 ed 1f 00 00       	push   $0x1fed
+     709:	ff 35 74 2d 00 00    	push   0x2d74
+     70f:	e8 7c 16 00 00       	call   1d90 <printf>
+     714:	83 c4 10             	add    $0x10,%esp
+  printf(stdout, "\n");
+     717:	c7 45 0c a7 1f 00 00 	movl   $0x1fa7,0xc(%ebp)
+     71e:	a1 74 2d 00 00       	mov    0x2d74,%eax
+     723:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     726:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     729:	5b                   	pop    %ebx
+     72a:	5e                   	pop    %esi
+     72b:	5d                   	pop    %ebp
+  printf(stdout, "\n");
+     72c:	e9 5f 16 00 00       	jmp    1d90 <printf>
+     731:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     738:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     73f:	90                   	nop
+
+00000740 <switchbench>:
+{
+     740:	55                   	push   %ebp
+     741:	89 e5                	mov    %esp,%ebp
+     743:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "switch bench\n");
+     746:	68 fd 1f 00 00       	push   $0x1ffd
+     74b:	ff 35 74 2d 00 00    	push   0x2d74
+     751:	e8 3a 16 00 00       	call   1d90 <printf>
+  printrate("switch bench", NSWITCH, pingpong("switch bench"));
+     756:	c7 04 24 0b 20 00 00 	movl   $0x200b,(%esp)
+     75d:	e8 ee fd ff ff       	call   550 <pingpong>
+     762:	83 c4 0c             	add    $0xc,%esp
+     765:	50                   	push   %eax
+     766:	68 10 27 00 00       	push   $0x2710
+     76b:	68 0b 20 00 00       	push   $0x200b
+     770:	e8 5b ff ff ff       	call   6d0 <printrate>
+}
+     775:	83 c4 10             	add    $0x10,%esp
+     778:	c9                   	leave
+     779:	c3                   	ret
+     77a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000780 <wakebench>:
+{
+     780:	55                   	push   %ebp
+     781:	89 e5                	mov    %esp,%ebp
+     783:	56                   	push   %esi
+     784:	53                   	push   %ebx
+     785:	83 ec 18             	sub    $0x18,%esp
+  printf(stdout, "wake bench\n");
+     788:	68 18 20 00 00       	push   $0x2018
+     78d:	ff 35 74 2d 00 00    	push   0x2d74
+     793:	e8 f8 15 00 00       	call   1d90 <printf>
+  if(pipe(fds) < 0){
+     798:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     79b:	89 04 24             	mov    %eax,(%esp)
+     79e:	e8 5b 14 00 00       	call   1bfe <pipe>
+     7a3:	83 c4 10             	add    $0x10,%esp
+     7a6:	85 c0                	test   %eax,%eax
+     7a8:	0f 88 22 01 00 00    	js     8d0 <wakebench+0x150>
+     7ae:	bb 28 00 00 00       	mov    $0x28,%ebx
+     7b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7b7:	90                   	nop
+    pid = fork();
+     7b8:	e8 29 14 00 00       	call   1be6 <fork>
+    if(pid < 0){
+     7bd:	85 c0                	test   %eax,%eax
+     7bf:	0f 88 b1 00 00 00    	js     876 <wakebench+0xf6>
+    if(pid == 0){
+     7c5:	0f 84 e4 00 00 00    	je     8af <wakebench+0x12f>
+  for(i = 0; i < NSLEEPER; i++){
+     7cb:	83 eb 01             	sub    $0x1,%ebx
+     7ce:	75 e8                	jne    7b8 <wakebench+0x38>
+  ticks = pingpong("wake bench");
+     7d0:	83 ec 0c             	sub    $0xc,%esp
+  close(fds[1]);
+     7d3:	bb 28 00 00 00       	mov    $0x28,%ebx
+  ticks = pingpong("wake bench");
+     7d8:	68 24 20 00 00       	push   $0x2024
+     7dd:	e8 6e fd ff ff       	call   550 <pingpong>
+     7e2:	89 c6                	mov    %eax,%esi
+  close(fds[0]);
+     7e4:	58                   	pop    %eax
+     7e5:	ff 75 f0             	push   -0x10(%ebp)
+     7e8:	e8 29 14 00 00       	call   1c16 <close>
+  close(fds[1]);
+     7ed:	5a                   	pop    %edx
+     7ee:	ff 75 f4             	push   -0xc(%ebp)
+     7f1:	e8 20 14 00 00       	call   1c16 <close>
+     7f6:	83 c4 10             	add    $0x10,%esp
+     7f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    wait();
+     800:	e8 f1 13 00 00       	call   1bf6 <wait>
+  for(i = 0; i < NSLEEPER; i++)
+     805:	83 eb 01             	sub    $0x1,%ebx
+     808:	75 f6                	jne    800 <wakebench+0x80>
+  printrate("wake bench", NSWITCH, ticks);
+     80a:	83 ec 04             	sub    $0x4,%esp
+  start = uptime();
+     80d:	bb 28 00 00 00       	mov    $0x28,%ebx
+  printrate("wake bench", NSWITCH, ticks);
+     812:	56                   	push   %esi
+     813:	68 10 27 00 00       	push   $0x2710
+     818:	68 24 20 00 00       	push   $0x2024
+     81d:	e8 ae fe ff ff       	call   6d0 <printrate>
+  start = uptime();
+     822:	e8 5f 14 00 00       	call   1c86 <uptime>
+     827:	83 c4 10             	add    $0x10,%esp
+     82a:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < NSLEEPER; i++){
+     82c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    pid = fork();
+     830:	e8 b1 13 00 00       	call   1be6 <fork>
+    if(pid < 0){
+     835:	85 c0                	test   %eax,%eax
+     837:	78 3d                	js     876 <wakebench+0xf6>
+    if(pid == 0){
+     839:	74 53                	je     88e <wakebench+0x10e>
+  for(i = 0; i < NSLEEPER; i++){
+     83b:	83 eb 01             	sub    $0x1,%ebx
+     83e:	75 f0                	jne    830 <wakebench+0xb0>
+     840:	bb 28 00 00 00       	mov    $0x28,%ebx
+     845:	8d 76 00             	lea    0x0(%esi),%esi
+    wait();
+     848:	e8 a9 13 00 00       	call   1bf6 <wait>
+  for(i = 0; i < NSLEEPER; i++)
+     84d:	83 eb 01             	sub    $0x1,%ebx
+     850:	75 f6                	jne    848 <wakebench+0xc8>
+         NSLEEPER, uptime() - start);
+     852:	e8 2f 14 00 00       	call   1c86 <uptime>
+  printf(stdout, "wake bench: %d x 50 sleep(1) in %d ticks\n",
+     857:	29 f0                	sub    %esi,%eax
+     859:	50                   	push   %eax
+     85a:	6a 28                	push   $0x28
+     85c:	68 ec 22 00 00       	push   $0x22ec
+     861:	ff 35 74 2d 00 00    	push   0x2d74
+     867:	e8 24 15 00 00       	call   1d90 <printf>
+}
+     86c:	83 c4 10             	add    $0x10,%esp
+     86f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     872:	5b                   	pop    %ebx
+     873:	5e                   	pop    %esi
+     874:	5d                   	pop    %ebp
+     875:	c3                   	ret
+      printf(stdout, "fork failed\n");
+     876:	83 ec 08             	sub    $0x8,%esp
+     879:	68 51 1f 00 00       	push   $0x1f51
+     87e:	ff 35 74 2d 00 00    	push   0x2d74
+     884:	e8 07 15 00 00       	call   1d90 <printf>
+      exit();
+     889:	e8 60 13 00 00       	call   1bee <exit>
+     88e:	bb 32 00 00 00       	mov    $0x32,%ebx
+     893:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     897:	90                   	nop
+        sleep(1);
+     898:	83 ec 0c             	sub    $0xc,%esp
+     89b:	6a 01                	push   $0x1
+     89d:	e8 dc 13 00 00       	call   1c7e <sleep>
+      for(j = 0; j < 50; j++)
+     8a2:	83 c4 10             	add    $0x10,%esp
+     8a5:	83 eb 01             	sub    $0x1,%ebx
+     8a8:	75 ee                	jne    898 <wakebench+0x118>
+      exit();
+     8aa:	e8 3f 13 00 00       	call   1bee <exit>
+      close(fds[1]);
+     8af:	83 ec 0c             	sub    $0xc,%esp
+     8b2:	ff 75 f4             	push   -0xc(%ebp)
+     8b5:	e8 5c 13 00 00       	call   1c16 <close>
+      read(fds[0], &c, 1);
+     8ba:	83 c4 0c             	add    $0xc,%esp
+     8bd:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     8c0:	6a 01                	push   $0x1
+     8c2:	50                   	push   %eax
+     8c3:	ff 75 f0             	push   -0x10(%ebp)
+     8c6:	e8 3b 13 00 00       	call   1c06 <read>
+      exit();
+     8cb:	e8 1e 13 00 00       	call   1bee <exit>
+    printf(stdout, "pipe() failed\n");
+     8d0:	51                   	push   %ecx
+     8d1:	51                   	push   %ecx
+     8d2:	68 9a 1f 00 00       	push   $0x1f9a
+     8d7:	ff 35 74 2d 00 00    	push   0x2d74
+     8dd:	e8 ae 14 00 00       	call   1d90 <printf>
+    exit();
+     8e2:	e8 07 13 00 00       	call   1bee <exit>
+     8e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ee:	66 90                	xchg   %ax,%ax
+
+000008f0 <burnbench>:
+{
+     8f0:	55                   	push   %ebp
+     8f1:	89 e5                	mov    %esp,%ebp
+     8f3:	56                   	push   %esi
+     8f4:	53                   	push   %ebx
+  for(i = 0; i < NBURN; i++){
+     8f5:	31 db                	xor    %ebx,%ebx
+{
+     8f7:	83 ec 18             	sub    $0x18,%esp
+  printf(stdout, "burn bench\n");
+     8fa:	68 2f 20 00 00       	push   $0x202f
+     8ff:	ff 35 74 2d 00 00    	push   0x2d74
+     905:	e8 86 14 00 00       	call   1d90 <printf>
+  start = uptime();
+     90a:	e8 77 13 00 00       	call   1c86 <uptime>
+     90f:	83 c4 10             	add    $0x10,%esp
+     912:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < NBURN; i++){
+     914:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    pid = fork();
+     918:	e8 c9 12 00 00       	call   1be6 <fork>
+     91d:	89 c1                	mov    %eax,%ecx
+    if(pid < 0){
+     91f:	85 c0                	test   %eax,%eax
+     921:	78 3b                	js     95e <burnbench+0x6e>
+    if(pid == 0){
+     923:	74 51                	je     976 <burnbench+0x86>
+  for(i = 0; i < NBURN; i++){
+     925:	83 c3 01             	add    $0x1,%ebx
+     928:	83 fb 0c             	cmp    $0xc,%ebx
+     92b:	75 eb                	jne    918 <burnbench+0x28>
+     92d:	8d 76 00             	lea    0x0(%esi),%esi
+    wait();
+     930:	e8 c1 12 00 00       	call   1bf6 <wait>
+  for(i = 0; i < NBURN; i++)
+     935:	83 eb 01             	sub    $0x1,%ebx
+     938:	75 f6                	jne    930 <burnbench+0x40>
+         NBURN, uptime() - start);
+     93a:	e8 47 13 00 00       	call   1c86 <uptime>
+  printf(stdout, "burn bench: %d jobs done in %d ticks\n",
+     93f:	29 f0                	sub    %esi,%eax
+     941:	50                   	push   %eax
+     942:	6a 0c                	push   $0xc
+     944:	68 18 23 00 00       	push   $0x2318
+     949:	ff 35 74 2d 00 00    	push   0x2d74
+     94f:	e8 3c 14 00 00       	call   1d90 <printf>
+}
+     954:	83 c4 10             	add    $0x10,%esp
+     957:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     95a:	5b                   	pop    %ebx
+     95b:	5e                   	pop    %esi
+     95c:	5d                   	pop    %ebp
+     95d:	c3                   	ret
+      printf(stdout, "fork failed\n");
+     95e:	83 ec 08             	sub    $0x8,%esp
+     961:	68 51 1f 00 00       	push   $0x1f51
+     966:	ff 35 74 2d 00 00    	push   0x2d74
+     96c:	e8 1f 14 00 00       	call   1d90 <printf>
+      exit();
+     971:	e8 78 12 00 00       	call   1bee <exit>
+      for(j = 0; j < (i % 3 + 1) * 20000000; j++)
+     976:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+      x = 0;
+     97b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+      for(j = 0; j < (i % 3 + 1) * 20000000; j++)
+     982:	f7 e3                	mul    %ebx
+     984:	89 d0                	mov    %edx,%eax
+     986:	83 e2 fe             	and    $0xfffffffe,%edx
+     989:	d1 e8                	shr    %eax
+     98b:	01 c2                	add    %eax,%edx
+     98d:	89 d8                	mov    %ebx,%eax
+     98f:	29 d0                	sub    %edx,%eax
+     991:	83 c0 01             	add    $0x1,%eax
+     994:	69 c0 00 2d 31 01    	imul   $0x1312d00,%eax,%eax
+        x++;
+     99a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+      for(j = 0; j < (i % 3 + 1) * 20000000; j++)
+     99d:	83 c1 01             	add    $0x1,%ecx
+        x++;
+     9a0:	83 c2 01             	add    $0x1,%edx
+     9a3:	89 55 f4             	mov    %edx,-0xc(%ebp)
+      for(j = 0; j < (i % 3 + 1) * 20000000; j++)
+     9a6:	39 c1                	cmp    %eax,%ecx
+     9a8:	75 f0                	jne    99a <burnbench+0xaa>
+      exit();
+     9aa:	e8 3f 12 00 00       	call   1bee <exit>
+     9af:	90                   	nop
+
+000009b0 <sleeploop>:
+{
+     9b0:	55                   	push   %ebp
+     9b1:	89 e5                	mov    %esp,%ebp
+     9b3:	56                   	push   %esi
+     9b4:	53                   	push   %ebx
+  start = uptime();
+     9b5:	bb 32 00 00 00       	mov    $0x32,%ebx
+     9ba:	e8 c7 12 00 00       	call   1c86 <uptime>
+     9bf:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 50; i++)
+     9c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    sleep(1);
+     9c8:	83 ec 0c             	sub    $0xc,%esp
+     9cb:	6a 01                	push   $0x1
+     9cd:	e8 ac 12 00 00       	call   1c7e <sleep>
+  for(i = 0; i < 50; i++)
+     9d2:	83 c4 10             	add    $0x10,%esp
+     9d5:	83 eb 01             	sub    $0x1,%ebx
+     9d8:	75 ee                	jne    9c8 <sleeploop+0x18>
+  return uptime() - start;
+     9da:	e8 a7 12 00 00       	call   1c86 <uptime>
+}
+     9df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  return uptime() - start;
+     9e2:	29 f0                	sub    %esi,%eax
+}
+     9e4:	5b                   	pop    %ebx
+     9e5:	5e                   	pop    %esi
+     9e6:	5d                   	pop    %ebp
+     9e7:	c3                   	ret
+     9e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ef:	90                   	nop
+
+000009f0 <latencybench>:
+{
+     9f0:	55                   	push   %ebp
+     9f1:	89 e5                	mov    %esp,%ebp
+     9f3:	57                   	push   %edi
+     9f4:	56                   	push   %esi
+     9f5:	53                   	push   %ebx
+  start = uptime();
+     9f6:	bb 32 00 00 00       	mov    $0x32,%ebx
+{
+     9fb:	83 ec 44             	sub    $0x44,%esp
+  printf(stdout, "latency bench\n");
+     9fe:	68 3b 20 00 00       	push   $0x203b
+     a03:	ff 35 74 2d 00 00    	push   0x2d74
+     a09:	e8 82 13 00 00       	call   1d90 <printf>
+  start = uptime();
+     a0e:	e8 73 12 00 00       	call   1c86 <uptime>
+     a13:	83 c4 10             	add    $0x10,%esp
+     a16:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 50; i++)
+     a18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a1f:	90                   	nop
+    sleep(1);
+     a20:	83 ec 0c             	sub    $0xc,%esp
+     a23:	6a 01                	push   $0x1
+     a25:	e8 54 12 00 00       	call   1c7e <sleep>
+  for(i = 0; i < 50; i++)
+     a2a:	83 c4 10             	add    $0x10,%esp
+     a2d:	83 eb 01             	sub    $0x1,%ebx
+     a30:	75 ee                	jne    a20 <latencybench+0x30>
+  return uptime() - start;
+     a32:	e8 4f 12 00 00       	call   1c86 <uptime>
+     a37:	8d 7d e8             	lea    -0x18(%ebp),%edi
+     a3a:	29 f0                	sub    %esi,%eax
+     a3c:	8d 75 c8             	lea    -0x38(%ebp),%esi
+     a3f:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     a42:	89 f3                	mov    %esi,%ebx
+     a44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    pids[i] = fork();
+     a48:	e8 99 11 00 00       	call   1be6 <fork>
+     a4d:	89 03                	mov    %eax,(%ebx)
+    if(pids[i] < 0){
+     a4f:	85 c0                	test   %eax,%eax
+     a51:	0f 88 d9 00 00 00    	js     b30 <latencybench+0x140>
+    if(pids[i] == 0)
+     a57:	0f 84 d1 00 00 00    	je     b2e <latencybench+0x13e>
+  for(i = 0; i < NBENCHPROC; i++){
+     a5d:	83 c3 04             	add    $0x4,%ebx
+     a60:	39 fb                	cmp    %edi,%ebx
+     a62:	75 e4                	jne    a48 <latencybench+0x58>
+  start = uptime();
+     a64:	e8 1d 12 00 00       	call   1c86 <uptime>
+     a69:	bb 32 00 00 00       	mov    $0x32,%ebx
+     a6e:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  for(i = 0; i < 50; i++)
+     a71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    sleep(1);
+     a78:	83 ec 0c             	sub    $0xc,%esp
+     a7b:	6a 01                	push   $0x1
+     a7d:	e8 fc 11 00 00       	call   1c7e <sleep>
+  for(i = 0; i < 50; i++)
+     a82:	83 c4 10             	add    $0x10,%esp
+     a85:	83 eb 01             	sub    $0x1,%ebx
+     a88:	75 ee                	jne    a78 <latencybench+0x88>
+  return uptime() - start;
+     a8a:	e8 f7 11 00 00       	call   1c86 <uptime>
+     a8f:	8b 55 c0             	mov    -0x40(%ebp),%edx
+     a92:	89 f3                	mov    %esi,%ebx
+     a94:	29 d0                	sub    %edx,%eax
+     a96:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  for(i = 0; i < NBENCHPROC; i++)
+     a99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(setpriority(pids[i], 3) < 0){
+     aa0:	83 ec 08             	sub    $0x8,%esp
+     aa3:	6a 03                	push   $0x3
+     aa5:	ff 33                	push   (%ebx)
+     aa7:	e8 e2 11 00 00       	call   1c8e <setpriority>
+     aac:	83 c4 10             	add    $0x10,%esp
+     aaf:	85 c0                	test   %eax,%eax
+     ab1:	0f 88 91 00 00 00    	js     b48 <latencybench+0x158>
+  for(i = 0; i < NBENCHPROC; i++)
+     ab7:	83 c3 04             	add    $0x4,%ebx
+     aba:	39 fb                	cmp    %edi,%ebx
+     abc:	75 e2                	jne    aa0 <latencybench+0xb0>
+  start = uptime();
+     abe:	e8 c3 11 00 00       	call   1c86 <uptime>
+     ac3:	bb 32 00 00 00       	mov    $0x32,%ebx
+     ac8:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  for(i = 0; i < 50; i++)
+     acb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     acf:	90                   	nop
+    sleep(1);
+     ad0:	83 ec 0c             	sub    $0xc,%esp
+     ad3:	6a 01                	push   $0x1
+     ad5:	e8 a4 11 00 00       	call   1c7e <sleep>
+  for(i = 0; i < 50; i++)
+     ada:	83 c4 10             	add    $0x10,%esp
+     add:	83 eb 01             	sub    $0x1,%ebx
+     ae0:	75 ee                	jne    ad0 <latencybench+0xe0>
+  return uptime() - start;
+     ae2:	e8 9f 11 00 00       	call   1c86 <uptime>
+     ae7:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+     aea:	29 c8                	sub    %ecx,%eax
+     aec:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < NBENCHPROC; i++){
+     aee:	66 90                	xchg   %ax,%ax
+    kill(pids[i]);
+     af0:	83 ec 0c             	sub    $0xc,%esp
+     af3:	ff 36                	push   (%esi)
+  for(i = 0; i < NBENCHPROC; i++){
+     af5:	83 c6 04             	add    $0x4,%esi
+    kill(pids[i]);
+     af8:	e8 21 11 00 00       	call   1c1e <kill>
+    wait();
+     afd:	e8 f4 10 00 00       	call   1bf6 <wait>
+  for(i = 0; i < NBENCHPROC; i++){
+     b02:	83 c4 10             	add    $0x10,%esp
+     b05:	39 fe                	cmp    %edi,%esi
+     b07:	75 e7                	jne    af0 <latencybench+0x100>
+  printf(stdout, "latency bench: 50 sleep(1) in %d ticks idle, "
+     b09:	83 ec 0c             	sub    $0xc,%esp
+     b0c:	53                   	push   %ebx
+     b0d:	ff 75 c0             	push   -0x40(%ebp)
+     b10:	ff 75 c4             	push   -0x3c(%ebp)
+     b13:	68 40 23 00 00       	push   $0x2340
+     b18:	ff 35 74 2d 00 00    	push   0x2d74
+     b1e:	e8 6d 12 00 00       	call   1d90 <printf>
+}
+     b23:	83 c4 20             	add    $0x20,%esp
+     b26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b29:	5b                   	pop    %ebx
+     b2a:	5e                   	pop    %esi
+     b2b:	5f                   	pop    %edi
+     b2c:	5d                   	pop    %ebp
+     b2d:	c3                   	ret
+      for(;;)
+     b2e:	eb fe                	jmp    b2e <latencybench+0x13e>
+      printf(stdout, "fork failed\n");
+     b30:	83 ec 08             	sub    $0x8,%esp
+     b33:	68 51 1f 00 00       	push   $0x1f51
+     b38:	ff 35 74 2d 00 00    	push   0x2d74
+     b3e:	e8 4d 12 00 00       	call   1d90 <printf>
+      exit();
+     b43:	e8 a6 10 00 00       	call   1bee <exit>
+      printf(stdout, "setpriority failed\n");
+     b48:	83 ec 08             	sub    $0x8,%esp
+     b4b:	68 4a 20 00 00       	push   $0x204a
+     b50:	ff 35 74 2d 00 00    	push   0x2d74
+     b56:	e8 35 12 00 00       	call   1d90 <printf>
+      exit();
+     b5b:	e8 8e 10 00 00       	call   1bee <exit>
+
+00000b60 <stridebench>:
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	57                   	push   %edi
+     b64:	56                   	push   %esi
+     b65:	8d 7d dc             	lea    -0x24(%ebp),%edi
+     b68:	53                   	push   %ebx
+  for(i = 0; i < 3; i++){
+     b69:	31 db                	xor    %ebx,%ebx
+{
+     b6b:	83 ec 44             	sub    $0x44,%esp
+  printf(stdout, "stride bench\n");
+     b6e:	68 6b 20 00 00       	push   $0x206b
+     b73:	ff 35 74 2d 00 00    	push   0x2d74
+     b79:	e8 12 12 00 00       	call   1d90 <printf>
+     b7e:	83 c4 10             	add    $0x10,%esp
+    pids[i] = fork();
+     b81:	e8 60 10 00 00       	call   1be6 <fork>
+     b86:	89 04 9f             	mov    %eax,(%edi,%ebx,4)
+    if(pids[i] < 0){
+     b89:	85 c0                	test   %eax,%eax
+     b8b:	0f 88 84 01 00 00    	js     d15 <stridebench+0x1b5>
+      if(settickets(100 * (i + 1)) < 0){
+     b91:	83 c3 01             	add    $0x1,%ebx
+    if(pids[i] == 0){
+     b94:	85 c0                	test   %eax,%eax
+     b96:	0f 84 2b 01 00 00    	je     cc7 <stridebench+0x167>
+  for(i = 0; i < 3; i++){
+     b9c:	83 fb 03             	cmp    $0x3,%ebx
+     b9f:	75 e0                	jne    b81 <stridebench+0x21>
+  sleep(500);
+     ba1:	83 ec 0c             	sub    $0xc,%esp
+     ba4:	68 f4 01 00 00       	push   $0x1f4
+     ba9:	e8 d0 10 00 00       	call   1c7e <sleep>
+  if(getpinfo(&ps) < 0){
+     bae:	c7 04 24 c0 3f 00 00 	movl   $0x3fc0,(%esp)
+     bb5:	e8 e4 10 00 00       	call   1c9e <getpinfo>
+     bba:	83 c4 10             	add    $0x10,%esp
+     bbd:	85 c0                	test   %eax,%eax
+     bbf:	0f 88 39 01 00 00    	js     cfe <stridebench+0x19e>
+     bc5:	8d 5d d0             	lea    -0x30(%ebp),%ebx
+  tot = 0;
+     bc8:	31 c9                	xor    %ecx,%ecx
+     bca:	89 fe                	mov    %edi,%esi
+    used[i] = 0;
+     bcc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+      if(ps.inuse[j] && ps.pid[j] == pids[i])
+     bd2:	8b 06                	mov    (%esi),%eax
+    for(j = 0; j < NPROC; j++)
+     bd4:	31 d2                	xor    %edx,%edx
+     bd6:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+     bd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(ps.inuse[j] && ps.pid[j] == pids[i])
+     be0:	8b 0c 95 c0 3f 00 00 	mov    0x3fc0(,%edx,4),%ecx
+     be7:	85 c9                	test   %ecx,%ecx
+     be9:	74 15                	je     c00 <stridebench+0xa0>
+     beb:	39 04 95 c0 40 00 00 	cmp    %eax,0x40c0(,%edx,4)
+     bf2:	75 0c                	jne    c00 <stridebench+0xa0>
+        used[i] = ps.ticks[j];
+     bf4:	8b 0c 95 c0 43 00 00 	mov    0x43c0(,%edx,4),%ecx
+     bfb:	89 0b                	mov    %ecx,(%ebx)
+     bfd:	8d 76 00             	lea    0x0(%esi),%esi
+    for(j = 0; j < NPROC; j++)
+     c00:	83 c2 01             	add    $0x1,%edx
+     c03:	83 fa 40             	cmp    $0x40,%edx
+     c06:	75 d8                	jne    be0 <stridebench+0x80>
+    kill(pids[i]);
+     c08:	83 ec 0c             	sub    $0xc,%esp
+    tot += used[i];
+     c0b:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+     c0e:	03 0b                	add    (%ebx),%ecx
+  for(i = 0; i < 3; i++){
+     c10:	83 c3 04             	add    $0x4,%ebx
+    tot += used[i];
+     c13:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+  for(i = 0; i < 3; i++){
+     c16:	83 c6 04             	add    $0x4,%esi
+    tot += used[i];
+     c19:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+    kill(pids[i]);
+     c1c:	50                   	push   %eax
+     c1d:	e8 fc 0f 00 00       	call   1c1e <kill>
+    wait();
+     c22:	e8 cf 0f 00 00       	call   1bf6 <wait>
+  for(i = 0; i < 3; i++){
+     c27:	83 c4 10             	add    $0x10,%esp
+     c2a:	39 fb                	cmp    %edi,%ebx
+     c2c:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+     c2f:	8b 55 c0             	mov    -0x40(%ebp),%edx
+     c32:	75 98                	jne    bcc <stridebench+0x6c>
+    printf(stdout, "stride bench: no ticks used\n");
+     c34:	8b 1d 74 2d 00 00    	mov    0x2d74,%ebx
+     c3a:	89 d6                	mov    %edx,%esi
+  if(tot == 0){
+     c3c:	85 c9                	test   %ecx,%ecx
+     c3e:	74 6e                	je     cae <stridebench+0x14e>
+         used[0] * 100 / tot, used[1] * 100 / tot, used[2] * 100 / tot);
+     c40:	6b 45 d8 64          	imul   $0x64,-0x28(%ebp),%eax
+  printf(stdout, "stride bench: shares %d%% %d%% %d%%, want 16%% 33%% 50%%",
+     c44:	83 ec 0c             	sub    $0xc,%esp
+     c47:	99                   	cltd
+     c48:	f7 f9                	idiv   %ecx
+     c4a:	50                   	push   %eax
+         used[0] * 100 / tot, used[1] * 100 / tot, used[2] * 100 / tot);
+     c4b:	6b 45 d4 64          	imul   $0x64,-0x2c(%ebp),%eax
+  printf(stdout, "stride bench: shares %d%% %d%% %d%%, want 16%% 33%% 50%%",
+     c4f:	99                   	cltd
+     c50:	f7 f9                	idiv   %ecx
+     c52:	50                   	push   %eax
+         used[0] * 100 / tot, used[1] * 100 / tot, used[2] * 100 / tot);
+     c53:	6b 45 d0 64          	imul   $0x64,-0x30(%ebp),%eax
+  printf(stdout, "stride bench: shares %d%% %d%% %d%%, want 16%% 33%% 50%%",
+     c57:	99                   	cltd
+     c58:	f7 f9                	idiv   %ecx
+     c5a:	50                   	push   %eax
+     c5b:	68 8c 23 00 00       	push   $0x238c
+     c60:	53                   	push   %ebx
+     c61:	bb 9c ff ff ff       	mov    $0xffffff9c,%ebx
+     c66:	e8 25 11 00 00       	call   1d90 <printf>
+     c6b:	83 c4 20             	add    $0x20,%esp
+  for(i = 0; i < 3; i++){
+     c6e:	31 c9                	xor    %ecx,%ecx
+    j = used[i] * 600 / tot - 100 * (i + 1);
+     c70:	69 44 8d d0 58 02 00 	imul   $0x258,-0x30(%ebp,%ecx,4),%eax
+     c77:	00 
+     c78:	83 c1 01             	add    $0x1,%ecx
+     c7b:	99                   	cltd
+     c7c:	f7 fe                	idiv   %esi
+    if(j < -25 || j > 25)
+     c7e:	8d 44 03 19          	lea    0x19(%ebx,%eax,1),%eax
+     c82:	83 eb 64             	sub    $0x64,%ebx
+     c85:	83 f8 32             	cmp    $0x32,%eax
+     c88:	77 56                	ja     ce0 <stridebench+0x180>
+  for(i = 0; i < 3; i++){
+     c8a:	83 f9 03             	cmp    $0x3,%ecx
+     c8d:	75 e1                	jne    c70 <stridebench+0x110>
+  printf(stdout, i == 3 ? ", ok\n" : ", off\n");
+     c8f:	b8 65 20 00 00       	mov    $0x2065,%eax
+     c94:	83 ec 08             	sub    $0x8,%esp
+     c97:	50                   	push   %eax
+     c98:	ff 35 74 2d 00 00    	push   0x2d74
+     c9e:	e8 ed 10 00 00       	call   1d90 <printf>
+     ca3:	83 c4 10             	add    $0x10,%esp
+}
+     ca6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ca9:	5b                   	pop    %ebx
+     caa:	5e                   	pop    %esi
+     cab:	5f                   	pop    %edi
+     cac:	5d                   	pop    %ebp
+     cad:	c3                   	ret
+    printf(stdout, "stride bench: no ticks used\n");
+     cae:	83 ec 08             	sub    $0x8,%esp
+     cb1:	68 9d 20 00 00       	push   $0x209d
+     cb6:	53                   	push   %ebx
+     cb7:	e8 d4 10 00 00       	call   1d90 <printf>
+     cbc:	83 c4 10             	add    $0x10,%esp
+}
+     cbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cc2:	5b                   	pop    %ebx
+     cc3:	5e                   	pop    %esi
+     cc4:	5f                   	pop    %edi
+     cc5:	5d                   	pop    %ebp
+     cc6:	c3                   	ret
+      if(settickets(100 * (i + 1)) < 0){
+     cc7:	6b db 64             	imul   $0x64,%ebx,%ebx
+     cca:	83 ec 0c             	sub    $0xc,%esp
+     ccd:	53                   	push   %ebx
+     cce:	e8 c3 0f 00 00       	call   1c96 <settickets>
+     cd3:	83 c4 10             	add    $0x10,%esp
+     cd6:	85 c0                	test   %eax,%eax
+     cd8:	78 0d                	js     ce7 <stridebench+0x187>
+      for(;;)
+     cda:	eb fe                	jmp    cda <stridebench+0x17a>
+     cdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  printf(stdout, i == 3 ? ", ok\n" : ", off\n");
+     ce0:	b8 5e 20 00 00       	mov    $0x205e,%eax
+     ce5:	eb ad                	jmp    c94 <stridebench+0x134>
+        printf(stdout, "settickets failed\n");
+     ce7:	56                   	push   %esi
+     ce8:	56                   	push   %esi
+     ce9:	68 79 20 00 00       	push   $0x2079
+     cee:	ff 35 74 2d 00 00    	push   0x2d74
+     cf4:	e8 97 10 00 00       	call   1d90 <printf>
+        exit();
+     cf9:	e8 f0 0e 00 00       	call   1bee <exit>
+    printf(stdout, "getpinfo failed\n");
+     cfe:	53                   	push   %ebx
+     cff:	53                   	push   %ebx
+     d00:	68 8c 20 00 00       	push   $0x208c
+     d05:	ff 35 74 2d 00 00    	push   0x2d74
+     d0b:	e8 80 10 00 00       	call   1d90 <printf>
+    exit();
+     d10:	e8 d9 0e 00 00       	call   1bee <exit>
+      printf(stdout, "fork failed\n");
+     d15:	83 ec 08             	sub    $0x8,%esp
+     d18:	68 51 1f 00 00       	push   $0x1f51
+     d1d:	ff 35 74 2d 00 00    	push   0x2d74
+     d23:	e8 68 10 00 00       	call   1d90 <printf>
+      exit();
+     d28:	e8 c1 0e 00 00       	call   1bee <exit>
+     d2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d30 <nanosleepbench>:
+{
+     d30:	55                   	push   %ebp
+     d31:	89 e5                	mov    %esp,%ebp
+     d33:	56                   	push   %esi
+     d34:	53                   	push   %ebx
+  start = uptime();
+     d35:	bb 64 00 00 00       	mov    $0x64,%ebx
+  printf(stdout, "nanosleep bench\n");
+     d3a:	83 ec 08             	sub    $0x8,%esp
+     d3d:	68 ba 20 00 00       	push   $0x20ba
+     d42:	ff 35 74 2d 00 00    	push   0x2d74
+     d48:	e8 43 10 00 00       	call   1d90 <printf>
+  start = uptime();
+     d4d:	e8 34 0f 00 00       	call   1c86 <uptime>
+     d52:	83 c4 10             	add    $0x10,%esp
+     d55:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     d57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d5e:	66 90                	xchg   %ax,%ax
+    if(nanosleep(1000000) < 0){
+     d60:	83 ec 0c             	sub    $0xc,%esp
+     d63:	68 40 42 0f 00       	push   $0xf4240
+     d68:	e8 39 0f 00 00       	call   1ca6 <nanosleep>
+     d6d:	83 c4 10             	add    $0x10,%esp
+     d70:	85 c0                	test   %eax,%eax
+     d72:	78 2a                	js     d9e <nanosleepbench+0x6e>
+  for(i = 0; i < 100; i++){
+     d74:	83 eb 01             	sub    $0x1,%ebx
+     d77:	75 e7                	jne    d60 <nanosleepbench+0x30>
+         uptime() - start);
+     d79:	e8 08 0f 00 00       	call   1c86 <uptime>
+  printf(stdout, "nanosleep bench: 100 x 1ms in %d ticks, want 10\n",
+     d7e:	83 ec 04             	sub    $0x4,%esp
+     d81:	29 f0                	sub    %esi,%eax
+     d83:	50                   	push   %eax
+     d84:	68 c8 23 00 00       	push   $0x23c8
+     d89:	ff 35 74 2d 00 00    	push   0x2d74
+     d8f:	e8 fc 0f 00 00       	call   1d90 <printf>
+}
+     d94:	83 c4 10             	add    $0x10,%esp
+     d97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d9a:	5b                   	pop    %ebx
+     d9b:	5e                   	pop    %esi
+     d9c:	5d                   	pop    %ebp
+     d9d:	c3                   	ret
+      printf(stdout, "nanosleep failed\n");
+     d9e:	83 ec 08             	sub    $0x8,%esp
+     da1:	68 cb 20 00 00       	push   $0x20cb
+     da6:	ff 35 74 2d 00 00    	push   0x2d74
+     dac:	e8 df 0f 00 00       	call   1d90 <printf>
+      exit();
+     db1:	e8 38 0e 00 00       	call   1bee <exit>
+     db6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000dc0 <threadbench>:
+{
+     dc0:	55                   	push   %ebp
+     dc1:	89 e5                	mov    %esp,%ebp
+     dc3:	57                   	push   %edi
+     dc4:	56                   	push   %esi
+     dc5:	53                   	push   %ebx
+  for(n = 1; n <= NTHREAD; n *= NTHREAD){
+     dc6:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+     dcb:	83 ec 24             	sub    $0x24,%esp
+  printf(stdout, "thread bench\n");
+     dce:	68 dd 20 00 00       	push   $0x20dd
+     dd3:	ff 35 74 2d 00 00    	push   0x2d74
+     dd9:	e8 b2 0f 00 00       	call   1d90 <printf>
+     dde:	c7 45 e4 02 00 00 00 	movl   $0x2,-0x1c(%ebp)
+     de5:	83 c4 10             	add    $0x10,%esp
+    start = uptime();
+     de8:	e8 99 0e 00 00       	call   1c86 <uptime>
+      if(thread_create(threadwork, (void*)(THREADWORK / n)) < 0){
+     ded:	31 d2                	xor    %edx,%edx
+    for(i = 0; i < n; i++){
+     def:	31 ff                	xor    %edi,%edi
+    start = uptime();
+     df1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      if(thread_create(threadwork, (void*)(THREADWORK / n)) < 0){
+     df4:	b8 80 f0 fa 02       	mov    $0x2faf080,%eax
+     df9:	f7 fb                	idiv   %ebx
+     dfb:	89 c6                	mov    %eax,%esi
+     dfd:	8d 76 00             	lea    0x0(%esi),%esi
+     e00:	83 ec 08             	sub    $0x8,%esp
+     e03:	56                   	push   %esi
+     e04:	68 70 00 00 00       	push   $0x70
+     e09:	e8 b2 0c 00 00       	call   1ac0 <thread_create>
+     e0e:	83 c4 10             	add    $0x10,%esp
+     e11:	85 c0                	test   %eax,%eax
+     e13:	78 53                	js     e68 <threadbench+0xa8>
+    for(i = 0; i < n; i++){
+     e15:	83 c7 01             	add    $0x1,%edi
+     e18:	39 df                	cmp    %ebx,%edi
+     e1a:	75 e4                	jne    e00 <threadbench+0x40>
+    for(i = 0; i < n; i++)
+     e1c:	31 f6                	xor    %esi,%esi
+      thread_join();
+     e1e:	e8 6d 0d 00 00       	call   1b90 <thread_join>
+    for(i = 0; i < n; i++)
+     e23:	83 c6 01             	add    $0x1,%esi
+     e26:	39 de                	cmp    %ebx,%esi
+     e28:	75 f4                	jne    e1e <threadbench+0x5e>
+           n, uptime() - start);
+     e2a:	e8 57 0e 00 00       	call   1c86 <uptime>
+    printf(stdout, "thread bench: %d thread(s) in %d ticks\n",
+     e2f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  for(n = 1; n <= NTHREAD; n *= NTHREAD){
+     e32:	8d 1c b5 00 00 00 00 	lea    0x0(,%esi,4),%ebx
+    printf(stdout, "thread bench: %d thread(s) in %d ticks\n",
+     e39:	29 c8                	sub    %ecx,%eax
+     e3b:	50                   	push   %eax
+     e3c:	56                   	push   %esi
+     e3d:	68 fc 23 00 00       	push   $0x23fc
+     e42:	ff 35 74 2d 00 00    	push   0x2d74
+     e48:	e8 43 0f 00 00       	call   1d90 <printf>
+  for(n = 1; n <= NTHREAD; n *= NTHREAD){
+     e4d:	83 c4 10             	add    $0x10,%esp
+     e50:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+     e54:	74 0a                	je     e60 <threadbench+0xa0>
+     e56:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+     e5d:	eb 89                	jmp    de8 <threadbench+0x28>
+     e5f:	90                   	nop
+}
+     e60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e63:	5b                   	pop    %ebx
+     e64:	5e                   	pop    %esi
+     e65:	5f                   	pop    %edi
+     e66:	5d                   	pop    %ebp
+     e67:	c3                   	ret
+        printf(stdout, "thread_create failed\n");
+     e68:	83 ec 08             	sub    $0x8,%esp
+     e6b:	68 eb 20 00 00       	push   $0x20eb
+     e70:	ff 35 74 2d 00 00    	push   0x2d74
+     e76:	e8 15 0f 00 00       	call   1d90 <printf>
+        exit();
+     e7b:	e8 6e 0d 00 00       	call   1bee <exit>
+
+00000e80 <lockrun>:
+{
+     e80:	55                   	push   %ebp
+     e81:	89 e5                	mov    %esp,%ebp
+     e83:	57                   	push   %edi
+     e84:	56                   	push   %esi
+     e85:	53                   	push   %ebx
+  start = uptime();
+     e86:	bb 08 00 00 00       	mov    $0x8,%ebx
+{
+     e8b:	83 ec 0c             	sub    $0xc,%esp
+     e8e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  locked = 0;
+     e91:	c7 05 a4 2d 00 00 00 	movl   $0x0,0x2da4
+     e98:	00 00 00 
+  start = uptime();
+     e9b:	e8 e6 0d 00 00       	call   1c86 <uptime>
+     ea0:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < NLOCKER; i++){
+     ea2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(thread_create(fn, 0) < 0){
+     ea8:	83 ec 08             	sub    $0x8,%esp
+     eab:	6a 00                	push   $0x0
+     ead:	57                   	push   %edi
+     eae:	e8 0d 0c 00 00       	call   1ac0 <thread_create>
+     eb3:	83 c4 10             	add    $0x10,%esp
+     eb6:	85 c0                	test   %eax,%eax
+     eb8:	78 60                	js     f1a <lockrun+0x9a>
+  for(i = 0; i < NLOCKER; i++){
+     eba:	83 eb 01             	sub    $0x1,%ebx
+     ebd:	75 e9                	jne    ea8 <lockrun+0x28>
+     ebf:	bb 08 00 00 00       	mov    $0x8,%ebx
+     ec4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    thread_join();
+     ec8:	e8 c3 0c 00 00       	call   1b90 <thread_join>
+  for(i = 0; i < NLOCKER; i++)
+     ecd:	83 eb 01             	sub    $0x1,%ebx
+     ed0:	75 f6                	jne    ec8 <lockrun+0x48>
+  printf(stdout, "mutex bench: %d x %d %s in %d ticks%s\n", NLOCKER, NLOCK,
+     ed2:	81 3d a4 2d 00 00 00 	cmpl   $0x27100,0x2da4
+     ed9:	71 02 00 
+     edc:	b8 a8 1f 00 00       	mov    $0x1fa8,%eax
+     ee1:	bb 01 21 00 00       	mov    $0x2101,%ebx
+     ee6:	0f 44 d8             	cmove  %eax,%ebx
+         name, uptime() - start, locked == NLOCKER*NLOCK ? "" : ", wrong count");
+     ee9:	e8 98 0d 00 00       	call   1c86 <uptime>
+  printf(stdout, "mutex bench: %d x %d %s in %d ticks%s\n", NLOCKER, NLOCK,
+     eee:	83 ec 04             	sub    $0x4,%esp
+     ef1:	29 f0                	sub    %esi,%eax
+     ef3:	53                   	push   %ebx
+     ef4:	50                   	push   %eax
+     ef5:	ff 75 08             	push   0x8(%ebp)
+     ef8:	68 20 4e 00 00       	push   $0x4e20
+     efd:	6a 08                	push   $0x8
+     eff:	68 24 24 00 00       	push   $0x2424
+     f04:	ff 35 74 2d 00 00    	push   0x2d74
+     f0a:	e8 81 0e 00 00       	call   1d90 <printf>
+}
+     f0f:	83 c4 20             	add    $0x20,%esp
+     f12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f15:	5b                   	pop    %ebx
+     f16:	5e                   	pop    %esi
+     f17:	5f                   	pop    %edi
+     f18:	5d                   	pop    %ebp
+     f19:	c3                   	ret
+      printf(stdout, "thread_create failed\n");
+     f1a:	83 ec 08             	sub    $0x8,%esp
+     f1d:	68 eb 20 00 00       	push   $0x20eb
+     f22:	ff 35 74 2d 00 00    	push   0x2d74
+     f28:	e8 63 0e 00 00       	call   1d90 <printf>
+      exit();
+     f2d:	e8 bc 0c 00 00       	call   1bee <exit>
+     f32:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000f40 <mutexbench>:
+{
+     f40:	55                   	push   %ebp
+     f41:	89 e5                	mov    %esp,%ebp
+     f43:	53                   	push   %ebx
+     f44:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "mutex bench\n");
+     f47:	68 0f 21 00 00       	push   $0x210f
+     f4c:	ff 35 74 2d 00 00    	push   0x2d74
+     f52:	e8 39 0e 00 00       	call   1d90 <printf>
+  lock_init(&spin);
+     f57:	c7 04 24 b0 2d 00 00 	movl   $0x2db0,(%esp)
+     f5e:	e8 dd 09 00 00       	call   1940 <lock_init>
+  mutex_init(&mutex);
+     f63:	c7 04 24 ac 2d 00 00 	movl   $0x2dac,(%esp)
+     f6a:	e8 11 0a 00 00       	call   1980 <mutex_init>
+  cond_init(&cond);
+     f6f:	c7 04 24 a8 2d 00 00 	movl   $0x2da8,(%esp)
+     f76:	e8 95 0a 00 00       	call   1a10 <cond_init>
+  lockrun("spin lock", spinner);
+     f7b:	5a                   	pop    %edx
+     f7c:	59                   	pop    %ecx
+     f7d:	68 b0 00 00 00       	push   $0xb0
+     f82:	68 1c 21 00 00       	push   $0x211c
+     f87:	e8 f4 fe ff ff       	call   e80 <lockrun>
+  lockrun("mutex", mutexer);
+     f8c:	5b                   	pop    %ebx
+     f8d:	58                   	pop    %eax
+     f8e:	68 f0 00 00 00       	push   $0xf0
+     f93:	68 26 21 00 00       	push   $0x2126
+     f98:	e8 e3 fe ff ff       	call   e80 <lockrun>
+  turn = 0;
+     f9d:	c7 05 a0 2d 00 00 00 	movl   $0x0,0x2da0
+     fa4:	00 00 00 
+  start = uptime();
+     fa7:	e8 da 0c 00 00       	call   1c86 <uptime>
+     fac:	89 c3                	mov    %eax,%ebx
+    if(thread_create(ponger, (void*)i) < 0){
+     fae:	58                   	pop    %eax
+     faf:	5a                   	pop    %edx
+     fb0:	6a 00                	push   $0x0
+     fb2:	68 30 01 00 00       	push   $0x130
+     fb7:	e8 04 0b 00 00       	call   1ac0 <thread_create>
+     fbc:	83 c4 10             	add    $0x10,%esp
+     fbf:	85 c0                	test   %eax,%eax
+     fc1:	78 3f                	js     1002 <mutexbench+0xc2>
+     fc3:	83 ec 08             	sub    $0x8,%esp
+     fc6:	6a 01                	push   $0x1
+     fc8:	68 30 01 00 00       	push   $0x130
+     fcd:	e8 ee 0a 00 00       	call   1ac0 <thread_create>
+     fd2:	83 c4 10             	add    $0x10,%esp
+     fd5:	85 c0                	test   %eax,%eax
+     fd7:	78 29                	js     1002 <mutexbench+0xc2>
+    thread_join();
+     fd9:	e8 b2 0b 00 00       	call   1b90 <thread_join>
+     fde:	e8 ad 0b 00 00       	call   1b90 <thread_join>
+  printrate("mutex bench: condvar", NSWITCH, uptime() - start);
+     fe3:	e8 9e 0c 00 00       	call   1c86 <uptime>
+     fe8:	83 ec 04             	sub    $0x4,%esp
+     feb:	29 d8                	sub    %ebx,%eax
+     fed:	50                   	push   %eax
+     fee:	68 10 27 00 00       	push   $0x2710
+     ff3:	68 2c 21 00 00       	push   $0x212c
+     ff8:	e8 d3 f6 ff ff       	call   6d0 <printrate>
+}
+     ffd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1000:	c9                   	leave
+    1001:	c3                   	ret
+      printf(stdout, "thread_create failed\n");
+    1002:	50                   	push   %eax
+    1003:	50                   	push   %eax
+    1004:	68 eb 20 00 00       	push   $0x20eb
+    1009:	ff 35 74 2d 00 00    	push   0x2d74
+    100f:	e8 7c 0d 00 00       	call   1d90 <printf>
+      exit();
+    1014:	e8 d5 0b 00 00       	call   1bee <exit>
+    1019:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001020 <sweeprun>:
+{
+    1020:	55                   	push   %ebp
+    1021:	89 e5                	mov    %esp,%ebp
+    1023:	57                   	push   %edi
+    1024:	56                   	push   %esi
+    1025:	53                   	push   %ebx
+  for(ncpus = 0; mask >> ncpus; ncpus++)
+    1026:	31 db                	xor    %ebx,%ebx
+{
+    1028:	83 ec 0c             	sub    $0xc,%esp
+  mask = sched_getaffinity(getpid());
+    102b:	e8 3e 0c 00 00       	call   1c6e <getpid>
+    1030:	83 ec 0c             	sub    $0xc,%esp
+    1033:	50                   	push   %eax
+    1034:	e8 9d 0c 00 00       	call   1cd6 <sched_getaffinity>
+  for(ncpus = 0; mask >> ncpus; ncpus++)
+    1039:	83 c4 10             	add    $0x10,%esp
+    103c:	85 c0                	test   %eax,%eax
+    103e:	74 0d                	je     104d <sweeprun+0x2d>
+    1040:	83 c3 01             	add    $0x1,%ebx
+    1043:	89 c2                	mov    %eax,%edx
+    1045:	89 d9                	mov    %ebx,%ecx
+    1047:	d3 fa                	sar    %cl,%edx
+    1049:	85 d2                	test   %edx,%edx
+    104b:	75 f3                	jne    1040 <sweeprun+0x20>
+  start = uptime();
+    104d:	e8 34 0c 00 00       	call   1c86 <uptime>
+  for(i = 0; i < NBENCHPROC; i++){
+    1052:	31 f6                	xor    %esi,%esi
+  start = uptime();
+    1054:	89 c7                	mov    %eax,%edi
+    pid = fork();
+    1056:	e8 8b 0b 00 00       	call   1be6 <fork>
+    if(pid < 0){
+    105b:	85 c0                	test   %eax,%eax
+    105d:	0f 88 a9 00 00 00    	js     110c <sweeprun+0xec>
+    if(pid == 0){
+    1063:	74 26                	je     108b <sweeprun+0x6b>
+  for(i = 0; i < NBENCHPROC; i++){
+    1065:	83 c6 01             	add    $0x1,%esi
+    1068:	83 fe 08             	cmp    $0x8,%esi
+    106b:	75 e9                	jne    1056 <sweeprun+0x36>
+    106d:	bb 08 00 00 00       	mov    $0x8,%ebx
+    wait();
+    1072:	e8 7f 0b 00 00       	call   1bf6 <wait>
+  for(i = 0; i < NBENCHPROC; i++)
+    1077:	83 eb 01             	sub    $0x1,%ebx
+    107a:	75 f6                	jne    1072 <sweeprun+0x52>
+  return uptime() - start;
+    107c:	e8 05 0c 00 00       	call   1c86 <uptime>
+}
+    1081:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1084:	5b                   	pop    %ebx
+  return uptime() - start;
+    1085:	29 f8                	sub    %edi,%eax
+}
+    1087:	5e                   	pop    %esi
+    1088:	5f                   	pop    %edi
+    1089:	5d                   	pop    %ebp
+    108a:	c3                   	ret
+      if(pin && sched_setaffinity(getpid(), 1 << (i % ncpus)) < 0){
+    108b:	8b 45 08             	mov    0x8(%ebp),%eax
+    108e:	85 c0                	test   %eax,%eax
+    1090:	74 26                	je     10b8 <sweeprun+0x98>
+    1092:	e8 d7 0b 00 00       	call   1c6e <getpid>
+    1097:	83 ec 08             	sub    $0x8,%esp
+    109a:	89 c7                	mov    %eax,%edi
+    109c:	89 f0                	mov    %esi,%eax
+    109e:	99                   	cltd
+    109f:	f7 fb                	idiv   %ebx
+    10a1:	b8 01 00 00 00       	mov    $0x1,%eax
+    10a6:	89 d1                	mov    %edx,%ecx
+    10a8:	d3 e0                	shl    %cl,%eax
+    10aa:	50                   	push   %eax
+    10ab:	57                   	push   %edi
+    10ac:	e8 1d 0c 00 00       	call   1cce <sched_setaffinity>
+    10b1:	83 c4 10             	add    $0x10,%esp
+    10b4:	85 c0                	test   %eax,%eax
+    10b6:	78 3c                	js     10f4 <sweeprun+0xd4>
+      buf = sbrk(SWEEPSIZE);
+    10b8:	83 ec 0c             	sub    $0xc,%esp
+    10bb:	68 00 80 00 00       	push   $0x8000
+    10c0:	e8 b1 0b 00 00       	call   1c76 <sbrk>
+    10c5:	83 c4 10             	add    $0x10,%esp
+    10c8:	b9 d0 07 00 00       	mov    $0x7d0,%ecx
+    10cd:	89 c3                	mov    %eax,%ebx
+      for(j = 0; j < NSWEEP; j++)
+    10cf:	8d 90 00 80 00 00    	lea    0x8000(%eax),%edx
+    10d5:	8d 76 00             	lea    0x0(%esi),%esi
+        for(k = 0; k < SWEEPSIZE; k += 64)
+    10d8:	89 d8                	mov    %ebx,%eax
+    10da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+          buf[k]++;
+    10e0:	80 00 01             	addb   $0x1,(%eax)
+        for(k = 0; k < SWEEPSIZE; k += 64)
+    10e3:	83 c0 40             	add    $0x40,%eax
+    10e6:	39 c2                	cmp    %eax,%edx
+    10e8:	75 f6                	jne    10e0 <sweeprun+0xc0>
+      for(j = 0; j < NSWEEP; j++)
+    10ea:	83 e9 01             	sub    $0x1,%ecx
+    10ed:	75 e9                	jne    10d8 <sweeprun+0xb8>
+      exit();
+    10ef:	e8 fa 0a 00 00       	call   1bee <exit>
+        printf(stdout, "sched_setaffinity failed\n");
+    10f4:	83 ec 08             	sub    $0x8,%esp
+    10f7:	68 41 21 00 00       	push   $0x2141
+    10fc:	ff 35 74 2d 00 00    	push   0x2d74
+    1102:	e8 89 0c 00 00       	call   1d90 <printf>
+        exit();
+    1107:	e8 e2 0a 00 00       	call   1bee <exit>
+      printf(stdout, "fork failed\n");
+    110c:	83 ec 08             	sub    $0x8,%esp
+    110f:	68 51 1f 00 00       	push   $0x1f51
+    1114:	ff 35 74 2d 00 00    	push   0x2d74
+    111a:	e8 71 0c 00 00       	call   1d90 <printf>
+      exit();
+    111f:	e8 ca 0a 00 00       	call   1bee <exit>
+    1124:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    112b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    112f:	90                   	nop
+
+00001130 <affinitybench>:
+{
+    1130:	55                   	push   %ebp
+    1131:	89 e5                	mov    %esp,%ebp
+    1133:	53                   	push   %ebx
+    1134:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "affinity bench\n");
+    1137:	68 5b 21 00 00       	push   $0x215b
+    113c:	ff 35 74 2d 00 00    	push   0x2d74
+    1142:	e8 49 0c 00 00       	call   1d90 <printf>
+  free = sweeprun(0);
+    1147:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    114e:	e8 cd fe ff ff       	call   1020 <sweeprun>
+  pinned = sweeprun(1);
+    1153:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  free = sweeprun(0);
+    115a:	89 c3                	mov    %eax,%ebx
+  pinned = sweeprun(1);
+    115c:	e8 bf fe ff ff       	call   1020 <sweeprun>
+  printf(stdout, "affinity bench: %d ticks unpinned, %d pinned\n",
+    1161:	50                   	push   %eax
+    1162:	53                   	push   %ebx
+    1163:	68 4c 24 00 00       	push   $0x244c
+    1168:	ff 35 74 2d 00 00    	push   0x2d74
+    116e:	e8 1d 0c 00 00       	call   1d90 <printf>
+}
+    1173:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1176:	83 c4 20             	add    $0x20,%esp
+    1179:	c9                   	leave
+    117a:	c3                   	ret
+    117b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    117f:	90                   	nop
+
+00001180 <readbench>:
+{
+    1180:	55                   	push   %ebp
+    1181:	89 e5                	mov    %esp,%ebp
+    1183:	56                   	push   %esi
+    1184:	53                   	push   %ebx
+  printf(stdout, "read bench\n");
+    1185:	83 ec 08             	sub    $0x8,%esp
+    1188:	68 df 20 00 00       	push   $0x20df
+    118d:	ff 35 74 2d 00 00    	push   0x2d74
+    1193:	e8 f8 0b 00 00       	call   1d90 <printf>
+  if((fd = open("readbench", O_CREATE|O_RDWR)) < 0){
+    1198:	5a                   	pop    %edx
+    1199:	59                   	pop    %ecx
+    119a:	68 02 02 00 00       	push   $0x202
+    119f:	68 6b 21 00 00       	push   $0x216b
+    11a4:	e8 85 0a 00 00       	call   1c2e <open>
+    11a9:	83 c4 10             	add    $0x10,%esp
+    11ac:	85 c0                	test   %eax,%eax
+    11ae:	0f 88 2c 01 00 00    	js     12e0 <readbench+0x160>
+    11b4:	89 c6                	mov    %eax,%esi
+    11b6:	bb 14 00 00 00       	mov    $0x14,%ebx
+    11bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11bf:	90                   	nop
+    write(fd, buf, sizeof(buf));
+    11c0:	83 ec 04             	sub    $0x4,%esp
+    11c3:	68 00 02 00 00       	push   $0x200
+    11c8:	68 c0 3d 00 00       	push   $0x3dc0
+    11cd:	56                   	push   %esi
+    11ce:	e8 3b 0a 00 00       	call   1c0e <write>
+  for(i = 0; i < READBLOCKS; i++)
+    11d3:	83 c4 10             	add    $0x10,%esp
+    11d6:	83 eb 01             	sub    $0x1,%ebx
+    11d9:	75 e5                	jne    11c0 <readbench+0x40>
+  close(fd);
+    11db:	83 ec 0c             	sub    $0xc,%esp
+  start = uptime();
+    11de:	bb 08 00 00 00       	mov    $0x8,%ebx
+  close(fd);
+    11e3:	56                   	push   %esi
+    11e4:	e8 2d 0a 00 00       	call   1c16 <close>
+  start = uptime();
+    11e9:	e8 98 0a 00 00       	call   1c86 <uptime>
+    11ee:	83 c4 10             	add    $0x10,%esp
+    11f1:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < NBENCHPROC; i++){
+    11f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11f7:	90                   	nop
+    pid = fork();
+    11f8:	e8 e9 09 00 00       	call   1be6 <fork>
+    if(pid < 0){
+    11fd:	85 c0                	test   %eax,%eax
+    11ff:	0f 88 c3 00 00 00    	js     12c8 <readbench+0x148>
+    if(pid == 0){
+    1205:	74 4e                	je     1255 <readbench+0xd5>
+  for(i = 0; i < NBENCHPROC; i++){
+    1207:	83 eb 01             	sub    $0x1,%ebx
+    120a:	75 ec                	jne    11f8 <readbench+0x78>
+    120c:	bb 08 00 00 00       	mov    $0x8,%ebx
+    1211:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    wait();
+    1218:	e8 d9 09 00 00       	call   1bf6 <wait>
+  for(i = 0; i < NBENCHPROC; i++)
+    121d:	83 eb 01             	sub    $0x1,%ebx
+    1220:	75 f6                	jne    1218 <readbench+0x98>
+         NBENCHPROC * NREAD * READBLOCKS, uptime() - start);
+    1222:	e8 5f 0a 00 00       	call   1c86 <uptime>
+  printf(stdout, "read bench: %d blocks read in %d ticks\n",
+    1227:	29 f0                	sub    %esi,%eax
+    1229:	50                   	push   %eax
+    122a:	68 80 3e 00 00       	push   $0x3e80
+    122f:	68 7c 24 00 00       	push   $0x247c
+    1234:	ff 35 74 2d 00 00    	push   0x2d74
+    123a:	e8 51 0b 00 00       	call   1d90 <printf>
+  unlink("readbench");
+    123f:	c7 04 24 6b 21 00 00 	movl   $0x216b,(%esp)
+    1246:	e8 f3 09 00 00       	call   1c3e <unlink>
+}
+    124b:	83 c4 10             	add    $0x10,%esp
+    124e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1251:	5b                   	pop    %ebx
+    1252:	5e                   	pop    %esi
+    1253:	5d                   	pop    %ebp
+    1254:	c3                   	ret
+    1255:	be 64 00 00 00       	mov    $0x64,%esi
+    125a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        if((fd = open("readbench", O_RDONLY)) < 0){
+    1260:	83 ec 08             	sub    $0x8,%esp
+    1263:	6a 00                	push   $0x0
+    1265:	68 6b 21 00 00       	push   $0x216b
+    126a:	e8 bf 09 00 00       	call   1c2e <open>
+    126f:	83 c4 10             	add    $0x10,%esp
+    1272:	89 c3                	mov    %eax,%ebx
+    1274:	85 c0                	test   %eax,%eax
+    1276:	78 38                	js     12b0 <readbench+0x130>
+    1278:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    127f:	90                   	nop
+        while(read(fd, buf, sizeof(buf)) > 0)
+    1280:	83 ec 04             	sub    $0x4,%esp
+    1283:	68 00 02 00 00       	push   $0x200
+    1288:	68 c0 3d 00 00       	push   $0x3dc0
+    128d:	53                   	push   %ebx
+    128e:	e8 73 09 00 00       	call   1c06 <read>
+    1293:	83 c4 10             	add    $0x10,%esp
+    1296:	85 c0                	test   %eax,%eax
+    1298:	7f e6                	jg     1280 <readbench+0x100>
+        close(fd);
+    129a:	83 ec 0c             	sub    $0xc,%esp
+    129d:	53                   	push   %ebx
+    129e:	e8 73 09 00 00       	call   1c16 <close>
+      for(j = 0; j < NREAD; j++){
+    12a3:	83 c4 10             	add    $0x10,%esp
+    12a6:	83 ee 01             	sub    $0x1,%esi
+    12a9:	75 b5                	jne    1260 <readbench+0xe0>
+      exit();
+    12ab:	e8 3e 09 00 00       	call   1bee <exit>
+          printf(stdout, "open failed\n");
+    12b0:	83 ec 08             	sub    $0x8,%esp
+    12b3:	68 75 21 00 00       	push   $0x2175
+    12b8:	ff 35 74 2d 00 00    	push   0x2d74
+    12be:	e8 cd 0a 00 00       	call   1d90 <printf>
+          exit();
+    12c3:	e8 26 09 00 00       	call   1bee <exit>
+      printf(stdout, "fork failed\n");
+    12c8:	83 ec 08             	sub    $0x8,%esp
+    12cb:	68 51 1f 00 00       	push   $0x1f51
+    12d0:	ff 35 74 2d 00 00    	push   0x2d74
+    12d6:	e8 b5 0a 00 00       	call   1d90 <printf>
+      exit();
+    12db:	e8 0e 09 00 00       	call   1bee <exit>
+    printf(stdout, "create failed\n");
+    12e0:	50                   	push   %eax
+    12e1:	50                   	push   %eax
+    12e2:	68 f2 20 00 00       	push   $0x20f2
+    12e7:	ff 35 74 2d 00 00    	push   0x2d74
+    12ed:	e8 9e 0a 00 00       	call   1d90 <printf>
+    exit();
+    12f2:	e8 f7 08 00 00       	call   1bee <exit>
+    12f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12fe:	66 90                	xchg   %ax,%ax
+
+00001300 <seqread>:
+{
+    1300:	55                   	push   %ebp
+    1301:	89 e5                	mov    %esp,%ebp
+    1303:	56                   	push   %esi
+    1304:	53                   	push   %ebx
+  if((fd = open(SEQFILE, O_RDONLY)) < 0){
+    1305:	83 ec 08             	sub    $0x8,%esp
+    1308:	6a 00                	push   $0x0
+    130a:	68 82 21 00 00       	push   $0x2182
+    130f:	e8 1a 09 00 00       	call   1c2e <open>
+    1314:	83 c4 10             	add    $0x10,%esp
+    1317:	85 c0                	test   %eax,%eax
+    1319:	78 3b                	js     1356 <seqread+0x56>
+    131b:	89 c6                	mov    %eax,%esi
+  tot = 0;
+    131d:	31 db                	xor    %ebx,%ebx
+    131f:	eb 09                	jmp    132a <seqread+0x2a>
+    1321:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    tot += n;
+    1328:	01 c3                	add    %eax,%ebx
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+    132a:	83 ec 04             	sub    $0x4,%esp
+    132d:	68 00 02 00 00       	push   $0x200
+    1332:	68 c0 3b 00 00       	push   $0x3bc0
+    1337:	56                   	push   %esi
+    1338:	e8 c9 08 00 00       	call   1c06 <read>
+    133d:	83 c4 10             	add    $0x10,%esp
+    1340:	85 c0                	test   %eax,%eax
+    1342:	7f e4                	jg     1328 <seqread+0x28>
+  close(fd);
+    1344:	83 ec 0c             	sub    $0xc,%esp
+    1347:	56                   	push   %esi
+    1348:	e8 c9 08 00 00       	call   1c16 <close>
+}
+    134d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1350:	89 d8                	mov    %ebx,%eax
+    1352:	5b                   	pop    %ebx
+    1353:	5e                   	pop    %esi
+    1354:	5d                   	pop    %ebp
+    1355:	c3                   	ret
+    printf(stdout, "open %s failed\n", SEQFILE);
+    1356:	50                   	push   %eax
+    1357:	68 82 21 00 00       	push   $0x2182
+    135c:	68 8c 21 00 00       	push   $0x218c
+    1361:	ff 35 74 2d 00 00    	push   0x2d74
+    1367:	e8 24 0a 00 00       	call   1d90 <printf>
+    exit();
+    136c:	e8 7d 08 00 00       	call   1bee <exit>
+    1371:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1378:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    137f:	90                   	nop
+
+00001380 <seqreadbench>:
+{
+    1380:	55                   	push   %ebp
+    1381:	89 e5                	mov    %esp,%ebp
+    1383:	56                   	push   %esi
+    1384:	53                   	push   %ebx
+  printf(stdout, "seqread bench\n");
+    1385:	83 ec 08             	sub    $0x8,%esp
+    1388:	68 9c 21 00 00       	push   $0x219c
+    138d:	ff 35 74 2d 00 00    	push   0x2d74
+    1393:	e8 f8 09 00 00       	call   1d90 <printf>
+    start = uptime();
+    1398:	e8 e9 08 00 00       	call   1c86 <uptime>
+    139d:	89 c6                	mov    %eax,%esi
+    n = seqread();
+    139f:	e8 5c ff ff ff       	call   1300 <seqread>
+    13a4:	89 c3                	mov    %eax,%ebx
+    t = uptime() - start;
+    13a6:	e8 db 08 00 00       	call   1c86 <uptime>
+    printf(stdout, "seqread bench: %s %d bytes in %d ticks, %d KB/s\n",
+    13ab:	83 c4 10             	add    $0x10,%esp
+    t = uptime() - start;
+    13ae:	89 c1                	mov    %eax,%ecx
+    printf(stdout, "seqread bench: %s %d bytes in %d ticks, %d KB/s\n",
+    13b0:	29 f1                	sub    %esi,%ecx
+    13b2:	0f 84 88 00 00 00    	je     1440 <seqreadbench+0xc0>
+           i == 0 ? "cold" : "cached", n, t, t ? n / 1024 * 100 / t : 0);
+    13b8:	85 db                	test   %ebx,%ebx
+    13ba:	8d 83 ff 03 00 00    	lea    0x3ff(%ebx),%eax
+    13c0:	0f 49 c3             	cmovns %ebx,%eax
+    printf(stdout, "seqread bench: %s %d bytes in %d ticks, %d KB/s\n",
+    13c3:	31 d2                	xor    %edx,%edx
+           i == 0 ? "cold" : "cached", n, t, t ? n / 1024 * 100 / t : 0);
+    13c5:	c1 f8 0a             	sar    $0xa,%eax
+    13c8:	6b c0 64             	imul   $0x64,%eax,%eax
+    printf(stdout, "seqread bench: %s %d bytes in %d ticks, %d KB/s\n",
+    13cb:	f7 f1                	div    %ecx
+    13cd:	83 ec 08             	sub    $0x8,%esp
+    13d0:	50                   	push   %eax
+    13d1:	51                   	push   %ecx
+    13d2:	53                   	push   %ebx
+    13d3:	68 ab 21 00 00       	push   $0x21ab
+    13d8:	68 a4 24 00 00       	push   $0x24a4
+    13dd:	ff 35 74 2d 00 00    	push   0x2d74
+    13e3:	e8 a8 09 00 00       	call   1d90 <printf>
+    start = uptime();
+    13e8:	83 c4 20             	add    $0x20,%esp
+    13eb:	e8 96 08 00 00       	call   1c86 <uptime>
+    13f0:	89 c6                	mov    %eax,%esi
+    n = seqread();
+    13f2:	e8 09 ff ff ff       	call   1300 <seqread>
+    13f7:	89 c3                	mov    %eax,%ebx
+    t = uptime() - start;
+    13f9:	e8 88 08 00 00       	call   1c86 <uptime>
+    13fe:	89 c1                	mov    %eax,%ecx
+    printf(stdout, "seqread bench: %s %d bytes in %d ticks, %d KB/s\n",
+    1400:	31 c0                	xor    %eax,%eax
+    1402:	29 f1                	sub    %esi,%ecx
+    1404:	74 15                	je     141b <seqreadbench+0x9b>
+           i == 0 ? "cold" : "cached", n, t, t ? n / 1024 * 100 / t : 0);
+    1406:	85 db                	test   %ebx,%ebx
+    1408:	8d 83 ff 03 00 00    	lea    0x3ff(%ebx),%eax
+    140e:	0f 49 c3             	cmovns %ebx,%eax
+    printf(stdout, "seqread bench: %s %d bytes in %d ticks, %d KB/s\n",
+    1411:	31 d2                	xor    %edx,%edx
+           i == 0 ? "cold" : "cached", n, t, t ? n / 1024 * 100 / t : 0);
+    1413:	c1 f8 0a             	sar    $0xa,%eax
+    1416:	6b c0 64             	imul   $0x64,%eax,%eax
+    printf(stdout, "seqread bench: %s %d bytes in %d ticks, %d KB/s\n",
+    1419:	f7 f1                	div    %ecx
+    141b:	83 ec 08             	sub    $0x8,%esp
+    141e:	50                   	push   %eax
+    141f:	51                   	push   %ecx
+    1420:	53                   	push   %ebx
+    1421:	68 b0 21 00 00       	push   $0x21b0
+    1426:	68 a4 24 00 00       	push   $0x24a4
+    142b:	ff 35 74 2d 00 00    	push   0x2d74
+    1431:	e8 5a 09 00 00       	call   1d90 <printf>
+}
+    1436:	83 c4 20             	add    $0x20,%esp
+    1439:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    143c:	5b                   	pop    %ebx
+    143d:	5e                   	pop    %esi
+    143e:	5d                   	pop    %ebp
+    143f:	c3                   	ret
+    1440:	31 c0                	xor    %eax,%eax
+    1442:	eb 89                	jmp    13cd <seqreadbench+0x4d>
+    1444:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    144b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    144f:	90                   	nop
+
+00001450 <commitbench>:
+{
+    1450:	55                   	push   %ebp
+    1451:	89 e5                	mov    %esp,%ebp
+    1453:	57                   	push   %edi
+    1454:	56                   	push   %esi
+    1455:	53                   	push   %ebx
+    1456:	83 ec 14             	sub    $0x14,%esp
+  printf(stdout, "commit bench\n");
+    1459:	68 b7 21 00 00       	push   $0x21b7
+    145e:	ff 35 74 2d 00 00    	push   0x2d74
+    1464:	e8 27 09 00 00       	call   1d90 <printf>
+  if((fd = open("commitbench", O_CREATE|O_RDWR)) < 0){
+    1469:	5b                   	pop    %ebx
+    146a:	5e                   	pop    %esi
+    146b:	68 02 02 00 00       	push   $0x202
+    1470:	68 c5 21 00 00       	push   $0x21c5
+    1475:	e8 b4 07 00 00       	call   1c2e <open>
+    147a:	83 c4 10             	add    $0x10,%esp
+    147d:	85 c0                	test   %eax,%eax
+    147f:	0f 88 c4 00 00 00    	js     1549 <commitbench+0xf9>
+    1485:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < NCOMMIT; i++){
+    1487:	31 db                	xor    %ebx,%ebx
+  start = uptime();
+    1489:	e8 f8 07 00 00       	call   1c86 <uptime>
+    148e:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < NCOMMIT; i++){
+    1490:	eb 2e                	jmp    14c0 <commitbench+0x70>
+    1492:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    1498:	83 ec 04             	sub    $0x4,%esp
+    149b:	68 00 06 00 00       	push   $0x600
+    14a0:	68 c0 35 00 00       	push   $0x35c0
+    14a5:	56                   	push   %esi
+    14a6:	e8 63 07 00 00       	call   1c0e <write>
+    14ab:	83 c4 10             	add    $0x10,%esp
+    14ae:	3d 00 06 00 00       	cmp    $0x600,%eax
+    14b3:	75 7c                	jne    1531 <commitbench+0xe1>
+  for(i = 0; i < NCOMMIT; i++){
+    14b5:	83 c3 01             	add    $0x1,%ebx
+    14b8:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+    14be:	74 32                	je     14f2 <commitbench+0xa2>
+    if(i % 16 == 0){
+    14c0:	f6 c3 0f             	test   $0xf,%bl
+    14c3:	75 d3                	jne    1498 <commitbench+0x48>
+      close(fd);
+    14c5:	83 ec 0c             	sub    $0xc,%esp
+    14c8:	56                   	push   %esi
+    14c9:	e8 48 07 00 00       	call   1c16 <close>
+      unlink("commitbench");
+    14ce:	c7 04 24 c5 21 00 00 	movl   $0x21c5,(%esp)
+    14d5:	e8 64 07 00 00       	call   1c3e <unlink>
+      fd = open("commitbench", O_CREATE|O_RDWR);
+    14da:	58                   	pop    %eax
+    14db:	5a                   	pop    %edx
+    14dc:	68 02 02 00 00       	push   $0x202
+    14e1:	68 c5 21 00 00       	push   $0x21c5
+    14e6:	e8 43 07 00 00       	call   1c2e <open>
+    14eb:	83 c4 10             	add    $0x10,%esp
+    14ee:	89 c6                	mov    %eax,%esi
+    14f0:	eb a6                	jmp    1498 <commitbench+0x48>
+  t = uptime() - start;
+    14f2:	e8 8f 07 00 00       	call   1c86 <uptime>
+  close(fd);
+    14f7:	83 ec 0c             	sub    $0xc,%esp
+    14fa:	56                   	push   %esi
+  t = uptime() - start;
+    14fb:	29 f8                	sub    %edi,%eax
+    14fd:	89 c3                	mov    %eax,%ebx
+  close(fd);
+    14ff:	e8 12 07 00 00       	call   1c16 <close>
+  unlink("commitbench");
+    1504:	c7 04 24 c5 21 00 00 	movl   $0x21c5,(%esp)
+    150b:	e8 2e 07 00 00       	call   1c3e <unlink>
+  printf(stdout, "commit bench: %d committed writes in %d ticks\n", NCOMMIT, t);
+    1510:	53                   	push   %ebx
+    1511:	68 c8 00 00 00       	push   $0xc8
+    1516:	68 d8 24 00 00       	push   $0x24d8
+    151b:	ff 35 74 2d 00 00    	push   0x2d74
+    1521:	e8 6a 08 00 00       	call   1d90 <printf>
+}
+    1526:	83 c4 20             	add    $0x20,%esp
+    1529:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    152c:	5b                   	pop    %ebx
+    152d:	5e                   	pop    %esi
+    152e:	5f                   	pop    %edi
+    152f:	5d                   	pop    %ebp
+    1530:	c3                   	ret
+      printf(stdout, "write failed\n");
+    1531:	83 ec 08             	sub    $0x8,%esp
+    1534:	68 d1 21 00 00       	push   $0x21d1
+    1539:	ff 35 74 2d 00 00    	push   0x2d74
+    153f:	e8 4c 08 00 00       	call   1d90 <printf>
+      exit();
+    1544:	e8 a5 06 00 00       	call   1bee <exit>
+    printf(stdout, "create failed\n");
+    1549:	51                   	push   %ecx
+    154a:	51                   	push   %ecx
+    154b:	68 f2 20 00 00       	push   $0x20f2
+    1550:	ff 35 74 2d 00 00    	push   0x2d74
+    1556:	e8 35 08 00 00       	call   1d90 <printf>
+    exit();
+    155b:	e8 8e 06 00 00       	call   1bee <exit>
+
+00001560 <seqiobench>:
+{
+    1560:	55                   	push   %ebp
+    1561:	89 e5                	mov    %esp,%ebp
+    1563:	57                   	push   %edi
+    1564:	56                   	push   %esi
+    1565:	53                   	push   %ebx
+    1566:	83 ec 14             	sub    $0x14,%esp
+  printf(stdout, "seqio bench\n");
+    1569:	68 df 21 00 00       	push   $0x21df
+    156e:	ff 35 74 2d 00 00    	push   0x2d74
+    1574:	e8 17 08 00 00       	call   1d90 <printf>
+  if((fd = open("seqiobench", O_CREATE|O_RDWR)) < 0){
+    1579:	5f                   	pop    %edi
+    157a:	58                   	pop    %eax
+    157b:	68 02 02 00 00       	push   $0x202
+    1580:	68 ec 21 00 00       	push   $0x21ec
+    1585:	e8 a4 06 00 00       	call   1c2e <open>
+    158a:	83 c4 10             	add    $0x10,%esp
+    158d:	85 c0                	test   %eax,%eax
+    158f:	0f 88 b3 00 00 00    	js     1648 <seqiobench+0xe8>
+    1595:	89 c6                	mov    %eax,%esi
+  start = uptime();
+    1597:	bb 28 00 00 00       	mov    $0x28,%ebx
+    159c:	e8 e5 06 00 00       	call   1c86 <uptime>
+    15a1:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < SEQIOBLOCKS / 3; i++){
+    15a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    15a7:	90                   	nop
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    15a8:	83 ec 04             	sub    $0x4,%esp
+    15ab:	68 00 06 00 00       	push   $0x600
+    15b0:	68 c0 2f 00 00       	push   $0x2fc0
+    15b5:	56                   	push   %esi
+    15b6:	e8 53 06 00 00       	call   1c0e <write>
+    15bb:	83 c4 10             	add    $0x10,%esp
+    15be:	3d 00 06 00 00       	cmp    $0x600,%eax
+    15c3:	75 6b                	jne    1630 <seqiobench+0xd0>
+  for(i = 0; i < SEQIOBLOCKS / 3; i++){
+    15c5:	83 eb 01             	sub    $0x1,%ebx
+    15c8:	75 de                	jne    15a8 <seqiobench+0x48>
+  t = uptime() - start;
+    15ca:	e8 b7 06 00 00       	call   1c86 <uptime>
+  close(fd);
+    15cf:	83 ec 0c             	sub    $0xc,%esp
+    15d2:	56                   	push   %esi
+  t = uptime() - start;
+    15d3:	29 f8                	sub    %edi,%eax
+    15d5:	89 c3                	mov    %eax,%ebx
+  close(fd);
+    15d7:	e8 3a 06 00 00       	call   1c16 <close>
+  unlink("seqiobench");
+    15dc:	c7 04 24 ec 21 00 00 	movl   $0x21ec,(%esp)
+    15e3:	e8 56 06 00 00       	call   1c3e <unlink>
+  if(t == 0)
+    15e8:	85 db                	test   %ebx,%ebx
+    15ea:	b8 01 00 00 00       	mov    $0x1,%eax
+    15ef:	0f 45 c3             	cmovne %ebx,%eax
+  kb = SEQIOBLOCKS * 512 / 1024 * 100 / t;
+    15f2:	31 d2                	xor    %edx,%edx
+    15f4:	89 c1                	mov    %eax,%ecx
+    15f6:	b8 70 17 00 00       	mov    $0x1770,%eax
+    15fb:	f7 f1                	div    %ecx
+  printf(stdout, "seqio bench: %d blocks in %d ticks, %d.%d MB/s\n",
+    15fd:	5a                   	pop    %edx
+    15fe:	5b                   	pop    %ebx
+         SEQIOBLOCKS, t, kb / 1024, kb % 1024 * 10 / 1024);
+    15ff:	89 c2                	mov    %eax,%edx
+  printf(stdout, "seqio bench: %d blocks in %d ticks, %d.%d MB/s\n",
+    1601:	c1 f8 0a             	sar    $0xa,%eax
+         SEQIOBLOCKS, t, kb / 1024, kb % 1024 * 10 / 1024);
+    1604:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+    160a:	8d 14 92             	lea    (%edx,%edx,4),%edx
+  printf(stdout, "seqio bench: %d blocks in %d ticks, %d.%d MB/s\n",
+    160d:	c1 ea 09             	shr    $0x9,%edx
+    1610:	52                   	push   %edx
+    1611:	50                   	push   %eax
+    1612:	51                   	push   %ecx
+    1613:	6a 78                	push   $0x78
+    1615:	68 08 25 00 00       	push   $0x2508
+    161a:	ff 35 74 2d 00 00    	push   0x2d74
+    1620:	e8 6b 07 00 00       	call   1d90 <printf>
+}
+    1625:	83 c4 20             	add    $0x20,%esp
+    1628:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    162b:	5b                   	pop    %ebx
+    162c:	5e                   	pop    %esi
+    162d:	5f                   	pop    %edi
+    162e:	5d                   	pop    %ebp
+    162f:	c3                   	ret
+      printf(stdout, "write failed\n");
+    1630:	83 ec 08             	sub    $0x8,%esp
+    1633:	68 d1 21 00 00       	push   $0x21d1
+    1638:	ff 35 74 2d 00 00    	push   0x2d74
+    163e:	e8 4d 07 00 00       	call   1d90 <printf>
+      exit();
+    1643:	e8 a6 05 00 00       	call   1bee <exit>
+    printf(stdout, "create failed\n");
+    1648:	56                   	push   %esi
+    1649:	56                   	push   %esi
+    164a:	68 f2 20 00 00       	push   $0x20f2
+    164f:	ff 35 74 2d 00 00    	push   0x2d74
+    1655:	e8 36 07 00 00       	call   1d90 <printf>
+    exit();
+    165a:	e8 8f 05 00 00       	call   1bee <exit>
+    165f:	90                   	nop
+
+00001660 <randiobench>:
+{
+    1660:	55                   	push   %ebp
+    1661:	89 e5                	mov    %esp,%ebp
+    1663:	57                   	push   %edi
+  printf(stdout, "randio bench\n");
+    1664:	bf 30 00 00 00       	mov    $0x30,%edi
+{
+    1669:	56                   	push   %esi
+    166a:	53                   	push   %ebx
+    166b:	83 ec 24             	sub    $0x24,%esp
+  printf(stdout, "randio bench\n");
+    166e:	68 f7 21 00 00       	push   $0x21f7
+    1673:	ff 35 74 2d 00 00    	push   0x2d74
+    1679:	e8 12 07 00 00       	call   1d90 <printf>
+    167e:	83 c4 10             	add    $0x10,%esp
+    1681:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      name[6] = '0' + i;
+    1688:	be 30 00 00 00       	mov    $0x30,%esi
+    168d:	89 f8                	mov    %edi,%eax
+      if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+    168f:	83 ec 08             	sub    $0x8,%esp
+      name[6] = '0' + i;
+    1692:	a2 6e 2d 00 00       	mov    %al,0x2d6e
+      name[7] = '0' + j;
+    1697:	89 f0                	mov    %esi,%eax
+    1699:	a2 6f 2d 00 00       	mov    %al,0x2d6f
+      if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+    169e:	68 02 02 00 00       	push   $0x202
+    16a3:	68 68 2d 00 00       	push   $0x2d68
+    16a8:	e8 81 05 00 00       	call   1c2e <open>
+    16ad:	83 c4 10             	add    $0x10,%esp
+    16b0:	89 c3                	mov    %eax,%ebx
+    16b2:	85 c0                	test   %eax,%eax
+    16b4:	0f 88 66 01 00 00    	js     1820 <randiobench+0x1c0>
+      write(fd, buf, sizeof(buf));
+    16ba:	83 ec 04             	sub    $0x4,%esp
+    for(j = 0; j < NRANDFILE; j++){
+    16bd:	83 c6 01             	add    $0x1,%esi
+      write(fd, buf, sizeof(buf));
+    16c0:	68 00 02 00 00       	push   $0x200
+    16c5:	68 c0 2d 00 00       	push   $0x2dc0
+    16ca:	50                   	push   %eax
+    16cb:	e8 3e 05 00 00       	call   1c0e <write>
+      close(fd);
+    16d0:	89 1c 24             	mov    %ebx,(%esp)
+    16d3:	e8 3e 05 00 00       	call   1c16 <close>
+    for(j = 0; j < NRANDFILE; j++){
+    16d8:	89 f0                	mov    %esi,%eax
+    16da:	83 c4 10             	add    $0x10,%esp
+    16dd:	3c 34                	cmp    $0x34,%al
+    16df:	75 ac                	jne    168d <randiobench+0x2d>
+  for(i = 0; i < NBENCHPROC; i++){
+    16e1:	83 c7 01             	add    $0x1,%edi
+    16e4:	89 f8                	mov    %edi,%eax
+    16e6:	3c 38                	cmp    $0x38,%al
+    16e8:	75 9e                	jne    1688 <randiobench+0x28>
+  start = uptime();
+    16ea:	e8 97 05 00 00       	call   1c86 <uptime>
+  for(i = 0; i < NBENCHPROC; i++){
+    16ef:	31 ff                	xor    %edi,%edi
+  start = uptime();
+    16f1:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < NBENCHPROC; i++){
+    16f3:	eb 05                	jmp    16fa <randiobench+0x9a>
+    16f5:	8d 76 00             	lea    0x0(%esi),%esi
+      seed = i + 1;
+    16f8:	89 df                	mov    %ebx,%edi
+    pid = fork();
+    16fa:	e8 e7 04 00 00       	call   1be6 <fork>
+    if(pid < 0){
+    16ff:	85 c0                	test   %eax,%eax
+    1701:	0f 88 49 01 00 00    	js     1850 <randiobench+0x1f0>
+      seed = i + 1;
+    1707:	8d 5f 01             	lea    0x1(%edi),%ebx
+    if(pid == 0){
+    170a:	0f 84 8b 00 00 00    	je     179b <randiobench+0x13b>
+  for(i = 0; i < NBENCHPROC; i++){
+    1710:	83 fb 08             	cmp    $0x8,%ebx
+    1713:	75 e3                	jne    16f8 <randiobench+0x98>
+    1715:	8d 76 00             	lea    0x0(%esi),%esi
+    wait();
+    1718:	e8 d9 04 00 00       	call   1bf6 <wait>
+  for(i = 0; i < NBENCHPROC; i++)
+    171d:	83 eb 01             	sub    $0x1,%ebx
+    1720:	75 f6                	jne    1718 <randiobench+0xb8>
+  t = uptime() - start;
+    1722:	e8 5f 05 00 00       	call   1c86 <uptime>
+    1727:	29 f0                	sub    %esi,%eax
+  printf(stdout, "randio bench: %d writes in %d ticks, %d IOPS\n",
+    1729:	be 30 00 00 00       	mov    $0x30,%esi
+  t = uptime() - start;
+    172e:	89 c1                	mov    %eax,%ecx
+    1730:	b8 01 00 00 00       	mov    $0x1,%eax
+    1735:	0f 44 c8             	cmove  %eax,%ecx
+  printf(stdout, "randio bench: %d writes in %d ticks, %d IOPS\n",
+    1738:	b8 40 9c 00 00       	mov    $0x9c40,%eax
+    173d:	31 d2                	xor    %edx,%edx
+    173f:	83 ec 0c             	sub    $0xc,%esp
+    1742:	f7 f1                	div    %ecx
+    1744:	50                   	push   %eax
+    1745:	51                   	push   %ecx
+    1746:	68 90 01 00 00       	push   $0x190
+    174b:	68 38 25 00 00       	push   $0x2538
+    1750:	ff 35 74 2d 00 00    	push   0x2d74
+    1756:	e8 35 06 00 00       	call   1d90 <printf>
+    175b:	83 c4 20             	add    $0x20,%esp
+    175e:	66 90                	xchg   %ax,%ax
+      name[6] = '0' + i;
+    1760:	bb 30 00 00 00       	mov    $0x30,%ebx
+      unlink(name);
+    1765:	83 ec 0c             	sub    $0xc,%esp
+      name[6] = '0' + i;
+    1768:	89 f0                	mov    %esi,%eax
+      name[7] = '0' + j;
+    176a:	88 1d 6f 2d 00 00    	mov    %bl,0x2d6f
+    for(j = 0; j < NRANDFILE; j++){
+    1770:	83 c3 01             	add    $0x1,%ebx
+      name[6] = '0' + i;
+    1773:	a2 6e 2d 00 00       	mov    %al,0x2d6e
+      unlink(name);
+    1778:	68 68 2d 00 00       	push   $0x2d68
+    177d:	e8 bc 04 00 00       	call   1c3e <unlink>
+    for(j = 0; j < NRANDFILE; j++){
+    1782:	83 c4 10             	add    $0x10,%esp
+    1785:	80 fb 34             	cmp    $0x34,%bl
+    1788:	75 db                	jne    1765 <randiobench+0x105>
+  for(i = 0; i < NBENCHPROC; i++){
+    178a:	83 c6 01             	add    $0x1,%esi
+    178d:	89 f0                	mov    %esi,%eax
+    178f:	3c 38                	cmp    $0x38,%al
+    1791:	75 cd                	jne    1760 <randiobench+0x100>
+}
+    1793:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1796:	5b                   	pop    %ebx
+    1797:	5e                   	pop    %esi
+    1798:	5f                   	pop    %edi
+    1799:	5d                   	pop    %ebp
+    179a:	c3                   	ret
+        name[6] = '0' + i;
+    179b:	8d 47 30             	lea    0x30(%edi),%eax
+    179e:	be 32 00 00 00       	mov    $0x32,%esi
+    17a3:	88 45 e7             	mov    %al,-0x19(%ebp)
+    17a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17ad:	8d 76 00             	lea    0x0(%esi),%esi
+        seed = seed * 1103515245 + 12345;
+    17b0:	69 db 6d 4e c6 41    	imul   $0x41c64e6d,%ebx,%ebx
+        name[6] = '0' + i;
+    17b6:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+        if((fd = open(name, O_RDWR)) < 0 ||
+    17ba:	83 ec 08             	sub    $0x8,%esp
+        name[6] = '0' + i;
+    17bd:	a2 6e 2d 00 00       	mov    %al,0x2d6e
+        seed = seed * 1103515245 + 12345;
+    17c2:	81 c3 39 30 00 00    	add    $0x3039,%ebx
+        name[7] = '0' + (seed >> 16) % NRANDFILE;
+    17c8:	89 d8                	mov    %ebx,%eax
+    17ca:	c1 e8 10             	shr    $0x10,%eax
+    17cd:	83 e0 03             	and    $0x3,%eax
+    17d0:	83 c0 30             	add    $0x30,%eax
+    17d3:	a2 6f 2d 00 00       	mov    %al,0x2d6f
+        if((fd = open(name, O_RDWR)) < 0 ||
+    17d8:	6a 02                	push   $0x2
+    17da:	68 68 2d 00 00       	push   $0x2d68
+    17df:	e8 4a 04 00 00       	call   1c2e <open>
+    17e4:	83 c4 10             	add    $0x10,%esp
+    17e7:	89 c7                	mov    %eax,%edi
+    17e9:	85 c0                	test   %eax,%eax
+    17eb:	78 4b                	js     1838 <randiobench+0x1d8>
+           write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    17ed:	83 ec 04             	sub    $0x4,%esp
+    17f0:	68 00 02 00 00       	push   $0x200
+    17f5:	68 c0 2d 00 00       	push   $0x2dc0
+    17fa:	50                   	push   %eax
+    17fb:	e8 0e 04 00 00       	call   1c0e <write>
+        if((fd = open(name, O_RDWR)) < 0 ||
+    1800:	83 c4 10             	add    $0x10,%esp
+    1803:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1808:	75 2e                	jne    1838 <randiobench+0x1d8>
+        close(fd);
+    180a:	83 ec 0c             	sub    $0xc,%esp
+    180d:	57                   	push   %edi
+    180e:	e8 03 04 00 00       	call   1c16 <close>
+      for(j = 0; j < NRANDIO; j++){
+    1813:	83 c4 10             	add    $0x10,%esp
+    1816:	83 ee 01             	sub    $0x1,%esi
+    1819:	75 95                	jne    17b0 <randiobench+0x150>
+      exit();
+    181b:	e8 ce 03 00 00       	call   1bee <exit>
+        printf(stdout, "create failed\n");
+    1820:	83 ec 08             	sub    $0x8,%esp
+    1823:	68 f2 20 00 00       	push   $0x20f2
+    1828:	ff 35 74 2d 00 00    	push   0x2d74
+    182e:	e8 5d 05 00 00       	call   1d90 <printf>
+        exit();
+    1833:	e8 b6 03 00 00       	call   1bee <exit>
+          printf(stdout, "write failed\n");
+    1838:	83 ec 08             	sub    $0x8,%esp
+    183b:	68 d1 21 00 00       	push   $0x21d1
+    1840:	ff 35 74 2d 00 00    	push   0x2d74
+    1846:	e8 45 05 00 00       	call   1d90 <printf>
+          exit();
+    184b:	e8 9e 03 00 00       	call   1bee <exit>
+      printf(stdout, "fork failed\n");
+    1850:	83 ec 08             	sub    $0x8,%esp
+    1853:	68 51 1f 00 00       	push   $0x1f51
+    1858:	ff 35 74 2d 00 00    	push   0x2d74
+    185e:	e8 2d 05 00 00       	call   1d90 <printf>
+      exit();
+    1863:	e8 86 03 00 00       	call   1bee <exit>
+    1868:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    186f:	90                   	nop
+
+00001870 <diskcpubench>:
+{
+    1870:	55                   	push   %ebp
+    1871:	89 e5                	mov    %esp,%ebp
+    1873:	57                   	push   %edi
+    1874:	56                   	push   %esi
+    1875:	53                   	push   %ebx
+    1876:	83 ec 44             	sub    $0x44,%esp
+  printf(stdout, "diskcpu bench\n");
+    1879:	68 05 22 00 00       	push   $0x2205
+    187e:	ff 35 74 2d 00 00    	push   0x2d74
+    1884:	e8 07 05 00 00       	call   1d90 <printf>
+  if(iostat(&s0) < 0){
+    1889:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    188c:	89 04 24             	mov    %eax,(%esp)
+    188f:	e8 4a 04 00 00       	call   1cde <iostat>
+    1894:	83 c4 10             	add    $0x10,%esp
+    1897:	85 c0                	test   %eax,%eax
+    1899:	78 66                	js     1901 <diskcpubench+0x91>
+  seqiobench();
+    189b:	e8 c0 fc ff ff       	call   1560 <seqiobench>
+  iostat(&s1);
+    18a0:	83 ec 0c             	sub    $0xc,%esp
+    18a3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    18a6:	50                   	push   %eax
+    18a7:	e8 32 04 00 00       	call   1cde <iostat>
+  nblock = (s1.nread - s0.nread) + (s1.nwrite - s0.nwrite);
+    18ac:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  ncmd = s1.ncmd - s0.ncmd;
+    18af:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  printf(stdout, "diskcpu bench: %d blocks in %d commands (%d DMA), "
+    18b2:	83 c4 10             	add    $0x10,%esp
+  ndma = s1.ndma - s0.ndma;
+    18b5:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  nblock = (s1.nread - s0.nread) + (s1.nwrite - s0.nwrite);
+    18b8:	03 4d d4             	add    -0x2c(%ebp),%ecx
+  printf(stdout, "diskcpu bench: %d blocks in %d commands (%d DMA), "
+    18bb:	31 c0                	xor    %eax,%eax
+  kc = s1.kcycles - s0.kcycles;
+    18bd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    18c0:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  nblock = (s1.nread - s0.nread) + (s1.nwrite - s0.nwrite);
+    18c3:	2b 4d c0             	sub    -0x40(%ebp),%ecx
+  ncmd = s1.ncmd - s0.ncmd;
+    18c6:	2b 5d c8             	sub    -0x38(%ebp),%ebx
+  ndma = s1.ndma - s0.ndma;
+    18c9:	2b 75 cc             	sub    -0x34(%ebp),%esi
+  printf(stdout, "diskcpu bench: %d blocks in %d commands (%d DMA), "
+    18cc:	2b 4d c4             	sub    -0x3c(%ebp),%ecx
+    18cf:	74 0e                	je     18df <diskcpubench+0x6f>
+  kc = s1.kcycles - s0.kcycles;
+    18d1:	89 d0                	mov    %edx,%eax
+         nblock ? kc * 64 / nblock * 32 : 0);
+    18d3:	31 d2                	xor    %edx,%edx
+  kc = s1.kcycles - s0.kcycles;
+    18d5:	29 f8                	sub    %edi,%eax
+         nblock ? kc * 64 / nblock * 32 : 0);
+    18d7:	c1 e0 06             	shl    $0x6,%eax
+    18da:	f7 f1                	div    %ecx
+  printf(stdout, "diskcpu bench: %d blocks in %d commands (%d DMA), "
+    18dc:	c1 e0 05             	shl    $0x5,%eax
+    18df:	83 ec 08             	sub    $0x8,%esp
+    18e2:	50                   	push   %eax
+    18e3:	56                   	push   %esi
+    18e4:	53                   	push   %ebx
+    18e5:	51                   	push   %ecx
+    18e6:	68 68 25 00 00       	push   $0x2568
+    18eb:	ff 35 74 2d 00 00    	push   0x2d74
+    18f1:	e8 9a 04 00 00       	call   1d90 <printf>
+}
+    18f6:	83 c4 20             	add    $0x20,%esp
+    18f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18fc:	5b                   	pop    %ebx
+    18fd:	5e                   	pop    %esi
+    18fe:	5f                   	pop    %edi
+    18ff:	5d                   	pop    %ebp
+    1900:	c3                   	ret
+    printf(stdout, "iostat failed\n");
+    1901:	50                   	push   %eax
+    1902:	50                   	push   %eax
+    1903:	68 14 22 00 00       	push   $0x2214
+    1908:	ff 35 74 2d 00 00    	push   0x2d74
+    190e:	e8 7d 04 00 00       	call   1d90 <printf>
+    exit();
+    1913:	e8 d6 02 00 00       	call   1bee <exit>
+    1918:	66 90                	xchg   %ax,%ax
+    191a:	66 90                	xchg   %ax,%ax
+    191c:	66 90                	xchg   %ax,%ax
+    191e:	66 90                	xchg   %ax,%ax
+
+00001920 <threadstart>:
+static lock_t stacklock;
+static char *freestacks;  // linked through their first word
+
+static void
+threadstart(void *fn, void *arg)
+{
+    1920:	55                   	push   %ebp
+    1921:	89 e5                	mov    %esp,%ebp
+    1923:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+    1926:	ff 75 0c             	push   0xc(%ebp)
+    1929:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+    192c:	e8 bd 02 00 00       	call   1bee <exit>
+    1931:	66 90                	xchg   %ax,%ax
+    1933:	66 90                	xchg   %ax,%ax
+    1935:	66 90                	xchg   %ax,%ax
+    1937:	66 90                	xchg   %ax,%ax
+    1939:	66 90                	xchg   %ax,%ax
+    193b:	66 90                	xchg   %ax,%ax
+    193d:	66 90                	xchg   %ax,%ax
+    193f:	90                   	nop
+
+00001940 <lock_init>:
+{
+    1940:	55                   	push   %ebp
+    1941:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    1943:	8b 45 08             	mov    0x8(%ebp),%eax
+    1946:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    194c:	5d                   	pop    %ebp
+    194d:	c3                   	ret
+    194e:	66 90                	xchg   %ax,%ax
+
+00001950 <lock_acquire>:
+{
+    1950:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    1951:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1956:	89 e5                	mov    %esp,%ebp
+    1958:	8b 55 08             	mov    0x8(%ebp),%edx
+    195b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    195f:	90                   	nop
+    1960:	89 c8                	mov    %ecx,%eax
+    1962:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    1965:	85 c0                	test   %eax,%eax
+    1967:	75 f7                	jne    1960 <lock_acquire+0x10>
+}
+    1969:	5d                   	pop    %ebp
+    196a:	c3                   	ret
+    196b:	66 90                	xchg   %ax,%ax
+    196d:	66 90                	xchg   %ax,%ax
+    196f:	90                   	nop
+
+00001970 <lock_release>:
+{
+    1970:	55                   	push   %ebp
+    1971:	31 c0                	xor    %eax,%eax
+    1973:	89 e5                	mov    %esp,%ebp
+    1975:	8b 55 08             	mov    0x8(%ebp),%edx
+    1978:	f0 87 02             	lock xchg %eax,(%edx)
+}
+    197b:	5d                   	pop    %ebp
+    197c:	c3                   	ret
+    197d:	66 90                	xchg   %ax,%ax
+    197f:	90                   	nop
+
+00001980 <mutex_init>:
+{
+    1980:	55                   	push   %ebp
+    1981:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    1983:	8b 45 08             	mov    0x8(%ebp),%eax
+    1986:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    198c:	5d                   	pop    %ebp
+    198d:	c3                   	ret
+    198e:	66 90                	xchg   %ax,%ax
+
+00001990 <mutex_lock>:
+{
+    1990:	55                   	push   %ebp
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    1991:	31 c0                	xor    %eax,%eax
+    1993:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+    1998:	89 e5                	mov    %esp,%ebp
+    199a:	56                   	push   %esi
+    199b:	53                   	push   %ebx
+    199c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    199f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+    19a3:	85 c0                	test   %eax,%eax
+    19a5:	74 30                	je     19d7 <mutex_lock+0x47>
+  if(c != 2)
+    19a7:	83 f8 02             	cmp    $0x2,%eax
+    19aa:	74 0c                	je     19b8 <mutex_lock+0x28>
+    19ac:	b8 02 00 00 00       	mov    $0x2,%eax
+    19b1:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+    19b4:	85 c0                	test   %eax,%eax
+    19b6:	74 1f                	je     19d7 <mutex_lock+0x47>
+    19b8:	be 02 00 00 00       	mov    $0x2,%esi
+    19bd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->state, 2);
+    19c0:	83 ec 08             	sub    $0x8,%esp
+    19c3:	6a 02                	push   $0x2
+    19c5:	53                   	push   %ebx
+    19c6:	e8 f3 02 00 00       	call   1cbe <futex_wait>
+    19cb:	89 f0                	mov    %esi,%eax
+    19cd:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+    19d0:	83 c4 10             	add    $0x10,%esp
+    19d3:	85 c0                	test   %eax,%eax
+    19d5:	75 e9                	jne    19c0 <mutex_lock+0x30>
+}
+    19d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    19da:	5b                   	pop    %ebx
+    19db:	5e                   	pop    %esi
+    19dc:	5d                   	pop    %ebp
+    19dd:	c3                   	ret
+    19de:	66 90                	xchg   %ax,%ax
+
+000019e0 <mutex_unlock>:
+{
+    19e0:	55                   	push   %ebp
+    19e1:	89 e5                	mov    %esp,%ebp
+    19e3:	83 ec 08             	sub    $0x8,%esp
+    19e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    19e9:	f0 83 2a 01          	lock subl $0x1,(%edx)
+    19ed:	75 09                	jne    19f8 <mutex_unlock+0x18>
+}
+    19ef:	c9                   	leave
+    19f0:	c3                   	ret
+    19f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19f8:	31 c0                	xor    %eax,%eax
+    19fa:	f0 87 02             	lock xchg %eax,(%edx)
+    futex_wake(&m->state, 1);
+    19fd:	83 ec 08             	sub    $0x8,%esp
+    1a00:	6a 01                	push   $0x1
+    1a02:	52                   	push   %edx
+    1a03:	e8 be 02 00 00       	call   1cc6 <futex_wake>
+    1a08:	83 c4 10             	add    $0x10,%esp
+}
+    1a0b:	c9                   	leave
+    1a0c:	c3                   	ret
+    1a0d:	66 90                	xchg   %ax,%ax
+    1a0f:	90                   	nop
+
+00001a10 <cond_init>:
+{
+    1a10:	55                   	push   %ebp
+    1a11:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    1a13:	8b 45 08             	mov    0x8(%ebp),%eax
+    1a16:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1a1c:	5d                   	pop    %ebp
+    1a1d:	c3                   	ret
+    1a1e:	66 90                	xchg   %ax,%ax
+
+00001a20 <cond_wait>:
+{
+    1a20:	55                   	push   %ebp
+    1a21:	89 e5                	mov    %esp,%ebp
+    1a23:	57                   	push   %edi
+    1a24:	56                   	push   %esi
+    1a25:	53                   	push   %ebx
+    1a26:	83 ec 0c             	sub    $0xc,%esp
+    1a29:	8b 75 08             	mov    0x8(%ebp),%esi
+    1a2c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  seq = c->seq;
+    1a2f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    1a31:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+    1a35:	75 49                	jne    1a80 <cond_wait+0x60>
+  futex_wait(&c->seq, seq);
+    1a37:	83 ec 08             	sub    $0x8,%esp
+    1a3a:	57                   	push   %edi
+    1a3b:	56                   	push   %esi
+    1a3c:	e8 7d 02 00 00       	call   1cbe <futex_wait>
+    1a41:	b8 02 00 00 00       	mov    $0x2,%eax
+    1a46:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    1a49:	83 c4 10             	add    $0x10,%esp
+    1a4c:	85 c0                	test   %eax,%eax
+    1a4e:	74 1f                	je     1a6f <cond_wait+0x4f>
+    1a50:	be 02 00 00 00       	mov    $0x2,%esi
+    1a55:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->state, 2);
+    1a58:	83 ec 08             	sub    $0x8,%esp
+    1a5b:	6a 02                	push   $0x2
+    1a5d:	53                   	push   %ebx
+    1a5e:	e8 5b 02 00 00       	call   1cbe <futex_wait>
+    1a63:	89 f0                	mov    %esi,%eax
+    1a65:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    1a68:	83 c4 10             	add    $0x10,%esp
+    1a6b:	85 c0                	test   %eax,%eax
+    1a6d:	75 e9                	jne    1a58 <cond_wait+0x38>
+}
+    1a6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a72:	5b                   	pop    %ebx
+    1a73:	5e                   	pop    %esi
+    1a74:	5f                   	pop    %edi
+    1a75:	5d                   	pop    %ebp
+    1a76:	c3                   	ret
+    1a77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a7e:	66 90                	xchg   %ax,%ax
+    1a80:	31 c0                	xor    %eax,%eax
+    1a82:	f0 87 03             	lock xchg %eax,(%ebx)
+    futex_wake(&m->state, 1);
+    1a85:	83 ec 08             	sub    $0x8,%esp
+    1a88:	6a 01                	push   $0x1
+    1a8a:	53                   	push   %ebx
+    1a8b:	e8 36 02 00 00       	call   1cc6 <futex_wake>
+    1a90:	83 c4 10             	add    $0x10,%esp
+    1a93:	eb a2                	jmp    1a37 <cond_wait+0x17>
+    1a95:	66 90                	xchg   %ax,%ax
+    1a97:	66 90                	xchg   %ax,%ax
+    1a99:	66 90                	xchg   %ax,%ax
+    1a9b:	66 90                	xchg   %ax,%ax
+    1a9d:	66 90                	xchg   %ax,%ax
+    1a9f:	90                   	nop
+
+00001aa0 <cond_broadcast>:
+{
+    1aa0:	55                   	push   %ebp
+    1aa1:	89 e5                	mov    %esp,%ebp
+    1aa3:	83 ec 10             	sub    $0x10,%esp
+    1aa6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_add_and_fetch(&c->seq, 1);
+    1aa9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+    1aad:	68 ff ff ff 7f       	push   $0x7fffffff
+    1ab2:	50                   	push   %eax
+    1ab3:	e8 0e 02 00 00       	call   1cc6 <futex_wake>
+}
+    1ab8:	83 c4 10             	add    $0x10,%esp
+    1abb:	c9                   	leave
+    1abc:	c3                   	ret
+    1abd:	66 90                	xchg   %ax,%ax
+    1abf:	90                   	nop
+
+00001ac0 <thread_create>:
+}
+
+// Start a thread running fn(arg).  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1ac0:	55                   	push   %ebp
+    1ac1:	ba 01 00 00 00       	mov    $0x1,%edx
+    1ac6:	89 e5                	mov    %esp,%ebp
+    1ac8:	53                   	push   %ebx
+    1ac9:	83 ec 04             	sub    $0x4,%esp
+    1acc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1ad0:	89 d0                	mov    %edx,%eax
+    1ad2:	f0 87 05 c4 44 00 00 	lock xchg %eax,0x44c4
+  while(xchg(&lk->locked, 1) != 0)
+    1ad9:	85 c0                	test   %eax,%eax
+    1adb:	75 f3                	jne    1ad0 <thread_create+0x10>
+  char *stack;
+  int pid;
+
+  lock_acquire(&stacklock);
+  if((stack = freestacks) != 0)
+    1add:	8b 1d c0 44 00 00    	mov    0x44c0,%ebx
+    1ae3:	85 db                	test   %ebx,%ebx
+    1ae5:	74 71                	je     1b58 <thread_create+0x98>
+    freestacks = *(char**)stack;
+    1ae7:	8b 13                	mov    (%ebx),%edx
+    1ae9:	89 15 c0 44 00 00    	mov    %edx,0x44c0
+    1aef:	f0 87 05 c4 44 00 00 	lock xchg %eax,0x44c4
+  lock_release(&stacklock);
+  if(stack == 0 && (stack = sbrk(TSTACK)) == (char*)-1)
+    return -1;
+  if((pid = clone(threadstart, fn, arg, stack)) < 0){
+    1af6:	53                   	push   %ebx
+    1af7:	ff 75 0c             	push   0xc(%ebp)
+    1afa:	ff 75 08             	push   0x8(%ebp)
+    1afd:	68 20 19 00 00       	push   $0x1920
+    1b02:	e8 a7 01 00 00       	call   1cae <clone>
+    1b07:	83 c4 10             	add    $0x10,%esp
+    1b0a:	89 c2                	mov    %eax,%edx
+    1b0c:	85 c0                	test   %eax,%eax
+    1b0e:	78 10                	js     1b20 <thread_create+0x60>
+    *(char**)stack = freestacks;
+    freestacks = stack;
+    lock_release(&stacklock);
+  }
+  return pid;
+}
+    1b10:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1b13:	89 d0                	mov    %edx,%eax
+    1b15:	c9                   	leave
+    1b16:	c3                   	ret
+    1b17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b1e:	66 90                	xchg   %ax,%ax
+    1b20:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1b25:	8d 76 00             	lea    0x0(%esi),%esi
+    1b28:	89 c8                	mov    %ecx,%eax
+    1b2a:	f0 87 05 c4 44 00 00 	lock xchg %eax,0x44c4
+  while(xchg(&lk->locked, 1) != 0)
+    1b31:	85 c0                	test   %eax,%eax
+    1b33:	75 f3                	jne    1b28 <thread_create+0x68>
+    *(char**)stack = freestacks;
+    1b35:	8b 0d c0 44 00 00    	mov    0x44c0,%ecx
+    freestacks = stack;
+    1b3b:	89 1d c0 44 00 00    	mov    %ebx,0x44c0
+    *(char**)stack = freestacks;
+    1b41:	89 0b                	mov    %ecx,(%ebx)
+    1b43:	f0 87 05 c4 44 00 00 	lock xchg %eax,0x44c4
+}
+    1b4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1b4d:	89 d0                	mov    %edx,%eax
+    1b4f:	c9                   	leave
+    1b50:	c3                   	ret
+    1b51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b58:	89 d8                	mov    %ebx,%eax
+    1b5a:	f0 87 05 c4 44 00 00 	lock xchg %eax,0x44c4
+  if(stack == 0 && (stack = sbrk(TSTACK)) == (char*)-1)
+    1b61:	83 ec 0c             	sub    $0xc,%esp
+    1b64:	68 00 10 00 00       	push   $0x1000
+    1b69:	e8 08 01 00 00       	call   1c76 <sbrk>
+    1b6e:	83 c4 10             	add    $0x10,%esp
+    1b71:	89 c3                	mov    %eax,%ebx
+    1b73:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1b76:	0f 85 7a ff ff ff    	jne    1af6 <thread_create+0x36>
+    return -1;
+    1b7c:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    1b81:	eb 8d                	jmp    1b10 <thread_create+0x50>
+    1b83:	66 90                	xchg   %ax,%ax
+    1b85:	66 90                	xchg   %ax,%ax
+    1b87:	66 90                	xchg   %ax,%ax
+    1b89:	66 90                	xchg   %ax,%ax
+    1b8b:	66 90                	xchg   %ax,%ax
+    1b8d:	66 90                	xchg   %ax,%ax
+    1b8f:	90                   	nop
+
+00001b90 <thread_join>:
+
+// Wait for a thread started by thread_create() to finish.
+// Returns its pid, or -1 if there are none.
+int
+thread_join(void)
+{
+    1b90:	55                   	push   %ebp
+    1b91:	89 e5                	mov    %esp,%ebp
+    1b93:	53                   	push   %ebx
+  char *stack;
+  int pid;
+
+  if((pid = join((void**)&stack)) < 0)
+    1b94:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1b97:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join((void**)&stack)) < 0)
+    1b9a:	50                   	push   %eax
+    1b9b:	e8 16 01 00 00       	call   1cb6 <join>
+    1ba0:	83 c4 10             	add    $0x10,%esp
+    1ba3:	85 c0                	test   %eax,%eax
+    1ba5:	78 38                	js     1bdf <thread_join+0x4f>
+    1ba7:	89 c1                	mov    %eax,%ecx
+    1ba9:	ba 01 00 00 00       	mov    $0x1,%edx
+    1bae:	66 90                	xchg   %ax,%ax
+    1bb0:	89 d0                	mov    %edx,%eax
+    1bb2:	f0 87 05 c4 44 00 00 	lock xchg %eax,0x44c4
+  while(xchg(&lk->locked, 1) != 0)
+    1bb9:	85 c0                	test   %eax,%eax
+    1bbb:	75 f3                	jne    1bb0 <thread_join+0x20>
+    return -1;
+  lock_acquire(&stacklock);
+  *(char**)stack = freestacks;
+    1bbd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1bc0:	8b 1d c0 44 00 00    	mov    0x44c0,%ebx
+    1bc6:	89 1a                	mov    %ebx,(%edx)
+  freestacks = stack;
+    1bc8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1bcb:	89 15 c0 44 00 00    	mov    %edx,0x44c0
+    1bd1:	f0 87 05 c4 44 00 00 	lock xchg %eax,0x44c4
+  lock_release(&stacklock);
+  return pid;
+}
+    1bd8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1bdb:	89 c8                	mov    %ecx,%eax
+    1bdd:	c9                   	leave
+    1bde:	c3                   	ret
+    return -1;
+    1bdf:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+    1be4:	eb f2                	jmp    1bd8 <thread_join+0x48>
+
+00001be6 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    1be6:	b8 01 00 00 00       	mov    $0x1,%eax
+    1beb:	cd 40                	int    $0x40
+    1bed:	c3                   	ret
+
+00001bee <exit>:
+SYSCALL(exit)
+    1bee:	b8 02 00 00 00       	mov    $0x2,%eax
+    1bf3:	cd 40                	int    $0x40
+    1bf5:	c3                   	ret
+
+00001bf6 <wait>:
+SYSCALL(wait)
+    1bf6:	b8 03 00 00 00       	mov    $0x3,%eax
+    1bfb:	cd 40                	int    $0x40
+    1bfd:	c3                   	ret
+
+00001bfe <pipe>:
+SYSCALL(pipe)
+    1bfe:	b8 04 00 00 00       	mov    $0x4,%eax
+    1c03:	cd 40                	int    $0x40
+    1c05:	c3                   	ret
+
+00001c06 <read>:
+SYSCALL(read)
+    1c06:	b8 05 00 00 00       	mov    $0x5,%eax
+    1c0b:	cd 40                	int    $0x40
+    1c0d:	c3                   	ret
+
+00001c0e <write>:
+SYSCALL(write)
+    1c0e:	b8 10 00 00 00       	mov    $0x10,%eax
+    1c13:	cd 40                	int    $0x40
+    1c15:	c3                   	ret
+
+00001c16 <close>:
+SYSCALL(close)
+    1c16:	b8 15 00 00 00       	mov    $0x15,%eax
+    1c1b:	cd 40                	int    $0x40
+    1c1d:	c3                   	ret
+
+00001c1e <kill>:
+SYSCALL(kill)
+    1c1e:	b8 06 00 00 00       	mov    $0x6,%eax
+    1c23:	cd 40                	int    $0x40
+    1c25:	c3                   	ret
+
+00001c26 <exec>:
+SYSCALL(exec)
+    1c26:	b8 07 00 00 00       	mov    $0x7,%eax
+    1c2b:	cd 40                	int    $0x40
+    1c2d:	c3                   	ret
+
+00001c2e <open>:
+SYSCALL(open)
+    1c2e:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1c33:	cd 40                	int    $0x40
+    1c35:	c3                   	ret
+
+00001c36 <mknod>:
+SYSCALL(mknod)
+    1c36:	b8 11 00 00 00       	mov    $0x11,%eax
+    1c3b:	cd 40                	int    $0x40
+    1c3d:	c3                   	ret
+
+00001c3e <unlink>:
+SYSCALL(unlink)
+    1c3e:	b8 12 00 00 00       	mov    $0x12,%eax
+    1c43:	cd 40                	int    $0x40
+    1c45:	c3                   	ret
+
+00001c46 <fstat>:
+SYSCALL(fstat)
+    1c46:	b8 08 00 00 00       	mov    $0x8,%eax
+    1c4b:	cd 40                	int    $0x40
+    1c4d:	c3                   	ret
+
+00001c4e <link>:
+SYSCALL(link)
+    1c4e:	b8 13 00 00 00       	mov    $0x13,%eax
+    1c53:	cd 40                	int    $0x40
+    1c55:	c3                   	ret
+
+00001c56 <mkdir>:
+SYSCALL(mkdir)
+    1c56:	b8 14 00 00 00       	mov    $0x14,%eax
+    1c5b:	cd 40                	int    $0x40
+    1c5d:	c3                   	ret
+
+00001c5e <chdir>:
+SYSCALL(chdir)
+    1c5e:	b8 09 00 00 00       	mov    $0x9,%eax
+    1c63:	cd 40                	int    $0x40
+    1c65:	c3                   	ret
+
+00001c66 <dup>:
+SYSCALL(dup)
+    1c66:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1c6b:	cd 40                	int    $0x40
+    1c6d:	c3                   	ret
+
+00001c6e <getpid>:
+SYSCALL(getpid)
+    1c6e:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1c73:	cd 40                	int    $0x40
+    1c75:	c3                   	ret
+
+00001c76 <sbrk>:
+SYSCALL(sbrk)
+    1c76:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1c7b:	cd 40                	int    $0x40
+    1c7d:	c3                   	ret
+
+00001c7e <sleep>:
+SYSCALL(sleep)
+    1c7e:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1c83:	cd 40                	int    $0x40
+    1c85:	c3                   	ret
+
+00001c86 <uptime>:
+SYSCALL(uptime)
+    1c86:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1c8b:	cd 40                	int    $0x40
+    1c8d:	c3                   	ret
+
+00001c8e <setpriority>:
+SYSCALL(setpriority)
+    1c8e:	b8 16 00 00 00       	mov    $0x16,%eax
+    1c93:	cd 40                	int    $0x40
+    1c95:	c3                   	ret
+
+00001c96 <settickets>:
+SYSCALL(settickets)
+    1c96:	b8 17 00 00 00       	mov    $0x17,%eax
+    1c9b:	cd 40                	int    $0x40
+    1c9d:	c3                   	ret
+
+00001c9e <getpinfo>:
+SYSCALL(getpinfo)
+    1c9e:	b8 18 00 00 00       	mov    $0x18,%eax
+    1ca3:	cd 40                	int    $0x40
+    1ca5:	c3                   	ret
+
+00001ca6 <nanosleep>:
+SYSCALL(nanosleep)
+    1ca6:	b8 19 00 00 00       	mov    $0x19,%eax
+    1cab:	cd 40                	int    $0x40
+    1cad:	c3                   	ret
+
+00001cae <clone>:
+SYSCALL(clone)
+    1cae:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1cb3:	cd 40                	int    $0x40
+    1cb5:	c3                   	ret
+
+00001cb6 <join>:
+SYSCALL(join)
+    1cb6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1cbb:	cd 40                	int    $0x40
+    1cbd:	c3                   	ret
+
+00001cbe <futex_wait>:
+SYSCALL(futex_wait)
+    1cbe:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1cc3:	cd 40                	int    $0x40
+    1cc5:	c3                   	ret
+
+00001cc6 <futex_wake>:
+SYSCALL(futex_wake)
+    1cc6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1ccb:	cd 40                	int    $0x40
+    1ccd:	c3                   	ret
+
+00001cce <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+    1cce:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1cd3:	cd 40                	int    $0x40
+    1cd5:	c3                   	ret
+
+00001cd6 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+    1cd6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1cdb:	cd 40                	int    $0x40
+    1cdd:	c3                   	ret
+
+00001cde <iostat>:
+SYSCALL(iostat)
+    1cde:	b8 20 00 00 00       	mov    $0x20,%eax
+    1ce3:	cd 40                	int    $0x40
+    1ce5:	c3                   	ret
+    1ce6:	66 90                	xchg   %ax,%ax
+    1ce8:	66 90                	xchg   %ax,%ax
+    1cea:	66 90                	xchg   %ax,%ax
+    1cec:	66 90                	xchg   %ax,%ax
+    1cee:	66 90                	xchg   %ax,%ax
+
+00001cf0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1cf0:	55                   	push   %ebp
+    1cf1:	89 e5                	mov    %esp,%ebp
+    1cf3:	57                   	push   %edi
+    1cf4:	56                   	push   %esi
+    1cf5:	53                   	push   %ebx
+    1cf6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1cf8:	89 d1                	mov    %edx,%ecx
+{
+    1cfa:	83 ec 3c             	sub    $0x3c,%esp
+    1cfd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1d00:	85 d2                	test   %edx,%edx
+    1d02:	0f 89 80 00 00 00    	jns    1d88 <printint+0x98>
+    1d08:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    1d0c:	74 7a                	je     1d88 <printint+0x98>
+    x = -xx;
+    1d0e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1d10:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1d15:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1d18:	31 f6                	xor    %esi,%esi
+    1d1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1d20:	89 c8                	mov    %ecx,%eax
+    1d22:	31 d2                	xor    %edx,%edx
+    1d24:	89 f7                	mov    %esi,%edi
+    1d26:	f7 f3                	div    %ebx
+    1d28:	8d 76 01             	lea    0x1(%esi),%esi
+    1d2b:	0f b6 92 08 26 00 00 	movzbl 0x2608(%edx),%edx
+    1d32:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1d36:	89 ca                	mov    %ecx,%edx
+    1d38:	89 c1                	mov    %eax,%ecx
+    1d3a:	39 da                	cmp    %ebx,%edx
+    1d3c:	73 e2                	jae    1d20 <printint+0x30>
+  if(neg)
+    1d3e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1d41:	85 c0                	test   %eax,%eax
+    1d43:	74 07                	je     1d4c <printint+0x5c>
+    buf[i++] = '-';
+    1d45:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    1d4a:	89 f7                	mov    %esi,%edi
+    1d4c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    1d4f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1d52:	01 df                	add    %ebx,%edi
+    1d54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1d58:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    1d5b:	83 ec 04             	sub    $0x4,%esp
+    1d5e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1d61:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1d64:	6a 01                	push   $0x1
+    1d66:	50                   	push   %eax
+    1d67:	56                   	push   %esi
+    1d68:	e8 a1 fe ff ff       	call   1c0e <write>
+  while(--i >= 0)
+    1d6d:	89 f8                	mov    %edi,%eax
+    1d6f:	83 c4 10             	add    $0x10,%esp
+    1d72:	83 ef 01             	sub    $0x1,%edi
+    1d75:	39 d8                	cmp    %ebx,%eax
+    1d77:	75 df                	jne    1d58 <printint+0x68>
+}
+    1d79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d7c:	5b                   	pop    %ebx
+    1d7d:	5e                   	pop    %esi
+    1d7e:	5f                   	pop    %edi
+    1d7f:	5d                   	pop    %ebp
+    1d80:	c3                   	ret
+    1d81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1d88:	31 c0                	xor    %eax,%eax
+    1d8a:	eb 89                	jmp    1d15 <printint+0x25>
+    1d8c:	66 90                	xchg   %ax,%ax
+    1d8e:	66 90                	xchg   %ax,%ax
+
+00001d90 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1d90:	55                   	push   %ebp
+    1d91:	89 e5                	mov    %esp,%ebp
+    1d93:	57                   	push   %edi
+    1d94:	56                   	push   %esi
+    1d95:	53                   	push   %ebx
+    1d96:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1d99:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    1d9c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    1d9f:	0f b6 1e             	movzbl (%esi),%ebx
+    1da2:	83 c6 01             	add    $0x1,%esi
+    1da5:	84 db                	test   %bl,%bl
+    1da7:	74 67                	je     1e10 <printf+0x80>
+    1da9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    1dac:	31 d2                	xor    %edx,%edx
+    1dae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1db1:	eb 34                	jmp    1de7 <printf+0x57>
+    1db3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1db7:	90                   	nop
+    1db8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    1dbb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1dc0:	83 f8 25             	cmp    $0x25,%eax
+    1dc3:	74 18                	je     1ddd <printf+0x4d>
+  write(fd, &c, 1);
+    1dc5:	83 ec 04             	sub    $0x4,%esp
+    1dc8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1dcb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1dce:	6a 01                	push   $0x1
+    1dd0:	50                   	push   %eax
+    1dd1:	57                   	push   %edi
+    1dd2:	e8 37 fe ff ff       	call   1c0e <write>
+    1dd7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    1dda:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    1ddd:	0f b6 1e             	movzbl (%esi),%ebx
+    1de0:	83 c6 01             	add    $0x1,%esi
+    1de3:	84 db                	test   %bl,%bl
+    1de5:	74 29                	je     1e10 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1de7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    1dea:	85 d2                	test   %edx,%edx
+    1dec:	74 ca                	je     1db8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    1dee:	83 fa 25             	cmp    $0x25,%edx
+    1df1:	75 ea                	jne    1ddd <printf+0x4d>
+      if(c == 'd'){
+    1df3:	83 f8 25             	cmp    $0x25,%eax
+    1df6:	0f 84 24 01 00 00    	je     1f20 <printf+0x190>
+    1dfc:	83 e8 63             	sub    $0x63,%eax
+    1dff:	83 f8 15             	cmp    $0x15,%eax
+    1e02:	77 1c                	ja     1e20 <printf+0x90>
+    1e04:	ff 24 85 b0 25 00 00 	jmp    *0x25b0(,%eax,4)
+    1e0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1e0f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1e10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e13:	5b                   	pop    %ebx
+    1e14:	5e                   	pop    %esi
+    1e15:	5f                   	pop    %edi
+    1e16:	5d                   	pop    %ebp
+    1e17:	c3                   	ret
+    1e18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e1f:	90                   	nop
+  write(fd, &c, 1);
+    1e20:	83 ec 04             	sub    $0x4,%esp
+    1e23:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1e26:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    1e2a:	6a 01                	push   $0x1
+    1e2c:	52                   	push   %edx
+    1e2d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1e30:	57                   	push   %edi
+    1e31:	e8 d8 fd ff ff       	call   1c0e <write>
+    1e36:	83 c4 0c             	add    $0xc,%esp
+    1e39:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1e3c:	6a 01                	push   $0x1
+    1e3e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1e41:	52                   	push   %edx
+    1e42:	57                   	push   %edi
+    1e43:	e8 c6 fd ff ff       	call   1c0e <write>
+        putc(fd, c);
+    1e48:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1e4b:	31 d2                	xor    %edx,%edx
+    1e4d:	eb 8e                	jmp    1ddd <printf+0x4d>
+    1e4f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1e50:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1e53:	83 ec 0c             	sub    $0xc,%esp
+    1e56:	b9 10 00 00 00       	mov    $0x10,%ecx
+    1e5b:	8b 13                	mov    (%ebx),%edx
+    1e5d:	6a 00                	push   $0x0
+    1e5f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1e61:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1e64:	e8 87 fe ff ff       	call   1cf0 <printint>
+        ap++;
+    1e69:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1e6c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1e6f:	31 d2                	xor    %edx,%edx
+    1e71:	e9 67 ff ff ff       	jmp    1ddd <printf+0x4d>
+    1e76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e7d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1e80:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1e83:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1e85:	83 c0 04             	add    $0x4,%eax
+    1e88:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    1e8b:	85 db                	test   %ebx,%ebx
+    1e8d:	0f 84 9d 00 00 00    	je     1f30 <printf+0x1a0>
+        while(*s != 0){
+    1e93:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1e96:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1e98:	84 c0                	test   %al,%al
+    1e9a:	0f 84 3d ff ff ff    	je     1ddd <printf+0x4d>
+    1ea0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1ea3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1ea6:	89 de                	mov    %ebx,%esi
+    1ea8:	89 d3                	mov    %edx,%ebx
+    1eaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1eb0:	83 ec 04             	sub    $0x4,%esp
+    1eb3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1eb6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1eb9:	6a 01                	push   $0x1
+    1ebb:	53                   	push   %ebx
+    1ebc:	57                   	push   %edi
+    1ebd:	e8 4c fd ff ff       	call   1c0e <write>
+        while(*s != 0){
+    1ec2:	0f b6 06             	movzbl (%esi),%eax
+    1ec5:	83 c4 10             	add    $0x10,%esp
+    1ec8:	84 c0                	test   %al,%al
+    1eca:	75 e4                	jne    1eb0 <printf+0x120>
+      state = 0;
+    1ecc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    1ecf:	31 d2                	xor    %edx,%edx
+    1ed1:	e9 07 ff ff ff       	jmp    1ddd <printf+0x4d>
+    1ed6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1edd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1ee0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1ee3:	83 ec 0c             	sub    $0xc,%esp
+    1ee6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    1eeb:	8b 13                	mov    (%ebx),%edx
+    1eed:	6a 01                	push   $0x1
+    1eef:	e9 6b ff ff ff       	jmp    1e5f <printf+0xcf>
+    1ef4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1ef8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    1efb:	83 ec 04             	sub    $0x4,%esp
+    1efe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1f01:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1f03:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1f06:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1f09:	6a 01                	push   $0x1
+    1f0b:	52                   	push   %edx
+    1f0c:	57                   	push   %edi
+    1f0d:	e8 fc fc ff ff       	call   1c0e <write>
+        ap++;
+    1f12:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1f15:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1f18:	31 d2                	xor    %edx,%edx
+    1f1a:	e9 be fe ff ff       	jmp    1ddd <printf+0x4d>
+    1f1f:	90                   	nop
+  write(fd, &c, 1);
+    1f20:	83 ec 04             	sub    $0x4,%esp
+    1f23:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1f26:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1f29:	6a 01                	push   $0x1
+    1f2b:	e9 11 ff ff ff       	jmp    1e41 <printf+0xb1>
+    1f30:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1f35:	bb a9 25 00 00       	mov    $0x25a9,%ebx
+    1f3a:	e9 61 ff ff ff       	jmp    1ea0 <printf+0x110>
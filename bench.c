@@ -0,0 +1,888 @@
+// Kernel benchmarks.  Run "bench" and compare the numbers
+// across make qemu CPUS=1, 2, 4 and 8.
+
+#include "param.h"
+#include "types.h"
+#include "user.h"
+#include "pstat.h"
+#include "fcntl.h"
+#include "iostat.h"
+
+char *echoargv[] = { "echo", "bench", 0 };
+int stdout = 1;
+
+#define NBENCHPROC 8
+
+// fork+sbrk throughput of NBENCHPROC processes running at once,
+// which mostly measures kalloc()/kfree() scalability.
+void
+forksbrkbench(void)
+{
+  int i, j, k, pid;
+  uint start;
+  char *a;
+
+  printf(stdout, "fork+sbrk bench\n");
+  start = uptime();
+  for(i = 0; i < NBENCHPROC; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      for(j = 0; j < 100; j++){
+        a = sbrk(16*4096);
+        if(a == (char*)0xffffffff){
+          printf(stdout, "sbrk failed\n");
+          exit();
+        }
+        for(k = 0; k < 16; k++)
+          a[k*4096] = k;
+        sbrk(-16*4096);
+        pid = fork();
+        if(pid == 0)
+          exit();
+        if(pid > 0)
+          wait();
+      }
+      exit();
+    }
+  }
+  for(i = 0; i < NBENCHPROC; i++)
+    wait();
+  printf(stdout, "fork+sbrk bench: %d ops in %d ticks\n",
+         NBENCHPROC*100, uptime() - start);
+}
+
+// fork+exec latency of a process with a large heap, the case
+// that copy-on-write fork makes cheap.  The child execs echo with
+// stdout closed, like sh does for every command.
+void
+forkexecbench(void)
+{
+  int i, pid;
+  uint start;
+  char *a, *oldbrk;
+
+  printf(stdout, "fork+exec bench\n");
+  oldbrk = sbrk(0);
+  a = sbrk(4*1024*1024);
+  if(a == (char*)0xffffffff){
+    printf(stdout, "sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < 4*1024*1024; i += 4096)
+    a[i] = 1;
+
+  start = uptime();
+  for(i = 0; i < 50; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      close(1);
+      exec("echo", echoargv);
+      exit();
+    }
+    wait();
+  }
+  printf(stdout, "fork+exec bench: 50 fork+exec of a 4MB process in %d ticks\n",
+         uptime() - start);
+  sbrk(-(sbrk(0) - oldbrk));
+}
+
+// fork+exec latency of a small process, with no heap for
+// copy-on-write to save copying.
+void
+smallexecbench(void)
+{
+  int i, pid;
+  uint start;
+
+  printf(stdout, "small fork+exec bench\n");
+  start = uptime();
+  for(i = 0; i < 100; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      close(1);
+      exec("echo", echoargv);
+      exit();
+    }
+    wait();
+  }
+  printf(stdout, "small fork+exec bench: 100 fork+exec in %d ticks\n",
+         uptime() - start);
+}
+
+// Cost of growing and shrinking a 64MB heap of which only one
+// page per megabyte is ever touched.
+void
+sparsesbrkbench(void)
+{
+  int i, j;
+  uint start;
+  char *a;
+
+  printf(stdout, "sparse sbrk bench\n");
+  start = uptime();
+  for(i = 0; i < 20; i++){
+    a = sbrk(64*1024*1024);
+    if(a == (char*)0xffffffff){
+      printf(stdout, "sbrk failed\n");
+      exit();
+    }
+    for(j = 0; j < 64; j++)
+      a[j*1024*1024] = j;
+    sbrk(-64*1024*1024);
+  }
+  printf(stdout, "sparse sbrk bench: 20 x 64MB sbrk in %d ticks\n",
+         uptime() - start);
+}
+
+// Context switch rate: two processes bounce one byte back and
+// forth over a pair of pipes, so every hop blocks one process and
+// wakes the other.  Most telling with CPUS=1.
+#define NSWITCH 10000
+
+// Run NSWITCH hops of ping-pong; return the ticks taken.
+int
+pingpong(char *name)
+{
+  int i, pid, ticks;
+  int ping[2], pong[2];
+  uint start;
+  char c;
+
+  if(pipe(ping) < 0 || pipe(pong) < 0){
+    printf(stdout, "pipe() failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    for(i = 0; i < NSWITCH/2; i++){
+      if(read(ping[0], &c, 1) != 1 || write(pong[1], &c, 1) != 1){
+        printf(stdout, "%s: child pipe failed\n", name);
+        exit();
+      }
+    }
+    exit();
+  }
+  start = uptime();
+  for(i = 0; i < NSWITCH/2; i++){
+    if(write(ping[1], "x", 1) != 1 || read(pong[0], &c, 1) != 1){
+      printf(stdout, "%s: pipe failed\n", name);
+      exit();
+    }
+  }
+  ticks = uptime() - start;
+  wait();
+  close(ping[0]);
+  close(ping[1]);
+  close(pong[0]);
+  close(pong[1]);
+  return ticks;
+}
+
+void
+printrate(char *name, int n, int ticks)
+{
+  printf(stdout, "%s: %d switches in %d ticks", name, n, ticks);
+  if(ticks > 0)
+    printf(stdout, ", %d per second", n * 100 / ticks);
+  printf(stdout, "\n");
+}
+
+void
+switchbench(void)
+{
+  printf(stdout, "switch bench\n");
+  printrate("switch bench", NSWITCH, pingpong("switch bench"));
+}
+
+// Cost of sleep and wakeup with many processes asleep: ping-pong
+// while NSLEEPER processes wait on a pipe of their own, then
+// NSLEEPER processes each doing 50 sleep(1)s at once, which
+// ideally takes 50 ticks.
+#define NSLEEPER 40
+
+void
+wakebench(void)
+{
+  int i, j, pid, fds[2], ticks;
+  uint start;
+  char c;
+
+  printf(stdout, "wake bench\n");
+  if(pipe(fds) < 0){
+    printf(stdout, "pipe() failed\n");
+    exit();
+  }
+  for(i = 0; i < NSLEEPER; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      close(fds[1]);
+      read(fds[0], &c, 1);
+      exit();
+    }
+  }
+  ticks = pingpong("wake bench");
+  close(fds[0]);
+  close(fds[1]);
+  for(i = 0; i < NSLEEPER; i++)
+    wait();
+  printrate("wake bench", NSWITCH, ticks);
+
+  start = uptime();
+  for(i = 0; i < NSLEEPER; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      for(j = 0; j < 50; j++)
+        sleep(1);
+      exit();
+    }
+  }
+  for(i = 0; i < NSLEEPER; i++)
+    wait();
+  printf(stdout, "wake bench: %d x 50 sleep(1) in %d ticks\n",
+         NSLEEPER, uptime() - start);
+}
+
+// Makespan of CPU-bound jobs of uneven length, NBURN at once.
+// When the short ones finish, the CPUs they ran on go idle unless
+// they take over jobs still queued elsewhere.
+#define NBURN 12
+
+void
+burnbench(void)
+{
+  int i, j, pid;
+  uint start;
+  volatile int x;
+
+  printf(stdout, "burn bench\n");
+  start = uptime();
+  for(i = 0; i < NBURN; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      x = 0;
+      for(j = 0; j < (i % 3 + 1) * 20000000; j++)
+        x++;
+      exit();
+    }
+  }
+  for(i = 0; i < NBURN; i++)
+    wait();
+  printf(stdout, "burn bench: %d jobs done in %d ticks\n",
+         NBURN, uptime() - start);
+}
+
+// How late a process that mostly sleeps, like sh, gets back to
+// the CPU: 50 sleep(1)s on an idle machine, then with NBENCHPROC
+// CPU-bound processes running, then with those moved to the
+// lowest priority level (3) by setpriority().
+int
+sleeploop(void)
+{
+  int i;
+  uint start;
+
+  start = uptime();
+  for(i = 0; i < 50; i++)
+    sleep(1);
+  return uptime() - start;
+}
+
+void
+latencybench(void)
+{
+  int i, idle, loaded, niced, pids[NBENCHPROC];
+
+  printf(stdout, "latency bench\n");
+  idle = sleeploop();
+  for(i = 0; i < NBENCHPROC; i++){
+    pids[i] = fork();
+    if(pids[i] < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pids[i] == 0)
+      for(;;)
+        ;
+  }
+  loaded = sleeploop();
+  for(i = 0; i < NBENCHPROC; i++)
+    if(setpriority(pids[i], 3) < 0){
+      printf(stdout, "setpriority failed\n");
+      exit();
+    }
+  niced = sleeploop();
+  for(i = 0; i < NBENCHPROC; i++){
+    kill(pids[i]);
+    wait();
+  }
+  printf(stdout, "latency bench: 50 sleep(1) in %d ticks idle, "
+         "%d loaded, %d with load niced\n", idle, loaded, niced);
+}
+
+// CPU shares under stride scheduling: three CPU-bound processes
+// holding 100, 200 and 300 tickets run for 500 ticks, and each
+// one's share of the ticks they used should be close to its share
+// of the tickets.  Run with CPUS=1, or each may get a CPU of its own.
+void
+stridebench(void)
+{
+  static struct pstat ps;
+  int i, j, tot, used[3], pids[3];
+
+  printf(stdout, "stride bench\n");
+  for(i = 0; i < 3; i++){
+    pids[i] = fork();
+    if(pids[i] < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pids[i] == 0){
+      if(settickets(100 * (i + 1)) < 0){
+        printf(stdout, "settickets failed\n");
+        exit();
+      }
+      for(;;)
+        ;
+    }
+  }
+  sleep(500);
+  if(getpinfo(&ps) < 0){
+    printf(stdout, "getpinfo failed\n");
+    exit();
+  }
+  tot = 0;
+  for(i = 0; i < 3; i++){
+    used[i] = 0;
+    for(j = 0; j < NPROC; j++)
+      if(ps.inuse[j] && ps.pid[j] == pids[i])
+        used[i] = ps.ticks[j];
+    tot += used[i];
+    kill(pids[i]);
+    wait();
+  }
+  if(tot == 0){
+    printf(stdout, "stride bench: no ticks used\n");
+    return;
+  }
+  // Shares in percent; tickets are 1/6, 2/6 and 3/6 of the total.
+  printf(stdout, "stride bench: shares %d%% %d%% %d%%, want 16%% 33%% 50%%",
+         used[0] * 100 / tot, used[1] * 100 / tot, used[2] * 100 / tot);
+  for(i = 0; i < 3; i++){
+    j = used[i] * 600 / tot - 100 * (i + 1);
+    if(j < -25 || j > 25)
+      break;
+  }
+  printf(stdout, i == 3 ? ", ok\n" : ", off\n");
+}
+
+// Resolution of nanosleep(): 100 sleeps of 1ms ideally take 100ms,
+// which is 10 ticks; rounded up to whole ticks they would take 100.
+void
+nanosleepbench(void)
+{
+  int i;
+  uint start;
+
+  printf(stdout, "nanosleep bench\n");
+  start = uptime();
+  for(i = 0; i < 100; i++){
+    if(nanosleep(1000000) < 0){
+      printf(stdout, "nanosleep failed\n");
+      exit();
+    }
+  }
+  printf(stdout, "nanosleep bench: 100 x 1ms in %d ticks, want 10\n",
+         uptime() - start);
+}
+
+// Scaling of threads: the same CPU-bound work done by one
+// thread and split over NTHREAD, which should take about
+// 1/NTHREAD the time given as many CPUS.
+#define NTHREAD 4
+#define THREADWORK 50000000
+
+void
+threadwork(void *arg)
+{
+  volatile uint i;
+
+  for(i = 0; i < (uint)arg; i++)
+    ;
+}
+
+void
+threadbench(void)
+{
+  int i, n;
+  uint start;
+
+  printf(stdout, "thread bench\n");
+  for(n = 1; n <= NTHREAD; n *= NTHREAD){
+    start = uptime();
+    for(i = 0; i < n; i++){
+      if(thread_create(threadwork, (void*)(THREADWORK / n)) < 0){
+        printf(stdout, "thread_create failed\n");
+        exit();
+      }
+    }
+    for(i = 0; i < n; i++)
+      thread_join();
+    printf(stdout, "thread bench: %d thread(s) in %d ticks\n",
+           n, uptime() - start);
+  }
+}
+
+// A contended lock: NLOCKER threads, more than there are CPUS,
+// each take it NLOCK times, first as a spin lock and then as a
+// mutex.  While the holder of the spin lock is preempted, the
+// others spin out their time slices; waiters for the mutex sleep.
+// Ends with a condition variable ping-pong between two threads.
+#define NLOCKER 8
+#define NLOCK 20000
+
+lock_t spin;
+mutex_t mutex;
+cond_t cond;
+int locked, turn;
+
+void
+spinner(void *arg)
+{
+  int i;
+
+  for(i = 0; i < NLOCK; i++){
+    lock_acquire(&spin);
+    locked++;
+    lock_release(&spin);
+  }
+}
+
+void
+mutexer(void *arg)
+{
+  int i;
+
+  for(i = 0; i < NLOCK; i++){
+    mutex_lock(&mutex);
+    locked++;
+    mutex_unlock(&mutex);
+  }
+}
+
+void
+ponger(void *arg)
+{
+  int i, me = (int)arg;
+
+  mutex_lock(&mutex);
+  for(i = 0; i < NSWITCH; i++){
+    while(turn != me)
+      cond_wait(&cond, &mutex);
+    turn = !me;
+    cond_broadcast(&cond);
+  }
+  mutex_unlock(&mutex);
+}
+
+void
+lockrun(char *name, void (*fn)(void*))
+{
+  int i;
+  uint start;
+
+  locked = 0;
+  start = uptime();
+  for(i = 0; i < NLOCKER; i++){
+    if(thread_create(fn, 0) < 0){
+      printf(stdout, "thread_create failed\n");
+      exit();
+    }
+  }
+  for(i = 0; i < NLOCKER; i++)
+    thread_join();
+  printf(stdout, "mutex bench: %d x %d %s in %d ticks%s\n", NLOCKER, NLOCK,
+         name, uptime() - start, locked == NLOCKER*NLOCK ? "" : ", wrong count");
+}
+
+void
+mutexbench(void)
+{
+  int i;
+  uint start;
+
+  printf(stdout, "mutex bench\n");
+  lock_init(&spin);
+  mutex_init(&mutex);
+  cond_init(&cond);
+  lockrun("spin lock", spinner);
+  lockrun("mutex", mutexer);
+
+  turn = 0;
+  start = uptime();
+  for(i = 0; i < 2; i++){
+    if(thread_create(ponger, (void*)i) < 0){
+      printf(stdout, "thread_create failed\n");
+      exit();
+    }
+  }
+  for(i = 0; i < 2; i++)
+    thread_join();
+  printrate("mutex bench: condvar", NSWITCH, uptime() - start);
+}
+
+// Cache-warm work with and without pinning: NBENCHPROC processes
+// each sweep a buffer of their own, first free to move between
+// CPUs and then each pinned to one by sched_setaffinity().
+#define SWEEPSIZE (32*1024)
+#define NSWEEP 2000
+
+int
+sweeprun(int pin)
+{
+  int i, j, k, pid, ncpus, mask;
+  uint start;
+  char *buf;
+
+  mask = sched_getaffinity(getpid());
+  for(ncpus = 0; mask >> ncpus; ncpus++)
+    ;
+  start = uptime();
+  for(i = 0; i < NBENCHPROC; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      if(pin && sched_setaffinity(getpid(), 1 << (i % ncpus)) < 0){
+        printf(stdout, "sched_setaffinity failed\n");
+        exit();
+      }
+      buf = sbrk(SWEEPSIZE);
+      for(j = 0; j < NSWEEP; j++)
+        for(k = 0; k < SWEEPSIZE; k += 64)
+          buf[k]++;
+      exit();
+    }
+  }
+  for(i = 0; i < NBENCHPROC; i++)
+    wait();
+  return uptime() - start;
+}
+
+void
+affinitybench(void)
+{
+  int free, pinned;
+
+  printf(stdout, "affinity bench\n");
+  free = sweeprun(0);
+  pinned = sweeprun(1);
+  printf(stdout, "affinity bench: %d ticks unpinned, %d pinned\n",
+         free, pinned);
+}
+
+// Cached file reads: NBENCHPROC processes each read the same
+// READBLOCKS-block file NREAD times.  Every block is in the
+// buffer cache, so this mostly measures bread()/brelse().
+#define READBLOCKS 20
+#define NREAD 100
+
+void
+readbench(void)
+{
+  static char buf[512];
+  int i, j, fd, pid;
+  uint start;
+
+  printf(stdout, "read bench\n");
+  if((fd = open("readbench", O_CREATE|O_RDWR)) < 0){
+    printf(stdout, "create failed\n");
+    exit();
+  }
+  for(i = 0; i < READBLOCKS; i++)
+    write(fd, buf, sizeof(buf));
+  close(fd);
+
+  start = uptime();
+  for(i = 0; i < NBENCHPROC; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      for(j = 0; j < NREAD; j++){
+        if((fd = open("readbench", O_RDONLY)) < 0){
+          printf(stdout, "open failed\n");
+          exit();
+        }
+        while(read(fd, buf, sizeof(buf)) > 0)
+          ;
+        close(fd);
+      }
+      exit();
+    }
+  }
+  for(i = 0; i < NBENCHPROC; i++)
+    wait();
+  printf(stdout, "read bench: %d blocks read in %d ticks\n",
+         NBENCHPROC * NREAD * READBLOCKS, uptime() - start);
+  unlink("readbench");
+}
+
+// Sequential read throughput: read a large file 512 bytes at a
+// time, twice.  Only the first pass after boot goes to the disk,
+// where read-ahead should keep it busy; the second is from the
+// buffer cache.
+#define SEQFILE "usertests"
+
+int
+seqread(void)
+{
+  static char buf[512];
+  int fd, n, tot;
+
+  if((fd = open(SEQFILE, O_RDONLY)) < 0){
+    printf(stdout, "open %s failed\n", SEQFILE);
+    exit();
+  }
+  tot = 0;
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+    tot += n;
+  close(fd);
+  return tot;
+}
+
+void
+seqreadbench(void)
+{
+  int i, n;
+  uint start, t;
+
+  printf(stdout, "seqread bench\n");
+  for(i = 0; i < 2; i++){
+    start = uptime();
+    n = seqread();
+    t = uptime() - start;
+    printf(stdout, "seqread bench: %s %d bytes in %d ticks, %d KB/s\n",
+           i == 0 ? "cold" : "cached", n, t, t ? n / 1024 * 100 / t : 0);
+  }
+}
+
+// Log commit latency: NCOMMIT synchronous 1536-byte writes, each
+// its own transaction of three data blocks plus the inode and
+// bitmap, committed before write() returns.
+#define NCOMMIT 200
+
+void
+commitbench(void)
+{
+  static char buf[1536];
+  int i, fd;
+  uint start, t;
+
+  printf(stdout, "commit bench\n");
+  if((fd = open("commitbench", O_CREATE|O_RDWR)) < 0){
+    printf(stdout, "create failed\n");
+    exit();
+  }
+  start = uptime();
+  for(i = 0; i < NCOMMIT; i++){
+    if(i % 16 == 0){
+      close(fd);
+      unlink("commitbench");
+      fd = open("commitbench", O_CREATE|O_RDWR);
+    }
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+      printf(stdout, "write failed\n");
+      exit();
+    }
+  }
+  t = uptime() - start;
+  close(fd);
+  unlink("commitbench");
+  printf(stdout, "commit bench: %d committed writes in %d ticks\n", NCOMMIT, t);
+}
+
+// Disk throughput for sequential writes: one process writes a
+// SEQIOBLOCKS-block file 1536 bytes (one transaction) at a time.
+// Each commit writes the log and then the blocks' homes, runs of
+// adjacent blocks the disk scheduler can merge.
+#define SEQIOBLOCKS 120
+
+void
+seqiobench(void)
+{
+  static char buf[1536];
+  int i, fd, kb;
+  uint start, t;
+
+  printf(stdout, "seqio bench\n");
+  if((fd = open("seqiobench", O_CREATE|O_RDWR)) < 0){
+    printf(stdout, "create failed\n");
+    exit();
+  }
+  start = uptime();
+  for(i = 0; i < SEQIOBLOCKS / 3; i++){
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+      printf(stdout, "write failed\n");
+      exit();
+    }
+  }
+  t = uptime() - start;
+  close(fd);
+  unlink("seqiobench");
+  if(t == 0)
+    t = 1;
+  kb = SEQIOBLOCKS * 512 / 1024 * 100 / t;
+  printf(stdout, "seqio bench: %d blocks in %d ticks, %d.%d MB/s\n",
+         SEQIOBLOCKS, t, kb / 1024, kb % 1024 * 10 / 1024);
+}
+
+// Disk operations per second for scattered writes: NBENCHPROC
+// processes each overwrite the first block of one of their
+// NRANDFILE files, picked at random, NRANDIO times.  Commits
+// gather blocks from all over the disk for the elevator to sort.
+#define NRANDFILE 4
+#define NRANDIO 50
+
+void
+randiobench(void)
+{
+  static char buf[512];
+  static char name[] = "randio00";
+  int i, j, fd, pid;
+  uint start, t, seed;
+
+  printf(stdout, "randio bench\n");
+  for(i = 0; i < NBENCHPROC; i++){
+    for(j = 0; j < NRANDFILE; j++){
+      name[6] = '0' + i;
+      name[7] = '0' + j;
+      if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+        printf(stdout, "create failed\n");
+        exit();
+      }
+      write(fd, buf, sizeof(buf));
+      close(fd);
+    }
+  }
+
+  start = uptime();
+  for(i = 0; i < NBENCHPROC; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      seed = i + 1;
+      for(j = 0; j < NRANDIO; j++){
+        seed = seed * 1103515245 + 12345;
+        name[6] = '0' + i;
+        name[7] = '0' + (seed >> 16) % NRANDFILE;
+        if((fd = open(name, O_RDWR)) < 0 ||
+           write(fd, buf, sizeof(buf)) != sizeof(buf)){
+          printf(stdout, "write failed\n");
+          exit();
+        }
+        close(fd);
+      }
+      exit();
+    }
+  }
+  for(i = 0; i < NBENCHPROC; i++)
+    wait();
+  t = uptime() - start;
+  if(t == 0)
+    t = 1;
+  printf(stdout, "randio bench: %d writes in %d ticks, %d IOPS\n",
+         NBENCHPROC * NRANDIO, t, NBENCHPROC * NRANDIO * 100 / t);
+
+  for(i = 0; i < NBENCHPROC; i++){
+    for(j = 0; j < NRANDFILE; j++){
+      name[6] = '0' + i;
+      name[7] = '0' + j;
+      unlink(name);
+    }
+  }
+}
+
+// CPU time the disk driver spends per MB moved, from iostat()
+// around the sequential write of seqiobench().  With bus-master
+// DMA it should be a small fraction of what PIO takes.
+void
+diskcpubench(void)
+{
+  struct iostat s0, s1;
+  uint nblock, ncmd, ndma, kc;
+
+  printf(stdout, "diskcpu bench\n");
+  if(iostat(&s0) < 0){
+    printf(stdout, "iostat failed\n");
+    exit();
+  }
+  seqiobench();
+  iostat(&s1);
+  nblock = (s1.nread - s0.nread) + (s1.nwrite - s0.nwrite);
+  ncmd = s1.ncmd - s0.ncmd;
+  ndma = s1.ndma - s0.ndma;
+  kc = s1.kcycles - s0.kcycles;
+  printf(stdout, "diskcpu bench: %d blocks in %d commands (%d DMA), "
+         "%d Kcycles/MB\n", nblock, ncmd, ndma,
+         nblock ? kc * 64 / nblock * 32 : 0);
+}
+
+int
+main(void)
+{
+  forksbrkbench();
+  forkexecbench();
+  smallexecbench();
+  sparsesbrkbench();
+  switchbench();
+  wakebench();
+  burnbench();
+  latencybench();
+  stridebench();
+  nanosleepbench();
+  threadbench();
+  mutexbench();
+  affinitybench();
+  readbench();
+  seqreadbench();
+  commitbench();
+  seqiobench();
+  randiobench();
+  diskcpubench();
+  exit();
+}
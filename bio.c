@@ -1,6 +1,6 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
@@ -17,79 +17,217 @@
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+//
+// Buffers are hashed by (dev, blockno) into NBHASH buckets, each
+// with its own lock, which protects the chain and the refcnt of
+// every buffer on it.  Unused buffers (refcnt 0) are also on an
+// LRU list under bcache.lock, taken after a bucket lock, from
+// which a miss recycles the least recently used one.  Misses
+// hold bcache.evict while they do, so that only one CPU at a
+// time holds two bucket locks.
+//
+// binit() runs once memory is free and gives the cache
+// 1/BUFFRAC of it, but no fewer than NBUF buffers.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "buddy.h"
 
-struct {
+#define NBHASH  128   // hash buckets
+#define BUFFRAC 64    // share of free memory for the cache
+
+struct bucket {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct buf *head;
+};
 
-  // Linked list of all buffers, through prev/next.
+struct {
+  struct spinlock lock;   // LRU list
+  struct spinlock evict;  // held by a miss while it recycles
+  struct buf *buf;
+  int nbuf;
+
+  // Linked list of unused buffers, through prev/next.
   // head.next is most recently used.
   struct buf head;
+
+  struct bucket hash[NBHASH];
 } bcache;
 
+#define BHASH(dev, blockno) (&bcache.hash[((dev) * 31 + (blockno)) % NBHASH])
+
+// Take b off the LRU list.  Caller holds bcache.lock.
+static void
+lrudel(struct buf *b)
+{
+  b->next->prev = b->prev;
+  b->prev->next = b->next;
+}
+
+// Put b at the most recently used end.  Caller holds bcache.lock.
+static void
+lruput(struct buf *b)
+{
+  b->next = bcache.head.next;
+  b->prev = &bcache.head;
+  bcache.head.next->prev = b;
+  bcache.head.next = b;
+}
+
 void
 binit(void)
 {
   struct buf *b;
+  struct bucket *bk;
+  uint n;
 
   initlock(&bcache.lock, "bcache");
+  initlock(&bcache.evict, "bcache.evict");
+  for(bk = bcache.hash; bk < &bcache.hash[NBHASH]; bk++)
+    initlock(&bk->lock, "bcache.bucket");
+
+  n = buddy_nfree() / BUFFRAC * PGSIZE / sizeof(struct buf);
+  if(n > (PGSIZE << (MAX_ORDER-1)) / sizeof(struct buf))
+    n = (PGSIZE << (MAX_ORDER-1)) / sizeof(struct buf);
+  if(n < NBUF)
+    n = NBUF;
+  if((bcache.buf = buddy_alloc(n * sizeof(struct buf))) == 0)
+    panic("binit");
+  bcache.nbuf = n;
+  cprintf("bcache: %d buffers\n", n);
 
 //PAGEBREAK!
-  // Create linked list of buffers
+  // Every buffer starts unused, holding a distinct block of
+  // device 0 that is not yet valid.
   bcache.head.prev = &bcache.head;
   bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
+  for(b = bcache.buf; b < bcache.buf+n; b++){
+    b->dev = 0;
+    b->blockno = b - bcache.buf;
+    b->flags = 0;
+    b->refcnt = 0;
+    b->done = 0;
     initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    bk = BHASH(b->dev, b->blockno);
+    b->hnext = bk->head;
+    bk->head = b;
+    lruput(b);
+  }
+}
+
+// The buffer for block on device dev in bk, or 0.
+// Caller holds bk->lock.
+static struct buf*
+blookup(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bk->head; b; b = b->hnext)
+    if(b->dev == dev && b->blockno == blockno)
+      return b;
+  return 0;
+}
+
+// Take a reference to b.  Caller holds the lock of b's bucket.
+static void
+bref(struct buf *b)
+{
+  if(b->refcnt++ == 0){
+    acquire(&bcache.lock);
+    lrudel(b);
+    release(&bcache.lock);
   }
 }
 
 // Look through buffer cache for block on device dev.
 // If not found, allocate a buffer.
 // In either case, return locked buffer.
+// For read-ahead, return 0 instead if the block is
+// already cached or no buffer is free.
 static struct buf*
-bget(uint dev, uint blockno)
+bget(uint dev, uint blockno, int ahead)
 {
-  struct buf *b;
-
-  acquire(&bcache.lock);
+  struct bucket *bk, *from;
+  struct buf *b, **pp;
 
-  // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
-    if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+  bk = BHASH(dev, blockno);
+  acquire(&bk->lock);
+  if((b = blookup(bk, dev, blockno)) != 0){
+    if(ahead){
+      release(&bk->lock);
+      return 0;
     }
+    bref(b);
+    release(&bk->lock);
+    acquiresleep(&b->lock);
+    return b;
   }
+  release(&bk->lock);
 
-  // Not cached; recycle an unused buffer.
-  // Even if refcnt==0, B_DIRTY indicates a buffer is in use
-  // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+  // Not cached; recycle an unused buffer.  Look again once we
+  // are the only one recycling: another miss may have just
+  // brought the block in.
+  acquire(&bcache.evict);
+  acquire(&bk->lock);
+  if((b = blookup(bk, dev, blockno)) != 0){
+    if(ahead)
+      b = 0;
+    else
+      bref(b);
+    goto out;
+  }
+  for(;;){
+    // Even if refcnt==0, B_DIRTY indicates a buffer is in use
+    // because log.c has modified it but not yet committed it.
+    acquire(&bcache.lock);
+    for(b = bcache.head.prev; b != &bcache.head; b = b->prev)
+      if((b->flags & B_DIRTY) == 0)
+        break;
+    release(&bcache.lock);
+    if(b == &bcache.head){
+      if(!ahead)
+        panic("bget: no buffers");
+      b = 0;
+      goto out;
     }
+
+    // b may be taken by a hit in its bucket until we lock it.
+    from = BHASH(b->dev, b->blockno);
+    if(from != bk)
+      acquire(&from->lock);
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0)
+      break;
+    if(from != bk)
+      release(&from->lock);
   }
-  panic("bget: no buffers");
+  acquire(&bcache.lock);
+  lrudel(b);
+  release(&bcache.lock);
+  for(pp = &from->head; *pp != b; pp = &(*pp)->hnext)
+    ;
+  *pp = b->hnext;
+  if(from != bk)
+    release(&from->lock);
+
+  b->dev = dev;
+  b->blockno = blockno;
+  b->flags = 0;
+  b->refcnt = 1;
+  b->hnext = bk->head;
+  bk->head = b;
+
+out:
+  release(&bk->lock);
+  release(&bcache.evict);
+  if(b)
+    acquiresleep(&b->lock);
+  return b;
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -98,13 +236,73 @@ bread(uint dev, uint blockno)
 {
   struct buf *b;
 
-  b = bget(dev, blockno);
+  b = bget(dev, blockno, 0);
   if((b->flags & B_VALID) == 0) {
     iderw(b);
   }
   return b;
 }
 
+// Return a locked buf for the indicated block without reading
+// it, for a caller about to overwrite all of it.  The caller
+// fills b->data and sets B_VALID, and B_DIRTY to write it.
+struct buf*
+bblank(uint dev, uint blockno)
+{
+  return bget(dev, blockno, 0);
+}
+
+// Start reading the indicated block into the cache, unless it
+// is there already, and return without waiting.  The buffer
+// stays locked until the read is done, when bdone() releases
+// it; a bread() of the block meanwhile waits for it.
+void
+breadahead(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  if((b = bget(dev, blockno, 1)) == 0)
+    return;
+  bsubmit(b, bdone);
+}
+
+// Start disk I/O on a locked buffer and return without waiting:
+// write it if B_DIRTY is set, else read it unless B_VALID is.
+// If done is not 0, ideintr() calls done(b) when the I/O
+// finishes, from whatever process it interrupts.  Otherwise
+// the caller finds out with bpoll() or bwait().  Submitting
+// several buffers before waiting on any lets the disk queue
+// them all.
+void
+bsubmit(struct buf *b, void (*done)(struct buf*))
+{
+  if(!holdingsleep(&b->lock))
+    panic("bsubmit");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID){
+    if(done)
+      done(b);
+    return;
+  }
+  b->done = done;
+  idesubmit(b);
+}
+
+// Has the I/O bsubmit() started on b finished?
+int
+bpoll(struct buf *b)
+{
+  return (b->flags & (B_VALID|B_DIRTY)) == B_VALID;
+}
+
+// Wait for the I/O bsubmit() started on b to finish.
+void
+bwait(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("bwait");
+  ideiowait(b);
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
@@ -116,28 +314,35 @@ bwrite(struct buf *b)
 }
 
 // Release a locked buffer.
-// Move to the head of the MRU list.
+// Once unused, move to the head of the MRU list.
 void
 brelse(struct buf *b)
 {
   if(!holdingsleep(&b->lock))
     panic("brelse");
+  bdone(b);
+}
+
+// Release b for whoever locked it.  Called by brelse(), and
+// as the bsubmit() callback of a read-ahead, which may run in
+// any process or none.
+void
+bdone(struct buf *b)
+{
+  struct bucket *bk;
 
   releasesleep(&b->lock);
 
-  acquire(&bcache.lock);
+  bk = BHASH(b->dev, b->blockno);
+  acquire(&bk->lock);
   b->refcnt--;
   if (b->refcnt == 0) {
     // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    acquire(&bcache.lock);
+    lruput(b);
+    release(&bcache.lock);
   }
-  
-  release(&bcache.lock);
+  release(&bk->lock);
 }
 //PAGEBREAK!
 // Blank page.
@@ -1,23 +1,70 @@
-#include "defs.h"
+// Buddy allocator for physical memory.  Manages every page from
+// the end of the kernel up to PHYSTOP in power-of-two blocks of
+// 2^order pages, order 0 (4KB) through MAX_ORDER-1 (4MB).
+// A block of order k at physical address pa is always aligned
+// to PGSIZE << k, so its buddy is at pa ^ (PGSIZE << k) and
+// split/coalesce each take O(MAX_ORDER) steps.
+//
+// kalloc() and kfree() in kalloc.c are thin wrappers around
+// buddy_alloc(PGSIZE) and buddy_free(v, PGSIZE).
+
 #include "types.h"
+#include "defs.h"
 #include "param.h"
 #include "memlayout.h"
+#include "mmu.h"
 #include "buddy.h"
-#include <stddef.h>
+
+#define NPAGES (PHYSTOP >> PGSHIFT)
+
+#define PG_FREE 0x1  // page is the head of a block on a free list
+
+// Per-page metadata, indexed by physical page number.
+// Only meaningful for the first page of a block.
+struct page {
+    uchar order;  // order of the block starting at this page
+    uchar flags;  // PG_FREE
+};
 
 struct free_area free_areas[MAX_ORDER];  // Define here
 struct spinlock buddy_lock;              // Define here
+int buddy_use_lock;                      // Set by kinit2()
+static struct page pages[NPAGES];
+
+static struct page *
+virt_to_page(void *v)
+{
+    uint pa = V2P(v);
+
+    if (pa >= PHYSTOP)
+        panic("virt_to_page");
+    return &pages[pa >> PGSHIFT];
+}
 
 void buddyinit(void) {
     initlock(&buddy_lock, "buddy_lock");
+    buddy_use_lock = 0;
     for (int i = 0; i < MAX_ORDER; i++) {
         INIT_LIST_HEAD(&free_areas[i].free_list);
+        free_areas[i].nr_free = 0;
     }
 }
 
 void add_free_block(struct free_block *block, int order) {
-    struct list_head *head = &free_areas[order].free_list;
-    list_add(&block->list, head);
+    struct page *pg = virt_to_page(block);
+
+    pg->order = order;
+    pg->flags |= PG_FREE;
+    list_add(&block->list, &free_areas[order].free_list);
+    free_areas[order].nr_free++;
+}
+
+static void del_free_block(struct free_block *block, int order) {
+    struct page *pg = virt_to_page(block);
+
+    pg->flags &= ~PG_FREE;
+    list_del(&block->list);
+    free_areas[order].nr_free--;
 }
 
 struct free_block *remove_free_block(int order) {
@@ -27,79 +74,191 @@ struct free_block *remove_free_block(int order) {
         return NULL;  // No free block available
     }
 
-    struct list_head *entry = head->next;
-    list_del(entry);
+    struct free_block *block = list_first_entry(head, struct free_block, list);
+    del_free_block(block, order);
+    return block;
+}
 
-    // Cast back to the free_block structure
-    return (struct free_block *)((char *)entry - offsetof(struct free_block, list));
+// Smallest order whose block holds size bytes.
+static int get_order(uint size) {
+    int order = 0;
+
+    while ((PGSIZE << order) < size && order < MAX_ORDER)
+        order++;
+    return order;
 }
 
-void *buddy_alloc(uint64_t size) {
-     if (size > (1 << (MAX_ORDER - 1))) {  // If size exceeds maximum buddy block size
-        return kalloc();                 // Fall back to kalloc
-     }
-    int order = get_order(size);
-    if (order >= MAX_ORDER)
-        return NULL;
+// block is being split from order+1 down to order:
+// its upper half becomes a free block of the given order.
+static void split_block(struct free_block *block, int order) {
+    struct free_block *upper = (struct free_block *)((char *)block + (PGSIZE << order));
+    add_free_block(upper, order);
+}
+
+static struct free_block *find_buddy(struct free_block *block, int order) {
+    return (struct free_block *)P2V(V2P(block) ^ (PGSIZE << order));
+}
 
-    spin_lock(&buddy_lock);
+// The buddy can only be merged if it is the head of a free
+// block of exactly the same order.
+static int is_buddy_free(struct free_block *buddy, int order) {
+    struct page *pg;
 
+    if (V2P(buddy) >= PHYSTOP)
+        return 0;
+    pg = virt_to_page(buddy);
+    return (pg->flags & PG_FREE) && pg->order == order;
+}
+
+// Buddies merge into the block starting at the lower address.
+static struct free_block *merge_blocks(struct free_block *block, struct free_block *buddy) {
+    return block < buddy ? block : buddy;
+}
+
+// Take a block of the given order off the free lists,
+// splitting a larger block if needed.  Caller holds buddy_lock.
+static void *buddy_alloc_order(int order) {
     // Find the smallest free block that can accommodate the size
     for (int i = order; i < MAX_ORDER; i++) {
-        if (!list_empty(&free_areas[i].free_list)) {
-            struct free_block *block = list_first_entry(&free_areas[i].free_list, struct free_block, list);
-            list_del(&block->list);
-
-            // Split blocks if needed
-            while (i > order) {
-                i--;
-                split_block(block, i);
-            }
-
-            spin_unlock(&buddy_lock);
-            return (void *)block;
+        struct free_block *block = remove_free_block(i);
+        if (block == NULL)
+            continue;
+
+        // Split blocks if needed
+        while (i > order) {
+            i--;
+            split_block(block, i);
         }
+        virt_to_page(block)->order = order;
+        return (void *)block;
     }
-
-    spin_unlock(&buddy_lock);
     return NULL;  // No suitable block found
 }
 
-void buddy_free(void *addr, uint64_t size) {
-    int order = get_order(size);
+// Return a block to the free lists, coalescing with its buddy
+// as far as possible.  Caller holds buddy_lock.
+static void buddy_free_order(void *addr, int order) {
     struct free_block *block = (struct free_block *)addr;
 
-    spin_lock(&buddy_lock);
+    if ((uint)addr % (PGSIZE << order) || order >= MAX_ORDER)
+        panic("buddy_free: bad block");
+    if (virt_to_page(block)->flags & PG_FREE)
+        panic("buddy_free: double free");
 
     while (order < MAX_ORDER - 1) {
         struct free_block *buddy = find_buddy(block, order);
 
-        if (!is_buddy_free(buddy)) {
+        if (!is_buddy_free(buddy, order)) {
             break;
         }
 
         // Remove buddy from the free list and merge
-        list_del(&buddy->list);
+        del_free_block(buddy, order);
         block = merge_blocks(block, buddy);
         order++;
     }
 
-    list_add(&block->list, &free_areas[order].free_list);
+    add_free_block(block, order);
+}
+
+void *buddy_alloc(uint size) {
+    int order = get_order(size);
+    void *block;
+
+    if (order >= MAX_ORDER)
+        return NULL;
+
+    if (buddy_use_lock)
+        acquire(&buddy_lock);
+    block = buddy_alloc_order(order);
+    if (buddy_use_lock)
+        release(&buddy_lock);
+    return block;
+}
+
+void buddy_free(void *addr, uint size) {
+    if (buddy_use_lock)
+        acquire(&buddy_lock);
+    buddy_free_order(addr, get_order(size));
+    if (buddy_use_lock)
+        release(&buddy_lock);
+}
+
+// Allocate up to n blocks of size bytes into v[] under a single
+// acquisition of buddy_lock.  Returns the number allocated.
+int buddy_alloc_bulk(uint size, void **v, int n) {
+    int order = get_order(size);
+    int i;
+
+    if (order >= MAX_ORDER)
+        return 0;
 
-    spin_unlock(&buddy_lock);
+    if (buddy_use_lock)
+        acquire(&buddy_lock);
+    for (i = 0; i < n; i++) {
+        if ((v[i] = buddy_alloc_order(order)) == NULL)
+            break;
+    }
+    if (buddy_use_lock)
+        release(&buddy_lock);
+    return i;
 }
 
+// Free n blocks of size bytes under a single acquisition of buddy_lock.
+void buddy_free_bulk(void **v, uint size, int n) {
+    int order = get_order(size);
+
+    if (buddy_use_lock)
+        acquire(&buddy_lock);
+    for (int i = 0; i < n; i++)
+        buddy_free_order(v[i], order);
+    if (buddy_use_lock)
+        release(&buddy_lock);
+}
 
 void buddy_print(void){
+    uint total = 0;
+
     cprintf("Buddy Allocator Structure:\n");
 
     for (int order = 0; order < MAX_ORDER; order++) {
-        cprintf("Order %d (Block size: %d bytes):\n", order, 1 << (order + MIN_BLOCK_ORDER));
+        cprintf("Order %d (Block size: %d bytes): %d free\n",
+                order, PGSIZE << order, free_areas[order].nr_free);
+        total += free_areas[order].nr_free << order;
+    }
+    cprintf("Total free: %d pages\n", total);
+}
 
-        struct list_head *pos;
-        list_for_each(pos, &free_areas[order].free_list) {
-            struct free_block *block = list_entry(pos, struct free_block, list);
-            cprintf("  Free block: Address = %p, Size = %d bytes\n", block, block->size);
-        }
+// Number of free pages in the buddy pool.
+uint buddy_nfree(void) {
+    uint total = 0;
+
+    acquire(&buddy_lock);
+    for (int order = 0; order < MAX_ORDER; order++)
+        total += free_areas[order].nr_free << order;
+    release(&buddy_lock);
+    return total;
+}
+
+// Boot-time sanity check, run by main() once all memory has
+// been handed to the allocator: every order must hand out a
+// correctly aligned block, and freeing everything must coalesce
+// back to the same number of free pages.
+void buddy_test(void) {
+    void *blocks[MAX_ORDER];
+    uint before = buddy_nfree();
+
+    for (int order = 0; order < MAX_ORDER; order++) {
+        blocks[order] = buddy_alloc(PGSIZE << order);
+        if (blocks[order] == NULL)
+            panic("buddy_test: alloc");
+        if (V2P(blocks[order]) % (PGSIZE << order))
+            panic("buddy_test: alignment");
     }
-}
\ No newline at end of file
+    if (buddy_nfree() != before - ((1 << MAX_ORDER) - 1))
+        panic("buddy_test: accounting");
+    for (int order = MAX_ORDER - 1; order >= 0; order--)
+        buddy_free(blocks[order], PGSIZE << order);
+    if (buddy_nfree() != before)
+        panic("buddy_test: coalesce");
+}
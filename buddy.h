@@ -4,34 +4,39 @@
 #include "types.h"
 #include "spinlock.h"
 #include "list.h"
-#include <stdint.h>
+#include <stddef.h>
 
-#define MAX_ORDER 11 // Maximum block size = 2^(MAX_ORDER-1)
-#define MIN_BLOCK_ORDER 5  // Smallest block size is 32 bytes (2^5 = 32)
+#define MAX_ORDER 11 // Largest block = PGSIZE << (MAX_ORDER-1) = 4MB
+#define MIN_BLOCK_ORDER 12  // Smallest block is one page (2^12 = 4096)
 
+// A free block of 2^order pages.  The list node lives in the
+// first page of the block itself; the order lives in pages[].
 struct free_block {
     struct list_head list;  // Linked list node
-    uint64_t size;          // Size of the block
-    uint64_t magic;         // Magic number for validity check
 };
 
 struct free_area {
     struct list_head free_list;  // Free list for this size
+    uint nr_free;                // Number of blocks on free_list
 };
 
 extern struct free_area free_areas[MAX_ORDER];
 
-extern struct spinlick buddy_lock;
+extern struct spinlock buddy_lock;
+extern int buddy_use_lock;
 
 #define list_first_entry(ptr, type, member) \
     ((type *)((char *)(ptr)->next - offsetof(type, member)))
 
 void buddyinit(void);
-void *buddy_alloc(uint64_t size);
-void buddy_free(void *addr, uint64_t size);
+void *buddy_alloc(uint size);
+void buddy_free(void *addr, uint size);
+int buddy_alloc_bulk(uint size, void **v, int n);
+void buddy_free_bulk(void **v, uint size, int n);
 void buddy_print(void);
+uint buddy_nfree(void);
 void buddy_test(void);
 
 
 
-#endif
\ No newline at end of file
+#endif
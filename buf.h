@@ -4,9 +4,11 @@ struct buf {
   uint blockno;
   struct sleeplock lock;
   uint refcnt;
-  struct buf *prev; // LRU cache list
+  struct buf *prev; // LRU list of unused buffers
   struct buf *next;
+  struct buf *hnext; // hash chain
   struct buf *qnext; // disk queue
+  void (*done)(struct buf*); // called when disk I/O finishes; see bsubmit()
   uchar data[BSIZE];
 };
 #define B_VALID 0x2  // buffer has been read from disk
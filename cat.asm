@@ -0,0 +1,660 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 26                	jg     4f <main+0x4f>
+  29:	eb 52                	jmp    7d <main+0x7d>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  30:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+  33:	83 c6 01             	add    $0x1,%esi
+  36:	83 c3 04             	add    $0x4,%ebx
+    cat(fd);
+  39:	50                   	push   %eax
+  3a:	e8 51 00 00 00       	call   90 <cat>
+    close(fd);
+  3f:	89 3c 24             	mov    %edi,(%esp)
+  42:	e8 ec 00 00 00       	call   133 <close>
+  for(i = 1; i < argc; i++){
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4d:	74 29                	je     78 <main+0x78>
+    if((fd = open(argv[i], 0)) < 0){
+  4f:	83 ec 08             	sub    $0x8,%esp
+  52:	6a 00                	push   $0x0
+  54:	ff 33                	push   (%ebx)
+  56:	e8 f0 00 00 00       	call   14b <open>
+  5b:	83 c4 10             	add    $0x10,%esp
+  5e:	89 c7                	mov    %eax,%edi
+  60:	85 c0                	test   %eax,%eax
+  62:	79 cc                	jns    30 <main+0x30>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  64:	50                   	push   %eax
+  65:	ff 33                	push   (%ebx)
+  67:	68 83 04 00 00       	push   $0x483
+  6c:	6a 01                	push   $0x1
+  6e:	e8 3d 02 00 00       	call   2b0 <printf>
+      exit();
+  73:	e8 93 00 00 00       	call   10b <exit>
+  }
+  exit();
+  78:	e8 8e 00 00 00       	call   10b <exit>
+    cat(0);
+  7d:	83 ec 0c             	sub    $0xc,%esp
+  80:	6a 00                	push   $0x0
+  82:	e8 09 00 00 00       	call   90 <cat>
+    exit();
+  87:	e8 7f 00 00 00       	call   10b <exit>
+    *(char**)stack = freestacks;
+    freestacks = stack;
+    lock_release(&stacklock);
+  }
+  return pid;
+}
+  8c:	66 90                	xchg   %ax,%ax
+  8e:	66 90                	xchg   %ax,%ax
+
+00000090 <cat>:
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	56                   	push   %esi
+  94:	53                   	push   %ebx
+  95:	8b 75 08             	mov    0x8(%ebp),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  98:	eb 1d                	jmp    b7 <cat+0x27>
+  9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if (write(1, buf, n) != n) {
+  a0:	83 ec 04             	sub    $0x4,%esp
+  a3:	53                   	push   %ebx
+  a4:	68 00 06 00 00       	push   $0x600
+  a9:	6a 01                	push   $0x1
+  ab:	e8 7b 00 00 00       	call   12b <write>
+  b0:	83 c4 10             	add    $0x10,%esp
+  b3:	39 d8                	cmp    %ebx,%eax
+  b5:	75 25                	jne    dc <cat+0x4c>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  b7:	83 ec 04             	sub    $0x4,%esp
+  ba:	68 00 02 00 00       	push   $0x200
+  bf:	68 00 06 00 00       	push   $0x600
+  c4:	56                   	push   %esi
+  c5:	e8 59 00 00 00       	call   123 <read>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	89 c3                	mov    %eax,%ebx
+  cf:	85 c0                	test   %eax,%eax
+  d1:	7f cd                	jg     a0 <cat+0x10>
+  if(n < 0){
+  d3:	75 1b                	jne    f0 <cat+0x60>
+}
+  d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  d8:	5b                   	pop    %ebx
+  d9:	5e                   	pop    %esi
+  da:	5d                   	pop    %ebp
+  db:	c3                   	ret
+      printf(1, "cat: write error\n");
+  dc:	83 ec 08             	sub    $0x8,%esp
+  df:	68 60 04 00 00       	push   $0x460
+  e4:	6a 01                	push   $0x1
+  e6:	e8 c5 01 00 00       	call   2b0 <printf>
+      exit();
+  eb:	e8 1b 00 00 00       	call   10b <exit>
+    printf(1, "cat: read error\n");
+  f0:	50                   	push   %eax
+  f1:	50                   	push   %eax
+  f2:	68 72 04 00 00       	push   $0x472
+  f7:	6a 01                	push   $0x1
+  f9:	e8 b2 01 00 00       	call   2b0 <printf>
+    exit();
+  fe:	e8 08 00 00 00       	call   10b <exit>
+
+00000103 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 103:	b8 01 00 00 00       	mov    $0x1,%eax
+ 108:	cd 40                	int    $0x40
+ 10a:	c3                   	ret
+
+0000010b <exit>:
+SYSCALL(exit)
+ 10b:	b8 02 00 00 00       	mov    $0x2,%eax
+ 110:	cd 40                	int    $0x40
+ 112:	c3                   	ret
+
+00000113 <wait>:
+SYSCALL(wait)
+ 113:	b8 03 00 00 00       	mov    $0x3,%eax
+ 118:	cd 40                	int    $0x40
+ 11a:	c3                   	ret
+
+0000011b <pipe>:
+SYSCALL(pipe)
+ 11b:	b8 04 00 00 00       	mov    $0x4,%eax
+ 120:	cd 40                	int    $0x40
+ 122:	c3                   	ret
+
+00000123 <read>:
+SYSCALL(read)
+ 123:	b8 05 00 00 00       	mov    $0x5,%eax
+ 128:	cd 40                	int    $0x40
+ 12a:	c3                   	ret
+
+0000012b <write>:
+SYSCALL(write)
+ 12b:	b8 10 00 00 00       	mov    $0x10,%eax
+ 130:	cd 40                	int    $0x40
+ 132:	c3                   	ret
+
+00000133 <close>:
+SYSCALL(close)
+ 133:	b8 15 00 00 00       	mov    $0x15,%eax
+ 138:	cd 40                	int    $0x40
+ 13a:	c3                   	ret
+
+0000013b <kill>:
+SYSCALL(kill)
+ 13b:	b8 06 00 00 00       	mov    $0x6,%eax
+ 140:	cd 40                	int    $0x40
+ 142:	c3                   	ret
+
+00000143 <exec>:
+SYSCALL(exec)
+ 143:	b8 07 00 00 00       	mov    $0x7,%eax
+ 148:	cd 40                	int    $0x40
+ 14a:	c3                   	ret
+
+0000014b <open>:
+SYSCALL(open)
+ 14b:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 150:	cd 40                	int    $0x40
+ 152:	c3                   	ret
+
+00000153 <mknod>:
+SYSCALL(mknod)
+ 153:	b8 11 00 00 00       	mov    $0x11,%eax
+ 158:	cd 40                	int    $0x40
+ 15a:	c3                   	ret
+
+0000015b <unlink>:
+SYSCALL(unlink)
+ 15b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 160:	cd 40                	int    $0x40
+ 162:	c3                   	ret
+
+00000163 <fstat>:
+SYSCALL(fstat)
+ 163:	b8 08 00 00 00       	mov    $0x8,%eax
+ 168:	cd 40                	int    $0x40
+ 16a:	c3                   	ret
+
+0000016b <link>:
+SYSCALL(link)
+ 16b:	b8 13 00 00 00       	mov    $0x13,%eax
+ 170:	cd 40                	int    $0x40
+ 172:	c3                   	ret
+
+00000173 <mkdir>:
+SYSCALL(mkdir)
+ 173:	b8 14 00 00 00       	mov    $0x14,%eax
+ 178:	cd 40                	int    $0x40
+ 17a:	c3                   	ret
+
+0000017b <chdir>:
+SYSCALL(chdir)
+ 17b:	b8 09 00 00 00       	mov    $0x9,%eax
+ 180:	cd 40                	int    $0x40
+ 182:	c3                   	ret
+
+00000183 <dup>:
+SYSCALL(dup)
+ 183:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 188:	cd 40                	int    $0x40
+ 18a:	c3                   	ret
+
+0000018b <getpid>:
+SYSCALL(getpid)
+ 18b:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 190:	cd 40                	int    $0x40
+ 192:	c3                   	ret
+
+00000193 <sbrk>:
+SYSCALL(sbrk)
+ 193:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 198:	cd 40                	int    $0x40
+ 19a:	c3                   	ret
+
+0000019b <sleep>:
+SYSCALL(sleep)
+ 19b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 1a0:	cd 40                	int    $0x40
+ 1a2:	c3                   	ret
+
+000001a3 <uptime>:
+SYSCALL(uptime)
+ 1a3:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 1a8:	cd 40                	int    $0x40
+ 1aa:	c3                   	ret
+
+000001ab <setpriority>:
+SYSCALL(setpriority)
+ 1ab:	b8 16 00 00 00       	mov    $0x16,%eax
+ 1b0:	cd 40                	int    $0x40
+ 1b2:	c3                   	ret
+
+000001b3 <settickets>:
+SYSCALL(settickets)
+ 1b3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 1b8:	cd 40                	int    $0x40
+ 1ba:	c3                   	ret
+
+000001bb <getpinfo>:
+SYSCALL(getpinfo)
+ 1bb:	b8 18 00 00 00       	mov    $0x18,%eax
+ 1c0:	cd 40                	int    $0x40
+ 1c2:	c3                   	ret
+
+000001c3 <nanosleep>:
+SYSCALL(nanosleep)
+ 1c3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 1c8:	cd 40                	int    $0x40
+ 1ca:	c3                   	ret
+
+000001cb <clone>:
+SYSCALL(clone)
+ 1cb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 1d0:	cd 40                	int    $0x40
+ 1d2:	c3                   	ret
+
+000001d3 <join>:
+SYSCALL(join)
+ 1d3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 1d8:	cd 40                	int    $0x40
+ 1da:	c3                   	ret
+
+000001db <futex_wait>:
+SYSCALL(futex_wait)
+ 1db:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 1e0:	cd 40                	int    $0x40
+ 1e2:	c3                   	ret
+
+000001e3 <futex_wake>:
+SYSCALL(futex_wake)
+ 1e3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 1e8:	cd 40                	int    $0x40
+ 1ea:	c3                   	ret
+
+000001eb <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 1eb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 1f0:	cd 40                	int    $0x40
+ 1f2:	c3                   	ret
+
+000001f3 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 1f3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 1f8:	cd 40                	int    $0x40
+ 1fa:	c3                   	ret
+
+000001fb <iostat>:
+SYSCALL(iostat)
+ 1fb:	b8 20 00 00 00       	mov    $0x20,%eax
+ 200:	cd 40                	int    $0x40
+ 202:	c3                   	ret
+ 203:	66 90                	xchg   %ax,%ax
+ 205:	66 90                	xchg   %ax,%ax
+ 207:	66 90                	xchg   %ax,%ax
+ 209:	66 90                	xchg   %ax,%ax
+ 20b:	66 90                	xchg   %ax,%ax
+ 20d:	66 90                	xchg   %ax,%ax
+ 20f:	90                   	nop
+
+00000210 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	57                   	push   %edi
+ 214:	56                   	push   %esi
+ 215:	53                   	push   %ebx
+ 216:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 218:	89 d1                	mov    %edx,%ecx
+{
+ 21a:	83 ec 3c             	sub    $0x3c,%esp
+ 21d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 220:	85 d2                	test   %edx,%edx
+ 222:	0f 89 80 00 00 00    	jns    2a8 <printint+0x98>
+ 228:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 22c:	74 7a                	je     2a8 <printint+0x98>
+    x = -xx;
+ 22e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 230:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 235:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 238:	31 f6                	xor    %esi,%esi
+ 23a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 240:	89 c8                	mov    %ecx,%eax
+ 242:	31 d2                	xor    %edx,%edx
+ 244:	89 f7                	mov    %esi,%edi
+ 246:	f7 f3                	div    %ebx
+ 248:	8d 76 01             	lea    0x1(%esi),%esi
+ 24b:	0f b6 92 f8 04 00 00 	movzbl 0x4f8(%edx),%edx
+ 252:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 256:	89 ca                	mov    %ecx,%edx
+ 258:	89 c1                	mov    %eax,%ecx
+ 25a:	39 da                	cmp    %ebx,%edx
+ 25c:	73 e2                	jae    240 <printint+0x30>
+  if(neg)
+ 25e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 261:	85 c0                	test   %eax,%eax
+ 263:	74 07                	je     26c <printint+0x5c>
+    buf[i++] = '-';
+ 265:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 26a:	89 f7                	mov    %esi,%edi
+ 26c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 26f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 272:	01 df                	add    %ebx,%edi
+ 274:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 278:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 27b:	83 ec 04             	sub    $0x4,%esp
+ 27e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 281:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 284:	6a 01                	push   $0x1
+ 286:	50                   	push   %eax
+ 287:	56                   	push   %esi
+ 288:	e8 9e fe ff ff       	call   12b <write>
+  while(--i >= 0)
+ 28d:	89 f8                	mov    %edi,%eax
+ 28f:	83 c4 10             	add    $0x10,%esp
+ 292:	83 ef 01             	sub    $0x1,%edi
+ 295:	39 d8                	cmp    %ebx,%eax
+ 297:	75 df                	jne    278 <printint+0x68>
+}
+ 299:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 29c:	5b                   	pop    %ebx
+ 29d:	5e                   	pop    %esi
+ 29e:	5f                   	pop    %edi
+ 29f:	5d                   	pop    %ebp
+ 2a0:	c3                   	ret
+ 2a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 2a8:	31 c0                	xor    %eax,%eax
+ 2aa:	eb 89                	jmp    235 <printint+0x25>
+ 2ac:	66 90                	xchg   %ax,%ax
+ 2ae:	66 90                	xchg   %ax,%ax
+
+000002b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	57                   	push   %edi
+ 2b4:	56                   	push   %esi
+ 2b5:	53                   	push   %ebx
+ 2b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 2b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 2bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 2bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 2c2:	83 c6 01             	add    $0x1,%esi
+ 2c5:	84 db                	test   %bl,%bl
+ 2c7:	74 67                	je     330 <printf+0x80>
+ 2c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 2cc:	31 d2                	xor    %edx,%edx
+ 2ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 2d1:	eb 34                	jmp    307 <printf+0x57>
+ 2d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2d7:	90                   	nop
+ 2d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 2db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 2e0:	83 f8 25             	cmp    $0x25,%eax
+ 2e3:	74 18                	je     2fd <printf+0x4d>
+  write(fd, &c, 1);
+ 2e5:	83 ec 04             	sub    $0x4,%esp
+ 2e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 2eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 2ee:	6a 01                	push   $0x1
+ 2f0:	50                   	push   %eax
+ 2f1:	57                   	push   %edi
+ 2f2:	e8 34 fe ff ff       	call   12b <write>
+ 2f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 2fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 2fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 300:	83 c6 01             	add    $0x1,%esi
+ 303:	84 db                	test   %bl,%bl
+ 305:	74 29                	je     330 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 307:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 30a:	85 d2                	test   %edx,%edx
+ 30c:	74 ca                	je     2d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 30e:	83 fa 25             	cmp    $0x25,%edx
+ 311:	75 ea                	jne    2fd <printf+0x4d>
+      if(c == 'd'){
+ 313:	83 f8 25             	cmp    $0x25,%eax
+ 316:	0f 84 24 01 00 00    	je     440 <printf+0x190>
+ 31c:	83 e8 63             	sub    $0x63,%eax
+ 31f:	83 f8 15             	cmp    $0x15,%eax
+ 322:	77 1c                	ja     340 <printf+0x90>
+ 324:	ff 24 85 a0 04 00 00 	jmp    *0x4a0(,%eax,4)
+ 32b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 32f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 330:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 333:	5b                   	pop    %ebx
+ 334:	5e                   	pop    %esi
+ 335:	5f                   	pop    %edi
+ 336:	5d                   	pop    %ebp
+ 337:	c3                   	ret
+ 338:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33f:	90                   	nop
+  write(fd, &c, 1);
+ 340:	83 ec 04             	sub    $0x4,%esp
+ 343:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 346:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 34a:	6a 01                	push   $0x1
+ 34c:	52                   	push   %edx
+ 34d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 350:	57                   	push   %edi
+ 351:	e8 d5 fd ff ff       	call   12b <write>
+ 356:	83 c4 0c             	add    $0xc,%esp
+ 359:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 35c:	6a 01                	push   $0x1
+ 35e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 361:	52                   	push   %edx
+ 362:	57                   	push   %edi
+ 363:	e8 c3 fd ff ff       	call   12b <write>
+        putc(fd, c);
+ 368:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 36b:	31 d2                	xor    %edx,%edx
+ 36d:	eb 8e                	jmp    2fd <printf+0x4d>
+ 36f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 370:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 373:	83 ec 0c             	sub    $0xc,%esp
+ 376:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 37b:	8b 13                	mov    (%ebx),%edx
+ 37d:	6a 00                	push   $0x0
+ 37f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 381:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 384:	e8 87 fe ff ff       	call   210 <printint>
+        ap++;
+ 389:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 38c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 38f:	31 d2                	xor    %edx,%edx
+ 391:	e9 67 ff ff ff       	jmp    2fd <printf+0x4d>
+ 396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 3a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 3a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 3a5:	83 c0 04             	add    $0x4,%eax
+ 3a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 3ab:	85 db                	test   %ebx,%ebx
+ 3ad:	0f 84 9d 00 00 00    	je     450 <printf+0x1a0>
+        while(*s != 0){
+ 3b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 3b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 3b8:	84 c0                	test   %al,%al
+ 3ba:	0f 84 3d ff ff ff    	je     2fd <printf+0x4d>
+ 3c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 3c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 3c6:	89 de                	mov    %ebx,%esi
+ 3c8:	89 d3                	mov    %edx,%ebx
+ 3ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 3d0:	83 ec 04             	sub    $0x4,%esp
+ 3d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 3d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 3d9:	6a 01                	push   $0x1
+ 3db:	53                   	push   %ebx
+ 3dc:	57                   	push   %edi
+ 3dd:	e8 49 fd ff ff       	call   12b <write>
+        while(*s != 0){
+ 3e2:	0f b6 06             	movzbl (%esi),%eax
+ 3e5:	83 c4 10             	add    $0x10,%esp
+ 3e8:	84 c0                	test   %al,%al
+ 3ea:	75 e4                	jne    3d0 <printf+0x120>
+      state = 0;
+ 3ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 3ef:	31 d2                	xor    %edx,%edx
+ 3f1:	e9 07 ff ff ff       	jmp    2fd <printf+0x4d>
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 400:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 403:	83 ec 0c             	sub    $0xc,%esp
+ 406:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 40b:	8b 13                	mov    (%ebx),%edx
+ 40d:	6a 01                	push   $0x1
+ 40f:	e9 6b ff ff ff       	jmp    37f <printf+0xcf>
+ 414:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 418:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 41b:	83 ec 04             	sub    $0x4,%esp
+ 41e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 421:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 423:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 426:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 429:	6a 01                	push   $0x1
+ 42b:	52                   	push   %edx
+ 42c:	57                   	push   %edi
+ 42d:	e8 f9 fc ff ff       	call   12b <write>
+        ap++;
+ 432:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 435:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 438:	31 d2                	xor    %edx,%edx
+ 43a:	e9 be fe ff ff       	jmp    2fd <printf+0x4d>
+ 43f:	90                   	nop
+  write(fd, &c, 1);
+ 440:	83 ec 04             	sub    $0x4,%esp
+ 443:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 446:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 449:	6a 01                	push   $0x1
+ 44b:	e9 11 ff ff ff       	jmp    361 <printf+0xb1>
+ 450:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 455:	bb 98 04 00 00       	mov    $0x498,%ebx
+ 45a:	e9 61 ff ff ff       	jmp    3c0 <printf+0x110>
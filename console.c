@@ -179,6 +179,7 @@ consputc(int c)
 }
 
 #define INPUT_BUF 128
+#define CONSBUF   128  // bytes copied per acquire
 struct {
   char buf[INPUT_BUF];
   uint r;  // Read index
@@ -232,16 +233,28 @@ consoleintr(int (*getc)(void))
   }
 }
 
+// User memory is copied through buf on the kernel stack: the
+// kernel must not touch it, and maybe fault, holding cons.lock.
 int
 consoleread(struct inode *ip, char *dst, int n)
 {
+  char buf[CONSBUF];
   uint target;
-  int c;
+  int c, m;
 
   iunlock(ip);
   target = n;
+  m = 0;
   acquire(&cons.lock);
   while(n > 0){
+    if(m == CONSBUF){
+      // buf is full: copy it out without the lock.
+      release(&cons.lock);
+      memmove(dst, buf, m);
+      dst += m;
+      m = 0;
+      acquire(&cons.lock);
+    }
     while(input.r == input.w){
       if(myproc()->killed){
         release(&cons.lock);
@@ -259,12 +272,13 @@ consoleread(struct inode *ip, char *dst, int n)
       }
       break;
     }
-    *dst++ = c;
+    buf[m++] = c;
     --n;
     if(c == '\n')
       break;
   }
   release(&cons.lock);
+  memmove(dst, buf, m);
   ilock(ip);
 
   return target - n;
@@ -273,13 +287,18 @@ consoleread(struct inode *ip, char *dst, int n)
 int
 consolewrite(struct inode *ip, char *buf, int n)
 {
-  int i;
+  char kbuf[CONSBUF];
+  int i, j, m;
 
   iunlock(ip);
-  acquire(&cons.lock);
-  for(i = 0; i < n; i++)
-    consputc(buf[i] & 0xff);
-  release(&cons.lock);
+  for(i = 0; i < n; i += m){
+    m = n - i < CONSBUF ? n - i : CONSBUF;
+    memmove(kbuf, buf + i, m);
+    acquire(&cons.lock);
+    for(j = 0; j < m; j++)
+      consputc(kbuf[j] & 0xff);
+    release(&cons.lock);
+  }
   ilock(ip);
 
   return n;
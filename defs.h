@@ -2,17 +2,28 @@ struct buf;
 struct context;
 struct file;
 struct inode;
+struct kmem_cache;
 struct pipe;
 struct proc;
+struct iostat;
+struct pstat;
+struct pseg;
 struct rtcdate;
 struct spinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
+struct uvm;
 
 // bio.c
+struct buf*     bblank(uint, uint);
+void            bdone(struct buf*);
 void            binit(void);
 struct buf*     bread(uint, uint);
+void            breadahead(uint, uint);
+void            bsubmit(struct buf*, void (*)(struct buf*));
+int             bpoll(struct buf*);
+void            bwait(struct buf*);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
 
@@ -24,6 +35,8 @@ void            panic(char*) __attribute__((noreturn));
 
 // exec.c
 int             exec(char*, char**);
+void            dupsegs(struct pseg*, struct pseg*);
+void            freesegs(struct pseg*);
 
 // file.c
 struct file*    filealloc(void);
@@ -35,6 +48,7 @@ int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
 
 // fs.c
+void            icacheinit(void);
 void            readsb(int dev, struct superblock *sb);
 int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
@@ -53,10 +67,18 @@ int             readi(struct inode*, char*, uint, uint);
 void            stati(struct inode*, struct stat*);
 int             writei(struct inode*, char*, uint, uint);
 
+// futex.c
+void            futexinit(void);
+int             futexwait(uint, uint);
+int             futexwake(uint, int);
+
 // ide.c
 void            ideinit(void);
 void            ideintr(void);
+void            ideiowait(struct buf*);
 void            iderw(struct buf*);
+void            idestat(struct iostat*);
+void            idesubmit(struct buf*);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -65,9 +87,13 @@ void            ioapicinit(void);
 
 // kalloc.c
 char*           kalloc(void);
+char*           kalloc_zeroed(void);
 void            kfree(char*);
+void            kincref(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+int             krefcnt(char*);
+int             kzeroidle(void);
 
 // kbd.c
 void            kbdintr(void);
@@ -78,7 +104,14 @@ int             lapicid(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapicarm(uint);
+int             lapicexpired(void);
+uint            lapicnexttick(void);
+uint            lapicnow(void);
+void            lapicsend(int, int);
 void            lapicstartap(uchar, uint);
+void            lapicstop(void);
+uint            lapicticks(void);
 void            microdelay(int);
 
 // log.c
@@ -95,7 +128,19 @@ void            mpinit(void);
 void            picenable(int);
 void            picinit(void);
 
+// pagecache.c
+void            pcdump(void);
+char*           pcget(struct inode*, uint);
+void            pcinit(void);
+void            pcinval(struct inode*);
+
+// pci.c
+int             pcifind(int, int, uint*);
+uint            pciread(uint, int);
+void            pciwrite(uint, int, uint);
+
 // pipe.c
+void            pipeinit(void);
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
 int             piperead(struct pipe*, char*, int);
@@ -103,20 +148,35 @@ int             pipewrite(struct pipe*, char*, int);
 
 //PAGEBREAK: 16
 // proc.c
+int             clone(uint, uint, uint, uint);
 int             cpuid(void);
 void            exit(void);
 int             fork(void);
+int             getaffinity(int);
+void            getpinfo(struct pstat*);
 int             growproc(int);
+int             join(uint*);
 int             kill(int);
+void            uvmkill(struct proc*);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
+void            kickcpu(int);
 void            pinit(void);
+void            prioboost(void);
 void            procdump(void);
+int             quantumtick(void);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
+int             setaffinity(int, uint);
+int             setpriority(int, int);
+int             settickets(int);
 void            setproc(struct proc*);
 void            sleep(void*, struct spinlock*);
 void            userinit(void);
+struct uvm*     uvmalloc(void);
+void            uvmlock(struct proc*);
+void            uvmput(struct uvm*, pde_t*);
+void            uvmunlock(struct proc*);
 int             wait(void);
 void            wakeup(void*);
 void            yield(void);
@@ -133,6 +193,11 @@ void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
 
+// slab.c
+struct kmem_cache* kmem_cache_create(char*, uint);
+void*           kmem_cache_alloc(struct kmem_cache*);
+void            kmem_cache_free(struct kmem_cache*, void*);
+
 // sleeplock.c
 void            acquiresleep(struct sleeplock*);
 void            releasesleep(struct sleeplock*);
@@ -150,16 +215,25 @@ char*           strncpy(char*, const char*, int);
 
 // syscall.c
 int             argint(int, int*);
-int             argptr(int, char**, int);
+int             argptr(int, char**, int, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
 void            syscall(void);
 
 // timer.c
+void            hrtimerintr(void);
+int             nanosleep(uint);
+int             sleepticks(uint);
+void            timeridle(uint);
 void            timerinit(void);
+uint            timernext(uint);
+void            timertick(void);
+uint            timerwake(void);
 
 // trap.c
+uint            clockidle(void);
+void            clockskip(uint);
 void            idtinit(void);
 extern uint     ticks;
 void            tvinit(void);
@@ -179,12 +253,16 @@ int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
-int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
 pde_t*          copyuvm(pde_t*, uint);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+int             pagefault(struct proc*, uint);
+int             junkfault(struct proc*, uint);
+int             prefault(struct proc*, uint, uint, int);
+void            tlbintr(void);
+void            uvmcount(pde_t*, uint, int*, int*);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
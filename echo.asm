@@ -0,0 +1,583 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7e 47                	jle    65 <main+0x65>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1e:	8b 47 04             	mov    0x4(%edi),%eax
+  21:	83 fe 02             	cmp    $0x2,%esi
+  24:	74 2a                	je     50 <main+0x50>
+  26:	bb 02 00 00 00       	mov    $0x2,%ebx
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  30:	68 c0 03 00 00       	push   $0x3c0
+  35:	83 c3 01             	add    $0x1,%ebx
+  38:	50                   	push   %eax
+  39:	68 c2 03 00 00       	push   $0x3c2
+  3e:	6a 01                	push   $0x1
+  40:	e8 cb 01 00 00       	call   210 <printf>
+  45:	8b 44 9f fc          	mov    -0x4(%edi,%ebx,4),%eax
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 f3                	cmp    %esi,%ebx
+  4e:	75 e0                	jne    30 <main+0x30>
+  50:	68 c7 03 00 00       	push   $0x3c7
+  55:	50                   	push   %eax
+  56:	68 c2 03 00 00       	push   $0x3c2
+  5b:	6a 01                	push   $0x1
+  5d:	e8 ae 01 00 00       	call   210 <printf>
+  62:	83 c4 10             	add    $0x10,%esp
+  exit();
+  65:	e8 08 00 00 00       	call   72 <exit>
+
+0000006a <fork>:
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+  6a:	b8 01 00 00 00       	mov    $0x1,%eax
+  6f:	cd 40                	int    $0x40
+}
+
+void
+lock_acquire(lock_t *lk)
+{
+  while(xchg(&lk->locked, 1) != 0)
+  71:	c3                   	ret
+
+00000072 <exit>:
+  72:	b8 02 00 00 00       	mov    $0x2,%eax
+  lock_release(&stacklock);
+  if(stack == 0 && (stack = sbrk(TSTACK)) == (char*)-1)
+    return -1;
+  if((pid = clone(threadstart, fn, arg, stack)) < 0){
+    lock_acquire(&stacklock);
+    *(char**)stack = freestacks;
+  77:	cd 40                	int    $0x40
+  79:	c3                   	ret
+
+0000007a <wait>:
+  7a:	b8 03 00 00 00       	mov    $0x3,%eax
+    freestacks = stack;
+  7f:	cd 40                	int    $0x40
+    *(char**)stack = freestacks;
+  81:	c3                   	ret
+
+00000082 <pipe>:
+  82:	b8 04 00 00 00       	mov    $0x4,%eax
+  87:	cd 40                	int    $0x40
+  89:	c3                   	ret
+
+0000008a <read>:
+    lock_release(&stacklock);
+  }
+  return pid;
+}
+  8a:	b8 05 00 00 00       	mov    $0x5,%eax
+  8f:	cd 40                	int    $0x40
+  91:	c3                   	ret
+
+00000092 <write>:
+  92:	b8 10 00 00 00       	mov    $0x10,%eax
+  97:	cd 40                	int    $0x40
+  99:	c3                   	ret
+
+0000009a <close>:
+  9a:	b8 15 00 00 00       	mov    $0x15,%eax
+  9f:	cd 40                	int    $0x40
+  if(stack == 0 && (stack = sbrk(TSTACK)) == (char*)-1)
+  a1:	c3                   	ret
+
+000000a2 <kill>:
+  a2:	b8 06 00 00 00       	mov    $0x6,%eax
+  a7:	cd 40                	int    $0x40
+  a9:	c3                   	ret
+
+000000aa <exec>:
+  aa:	b8 07 00 00 00       	mov    $0x7,%eax
+  af:	cd 40                	int    $0x40
+  b1:	c3                   	ret
+
+000000b2 <open>:
+  b2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  b7:	cd 40                	int    $0x40
+  b9:	c3                   	ret
+
+000000ba <mknod>:
+  ba:	b8 11 00 00 00       	mov    $0x11,%eax
+    return -1;
+  bf:	cd 40                	int    $0x40
+  c1:	c3                   	ret
+
+000000c2 <unlink>:
+  c2:	b8 12 00 00 00       	mov    $0x12,%eax
+SYSCALL(close)
+SYSCALL(kill)
+SYSCALL(exec)
+SYSCALL(open)
+SYSCALL(mknod)
+SYSCALL(unlink)
+  c7:	cd 40                	int    $0x40
+  c9:	c3                   	ret
+
+000000ca <fstat>:
+SYSCALL(fstat)
+  ca:	b8 08 00 00 00       	mov    $0x8,%eax
+  cf:	cd 40                	int    $0x40
+  d1:	c3                   	ret
+
+000000d2 <link>:
+SYSCALL(link)
+  d2:	b8 13 00 00 00       	mov    $0x13,%eax
+  d7:	cd 40                	int    $0x40
+  d9:	c3                   	ret
+
+000000da <mkdir>:
+SYSCALL(mkdir)
+  da:	b8 14 00 00 00       	mov    $0x14,%eax
+  df:	cd 40                	int    $0x40
+  e1:	c3                   	ret
+
+000000e2 <chdir>:
+SYSCALL(chdir)
+  e2:	b8 09 00 00 00       	mov    $0x9,%eax
+  e7:	cd 40                	int    $0x40
+  e9:	c3                   	ret
+
+000000ea <dup>:
+SYSCALL(dup)
+  ea:	b8 0a 00 00 00       	mov    $0xa,%eax
+  ef:	cd 40                	int    $0x40
+  f1:	c3                   	ret
+
+000000f2 <getpid>:
+SYSCALL(getpid)
+  f2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  f7:	cd 40                	int    $0x40
+  f9:	c3                   	ret
+
+000000fa <sbrk>:
+SYSCALL(sbrk)
+  fa:	b8 0c 00 00 00       	mov    $0xc,%eax
+  ff:	cd 40                	int    $0x40
+ 101:	c3                   	ret
+
+00000102 <sleep>:
+SYSCALL(sleep)
+ 102:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 107:	cd 40                	int    $0x40
+ 109:	c3                   	ret
+
+0000010a <uptime>:
+SYSCALL(uptime)
+ 10a:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 10f:	cd 40                	int    $0x40
+ 111:	c3                   	ret
+
+00000112 <setpriority>:
+SYSCALL(setpriority)
+ 112:	b8 16 00 00 00       	mov    $0x16,%eax
+ 117:	cd 40                	int    $0x40
+ 119:	c3                   	ret
+
+0000011a <settickets>:
+SYSCALL(settickets)
+ 11a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 11f:	cd 40                	int    $0x40
+ 121:	c3                   	ret
+
+00000122 <getpinfo>:
+SYSCALL(getpinfo)
+ 122:	b8 18 00 00 00       	mov    $0x18,%eax
+ 127:	cd 40                	int    $0x40
+ 129:	c3                   	ret
+
+0000012a <nanosleep>:
+SYSCALL(nanosleep)
+ 12a:	b8 19 00 00 00       	mov    $0x19,%eax
+ 12f:	cd 40                	int    $0x40
+ 131:	c3                   	ret
+
+00000132 <clone>:
+SYSCALL(clone)
+ 132:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 137:	cd 40                	int    $0x40
+ 139:	c3                   	ret
+
+0000013a <join>:
+SYSCALL(join)
+ 13a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 13f:	cd 40                	int    $0x40
+ 141:	c3                   	ret
+
+00000142 <futex_wait>:
+SYSCALL(futex_wait)
+ 142:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 147:	cd 40                	int    $0x40
+ 149:	c3                   	ret
+
+0000014a <futex_wake>:
+SYSCALL(futex_wake)
+ 14a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 14f:	cd 40                	int    $0x40
+ 151:	c3                   	ret
+
+00000152 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 152:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 157:	cd 40                	int    $0x40
+ 159:	c3                   	ret
+
+0000015a <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 15a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 15f:	cd 40                	int    $0x40
+ 161:	c3                   	ret
+
+00000162 <iostat>:
+SYSCALL(iostat)
+ 162:	b8 20 00 00 00       	mov    $0x20,%eax
+ 167:	cd 40                	int    $0x40
+ 169:	c3                   	ret
+ 16a:	66 90                	xchg   %ax,%ax
+ 16c:	66 90                	xchg   %ax,%ax
+ 16e:	66 90                	xchg   %ax,%ax
+
+00000170 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	57                   	push   %edi
+ 174:	56                   	push   %esi
+ 175:	53                   	push   %ebx
+ 176:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 178:	89 d1                	mov    %edx,%ecx
+{
+ 17a:	83 ec 3c             	sub    $0x3c,%esp
+ 17d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 180:	85 d2                	test   %edx,%edx
+ 182:	0f 89 80 00 00 00    	jns    208 <printint+0x98>
+ 188:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 18c:	74 7a                	je     208 <printint+0x98>
+    x = -xx;
+ 18e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 190:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 195:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 198:	31 f6                	xor    %esi,%esi
+ 19a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 1a0:	89 c8                	mov    %ecx,%eax
+ 1a2:	31 d2                	xor    %edx,%edx
+ 1a4:	89 f7                	mov    %esi,%edi
+ 1a6:	f7 f3                	div    %ebx
+ 1a8:	8d 76 01             	lea    0x1(%esi),%esi
+ 1ab:	0f b6 92 28 04 00 00 	movzbl 0x428(%edx),%edx
+ 1b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 1b6:	89 ca                	mov    %ecx,%edx
+ 1b8:	89 c1                	mov    %eax,%ecx
+ 1ba:	39 da                	cmp    %ebx,%edx
+ 1bc:	73 e2                	jae    1a0 <printint+0x30>
+  if(neg)
+ 1be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 1c1:	85 c0                	test   %eax,%eax
+ 1c3:	74 07                	je     1cc <printint+0x5c>
+    buf[i++] = '-';
+ 1c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 1ca:	89 f7                	mov    %esi,%edi
+ 1cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 1cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 1d2:	01 df                	add    %ebx,%edi
+ 1d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 1d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 1db:	83 ec 04             	sub    $0x4,%esp
+ 1de:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 1e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 1e4:	6a 01                	push   $0x1
+ 1e6:	50                   	push   %eax
+ 1e7:	56                   	push   %esi
+ 1e8:	e8 a5 fe ff ff       	call   92 <write>
+  while(--i >= 0)
+ 1ed:	89 f8                	mov    %edi,%eax
+ 1ef:	83 c4 10             	add    $0x10,%esp
+ 1f2:	83 ef 01             	sub    $0x1,%edi
+ 1f5:	39 d8                	cmp    %ebx,%eax
+ 1f7:	75 df                	jne    1d8 <printint+0x68>
+}
+ 1f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1fc:	5b                   	pop    %ebx
+ 1fd:	5e                   	pop    %esi
+ 1fe:	5f                   	pop    %edi
+ 1ff:	5d                   	pop    %ebp
+ 200:	c3                   	ret
+ 201:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 208:	31 c0                	xor    %eax,%eax
+ 20a:	eb 89                	jmp    195 <printint+0x25>
+ 20c:	66 90                	xchg   %ax,%ax
+ 20e:	66 90                	xchg   %ax,%ax
+
+00000210 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	57                   	push   %edi
+ 214:	56                   	push   %esi
+ 215:	53                   	push   %ebx
+ 216:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 219:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 21c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 21f:	0f b6 1e             	movzbl (%esi),%ebx
+ 222:	83 c6 01             	add    $0x1,%esi
+ 225:	84 db                	test   %bl,%bl
+ 227:	74 67                	je     290 <printf+0x80>
+ 229:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 22c:	31 d2                	xor    %edx,%edx
+ 22e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 231:	eb 34                	jmp    267 <printf+0x57>
+ 233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 237:	90                   	nop
+ 238:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 23b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 240:	83 f8 25             	cmp    $0x25,%eax
+ 243:	74 18                	je     25d <printf+0x4d>
+  write(fd, &c, 1);
+ 245:	83 ec 04             	sub    $0x4,%esp
+ 248:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 24b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 24e:	6a 01                	push   $0x1
+ 250:	50                   	push   %eax
+ 251:	57                   	push   %edi
+ 252:	e8 3b fe ff ff       	call   92 <write>
+ 257:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 25a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 25d:	0f b6 1e             	movzbl (%esi),%ebx
+ 260:	83 c6 01             	add    $0x1,%esi
+ 263:	84 db                	test   %bl,%bl
+ 265:	74 29                	je     290 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 267:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 26a:	85 d2                	test   %edx,%edx
+ 26c:	74 ca                	je     238 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 26e:	83 fa 25             	cmp    $0x25,%edx
+ 271:	75 ea                	jne    25d <printf+0x4d>
+      if(c == 'd'){
+ 273:	83 f8 25             	cmp    $0x25,%eax
+ 276:	0f 84 24 01 00 00    	je     3a0 <printf+0x190>
+ 27c:	83 e8 63             	sub    $0x63,%eax
+ 27f:	83 f8 15             	cmp    $0x15,%eax
+ 282:	77 1c                	ja     2a0 <printf+0x90>
+ 284:	ff 24 85 d0 03 00 00 	jmp    *0x3d0(,%eax,4)
+ 28b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 28f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 290:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 293:	5b                   	pop    %ebx
+ 294:	5e                   	pop    %esi
+ 295:	5f                   	pop    %edi
+ 296:	5d                   	pop    %ebp
+ 297:	c3                   	ret
+ 298:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+  write(fd, &c, 1);
+ 2a0:	83 ec 04             	sub    $0x4,%esp
+ 2a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 2a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 2aa:	6a 01                	push   $0x1
+ 2ac:	52                   	push   %edx
+ 2ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 2b0:	57                   	push   %edi
+ 2b1:	e8 dc fd ff ff       	call   92 <write>
+ 2b6:	83 c4 0c             	add    $0xc,%esp
+ 2b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 2bc:	6a 01                	push   $0x1
+ 2be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 2c1:	52                   	push   %edx
+ 2c2:	57                   	push   %edi
+ 2c3:	e8 ca fd ff ff       	call   92 <write>
+        putc(fd, c);
+ 2c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 2cb:	31 d2                	xor    %edx,%edx
+ 2cd:	eb 8e                	jmp    25d <printf+0x4d>
+ 2cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 2d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 2d3:	83 ec 0c             	sub    $0xc,%esp
+ 2d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 2db:	8b 13                	mov    (%ebx),%edx
+ 2dd:	6a 00                	push   $0x0
+ 2df:	89 f8                	mov    %edi,%eax
+        ap++;
+ 2e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 2e4:	e8 87 fe ff ff       	call   170 <printint>
+        ap++;
+ 2e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 2ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 2ef:	31 d2                	xor    %edx,%edx
+ 2f1:	e9 67 ff ff ff       	jmp    25d <printf+0x4d>
+ 2f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 300:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 303:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 305:	83 c0 04             	add    $0x4,%eax
+ 308:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 30b:	85 db                	test   %ebx,%ebx
+ 30d:	0f 84 9d 00 00 00    	je     3b0 <printf+0x1a0>
+        while(*s != 0){
+ 313:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 316:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 318:	84 c0                	test   %al,%al
+ 31a:	0f 84 3d ff ff ff    	je     25d <printf+0x4d>
+ 320:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 323:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 326:	89 de                	mov    %ebx,%esi
+ 328:	89 d3                	mov    %edx,%ebx
+ 32a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 330:	83 ec 04             	sub    $0x4,%esp
+ 333:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 336:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 339:	6a 01                	push   $0x1
+ 33b:	53                   	push   %ebx
+ 33c:	57                   	push   %edi
+ 33d:	e8 50 fd ff ff       	call   92 <write>
+        while(*s != 0){
+ 342:	0f b6 06             	movzbl (%esi),%eax
+ 345:	83 c4 10             	add    $0x10,%esp
+ 348:	84 c0                	test   %al,%al
+ 34a:	75 e4                	jne    330 <printf+0x120>
+      state = 0;
+ 34c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 34f:	31 d2                	xor    %edx,%edx
+ 351:	e9 07 ff ff ff       	jmp    25d <printf+0x4d>
+ 356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 360:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 363:	83 ec 0c             	sub    $0xc,%esp
+ 366:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 36b:	8b 13                	mov    (%ebx),%edx
+ 36d:	6a 01                	push   $0x1
+ 36f:	e9 6b ff ff ff       	jmp    2df <printf+0xcf>
+ 374:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 378:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 37b:	83 ec 04             	sub    $0x4,%esp
+ 37e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 381:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 383:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 386:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 389:	6a 01                	push   $0x1
+ 38b:	52                   	push   %edx
+ 38c:	57                   	push   %edi
+ 38d:	e8 00 fd ff ff       	call   92 <write>
+        ap++;
+ 392:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 395:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 398:	31 d2                	xor    %edx,%edx
+ 39a:	e9 be fe ff ff       	jmp    25d <printf+0x4d>
+ 39f:	90                   	nop
+  write(fd, &c, 1);
+ 3a0:	83 ec 04             	sub    $0x4,%esp
+ 3a3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 3a6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 3a9:	6a 01                	push   $0x1
+ 3ab:	e9 11 ff ff ff       	jmp    2c1 <printf+0xb1>
+ 3b0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 3b5:	bb c9 03 00 00       	mov    $0x3c9,%ebx
+ 3ba:	e9 61 ff ff ff       	jmp    320 <printf+0x110>
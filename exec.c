@@ -6,17 +6,60 @@
 #include "defs.h"
 #include "x86.h"
 #include "elf.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+
+// Executables are paged in while they run, so writei() refuses
+// to change one that has segments in any process; ip->ntext
+// counts them.  It only goes from 0 to 1 in exec(), under
+// ip->lock, so writei() can trust it; fork() and clone() copy
+// existing segments, so they update it atomically without.
+
+// Copy the segment table from into to, taking new references.
+void
+dupsegs(struct pseg *to, struct pseg *from)
+{
+  int i;
+
+  for(i = 0; i < NPSEG; i++){
+    to[i] = from[i];
+    if(to[i].ip){
+      idup(to[i].ip);
+      __sync_add_and_fetch(&to[i].ip->ntext, 1);
+    }
+  }
+}
+
+// Drop the references a segment table holds on executables.
+// Must be called inside a transaction, since it calls iput().
+void
+freesegs(struct pseg *seg)
+{
+  int i;
+
+  for(i = 0; i < NPSEG; i++){
+    if(seg[i].ip){
+      __sync_sub_and_fetch(&seg[i].ip->ntext, 1);
+      iput(seg[i].ip);
+      seg[i].ip = 0;
+    }
+  }
+}
 
 int
 exec(char *path, char **argv)
 {
   char *s, *last;
-  int i, off;
+  int i, off, nseg;
   uint argc, sz, sp, ustack[3+MAXARG+1];
   struct elfhdr elf;
   struct inode *ip;
   struct proghdr ph;
+  struct pseg seg[NPSEG];
   pde_t *pgdir, *oldpgdir;
+  struct uvm *uvm, *olduvm;
   struct proc *curproc = myproc();
 
   begin_op();
@@ -28,6 +71,7 @@ exec(char *path, char **argv)
   }
   ilock(ip);
   pgdir = 0;
+  memset(seg, 0, sizeof(seg));
 
   // Check ELF header
   if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
@@ -38,8 +82,10 @@ exec(char *path, char **argv)
   if((pgdir = setupkvm()) == 0)
     goto bad;
 
-  // Load program into memory.
+  // Record the program segments.  Nothing is read yet:
+  // pagefault() brings each page in from ip on first touch.
   sz = 0;
+  nseg = 0;
   for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
     if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
       goto bad;
@@ -49,12 +95,21 @@ exec(char *path, char **argv)
       goto bad;
     if(ph.vaddr + ph.memsz < ph.vaddr)
       goto bad;
-    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+    if(ph.vaddr + ph.memsz >= KERNBASE)
       goto bad;
     if(ph.vaddr % PGSIZE != 0)
       goto bad;
-    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+    if(nseg == NPSEG)
       goto bad;
+    seg[nseg].ip = idup(ip);
+    __sync_add_and_fetch(&ip->ntext, 1);
+    seg[nseg].va = ph.vaddr;
+    seg[nseg].memsz = ph.memsz;
+    seg[nseg].off = ph.off;
+    seg[nseg].filesz = ph.filesz;
+    nseg++;
+    if(ph.vaddr + ph.memsz > sz)
+      sz = ph.vaddr + ph.memsz;
   }
   iunlockput(ip);
   end_op();
@@ -93,14 +148,25 @@ exec(char *path, char **argv)
       last = s+1;
   safestrcpy(curproc->name, last, sizeof(curproc->name));
 
+  // The new image is this thread's alone; any other threads
+  // keep the old one.
+  if((uvm = uvmalloc()) == 0)
+    goto bad;
+
   // Commit to the user image.
   oldpgdir = curproc->pgdir;
+  olduvm = curproc->uvm;
   curproc->pgdir = pgdir;
+  curproc->uvm = uvm;
   curproc->sz = sz;
   curproc->tf->eip = elf.entry;  // main
   curproc->tf->esp = sp;
   switchuvm(curproc);
-  freevm(oldpgdir);
+  uvmput(olduvm, oldpgdir);
+  begin_op();
+  freesegs(curproc->seg);
+  end_op();
+  memmove(curproc->seg, seg, sizeof(seg));
   return 0;
 
  bad:
@@ -108,6 +174,11 @@ exec(char *path, char **argv)
     freevm(pgdir);
   if(ip){
     iunlockput(ip);
+    freesegs(seg);
+    end_op();
+  } else {
+    begin_op();
+    freesegs(seg);
     end_op();
   }
   return -1;
@@ -14,8 +14,12 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  struct inode *next; // icache hash chain
+  struct inode *lruprev; // icache LRU list, while ref is 0
+  struct inode *lrunext;
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
+  int ntext;          // program segments mapping it (see exec.c)
 
   short type;         // copy of disk inode
   short major;
@@ -23,6 +27,10 @@ struct inode {
   short nlink;
   uint size;
   uint addrs[NDIRECT+1];
+
+  uint raoff;         // byte after the last one readi() read
+  uint rawin;         // read-ahead window, in blocks; 0 if not sequential
+  uint raend;         // block after the last one read ahead
 };
 
 // table mapping major device number to
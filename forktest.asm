@@ -0,0 +1,367 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "fork test OK\n");
+}
+
+int
+main(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 e4 f0             	and    $0xfffffff0,%esp
+  forktest();
+   6:	e8 35 00 00 00       	call   40 <forktest>
+  exit();
+   b:	e8 3e 01 00 00       	call   14e <exit>
+
+00000010 <printf>:
+{
+  10:	55                   	push   %ebp
+  11:	89 e5                	mov    %esp,%ebp
+  13:	53                   	push   %ebx
+  14:	83 ec 10             	sub    $0x10,%esp
+  17:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  write(fd, s, strlen(s));
+  1a:	53                   	push   %ebx
+  1b:	e8 00 01 00 00       	call   120 <strlen>
+  20:	83 c4 0c             	add    $0xc,%esp
+  23:	50                   	push   %eax
+  24:	53                   	push   %ebx
+  25:	ff 75 08             	push   0x8(%ebp)
+  28:	e8 41 01 00 00       	call   16e <write>
+}
+  2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  30:	83 c4 10             	add    $0x10,%esp
+  33:	c9                   	leave
+  34:	c3                   	ret
+  35:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000040 <forktest>:
+{
+  40:	55                   	push   %ebp
+  41:	89 e5                	mov    %esp,%ebp
+  43:	53                   	push   %ebx
+  for(n=0; n<N; n++){
+  44:	31 db                	xor    %ebx,%ebx
+{
+  46:	83 ec 10             	sub    $0x10,%esp
+  write(fd, s, strlen(s));
+  49:	68 48 02 00 00       	push   $0x248
+  4e:	e8 cd 00 00 00       	call   120 <strlen>
+  53:	83 c4 0c             	add    $0xc,%esp
+  56:	50                   	push   %eax
+  57:	68 48 02 00 00       	push   $0x248
+  5c:	6a 01                	push   $0x1
+  5e:	e8 0b 01 00 00       	call   16e <write>
+  63:	83 c4 10             	add    $0x10,%esp
+  66:	eb 19                	jmp    81 <forktest+0x41>
+  68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6f:	90                   	nop
+    if(pid == 0)
+  70:	74 5b                	je     cd <forktest+0x8d>
+  for(n=0; n<N; n++){
+  72:	83 c3 01             	add    $0x1,%ebx
+  75:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  7b:	0f 84 86 00 00 00    	je     107 <forktest+0xc7>
+    pid = fork();
+  81:	e8 c0 00 00 00       	call   146 <fork>
+    if(pid < 0)
+  86:	85 c0                	test   %eax,%eax
+  88:	79 e6                	jns    70 <forktest+0x30>
+  for(; n > 0; n--){
+  8a:	85 db                	test   %ebx,%ebx
+  8c:	74 10                	je     9e <forktest+0x5e>
+  8e:	66 90                	xchg   %ax,%ax
+    if(wait() < 0){
+  90:	e8 c1 00 00 00       	call   156 <wait>
+  95:	85 c0                	test   %eax,%eax
+  97:	78 39                	js     d2 <forktest+0x92>
+  for(; n > 0; n--){
+  99:	83 eb 01             	sub    $0x1,%ebx
+  9c:	75 f2                	jne    90 <forktest+0x50>
+  if(wait() != -1){
+  9e:	e8 b3 00 00 00       	call   156 <wait>
+  a3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  a6:	75 4c                	jne    f4 <forktest+0xb4>
+  write(fd, s, strlen(s));
+  a8:	83 ec 0c             	sub    $0xc,%esp
+  ab:	68 7a 02 00 00       	push   $0x27a
+  b0:	e8 6b 00 00 00       	call   120 <strlen>
+  b5:	83 c4 0c             	add    $0xc,%esp
+  b8:	50                   	push   %eax
+  b9:	68 7a 02 00 00       	push   $0x27a
+  be:	6a 01                	push   $0x1
+  c0:	e8 a9 00 00 00       	call   16e <write>
+}
+  c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c8:	83 c4 10             	add    $0x10,%esp
+  cb:	c9                   	leave
+  cc:	c3                   	ret
+      exit();
+  cd:	e8 7c 00 00 00       	call   14e <exit>
+  write(fd, s, strlen(s));
+  d2:	83 ec 0c             	sub    $0xc,%esp
+  d5:	68 53 02 00 00       	push   $0x253
+  da:	e8 41 00 00 00       	call   120 <strlen>
+  df:	83 c4 0c             	add    $0xc,%esp
+  e2:	50                   	push   %eax
+  e3:	68 53 02 00 00       	push   $0x253
+  e8:	6a 01                	push   $0x1
+  ea:	e8 7f 00 00 00       	call   16e <write>
+      exit();
+  ef:	e8 5a 00 00 00       	call   14e <exit>
+    printf(1, "wait got too many\n");
+  f4:	50                   	push   %eax
+  f5:	50                   	push   %eax
+  f6:	68 67 02 00 00       	push   $0x267
+  fb:	6a 01                	push   $0x1
+  fd:	e8 0e ff ff ff       	call   10 <printf>
+    exit();
+ 102:	e8 47 00 00 00       	call   14e <exit>
+    printf(1, "fork claimed to work N times!\n", N);
+ 107:	52                   	push   %edx
+ 108:	68 e8 03 00 00       	push   $0x3e8
+ 10d:	68 88 02 00 00       	push   $0x288
+ 112:	6a 01                	push   $0x1
+ 114:	e8 f7 fe ff ff       	call   10 <printf>
+    exit();
+ 119:	e8 30 00 00 00       	call   14e <exit>
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <strlen>:
+  return (uchar)*p - (uchar)*q;
+}
+
+uint
+strlen(const char *s)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 126:	80 3a 00             	cmpb   $0x0,(%edx)
+ 129:	74 15                	je     140 <strlen+0x20>
+ 12b:	31 c0                	xor    %eax,%eax
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+ 130:	83 c0 01             	add    $0x1,%eax
+ 133:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 137:	89 c1                	mov    %eax,%ecx
+ 139:	75 f5                	jne    130 <strlen+0x10>
+    ;
+  return n;
+}
+ 13b:	89 c8                	mov    %ecx,%eax
+ 13d:	5d                   	pop    %ebp
+ 13e:	c3                   	ret
+ 13f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 140:	31 c9                	xor    %ecx,%ecx
+}
+ 142:	5d                   	pop    %ebp
+ 143:	89 c8                	mov    %ecx,%eax
+ 145:	c3                   	ret
+
+00000146 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 146:	b8 01 00 00 00       	mov    $0x1,%eax
+ 14b:	cd 40                	int    $0x40
+ 14d:	c3                   	ret
+
+0000014e <exit>:
+SYSCALL(exit)
+ 14e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 153:	cd 40                	int    $0x40
+ 155:	c3                   	ret
+
+00000156 <wait>:
+SYSCALL(wait)
+ 156:	b8 03 00 00 00       	mov    $0x3,%eax
+ 15b:	cd 40                	int    $0x40
+ 15d:	c3                   	ret
+
+0000015e <pipe>:
+SYSCALL(pipe)
+ 15e:	b8 04 00 00 00       	mov    $0x4,%eax
+ 163:	cd 40                	int    $0x40
+ 165:	c3                   	ret
+
+00000166 <read>:
+SYSCALL(read)
+ 166:	b8 05 00 00 00       	mov    $0x5,%eax
+ 16b:	cd 40                	int    $0x40
+ 16d:	c3                   	ret
+
+0000016e <write>:
+SYSCALL(write)
+ 16e:	b8 10 00 00 00       	mov    $0x10,%eax
+ 173:	cd 40                	int    $0x40
+ 175:	c3                   	ret
+
+00000176 <close>:
+SYSCALL(close)
+ 176:	b8 15 00 00 00       	mov    $0x15,%eax
+ 17b:	cd 40                	int    $0x40
+ 17d:	c3                   	ret
+
+0000017e <kill>:
+SYSCALL(kill)
+ 17e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 183:	cd 40                	int    $0x40
+ 185:	c3                   	ret
+
+00000186 <exec>:
+SYSCALL(exec)
+ 186:	b8 07 00 00 00       	mov    $0x7,%eax
+ 18b:	cd 40                	int    $0x40
+ 18d:	c3                   	ret
+
+0000018e <open>:
+SYSCALL(open)
+ 18e:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 193:	cd 40                	int    $0x40
+ 195:	c3                   	ret
+
+00000196 <mknod>:
+SYSCALL(mknod)
+ 196:	b8 11 00 00 00       	mov    $0x11,%eax
+ 19b:	cd 40                	int    $0x40
+ 19d:	c3                   	ret
+
+0000019e <unlink>:
+SYSCALL(unlink)
+ 19e:	b8 12 00 00 00       	mov    $0x12,%eax
+ 1a3:	cd 40                	int    $0x40
+ 1a5:	c3                   	ret
+
+000001a6 <fstat>:
+SYSCALL(fstat)
+ 1a6:	b8 08 00 00 00       	mov    $0x8,%eax
+ 1ab:	cd 40                	int    $0x40
+ 1ad:	c3                   	ret
+
+000001ae <link>:
+SYSCALL(link)
+ 1ae:	b8 13 00 00 00       	mov    $0x13,%eax
+ 1b3:	cd 40                	int    $0x40
+ 1b5:	c3                   	ret
+
+000001b6 <mkdir>:
+SYSCALL(mkdir)
+ 1b6:	b8 14 00 00 00       	mov    $0x14,%eax
+ 1bb:	cd 40                	int    $0x40
+ 1bd:	c3                   	ret
+
+000001be <chdir>:
+SYSCALL(chdir)
+ 1be:	b8 09 00 00 00       	mov    $0x9,%eax
+ 1c3:	cd 40                	int    $0x40
+ 1c5:	c3                   	ret
+
+000001c6 <dup>:
+SYSCALL(dup)
+ 1c6:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 1cb:	cd 40                	int    $0x40
+ 1cd:	c3                   	ret
+
+000001ce <getpid>:
+SYSCALL(getpid)
+ 1ce:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 1d3:	cd 40                	int    $0x40
+ 1d5:	c3                   	ret
+
+000001d6 <sbrk>:
+SYSCALL(sbrk)
+ 1d6:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 1db:	cd 40                	int    $0x40
+ 1dd:	c3                   	ret
+
+000001de <sleep>:
+SYSCALL(sleep)
+ 1de:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 1e3:	cd 40                	int    $0x40
+ 1e5:	c3                   	ret
+
+000001e6 <uptime>:
+SYSCALL(uptime)
+ 1e6:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 1eb:	cd 40                	int    $0x40
+ 1ed:	c3                   	ret
+
+000001ee <setpriority>:
+SYSCALL(setpriority)
+ 1ee:	b8 16 00 00 00       	mov    $0x16,%eax
+ 1f3:	cd 40                	int    $0x40
+ 1f5:	c3                   	ret
+
+000001f6 <settickets>:
+SYSCALL(settickets)
+ 1f6:	b8 17 00 00 00       	mov    $0x17,%eax
+ 1fb:	cd 40                	int    $0x40
+ 1fd:	c3                   	ret
+
+000001fe <getpinfo>:
+SYSCALL(getpinfo)
+ 1fe:	b8 18 00 00 00       	mov    $0x18,%eax
+ 203:	cd 40                	int    $0x40
+ 205:	c3                   	ret
+
+00000206 <nanosleep>:
+SYSCALL(nanosleep)
+ 206:	b8 19 00 00 00       	mov    $0x19,%eax
+ 20b:	cd 40                	int    $0x40
+ 20d:	c3                   	ret
+
+0000020e <clone>:
+SYSCALL(clone)
+ 20e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 213:	cd 40                	int    $0x40
+ 215:	c3                   	ret
+
+00000216 <join>:
+SYSCALL(join)
+ 216:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 21b:	cd 40                	int    $0x40
+ 21d:	c3                   	ret
+
+0000021e <futex_wait>:
+SYSCALL(futex_wait)
+ 21e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 223:	cd 40                	int    $0x40
+ 225:	c3                   	ret
+
+00000226 <futex_wake>:
+SYSCALL(futex_wake)
+ 226:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 22b:	cd 40                	int    $0x40
+ 22d:	c3                   	ret
+
+0000022e <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 22e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 233:	cd 40                	int    $0x40
+ 235:	c3                   	ret
+
+00000236 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 236:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 23b:	cd 40                	int    $0x40
+ 23d:	c3                   	ret
+
+0000023e <iostat>:
+SYSCALL(iostat)
+ 23e:	b8 20 00 00 00       	mov    $0x20,%eax
+ 243:	cd 40                	int    $0x40
+ 245:	c3                   	ret
@@ -120,7 +120,7 @@ bfree(int dev, uint b)
 //   the reference and link counts have fallen to zero.
 //
 // * Referencing in cache: an entry in the inode cache
-//   is free if ip->ref is zero. Otherwise ip->ref tracks
+//   is unused if ip->ref is zero. Otherwise ip->ref tracks
 //   the number of in-memory pointers to the entry (open
 //   files and current directories). iget() finds or
 //   creates a cache entry and increments its ref; iput()
@@ -130,7 +130,7 @@ bfree(int dev, uint b)
 //   cache entry is only correct when ip->valid is 1.
 //   ilock() reads the inode from
 //   the disk and sets ip->valid, while iput() clears
-//   ip->valid if ip->ref has fallen to zero.
+//   ip->valid if it frees the inode on disk.
 //
 // * Locked: file system code may only examine and modify
 //   the information in an inode and its content if it
@@ -155,29 +155,85 @@ bfree(int dev, uint b)
 // multi-step atomic operations.
 //
 // The icache.lock spin-lock protects the allocation of icache
-// entries. Since ip->ref indicates whether an entry is free,
-// and ip->dev and ip->inum indicate which i-node an entry
-// holds, one must hold icache.lock while using any of those fields.
+// entries. In-memory inodes come from a slab cache and are
+// hashed by inum into NIHASH chains through ip->next.  When the
+// last reference goes away, iput() keeps a valid entry on an
+// LRU list so that the next iget() need not read the inode
+// again, up to NICACHE of them; beyond that, or when the slab
+// cache has no more memory, the least recently used entry is
+// freed or recycled. Since ip->ref, ip->next and the LRU links
+// indicate whether an entry is in use, and ip->dev and ip->inum
+// indicate which i-node an entry holds, one must hold
+// icache.lock while using any of those fields.
 //
 // An ip->lock sleep-lock protects all ip-> fields other than ref,
 // dev, and inum.  One must hold ip->lock in order to
 // read or write that inode's ip->valid, ip->size, ip->type, &c.
 
+#define NIHASH 31  // hash chains
+
 struct {
   struct spinlock lock;
-  struct inode inode[NINODE];
+  struct kmem_cache *cache;
+  struct inode *hash[NIHASH];
+
+  // Linked list of unused valid inodes, through lruprev/lrunext.
+  // lru.lrunext is most recently used.
+  struct inode lru;
+  int nlru;
 } icache;
 
+#define IHASH(inum) (&icache.hash[(inum) % NIHASH])
+
 void
-iinit(int dev)
+icacheinit(void)
 {
-  int i = 0;
-  
   initlock(&icache.lock, "icache");
-  for(i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
-  }
+  icache.cache = kmem_cache_create("inode", sizeof(struct inode));
+  icache.lru.lruprev = &icache.lru;
+  icache.lru.lrunext = &icache.lru;
+}
+
+// Take unused ip off the LRU list.  Caller holds icache.lock.
+static void
+ilrudel(struct inode *ip)
+{
+  ip->lrunext->lruprev = ip->lruprev;
+  ip->lruprev->lrunext = ip->lrunext;
+  icache.nlru--;
+}
 
+// Take ip out of the cache altogether.  Caller holds
+// icache.lock.
+static void
+iunhash(struct inode *ip)
+{
+  struct inode **pp;
+
+  for(pp = IHASH(ip->inum); *pp != ip; pp = &(*pp)->next)
+    ;
+  *pp = ip->next;
+}
+
+// Take the least recently used unused inode out of the cache
+// and return it, or 0 if there is none.  Caller holds
+// icache.lock.
+static struct inode*
+ievict(void)
+{
+  struct inode *ip;
+
+  if(icache.nlru == 0)
+    return 0;
+  ip = icache.lru.lruprev;
+  ilrudel(ip);
+  iunhash(ip);
+  return ip;
+}
+
+void
+iinit(int dev)
+{
   readsb(dev, &sb);
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
  inodestart %d bmap start %d\n", sb.size, sb.nblocks,
@@ -241,31 +297,36 @@ iupdate(struct inode *ip)
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip, **h;
 
   acquire(&icache.lock);
 
   // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
+  h = IHASH(inum);
+  for(ip = *h; ip; ip = ip->next){
+    if(ip->dev == dev && ip->inum == inum){
+      if(ip->ref++ == 0)
+        ilrudel(ip);
       release(&icache.lock);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
+  // Allocate a new inode cache entry, or recycle an unused one
+  // if memory is short.
+  if((ip = kmem_cache_alloc(icache.cache)) == 0 &&
+     (ip = ievict()) == 0)
     panic("iget: no inodes");
 
-  ip = empty;
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
   ip->valid = 0;
+  ip->raoff = ip->rawin = ip->raend = 0;
+  ip->ntext = 0;
+  initsleeplock(&ip->lock, "inode");
+  ip->next = *h;
+  *h = ip;
   release(&icache.lock);
 
   return ip;
@@ -322,8 +383,8 @@ iunlock(struct inode *ip)
 }
 
 // Drop a reference to an in-memory inode.
-// If that was the last reference, the inode cache entry can
-// be recycled.
+// If that was the last reference, the inode cache entry is
+// kept for reuse if valid, else freed.
 // If that was the last reference and the inode has no links
 // to it, free the inode (and its content) on disk.
 // All calls to iput() must be inside a transaction in
@@ -347,7 +408,19 @@ iput(struct inode *ip)
   releasesleep(&ip->lock);
 
   acquire(&icache.lock);
-  ip->ref--;
+  if(--ip->ref == 0){
+    if(ip->valid){
+      ip->lrunext = icache.lru.lrunext;
+      ip->lruprev = &icache.lru;
+      icache.lru.lrunext->lruprev = ip;
+      icache.lru.lrunext = ip;
+      icache.nlru++;
+      ip = icache.nlru > NICACHE ? ievict() : 0;
+    } else
+      iunhash(ip);
+    if(ip)
+      kmem_cache_free(icache.cache, ip);
+  }
   release(&icache.lock);
 }
 
@@ -432,6 +505,7 @@ itrunc(struct inode *ip)
 
   ip->size = 0;
   iupdate(ip);
+  pcinval(ip);
 }
 
 // Copy stat information from inode.
@@ -447,6 +521,45 @@ stati(struct inode *ip, struct stat *st)
 }
 
 //PAGEBREAK!
+// Read-ahead.  A read that starts at the byte where the last
+// one on ip left off is sequential, even if that is in the
+// middle of a block: the window of blocks to read ahead
+// opens at RAMIN and doubles with each such read up to RAMAX,
+// and any other read closes it.  Blocks from the start of the
+// read to the end of the window that have not been asked for
+// yet are queued with breadahead(), so the disk can work on
+// them while the caller copies out the ones before.
+#define RAMIN 4
+#define RAMAX 32
+
+static void
+readahead(struct inode *ip, uint off, uint n)
+{
+  uint bn, end, first, last;
+
+  if(off == ip->raoff)
+    ip->rawin = ip->rawin ? min(2 * ip->rawin, RAMAX) : RAMIN;
+  else
+    ip->rawin = ip->raend = 0;
+  ip->raoff = off + n;
+  if(ip->rawin == 0)
+    return;
+
+  first = off / BSIZE;
+  last = (off + n - 1) / BSIZE;
+  end = min(last + 1 + ip->rawin, (ip->size + BSIZE - 1) / BSIZE);
+  bn = ip->raend > first ? ip->raend : first;
+  if(bn >= end)
+    return;
+  // Wait until half the window is used before asking for more,
+  // so that read-ahead goes to the disk in batches.
+  if(end - bn < ip->rawin / 2 && bn > last)
+    return;
+  for(; bn < end; bn++)
+    breadahead(ip->dev, bmap(ip, bn));
+  ip->raend = end;
+}
+
 // Read data from inode.
 // Caller must hold ip->lock.
 int
@@ -465,6 +578,8 @@ readi(struct inode *ip, char *dst, uint off, uint n)
     return -1;
   if(off + n > ip->size)
     n = ip->size - off;
+  if(n > 0)
+    readahead(ip, off, n);
 
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
@@ -494,6 +609,10 @@ writei(struct inode *ip, char *src, uint off, uint n)
     return -1;
   if(off + n > MAXFILE*BSIZE)
     return -1;
+  if(ip->ntext > 0)  // a running program (see exec.c)
+    return -1;
+  if(n > 0)
+    pcinval(ip);
 
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
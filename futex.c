@@ -0,0 +1,132 @@
+// Futexes, for user-level locks that block in the kernel only
+// when contended.
+//
+// futexwait(addr, val) sleeps if the word at user address addr
+// still holds val; futexwake(addr, n) wakes up to n threads
+// waiting on addr, first come first served.  A waiter is known by
+// its address space and addr, so the threads of one process
+// share futexes while the same address in another process is
+// unrelated.  Waiters are hashed by address into NFUTEX queues,
+// each with its own lock.  futexwait() checks the word and queues
+// itself under that lock, so a thread that changes the word and
+// then calls futexwake() cannot miss it.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+
+#define NFUTEX 64
+
+struct futexw {
+  struct uvm *uvm;
+  uint addr;
+  int woken;
+  struct futexw *next;
+};
+
+struct futexq {
+  struct spinlock lock;
+  struct futexw *head;
+} futexq[NFUTEX];
+
+#define FUTEXQ(addr) (&futexq[((addr) >> 2) % NFUTEX])
+
+void
+futexinit(void)
+{
+  int i;
+
+  for(i = 0; i < NFUTEX; i++)
+    initlock(&futexq[i].lock, "futex");
+}
+
+// The word at user address addr of p, through the kernel's
+// mapping of its page so that reading it cannot fault while a
+// spinlock is held.  Returns 0 if the page is not present.
+static uint*
+futexword(struct proc *p, uint addr)
+{
+  char *page;
+
+  if((page = uva2ka(p->pgdir, (char*)PGROUNDDOWN(addr))) == 0)
+    return 0;
+  return (uint*)(page + addr % PGSIZE);
+}
+
+// Sleep until woken by futexwake(addr) if the word at addr
+// holds val.  Returns 0 once woken, or -1 if the word did not
+// hold val, addr is bad, or the thread was killed.
+int
+futexwait(uint addr, uint val)
+{
+  struct proc *p = myproc();
+  struct futexq *q;
+  struct futexw w, **pp;
+  uint *word;
+
+  if(addr % 4 || addr >= p->sz)
+    return -1;
+  q = FUTEXQ(addr);
+  for(;;){
+    acquire(&q->lock);
+    if((word = futexword(p, addr)) != 0)
+      break;
+    release(&q->lock);
+    if(prefault(p, addr, 4, 0) < 0)
+      return -1;
+  }
+  if(*word != val){
+    release(&q->lock);
+    return -1;
+  }
+
+  w.uvm = p->uvm;
+  w.addr = addr;
+  w.woken = 0;
+  w.next = 0;
+  for(pp = &q->head; *pp; pp = &(*pp)->next)
+    ;
+  *pp = &w;
+  while(!w.woken){
+    if(p->killed){
+      for(pp = &q->head; *pp != &w; pp = &(*pp)->next)
+        ;
+      *pp = w.next;
+      release(&q->lock);
+      return -1;
+    }
+    sleep(&w, &q->lock);
+  }
+  release(&q->lock);
+  return 0;
+}
+
+// Wake up to n threads of this process waiting on addr.
+// Returns how many were woken.
+int
+futexwake(uint addr, int n)
+{
+  struct proc *p = myproc();
+  struct futexq *q;
+  struct futexw *w, **pp;
+  int woken;
+
+  q = FUTEXQ(addr);
+  woken = 0;
+  acquire(&q->lock);
+  pp = &q->head;
+  while((w = *pp) != 0 && woken < n){
+    if(w->uvm == p->uvm && w->addr == addr){
+      *pp = w->next;
+      w->woken = 1;
+      wakeup(w);
+      woken++;
+    } else
+      pp = &w->next;
+  }
+  release(&q->lock);
+  return woken;
+}
@@ -0,0 +1,1819 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 28             	sub    $0x28,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	8b 49 04             	mov    0x4(%ecx),%ecx
+  19:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  1c:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  int i, k, n, nthread;
+
+  if(argc <= 1){
+  1f:	83 f8 01             	cmp    $0x1,%eax
+  22:	0f 8e 87 01 00 00    	jle    1af <main+0x1af>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit();
+  }
+  pattern = argv[1];
+  28:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  if(argc <= 2){
+  2b:	83 7d d8 02          	cmpl   $0x2,-0x28(%ebp)
+    jobs[0].direct = 1;
+    grep(&jobs[0]);
+    exit();
+  }
+
+  for(i = 2; i < argc; i += n){
+  2f:	c7 45 dc 02 00 00 00 	movl   $0x2,-0x24(%ebp)
+  pattern = argv[1];
+  36:	8b 40 04             	mov    0x4(%eax),%eax
+  39:	a3 c0 31 00 00       	mov    %eax,0x31c0
+  if(argc <= 2){
+  3e:	0f 84 96 01 00 00    	je     1da <main+0x1da>
+  44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  48:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  4b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  4e:	bf 20 11 00 00       	mov    $0x1120,%edi
+    nthread = 0;
+    for(n = 0; n < NTHREAD && i+n < argc; n++){
+  53:	31 db                	xor    %ebx,%ebx
+  55:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  for(i = 2; i < argc; i += n){
+  58:	89 fe                	mov    %edi,%esi
+    for(n = 0; n < NTHREAD && i+n < argc; n++){
+  5a:	89 df                	mov    %ebx,%edi
+  5c:	29 c8                	sub    %ecx,%eax
+  5e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  61:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  64:	8d 04 88             	lea    (%eax,%ecx,4),%eax
+  67:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  6a:	eb 20                	jmp    8c <main+0x8c>
+  6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  70:	83 c7 01             	add    $0x1,%edi
+      if((jobs[n].fd = open(argv[i+n], 0)) < 0)
+        break;
+      if(thread_create(grep, &jobs[n]) >= 0)
+        nthread++;
+  73:	83 c3 01             	add    $0x1,%ebx
+    for(n = 0; n < NTHREAD && i+n < argc; n++){
+  76:	83 ff 08             	cmp    $0x8,%edi
+  79:	74 57                	je     d2 <main+0xd2>
+  7b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  7e:	81 c6 14 04 00 00    	add    $0x414,%esi
+  84:	39 c7                	cmp    %eax,%edi
+  86:	0f 84 04 01 00 00    	je     190 <main+0x190>
+      if((jobs[n].fd = open(argv[i+n], 0)) < 0)
+  8c:	83 ec 08             	sub    $0x8,%esp
+  8f:	6a 00                	push   $0x0
+  91:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  94:	ff 34 b8             	push   (%eax,%edi,4)
+  97:	e8 92 07 00 00       	call   82e <open>
+  9c:	83 c4 10             	add    $0x10,%esp
+  9f:	89 06                	mov    %eax,(%esi)
+  a1:	85 c0                	test   %eax,%eax
+  a3:	0f 88 e7 00 00 00    	js     190 <main+0x190>
+      if(thread_create(grep, &jobs[n]) >= 0)
+  a9:	83 ec 08             	sub    $0x8,%esp
+  ac:	56                   	push   %esi
+  ad:	68 50 04 00 00       	push   $0x450
+  b2:	e8 09 06 00 00       	call   6c0 <thread_create>
+  b7:	83 c4 10             	add    $0x10,%esp
+  ba:	85 c0                	test   %eax,%eax
+  bc:	79 b2                	jns    70 <main+0x70>
+      else
+        grep(&jobs[n]);
+  be:	83 ec 0c             	sub    $0xc,%esp
+    for(n = 0; n < NTHREAD && i+n < argc; n++){
+  c1:	83 c7 01             	add    $0x1,%edi
+        grep(&jobs[n]);
+  c4:	56                   	push   %esi
+  c5:	e8 86 03 00 00       	call   450 <grep>
+  ca:	83 c4 10             	add    $0x10,%esp
+    for(n = 0; n < NTHREAD && i+n < argc; n++){
+  cd:	83 ff 08             	cmp    $0x8,%edi
+  d0:	75 a9                	jne    7b <main+0x7b>
+  for(i = 2; i < argc; i += n){
+  d2:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  d5:	89 da                	mov    %ebx,%edx
+  d7:	89 fb                	mov    %edi,%ebx
+  d9:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    }
+    while(nthread-- > 0)
+  dc:	8d 72 ff             	lea    -0x1(%edx),%esi
+  for(i = 2; i < argc; i += n){
+  df:	83 c0 08             	add    $0x8,%eax
+  e2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    while(nthread-- > 0)
+  e5:	85 d2                	test   %edx,%edx
+  e7:	74 18                	je     101 <main+0x101>
+  e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      thread_join();
+  f0:	e8 9b 06 00 00       	call   790 <thread_join>
+    while(nthread-- > 0)
+  f5:	83 ee 01             	sub    $0x1,%esi
+  f8:	73 f6                	jae    f0 <main+0xf0>
+    for(k = 0; k < n; k++){
+  fa:	85 db                	test   %ebx,%ebx
+  fc:	74 6e                	je     16c <main+0x16c>
+  fe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 101:	69 f3 14 04 00 00    	imul   $0x414,%ebx,%esi
+ 107:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 10a:	81 c6 20 11 00 00    	add    $0x1120,%esi
+      if(jobs[k].out){
+ 110:	8b 47 08             	mov    0x8(%edi),%eax
+ 113:	85 c0                	test   %eax,%eax
+ 115:	74 1a                	je     131 <main+0x131>
+        write(1, jobs[k].out, jobs[k].nout);
+ 117:	83 ec 04             	sub    $0x4,%esp
+ 11a:	ff 77 0c             	push   0xc(%edi)
+ 11d:	50                   	push   %eax
+ 11e:	6a 01                	push   $0x1
+ 120:	e8 e9 06 00 00       	call   80e <write>
+        free(jobs[k].out);
+ 125:	5a                   	pop    %edx
+ 126:	ff 77 08             	push   0x8(%edi)
+ 129:	e8 92 0a 00 00       	call   bc0 <free>
+ 12e:	83 c4 10             	add    $0x10,%esp
+      }
+      jobs[k].out = 0;
+ 131:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+      jobs[k].nout = jobs[k].cap = 0;
+      close(jobs[k].fd);
+ 138:	83 ec 0c             	sub    $0xc,%esp
+    for(k = 0; k < n; k++){
+ 13b:	81 c7 14 04 00 00    	add    $0x414,%edi
+      jobs[k].nout = jobs[k].cap = 0;
+ 141:	c7 87 fc fb ff ff 00 	movl   $0x0,-0x404(%edi)
+ 148:	00 00 00 
+ 14b:	c7 87 f8 fb ff ff 00 	movl   $0x0,-0x408(%edi)
+ 152:	00 00 00 
+      close(jobs[k].fd);
+ 155:	ff b7 ec fb ff ff    	push   -0x414(%edi)
+ 15b:	e8 b6 06 00 00       	call   816 <close>
+    for(k = 0; k < n; k++){
+ 160:	83 c4 10             	add    $0x10,%esp
+ 163:	39 f7                	cmp    %esi,%edi
+ 165:	75 a9                	jne    110 <main+0x110>
+    }
+    if(n < NTHREAD && i+n < argc){
+ 167:	83 fb 08             	cmp    $0x8,%ebx
+ 16a:	74 14                	je     180 <main+0x180>
+ 16c:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 16f:	39 55 d8             	cmp    %edx,-0x28(%ebp)
+ 172:	7f 4e                	jg     1c2 <main+0x1c2>
+      printf(1, "grep: cannot open %s\n", argv[i+n]);
+      exit();
+    }
+  }
+  exit();
+ 174:	e8 75 06 00 00       	call   7ee <exit>
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 2; i < argc; i += n){
+ 180:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 183:	39 55 d8             	cmp    %edx,-0x28(%ebp)
+ 186:	0f 8f bc fe ff ff    	jg     48 <main+0x48>
+ 18c:	eb e6                	jmp    174 <main+0x174>
+ 18e:	66 90                	xchg   %ax,%ax
+ 190:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 193:	89 da                	mov    %ebx,%edx
+ 195:	89 fb                	mov    %edi,%ebx
+ 197:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    while(nthread-- > 0)
+ 19a:	8d 72 ff             	lea    -0x1(%edx),%esi
+  for(i = 2; i < argc; i += n){
+ 19d:	01 d8                	add    %ebx,%eax
+ 19f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    while(nthread-- > 0)
+ 1a2:	85 d2                	test   %edx,%edx
+ 1a4:	0f 85 46 ff ff ff    	jne    f0 <main+0xf0>
+ 1aa:	e9 4b ff ff ff       	jmp    fa <main+0xfa>
+    printf(2, "usage: grep pattern [file ...]\n");
+ 1af:	53                   	push   %ebx
+ 1b0:	53                   	push   %ebx
+ 1b1:	68 08 0d 00 00       	push   $0xd08
+ 1b6:	6a 02                	push   $0x2
+ 1b8:	e8 d3 07 00 00       	call   990 <printf>
+    exit();
+ 1bd:	e8 2c 06 00 00       	call   7ee <exit>
+      printf(1, "grep: cannot open %s\n", argv[i+n]);
+ 1c2:	50                   	push   %eax
+ 1c3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 1c6:	ff 34 90             	push   (%eax,%edx,4)
+ 1c9:	68 28 0d 00 00       	push   $0xd28
+ 1ce:	6a 01                	push   $0x1
+ 1d0:	e8 bb 07 00 00       	call   990 <printf>
+      exit();
+ 1d5:	e8 14 06 00 00       	call   7ee <exit>
+    jobs[0].direct = 1;
+ 1da:	c7 05 24 11 00 00 01 	movl   $0x1,0x1124
+ 1e1:	00 00 00 
+    grep(&jobs[0]);
+ 1e4:	83 ec 0c             	sub    $0xc,%esp
+    jobs[0].fd = 0;
+ 1e7:	31 c9                	xor    %ecx,%ecx
+    grep(&jobs[0]);
+ 1e9:	68 20 11 00 00       	push   $0x1120
+    jobs[0].fd = 0;
+ 1ee:	89 0d 20 11 00 00    	mov    %ecx,0x1120
+    grep(&jobs[0]);
+ 1f4:	e8 57 02 00 00       	call   450 <grep>
+    exit();
+ 1f9:	e8 f0 05 00 00       	call   7ee <exit>
+ 1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <emit>:
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	57                   	push   %edi
+ 204:	56                   	push   %esi
+ 205:	53                   	push   %ebx
+ 206:	83 ec 1c             	sub    $0x1c,%esp
+ 209:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 20c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 20f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(!j->direct && j->nout + n > j->cap){
+ 212:	8b 4b 04             	mov    0x4(%ebx),%ecx
+ 215:	85 c9                	test   %ecx,%ecx
+ 217:	74 1f                	je     238 <emit+0x38>
+    write(1, p, n);
+ 219:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 21c:	89 55 0c             	mov    %edx,0xc(%ebp)
+ 21f:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+ 226:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 229:	5b                   	pop    %ebx
+ 22a:	5e                   	pop    %esi
+ 22b:	5f                   	pop    %edi
+ 22c:	5d                   	pop    %ebp
+    write(1, p, n);
+ 22d:	e9 dc 05 00 00       	jmp    80e <write>
+ 232:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(!j->direct && j->nout + n > j->cap){
+ 238:	8b 43 0c             	mov    0xc(%ebx),%eax
+ 23b:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ 23e:	3b 4b 10             	cmp    0x10(%ebx),%ecx
+ 241:	7f 25                	jg     268 <emit+0x68>
+  memmove(j->out + j->nout, p, n);
+ 243:	8b 73 08             	mov    0x8(%ebx),%esi
+ 246:	83 ec 04             	sub    $0x4,%esp
+ 249:	01 c6                	add    %eax,%esi
+ 24b:	57                   	push   %edi
+ 24c:	52                   	push   %edx
+ 24d:	56                   	push   %esi
+ 24e:	e8 0d 04 00 00       	call   660 <memmove>
+  j->nout += n;
+ 253:	01 7b 0c             	add    %edi,0xc(%ebx)
+ 256:	83 c4 10             	add    $0x10,%esp
+}
+ 259:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 25c:	5b                   	pop    %ebx
+ 25d:	5e                   	pop    %esi
+ 25e:	5f                   	pop    %edi
+ 25f:	5d                   	pop    %ebp
+ 260:	c3                   	ret
+ 261:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    j->cap = 2 * (j->nout + n);
+ 268:	01 c9                	add    %ecx,%ecx
+    if((out = malloc(j->cap)) == 0){
+ 26a:	83 ec 0c             	sub    $0xc,%esp
+ 26d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    j->cap = 2 * (j->nout + n);
+ 270:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    if((out = malloc(j->cap)) == 0){
+ 273:	51                   	push   %ecx
+ 274:	e8 77 09 00 00       	call   bf0 <malloc>
+ 279:	83 c4 10             	add    $0x10,%esp
+ 27c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 27f:	85 c0                	test   %eax,%eax
+ 281:	89 c6                	mov    %eax,%esi
+ 283:	74 4b                	je     2d0 <emit+0xd0>
+      memmove(out, j->out, j->nout);
+ 285:	83 ec 04             	sub    $0x4,%esp
+ 288:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 28b:	ff 73 0c             	push   0xc(%ebx)
+ 28e:	ff 73 08             	push   0x8(%ebx)
+ 291:	50                   	push   %eax
+ 292:	e8 c9 03 00 00       	call   660 <memmove>
+      if(j->out)
+ 297:	8b 43 08             	mov    0x8(%ebx),%eax
+ 29a:	83 c4 10             	add    $0x10,%esp
+ 29d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 2a0:	85 c0                	test   %eax,%eax
+ 2a2:	74 0f                	je     2b3 <emit+0xb3>
+        free(j->out);
+ 2a4:	83 ec 0c             	sub    $0xc,%esp
+ 2a7:	50                   	push   %eax
+ 2a8:	e8 13 09 00 00       	call   bc0 <free>
+ 2ad:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 2b0:	83 c4 10             	add    $0x10,%esp
+  if(j->direct){
+ 2b3:	8b 43 04             	mov    0x4(%ebx),%eax
+      j->out = out;
+ 2b6:	89 73 08             	mov    %esi,0x8(%ebx)
+  if(j->direct){
+ 2b9:	85 c0                	test   %eax,%eax
+ 2bb:	0f 85 58 ff ff ff    	jne    219 <emit+0x19>
+  memmove(j->out + j->nout, p, n);
+ 2c1:	8b 43 0c             	mov    0xc(%ebx),%eax
+ 2c4:	eb 80                	jmp    246 <emit+0x46>
+ 2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+      write(1, j->out, j->nout);
+ 2d0:	83 ec 04             	sub    $0x4,%esp
+ 2d3:	ff 73 0c             	push   0xc(%ebx)
+ 2d6:	ff 73 08             	push   0x8(%ebx)
+ 2d9:	6a 01                	push   $0x1
+ 2db:	e8 2e 05 00 00       	call   80e <write>
+      if(j->out)
+ 2e0:	8b 43 08             	mov    0x8(%ebx),%eax
+ 2e3:	83 c4 10             	add    $0x10,%esp
+ 2e6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 2e9:	85 c0                	test   %eax,%eax
+ 2eb:	74 0f                	je     2fc <emit+0xfc>
+        free(j->out);
+ 2ed:	83 ec 0c             	sub    $0xc,%esp
+ 2f0:	50                   	push   %eax
+ 2f1:	e8 ca 08 00 00       	call   bc0 <free>
+ 2f6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 2f9:	83 c4 10             	add    $0x10,%esp
+      j->out = 0;
+ 2fc:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+      j->nout = 0;
+ 303:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+      j->direct = 1;
+ 30a:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+ 311:	e9 03 ff ff ff       	jmp    219 <emit+0x19>
+ 316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000320 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	56                   	push   %esi
+ 325:	53                   	push   %ebx
+ 326:	83 ec 0c             	sub    $0xc,%esp
+ 329:	8b 7d 08             	mov    0x8(%ebp),%edi
+ 32c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+ 32f:	0f b6 0f             	movzbl (%edi),%ecx
+ 332:	84 c9                	test   %cl,%cl
+ 334:	0f 84 96 00 00 00    	je     3d0 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+ 33a:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+ 33e:	3c 2a                	cmp    $0x2a,%al
+ 340:	74 2d                	je     36f <matchhere+0x4f>
+ 342:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+ 348:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+ 34b:	80 f9 24             	cmp    $0x24,%cl
+ 34e:	74 50                	je     3a0 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 350:	89 f2                	mov    %esi,%edx
+ 352:	84 d2                	test   %dl,%dl
+ 354:	74 6e                	je     3c4 <matchhere+0xa4>
+ 356:	80 f9 2e             	cmp    $0x2e,%cl
+ 359:	75 65                	jne    3c0 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+ 35b:	83 c3 01             	add    $0x1,%ebx
+ 35e:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 361:	84 c0                	test   %al,%al
+ 363:	74 6b                	je     3d0 <matchhere+0xb0>
+ 365:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+ 367:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+ 36b:	3c 2a                	cmp    $0x2a,%al
+ 36d:	75 d9                	jne    348 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+ 36f:	8d 77 02             	lea    0x2(%edi),%esi
+ 372:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+ 375:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+ 378:	83 ec 08             	sub    $0x8,%esp
+ 37b:	53                   	push   %ebx
+ 37c:	56                   	push   %esi
+ 37d:	e8 9e ff ff ff       	call   320 <matchhere>
+ 382:	83 c4 10             	add    $0x10,%esp
+ 385:	85 c0                	test   %eax,%eax
+ 387:	75 47                	jne    3d0 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 389:	0f be 13             	movsbl (%ebx),%edx
+ 38c:	84 d2                	test   %dl,%dl
+ 38e:	74 45                	je     3d5 <matchhere+0xb5>
+ 390:	83 c3 01             	add    $0x1,%ebx
+ 393:	39 fa                	cmp    %edi,%edx
+ 395:	74 e1                	je     378 <matchhere+0x58>
+ 397:	83 ff 2e             	cmp    $0x2e,%edi
+ 39a:	74 dc                	je     378 <matchhere+0x58>
+ 39c:	eb 37                	jmp    3d5 <matchhere+0xb5>
+ 39e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+ 3a0:	84 c0                	test   %al,%al
+ 3a2:	74 39                	je     3dd <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 3a4:	89 f2                	mov    %esi,%edx
+ 3a6:	84 d2                	test   %dl,%dl
+ 3a8:	74 1a                	je     3c4 <matchhere+0xa4>
+ 3aa:	80 fa 24             	cmp    $0x24,%dl
+ 3ad:	75 15                	jne    3c4 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+ 3af:	83 c3 01             	add    $0x1,%ebx
+ 3b2:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 3b5:	89 c1                	mov    %eax,%ecx
+ 3b7:	eb ae                	jmp    367 <matchhere+0x47>
+ 3b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 3c0:	38 ca                	cmp    %cl,%dl
+ 3c2:	74 97                	je     35b <matchhere+0x3b>
+}
+ 3c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+ 3c7:	31 c0                	xor    %eax,%eax
+}
+ 3c9:	5b                   	pop    %ebx
+ 3ca:	5e                   	pop    %esi
+ 3cb:	5f                   	pop    %edi
+ 3cc:	5d                   	pop    %ebp
+ 3cd:	c3                   	ret
+ 3ce:	66 90                	xchg   %ax,%ax
+    return 1;
+ 3d0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 3d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3d8:	5b                   	pop    %ebx
+ 3d9:	5e                   	pop    %esi
+ 3da:	5f                   	pop    %edi
+ 3db:	5d                   	pop    %ebp
+ 3dc:	c3                   	ret
+    return *text == '\0';
+ 3dd:	89 f0                	mov    %esi,%eax
+ 3df:	84 c0                	test   %al,%al
+ 3e1:	0f 94 c0             	sete   %al
+ 3e4:	0f b6 c0             	movzbl %al,%eax
+ 3e7:	eb ec                	jmp    3d5 <matchhere+0xb5>
+ 3e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <match>:
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	56                   	push   %esi
+ 3f4:	53                   	push   %ebx
+ 3f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 3f8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+ 3fb:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+ 3fe:	75 11                	jne    411 <match+0x21>
+ 400:	eb 2e                	jmp    430 <match+0x40>
+ 402:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+ 408:	83 c6 01             	add    $0x1,%esi
+ 40b:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+ 40f:	74 16                	je     427 <match+0x37>
+    if(matchhere(re, text))
+ 411:	83 ec 08             	sub    $0x8,%esp
+ 414:	56                   	push   %esi
+ 415:	53                   	push   %ebx
+ 416:	e8 05 ff ff ff       	call   320 <matchhere>
+ 41b:	83 c4 10             	add    $0x10,%esp
+ 41e:	85 c0                	test   %eax,%eax
+ 420:	74 e6                	je     408 <match+0x18>
+      return 1;
+ 422:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 427:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 42a:	5b                   	pop    %ebx
+ 42b:	5e                   	pop    %esi
+ 42c:	5d                   	pop    %ebp
+ 42d:	c3                   	ret
+ 42e:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+ 430:	83 c3 01             	add    $0x1,%ebx
+ 433:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 436:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 439:	5b                   	pop    %ebx
+ 43a:	5e                   	pop    %esi
+ 43b:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+ 43c:	e9 df fe ff ff       	jmp    320 <matchhere>
+ 441:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 448:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44f:	90                   	nop
+
+00000450 <grep>:
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	57                   	push   %edi
+  m = 0;
+ 454:	31 ff                	xor    %edi,%edi
+{
+ 456:	56                   	push   %esi
+ 457:	53                   	push   %ebx
+ 458:	83 ec 1c             	sub    $0x1c,%esp
+  char *buf = j->buf;
+ 45b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 45e:	89 7d e0             	mov    %edi,-0x20(%ebp)
+ 461:	8d 58 14             	lea    0x14(%eax),%ebx
+  while((n = read(j->fd, buf+m, sizeof(j->buf)-m-1)) > 0){
+ 464:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ 467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46e:	66 90                	xchg   %ax,%ax
+ 470:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 473:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+ 478:	83 ec 04             	sub    $0x4,%esp
+ 47b:	29 c8                	sub    %ecx,%eax
+ 47d:	50                   	push   %eax
+ 47e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 481:	01 c8                	add    %ecx,%eax
+ 483:	50                   	push   %eax
+ 484:	8b 45 08             	mov    0x8(%ebp),%eax
+ 487:	ff 30                	push   (%eax)
+ 489:	e8 78 03 00 00       	call   806 <read>
+ 48e:	83 c4 10             	add    $0x10,%esp
+ 491:	85 c0                	test   %eax,%eax
+ 493:	0f 8e f9 00 00 00    	jle    592 <grep+0x142>
+    m += n;
+ 499:	01 45 e0             	add    %eax,-0x20(%ebp)
+    buf[m] = '\0';
+ 49c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    m += n;
+ 49f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  char *buf = j->buf;
+ 4a2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    buf[m] = '\0';
+ 4a5:	c6 04 08 00          	movb   $0x0,(%eax,%ecx,1)
+    while((q = strchr(p, '\n')) != 0){
+ 4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4b0:	83 ec 08             	sub    $0x8,%esp
+ 4b3:	6a 0a                	push   $0xa
+ 4b5:	ff 75 e4             	push   -0x1c(%ebp)
+ 4b8:	e8 63 01 00 00       	call   620 <strchr>
+ 4bd:	83 c4 10             	add    $0x10,%esp
+ 4c0:	89 c7                	mov    %eax,%edi
+ 4c2:	85 c0                	test   %eax,%eax
+ 4c4:	0f 84 86 00 00 00    	je     550 <grep+0x100>
+      *q = 0;
+ 4ca:	c6 07 00             	movb   $0x0,(%edi)
+      if(match(pattern, p)){
+ 4cd:	8b 1d c0 31 00 00    	mov    0x31c0,%ebx
+  if(re[0] == '^')
+ 4d3:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 4d6:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+ 4d9:	75 0e                	jne    4e9 <grep+0x99>
+ 4db:	eb 53                	jmp    530 <grep+0xe0>
+ 4dd:	8d 76 00             	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+ 4e0:	83 c6 01             	add    $0x1,%esi
+ 4e3:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+ 4e7:	74 37                	je     520 <grep+0xd0>
+    if(matchhere(re, text))
+ 4e9:	83 ec 08             	sub    $0x8,%esp
+ 4ec:	56                   	push   %esi
+ 4ed:	53                   	push   %ebx
+ 4ee:	e8 2d fe ff ff       	call   320 <matchhere>
+ 4f3:	83 c4 10             	add    $0x10,%esp
+ 4f6:	85 c0                	test   %eax,%eax
+ 4f8:	74 e6                	je     4e0 <grep+0x90>
+        emit(j, p, q+1 - p);
+ 4fa:	8d 77 01             	lea    0x1(%edi),%esi
+ 4fd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 500:	89 f0                	mov    %esi,%eax
+ 502:	83 ec 04             	sub    $0x4,%esp
+        *q = '\n';
+ 505:	c6 07 0a             	movb   $0xa,(%edi)
+        emit(j, p, q+1 - p);
+ 508:	29 d0                	sub    %edx,%eax
+ 50a:	50                   	push   %eax
+ 50b:	52                   	push   %edx
+ 50c:	ff 75 08             	push   0x8(%ebp)
+ 50f:	e8 ec fc ff ff       	call   200 <emit>
+ 514:	83 c4 10             	add    $0x10,%esp
+ 517:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+ 51a:	eb 94                	jmp    4b0 <grep+0x60>
+ 51c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 520:	8d 47 01             	lea    0x1(%edi),%eax
+ 523:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      p = q+1;
+ 526:	eb 88                	jmp    4b0 <grep+0x60>
+ 528:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52f:	90                   	nop
+    return matchhere(re+1, text);
+ 530:	83 ec 08             	sub    $0x8,%esp
+ 533:	8d 4b 01             	lea    0x1(%ebx),%ecx
+ 536:	56                   	push   %esi
+        emit(j, p, q+1 - p);
+ 537:	8d 77 01             	lea    0x1(%edi),%esi
+    return matchhere(re+1, text);
+ 53a:	51                   	push   %ecx
+ 53b:	e8 e0 fd ff ff       	call   320 <matchhere>
+ 540:	83 c4 10             	add    $0x10,%esp
+      if(match(pattern, p)){
+ 543:	85 c0                	test   %eax,%eax
+ 545:	74 d0                	je     517 <grep+0xc7>
+ 547:	eb b4                	jmp    4fd <grep+0xad>
+ 549:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(p == buf)
+ 550:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 553:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+ 556:	74 2e                	je     586 <grep+0x136>
+    if(m > 0){
+ 558:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 55b:	85 c0                	test   %eax,%eax
+ 55d:	0f 8e 0d ff ff ff    	jle    470 <grep+0x20>
+      m -= p - buf;
+ 563:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 566:	8b 7d dc             	mov    -0x24(%ebp),%edi
+      memmove(buf, p, m);
+ 569:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+ 56c:	89 d0                	mov    %edx,%eax
+ 56e:	29 f8                	sub    %edi,%eax
+ 570:	29 45 e0             	sub    %eax,-0x20(%ebp)
+ 573:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+ 576:	51                   	push   %ecx
+ 577:	52                   	push   %edx
+ 578:	57                   	push   %edi
+ 579:	e8 e2 00 00 00       	call   660 <memmove>
+ 57e:	83 c4 10             	add    $0x10,%esp
+ 581:	e9 ea fe ff ff       	jmp    470 <grep+0x20>
+      m = 0;
+ 586:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 58d:	e9 de fe ff ff       	jmp    470 <grep+0x20>
+}
+ 592:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 595:	5b                   	pop    %ebx
+ 596:	5e                   	pop    %esi
+ 597:	5f                   	pop    %edi
+ 598:	5d                   	pop    %ebp
+ 599:	c3                   	ret
+ 59a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005a0 <matchstar>:
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	57                   	push   %edi
+ 5a4:	56                   	push   %esi
+ 5a5:	53                   	push   %ebx
+ 5a6:	83 ec 0c             	sub    $0xc,%esp
+ 5a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 5ac:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 5af:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 5b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+ 5b8:	83 ec 08             	sub    $0x8,%esp
+ 5bb:	57                   	push   %edi
+ 5bc:	56                   	push   %esi
+ 5bd:	e8 5e fd ff ff       	call   320 <matchhere>
+ 5c2:	83 c4 10             	add    $0x10,%esp
+ 5c5:	85 c0                	test   %eax,%eax
+ 5c7:	75 1f                	jne    5e8 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 5c9:	0f be 17             	movsbl (%edi),%edx
+ 5cc:	84 d2                	test   %dl,%dl
+ 5ce:	74 0c                	je     5dc <matchstar+0x3c>
+ 5d0:	83 c7 01             	add    $0x1,%edi
+ 5d3:	39 da                	cmp    %ebx,%edx
+ 5d5:	74 e1                	je     5b8 <matchstar+0x18>
+ 5d7:	83 fb 2e             	cmp    $0x2e,%ebx
+ 5da:	74 dc                	je     5b8 <matchstar+0x18>
+}
+ 5dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5df:	5b                   	pop    %ebx
+ 5e0:	5e                   	pop    %esi
+ 5e1:	5f                   	pop    %edi
+ 5e2:	5d                   	pop    %ebp
+ 5e3:	c3                   	ret
+ 5e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+ 5eb:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 5f0:	5b                   	pop    %ebx
+ 5f1:	5e                   	pop    %esi
+ 5f2:	5f                   	pop    %edi
+ 5f3:	5d                   	pop    %ebp
+ 5f4:	c3                   	ret
+ 5f5:	66 90                	xchg   %ax,%ax
+ 5f7:	66 90                	xchg   %ax,%ax
+ 5f9:	66 90                	xchg   %ax,%ax
+ 5fb:	66 90                	xchg   %ax,%ax
+ 5fd:	66 90                	xchg   %ax,%ax
+ 5ff:	90                   	nop
+
+00000600 <threadstart>:
+static lock_t stacklock;
+static char *freestacks;  // linked through their first word
+
+static void
+threadstart(void *fn, void *arg)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+ 606:	ff 75 0c             	push   0xc(%ebp)
+ 609:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+ 60c:	e8 dd 01 00 00       	call   7ee <exit>
+ 611:	66 90                	xchg   %ax,%ax
+ 613:	66 90                	xchg   %ax,%ax
+ 615:	66 90                	xchg   %ax,%ax
+ 617:	66 90                	xchg   %ax,%ax
+ 619:	66 90                	xchg   %ax,%ax
+ 61b:	66 90                	xchg   %ax,%ax
+ 61d:	66 90                	xchg   %ax,%ax
+ 61f:	90                   	nop
+
+00000620 <strchr>:
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	8b 45 08             	mov    0x8(%ebp),%eax
+ 626:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 62a:	0f b6 10             	movzbl (%eax),%edx
+ 62d:	84 d2                	test   %dl,%dl
+ 62f:	75 12                	jne    643 <strchr+0x23>
+ 631:	eb 1d                	jmp    650 <strchr+0x30>
+ 633:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 637:	90                   	nop
+ 638:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 63c:	83 c0 01             	add    $0x1,%eax
+ 63f:	84 d2                	test   %dl,%dl
+ 641:	74 0d                	je     650 <strchr+0x30>
+    if(*s == c)
+ 643:	38 d1                	cmp    %dl,%cl
+ 645:	75 f1                	jne    638 <strchr+0x18>
+}
+ 647:	5d                   	pop    %ebp
+ 648:	c3                   	ret
+ 649:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 650:	31 c0                	xor    %eax,%eax
+}
+ 652:	5d                   	pop    %ebp
+ 653:	c3                   	ret
+ 654:	66 90                	xchg   %ax,%ax
+ 656:	66 90                	xchg   %ax,%ax
+ 658:	66 90                	xchg   %ax,%ax
+ 65a:	66 90                	xchg   %ax,%ax
+ 65c:	66 90                	xchg   %ax,%ax
+ 65e:	66 90                	xchg   %ax,%ax
+
+00000660 <memmove>:
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	57                   	push   %edi
+ 664:	56                   	push   %esi
+ 665:	8b 45 10             	mov    0x10(%ebp),%eax
+ 668:	8b 55 08             	mov    0x8(%ebp),%edx
+ 66b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 66e:	85 c0                	test   %eax,%eax
+ 670:	7e 13                	jle    685 <memmove+0x25>
+ 672:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 674:	89 d7                	mov    %edx,%edi
+ 676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 680:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 681:	39 f8                	cmp    %edi,%eax
+ 683:	75 fb                	jne    680 <memmove+0x20>
+}
+ 685:	5e                   	pop    %esi
+ 686:	89 d0                	mov    %edx,%eax
+ 688:	5f                   	pop    %edi
+ 689:	5d                   	pop    %ebp
+ 68a:	c3                   	ret
+ 68b:	66 90                	xchg   %ax,%ax
+ 68d:	66 90                	xchg   %ax,%ax
+ 68f:	90                   	nop
+
+00000690 <lock_acquire>:
+{
+ 690:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 691:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 696:	89 e5                	mov    %esp,%ebp
+ 698:	8b 55 08             	mov    0x8(%ebp),%edx
+ 69b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 69f:	90                   	nop
+ 6a0:	89 c8                	mov    %ecx,%eax
+ 6a2:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+ 6a5:	85 c0                	test   %eax,%eax
+ 6a7:	75 f7                	jne    6a0 <lock_acquire+0x10>
+}
+ 6a9:	5d                   	pop    %ebp
+ 6aa:	c3                   	ret
+ 6ab:	66 90                	xchg   %ax,%ax
+ 6ad:	66 90                	xchg   %ax,%ax
+ 6af:	90                   	nop
+
+000006b0 <lock_release>:
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	31 c0                	xor    %eax,%eax
+ 6b3:	89 e5                	mov    %esp,%ebp
+ 6b5:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6b8:	f0 87 02             	lock xchg %eax,(%edx)
+}
+ 6bb:	5d                   	pop    %ebp
+ 6bc:	c3                   	ret
+ 6bd:	66 90                	xchg   %ax,%ax
+ 6bf:	90                   	nop
+
+000006c0 <thread_create>:
+}
+
+// Start a thread running fn(arg).  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	ba 01 00 00 00       	mov    $0x1,%edx
+ 6c6:	89 e5                	mov    %esp,%ebp
+ 6c8:	53                   	push   %ebx
+ 6c9:	83 ec 04             	sub    $0x4,%esp
+ 6cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6d0:	89 d0                	mov    %edx,%eax
+ 6d2:	f0 87 05 c8 31 00 00 	lock xchg %eax,0x31c8
+  while(xchg(&lk->locked, 1) != 0)
+ 6d9:	85 c0                	test   %eax,%eax
+ 6db:	75 f3                	jne    6d0 <thread_create+0x10>
+  char *stack;
+  int pid;
+
+  lock_acquire(&stacklock);
+  if((stack = freestacks) != 0)
+ 6dd:	8b 1d c4 31 00 00    	mov    0x31c4,%ebx
+ 6e3:	85 db                	test   %ebx,%ebx
+ 6e5:	74 71                	je     758 <thread_create+0x98>
+    freestacks = *(char**)stack;
+ 6e7:	8b 13                	mov    (%ebx),%edx
+ 6e9:	89 15 c4 31 00 00    	mov    %edx,0x31c4
+ 6ef:	f0 87 05 c8 31 00 00 	lock xchg %eax,0x31c8
+  lock_release(&stacklock);
+  if(stack == 0 && (stack = sbrk(TSTACK)) == (char*)-1)
+    return -1;
+  if((pid = clone(threadstart, fn, arg, stack)) < 0){
+ 6f6:	53                   	push   %ebx
+ 6f7:	ff 75 0c             	push   0xc(%ebp)
+ 6fa:	ff 75 08             	push   0x8(%ebp)
+ 6fd:	68 00 06 00 00       	push   $0x600
+ 702:	e8 a7 01 00 00       	call   8ae <clone>
+ 707:	83 c4 10             	add    $0x10,%esp
+ 70a:	89 c2                	mov    %eax,%edx
+ 70c:	85 c0                	test   %eax,%eax
+ 70e:	78 10                	js     720 <thread_create+0x60>
+    *(char**)stack = freestacks;
+    freestacks = stack;
+    lock_release(&stacklock);
+  }
+  return pid;
+}
+ 710:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 713:	89 d0                	mov    %edx,%eax
+ 715:	c9                   	leave
+ 716:	c3                   	ret
+ 717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71e:	66 90                	xchg   %ax,%ax
+ 720:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 725:	8d 76 00             	lea    0x0(%esi),%esi
+ 728:	89 c8                	mov    %ecx,%eax
+ 72a:	f0 87 05 c8 31 00 00 	lock xchg %eax,0x31c8
+  while(xchg(&lk->locked, 1) != 0)
+ 731:	85 c0                	test   %eax,%eax
+ 733:	75 f3                	jne    728 <thread_create+0x68>
+    *(char**)stack = freestacks;
+ 735:	8b 0d c4 31 00 00    	mov    0x31c4,%ecx
+    freestacks = stack;
+ 73b:	89 1d c4 31 00 00    	mov    %ebx,0x31c4
+    *(char**)stack = freestacks;
+ 741:	89 0b                	mov    %ecx,(%ebx)
+ 743:	f0 87 05 c8 31 00 00 	lock xchg %eax,0x31c8
+}
+ 74a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 74d:	89 d0                	mov    %edx,%eax
+ 74f:	c9                   	leave
+ 750:	c3                   	ret
+ 751:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 758:	89 d8                	mov    %ebx,%eax
+ 75a:	f0 87 05 c8 31 00 00 	lock xchg %eax,0x31c8
+  if(stack == 0 && (stack = sbrk(TSTACK)) == (char*)-1)
+ 761:	83 ec 0c             	sub    $0xc,%esp
+ 764:	68 00 10 00 00       	push   $0x1000
+ 769:	e8 08 01 00 00       	call   876 <sbrk>
+ 76e:	83 c4 10             	add    $0x10,%esp
+ 771:	89 c3                	mov    %eax,%ebx
+ 773:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 776:	0f 85 7a ff ff ff    	jne    6f6 <thread_create+0x36>
+    return -1;
+ 77c:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+ 781:	eb 8d                	jmp    710 <thread_create+0x50>
+ 783:	66 90                	xchg   %ax,%ax
+ 785:	66 90                	xchg   %ax,%ax
+ 787:	66 90                	xchg   %ax,%ax
+ 789:	66 90                	xchg   %ax,%ax
+ 78b:	66 90                	xchg   %ax,%ax
+ 78d:	66 90                	xchg   %ax,%ax
+ 78f:	90                   	nop
+
+00000790 <thread_join>:
+
+// Wait for a thread started by thread_create() to finish.
+// Returns its pid, or -1 if there are none.
+int
+thread_join(void)
+{
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+ 793:	53                   	push   %ebx
+  char *stack;
+  int pid;
+
+  if((pid = join((void**)&stack)) < 0)
+ 794:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ 797:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join((void**)&stack)) < 0)
+ 79a:	50                   	push   %eax
+ 79b:	e8 16 01 00 00       	call   8b6 <join>
+ 7a0:	83 c4 10             	add    $0x10,%esp
+ 7a3:	85 c0                	test   %eax,%eax
+ 7a5:	78 38                	js     7df <thread_join+0x4f>
+ 7a7:	89 c1                	mov    %eax,%ecx
+ 7a9:	ba 01 00 00 00       	mov    $0x1,%edx
+ 7ae:	66 90                	xchg   %ax,%ax
+ 7b0:	89 d0                	mov    %edx,%eax
+ 7b2:	f0 87 05 c8 31 00 00 	lock xchg %eax,0x31c8
+  while(xchg(&lk->locked, 1) != 0)
+ 7b9:	85 c0                	test   %eax,%eax
+ 7bb:	75 f3                	jne    7b0 <thread_join+0x20>
+    return -1;
+  lock_acquire(&stacklock);
+  *(char**)stack = freestacks;
+ 7bd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 7c0:	8b 1d c4 31 00 00    	mov    0x31c4,%ebx
+ 7c6:	89 1a                	mov    %ebx,(%edx)
+  freestacks = stack;
+ 7c8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 7cb:	89 15 c4 31 00 00    	mov    %edx,0x31c4
+ 7d1:	f0 87 05 c8 31 00 00 	lock xchg %eax,0x31c8
+  lock_release(&stacklock);
+  return pid;
+}
+ 7d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 7db:	89 c8                	mov    %ecx,%eax
+ 7dd:	c9                   	leave
+ 7de:	c3                   	ret
+    return -1;
+ 7df:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ 7e4:	eb f2                	jmp    7d8 <thread_join+0x48>
+
+000007e6 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 7e6:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7eb:	cd 40                	int    $0x40
+ 7ed:	c3                   	ret
+
+000007ee <exit>:
+SYSCALL(exit)
+ 7ee:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7f3:	cd 40                	int    $0x40
+ 7f5:	c3                   	ret
+
+000007f6 <wait>:
+SYSCALL(wait)
+ 7f6:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7fb:	cd 40                	int    $0x40
+ 7fd:	c3                   	ret
+
+000007fe <pipe>:
+SYSCALL(pipe)
+ 7fe:	b8 04 00 00 00       	mov    $0x4,%eax
+ 803:	cd 40                	int    $0x40
+ 805:	c3                   	ret
+
+00000806 <read>:
+SYSCALL(read)
+ 806:	b8 05 00 00 00       	mov    $0x5,%eax
+ 80b:	cd 40                	int    $0x40
+ 80d:	c3                   	ret
+
+0000080e <write>:
+SYSCALL(write)
+ 80e:	b8 10 00 00 00       	mov    $0x10,%eax
+ 813:	cd 40                	int    $0x40
+ 815:	c3                   	ret
+
+00000816 <close>:
+SYSCALL(close)
+ 816:	b8 15 00 00 00       	mov    $0x15,%eax
+ 81b:	cd 40                	int    $0x40
+ 81d:	c3                   	ret
+
+0000081e <kill>:
+SYSCALL(kill)
+ 81e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 823:	cd 40                	int    $0x40
+ 825:	c3                   	ret
+
+00000826 <exec>:
+SYSCALL(exec)
+ 826:	b8 07 00 00 00       	mov    $0x7,%eax
+ 82b:	cd 40                	int    $0x40
+ 82d:	c3                   	ret
+
+0000082e <open>:
+SYSCALL(open)
+ 82e:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 833:	cd 40                	int    $0x40
+ 835:	c3                   	ret
+
+00000836 <mknod>:
+SYSCALL(mknod)
+ 836:	b8 11 00 00 00       	mov    $0x11,%eax
+ 83b:	cd 40                	int    $0x40
+ 83d:	c3                   	ret
+
+0000083e <unlink>:
+SYSCALL(unlink)
+ 83e:	b8 12 00 00 00       	mov    $0x12,%eax
+ 843:	cd 40                	int    $0x40
+ 845:	c3                   	ret
+
+00000846 <fstat>:
+SYSCALL(fstat)
+ 846:	b8 08 00 00 00       	mov    $0x8,%eax
+ 84b:	cd 40                	int    $0x40
+ 84d:	c3                   	ret
+
+0000084e <link>:
+SYSCALL(link)
+ 84e:	b8 13 00 00 00       	mov    $0x13,%eax
+ 853:	cd 40                	int    $0x40
+ 855:	c3                   	ret
+
+00000856 <mkdir>:
+SYSCALL(mkdir)
+ 856:	b8 14 00 00 00       	mov    $0x14,%eax
+ 85b:	cd 40                	int    $0x40
+ 85d:	c3                   	ret
+
+0000085e <chdir>:
+SYSCALL(chdir)
+ 85e:	b8 09 00 00 00       	mov    $0x9,%eax
+ 863:	cd 40                	int    $0x40
+ 865:	c3                   	ret
+
+00000866 <dup>:
+SYSCALL(dup)
+ 866:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 86b:	cd 40                	int    $0x40
+ 86d:	c3                   	ret
+
+0000086e <getpid>:
+SYSCALL(getpid)
+ 86e:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 873:	cd 40                	int    $0x40
+ 875:	c3                   	ret
+
+00000876 <sbrk>:
+SYSCALL(sbrk)
+ 876:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 87b:	cd 40                	int    $0x40
+ 87d:	c3                   	ret
+
+0000087e <sleep>:
+SYSCALL(sleep)
+ 87e:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 883:	cd 40                	int    $0x40
+ 885:	c3                   	ret
+
+00000886 <uptime>:
+SYSCALL(uptime)
+ 886:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 88b:	cd 40                	int    $0x40
+ 88d:	c3                   	ret
+
+0000088e <setpriority>:
+SYSCALL(setpriority)
+ 88e:	b8 16 00 00 00       	mov    $0x16,%eax
+ 893:	cd 40                	int    $0x40
+ 895:	c3                   	ret
+
+00000896 <settickets>:
+SYSCALL(settickets)
+ 896:	b8 17 00 00 00       	mov    $0x17,%eax
+ 89b:	cd 40                	int    $0x40
+ 89d:	c3                   	ret
+
+0000089e <getpinfo>:
+SYSCALL(getpinfo)
+ 89e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8a3:	cd 40                	int    $0x40
+ 8a5:	c3                   	ret
+
+000008a6 <nanosleep>:
+SYSCALL(nanosleep)
+ 8a6:	b8 19 00 00 00       	mov    $0x19,%eax
+ 8ab:	cd 40                	int    $0x40
+ 8ad:	c3                   	ret
+
+000008ae <clone>:
+SYSCALL(clone)
+ 8ae:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8b3:	cd 40                	int    $0x40
+ 8b5:	c3                   	ret
+
+000008b6 <join>:
+SYSCALL(join)
+ 8b6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8bb:	cd 40                	int    $0x40
+ 8bd:	c3                   	ret
+
+000008be <futex_wait>:
+SYSCALL(futex_wait)
+ 8be:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8c3:	cd 40                	int    $0x40
+ 8c5:	c3                   	ret
+
+000008c6 <futex_wake>:
+SYSCALL(futex_wake)
+ 8c6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8cb:	cd 40                	int    $0x40
+ 8cd:	c3                   	ret
+
+000008ce <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 8ce:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 8d3:	cd 40                	int    $0x40
+ 8d5:	c3                   	ret
+
+000008d6 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 8d6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 8db:	cd 40                	int    $0x40
+ 8dd:	c3                   	ret
+
+000008de <iostat>:
+SYSCALL(iostat)
+ 8de:	b8 20 00 00 00       	mov    $0x20,%eax
+ 8e3:	cd 40                	int    $0x40
+ 8e5:	c3                   	ret
+ 8e6:	66 90                	xchg   %ax,%ax
+ 8e8:	66 90                	xchg   %ax,%ax
+ 8ea:	66 90                	xchg   %ax,%ax
+ 8ec:	66 90                	xchg   %ax,%ax
+ 8ee:	66 90                	xchg   %ax,%ax
+
+000008f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 e5                	mov    %esp,%ebp
+ 8f3:	57                   	push   %edi
+ 8f4:	56                   	push   %esi
+ 8f5:	53                   	push   %ebx
+ 8f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 8f8:	89 d1                	mov    %edx,%ecx
+{
+ 8fa:	83 ec 3c             	sub    $0x3c,%esp
+ 8fd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 900:	85 d2                	test   %edx,%edx
+ 902:	0f 89 80 00 00 00    	jns    988 <printint+0x98>
+ 908:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 90c:	74 7a                	je     988 <printint+0x98>
+    x = -xx;
+ 90e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 910:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 915:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 918:	31 f6                	xor    %esi,%esi
+ 91a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 920:	89 c8                	mov    %ecx,%eax
+ 922:	31 d2                	xor    %edx,%edx
+ 924:	89 f7                	mov    %esi,%edi
+ 926:	f7 f3                	div    %ebx
+ 928:	8d 76 01             	lea    0x1(%esi),%esi
+ 92b:	0f b6 92 a0 0d 00 00 	movzbl 0xda0(%edx),%edx
+ 932:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 936:	89 ca                	mov    %ecx,%edx
+ 938:	89 c1                	mov    %eax,%ecx
+ 93a:	39 da                	cmp    %ebx,%edx
+ 93c:	73 e2                	jae    920 <printint+0x30>
+  if(neg)
+ 93e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 941:	85 c0                	test   %eax,%eax
+ 943:	74 07                	je     94c <printint+0x5c>
+    buf[i++] = '-';
+ 945:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 94a:	89 f7                	mov    %esi,%edi
+ 94c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 94f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 952:	01 df                	add    %ebx,%edi
+ 954:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 958:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 95b:	83 ec 04             	sub    $0x4,%esp
+ 95e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 961:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 964:	6a 01                	push   $0x1
+ 966:	50                   	push   %eax
+ 967:	56                   	push   %esi
+ 968:	e8 a1 fe ff ff       	call   80e <write>
+  while(--i >= 0)
+ 96d:	89 f8                	mov    %edi,%eax
+ 96f:	83 c4 10             	add    $0x10,%esp
+ 972:	83 ef 01             	sub    $0x1,%edi
+ 975:	39 d8                	cmp    %ebx,%eax
+ 977:	75 df                	jne    958 <printint+0x68>
+}
+ 979:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 97c:	5b                   	pop    %ebx
+ 97d:	5e                   	pop    %esi
+ 97e:	5f                   	pop    %edi
+ 97f:	5d                   	pop    %ebp
+ 980:	c3                   	ret
+ 981:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 988:	31 c0                	xor    %eax,%eax
+ 98a:	eb 89                	jmp    915 <printint+0x25>
+ 98c:	66 90                	xchg   %ax,%ax
+ 98e:	66 90                	xchg   %ax,%ax
+
+00000990 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 990:	55                   	push   %ebp
+ 991:	89 e5                	mov    %esp,%ebp
+ 993:	57                   	push   %edi
+ 994:	56                   	push   %esi
+ 995:	53                   	push   %ebx
+ 996:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 999:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 99c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 99f:	0f b6 1e             	movzbl (%esi),%ebx
+ 9a2:	83 c6 01             	add    $0x1,%esi
+ 9a5:	84 db                	test   %bl,%bl
+ 9a7:	74 67                	je     a10 <printf+0x80>
+ 9a9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 9ac:	31 d2                	xor    %edx,%edx
+ 9ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 9b1:	eb 34                	jmp    9e7 <printf+0x57>
+ 9b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9b7:	90                   	nop
+ 9b8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 9bb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 9c0:	83 f8 25             	cmp    $0x25,%eax
+ 9c3:	74 18                	je     9dd <printf+0x4d>
+  write(fd, &c, 1);
+ 9c5:	83 ec 04             	sub    $0x4,%esp
+ 9c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 9cb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9ce:	6a 01                	push   $0x1
+ 9d0:	50                   	push   %eax
+ 9d1:	57                   	push   %edi
+ 9d2:	e8 37 fe ff ff       	call   80e <write>
+ 9d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 9da:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9dd:	0f b6 1e             	movzbl (%esi),%ebx
+ 9e0:	83 c6 01             	add    $0x1,%esi
+ 9e3:	84 db                	test   %bl,%bl
+ 9e5:	74 29                	je     a10 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 9e7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9ea:	85 d2                	test   %edx,%edx
+ 9ec:	74 ca                	je     9b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 9ee:	83 fa 25             	cmp    $0x25,%edx
+ 9f1:	75 ea                	jne    9dd <printf+0x4d>
+      if(c == 'd'){
+ 9f3:	83 f8 25             	cmp    $0x25,%eax
+ 9f6:	0f 84 24 01 00 00    	je     b20 <printf+0x190>
+ 9fc:	83 e8 63             	sub    $0x63,%eax
+ 9ff:	83 f8 15             	cmp    $0x15,%eax
+ a02:	77 1c                	ja     a20 <printf+0x90>
+ a04:	ff 24 85 48 0d 00 00 	jmp    *0xd48(,%eax,4)
+ a0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a0f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ a10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a13:	5b                   	pop    %ebx
+ a14:	5e                   	pop    %esi
+ a15:	5f                   	pop    %edi
+ a16:	5d                   	pop    %ebp
+ a17:	c3                   	ret
+ a18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a1f:	90                   	nop
+  write(fd, &c, 1);
+ a20:	83 ec 04             	sub    $0x4,%esp
+ a23:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a26:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ a2a:	6a 01                	push   $0x1
+ a2c:	52                   	push   %edx
+ a2d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ a30:	57                   	push   %edi
+ a31:	e8 d8 fd ff ff       	call   80e <write>
+ a36:	83 c4 0c             	add    $0xc,%esp
+ a39:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a3c:	6a 01                	push   $0x1
+ a3e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ a41:	52                   	push   %edx
+ a42:	57                   	push   %edi
+ a43:	e8 c6 fd ff ff       	call   80e <write>
+        putc(fd, c);
+ a48:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a4b:	31 d2                	xor    %edx,%edx
+ a4d:	eb 8e                	jmp    9dd <printf+0x4d>
+ a4f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ a50:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a53:	83 ec 0c             	sub    $0xc,%esp
+ a56:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a5b:	8b 13                	mov    (%ebx),%edx
+ a5d:	6a 00                	push   $0x0
+ a5f:	89 f8                	mov    %edi,%eax
+        ap++;
+ a61:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ a64:	e8 87 fe ff ff       	call   8f0 <printint>
+        ap++;
+ a69:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a6c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a6f:	31 d2                	xor    %edx,%edx
+ a71:	e9 67 ff ff ff       	jmp    9dd <printf+0x4d>
+ a76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a7d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a80:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a83:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a85:	83 c0 04             	add    $0x4,%eax
+ a88:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a8b:	85 db                	test   %ebx,%ebx
+ a8d:	0f 84 9d 00 00 00    	je     b30 <printf+0x1a0>
+        while(*s != 0){
+ a93:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a96:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a98:	84 c0                	test   %al,%al
+ a9a:	0f 84 3d ff ff ff    	je     9dd <printf+0x4d>
+ aa0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ aa3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ aa6:	89 de                	mov    %ebx,%esi
+ aa8:	89 d3                	mov    %edx,%ebx
+ aaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ ab0:	83 ec 04             	sub    $0x4,%esp
+ ab3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ ab6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ ab9:	6a 01                	push   $0x1
+ abb:	53                   	push   %ebx
+ abc:	57                   	push   %edi
+ abd:	e8 4c fd ff ff       	call   80e <write>
+        while(*s != 0){
+ ac2:	0f b6 06             	movzbl (%esi),%eax
+ ac5:	83 c4 10             	add    $0x10,%esp
+ ac8:	84 c0                	test   %al,%al
+ aca:	75 e4                	jne    ab0 <printf+0x120>
+      state = 0;
+ acc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ acf:	31 d2                	xor    %edx,%edx
+ ad1:	e9 07 ff ff ff       	jmp    9dd <printf+0x4d>
+ ad6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ add:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ ae0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ae3:	83 ec 0c             	sub    $0xc,%esp
+ ae6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ aeb:	8b 13                	mov    (%ebx),%edx
+ aed:	6a 01                	push   $0x1
+ aef:	e9 6b ff ff ff       	jmp    a5f <printf+0xcf>
+ af4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ af8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ afb:	83 ec 04             	sub    $0x4,%esp
+ afe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ b01:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ b03:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ b06:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ b09:	6a 01                	push   $0x1
+ b0b:	52                   	push   %edx
+ b0c:	57                   	push   %edi
+ b0d:	e8 fc fc ff ff       	call   80e <write>
+        ap++;
+ b12:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b15:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b18:	31 d2                	xor    %edx,%edx
+ b1a:	e9 be fe ff ff       	jmp    9dd <printf+0x4d>
+ b1f:	90                   	nop
+  write(fd, &c, 1);
+ b20:	83 ec 04             	sub    $0x4,%esp
+ b23:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b26:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b29:	6a 01                	push   $0x1
+ b2b:	e9 11 ff ff ff       	jmp    a41 <printf+0xb1>
+ b30:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ b35:	bb 3e 0d 00 00       	mov    $0xd3e,%ebx
+ b3a:	e9 61 ff ff ff       	jmp    aa0 <printf+0x110>
+ b3f:	90                   	nop
+
+00000b40 <freeblock>:
+static Header *freep;
+static lock_t lock;  // for programs using threads
+
+static void
+freeblock(void *ap)
+{
+ b40:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ b41:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ b44:	89 e5                	mov    %esp,%ebp
+ b46:	57                   	push   %edi
+ b47:	56                   	push   %esi
+ b48:	53                   	push   %ebx
+ b49:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b4b:	a1 d0 31 00 00       	mov    0x31d0,%eax
+ b50:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b52:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b54:	39 ca                	cmp    %ecx,%edx
+ b56:	73 30                	jae    b88 <freeblock+0x48>
+ b58:	39 c1                	cmp    %eax,%ecx
+ b5a:	72 04                	jb     b60 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b5c:	39 c2                	cmp    %eax,%edx
+ b5e:	72 f0                	jb     b50 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b60:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ b63:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ b66:	39 f8                	cmp    %edi,%eax
+ b68:	74 26                	je     b90 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b6a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b6d:	8b 42 04             	mov    0x4(%edx),%eax
+ b70:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b73:	39 f1                	cmp    %esi,%ecx
+ b75:	74 30                	je     ba7 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b77:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b79:	5b                   	pop    %ebx
+  freep = p;
+ b7a:	89 15 d0 31 00 00    	mov    %edx,0x31d0
+}
+ b80:	5e                   	pop    %esi
+ b81:	5f                   	pop    %edi
+ b82:	5d                   	pop    %ebp
+ b83:	c3                   	ret
+ b84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b88:	39 c1                	cmp    %eax,%ecx
+ b8a:	72 d0                	jb     b5c <freeblock+0x1c>
+ b8c:	eb c2                	jmp    b50 <freeblock+0x10>
+ b8e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ b90:	03 70 04             	add    0x4(%eax),%esi
+ b93:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b96:	8b 02                	mov    (%edx),%eax
+ b98:	8b 00                	mov    (%eax),%eax
+ b9a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b9d:	8b 42 04             	mov    0x4(%edx),%eax
+ ba0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ba3:	39 f1                	cmp    %esi,%ecx
+ ba5:	75 d0                	jne    b77 <freeblock+0x37>
+    p->s.size += bp->s.size;
+ ba7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ baa:	89 15 d0 31 00 00    	mov    %edx,0x31d0
+    p->s.size += bp->s.size;
+ bb0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ bb3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ bb6:	89 0a                	mov    %ecx,(%edx)
+}
+ bb8:	5b                   	pop    %ebx
+ bb9:	5e                   	pop    %esi
+ bba:	5f                   	pop    %edi
+ bbb:	5d                   	pop    %ebp
+ bbc:	c3                   	ret
+ bbd:	66 90                	xchg   %ax,%ax
+ bbf:	90                   	nop
+
+00000bc0 <free>:
+
+void
+free(void *ap)
+{
+ bc0:	55                   	push   %ebp
+ bc1:	89 e5                	mov    %esp,%ebp
+ bc3:	53                   	push   %ebx
+ bc4:	83 ec 10             	sub    $0x10,%esp
+ bc7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&lock);
+ bca:	68 cc 31 00 00       	push   $0x31cc
+ bcf:	e8 bc fa ff ff       	call   690 <lock_acquire>
+  freeblock(ap);
+ bd4:	89 d8                	mov    %ebx,%eax
+ bd6:	e8 65 ff ff ff       	call   b40 <freeblock>
+  lock_release(&lock);
+ bdb:	c7 45 08 cc 31 00 00 	movl   $0x31cc,0x8(%ebp)
+}
+ be2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&lock);
+ be5:	83 c4 10             	add    $0x10,%esp
+}
+ be8:	c9                   	leave
+  lock_release(&lock);
+ be9:	e9 c2 fa ff ff       	jmp    6b0 <lock_release>
+ bee:	66 90                	xchg   %ax,%ax
+
+00000bf0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ bf0:	55                   	push   %ebp
+ bf1:	89 e5                	mov    %esp,%ebp
+ bf3:	57                   	push   %edi
+ bf4:	56                   	push   %esi
+ bf5:	53                   	push   %ebx
+ bf6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bf9:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&lock);
+ bfc:	68 cc 31 00 00       	push   $0x31cc
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c01:	8d 48 07             	lea    0x7(%eax),%ecx
+ c04:	c1 e9 03             	shr    $0x3,%ecx
+ c07:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&lock);
+ c0a:	e8 81 fa ff ff       	call   690 <lock_acquire>
+  if((prevp = freep) == 0){
+ c0f:	8b 15 d0 31 00 00    	mov    0x31d0,%edx
+ c15:	83 c4 10             	add    $0x10,%esp
+ c18:	85 d2                	test   %edx,%edx
+ c1a:	0f 84 b0 00 00 00    	je     cd0 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c20:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ c22:	8b 47 04             	mov    0x4(%edi),%eax
+ c25:	39 f0                	cmp    %esi,%eax
+ c27:	73 6f                	jae    c98 <malloc+0xa8>
+  if(nu < 4096)
+ c29:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ c2e:	39 de                	cmp    %ebx,%esi
+ c30:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ c33:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ c3a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ c3d:	eb 0a                	jmp    c49 <malloc+0x59>
+ c3f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c40:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ c42:	8b 47 04             	mov    0x4(%edi),%eax
+ c45:	39 f0                	cmp    %esi,%eax
+ c47:	73 4f                	jae    c98 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ c49:	89 fa                	mov    %edi,%edx
+ c4b:	39 3d d0 31 00 00    	cmp    %edi,0x31d0
+ c51:	75 ed                	jne    c40 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ c53:	83 ec 0c             	sub    $0xc,%esp
+ c56:	ff 75 e4             	push   -0x1c(%ebp)
+ c59:	e8 18 fc ff ff       	call   876 <sbrk>
+  if(p == (char*)-1)
+ c5e:	83 c4 10             	add    $0x10,%esp
+ c61:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c64:	74 15                	je     c7b <malloc+0x8b>
+  hp->s.size = nu;
+ c66:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+ c69:	83 c0 08             	add    $0x8,%eax
+ c6c:	e8 cf fe ff ff       	call   b40 <freeblock>
+  return freep;
+ c71:	8b 15 d0 31 00 00    	mov    0x31d0,%edx
+      if((p = morecore(nunits)) == 0){
+ c77:	85 d2                	test   %edx,%edx
+ c79:	75 c5                	jne    c40 <malloc+0x50>
+        lock_release(&lock);
+ c7b:	83 ec 0c             	sub    $0xc,%esp
+ c7e:	68 cc 31 00 00       	push   $0x31cc
+ c83:	e8 28 fa ff ff       	call   6b0 <lock_release>
+        return 0;
+ c88:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ c8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ c8e:	31 c0                	xor    %eax,%eax
+}
+ c90:	5b                   	pop    %ebx
+ c91:	5e                   	pop    %esi
+ c92:	5f                   	pop    %edi
+ c93:	5d                   	pop    %ebp
+ c94:	c3                   	ret
+ c95:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ c98:	39 c6                	cmp    %eax,%esi
+ c9a:	74 64                	je     d00 <malloc+0x110>
+        p->s.size -= nunits;
+ c9c:	29 f0                	sub    %esi,%eax
+ c9e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ ca1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ ca4:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&lock);
+ ca7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ caa:	89 15 d0 31 00 00    	mov    %edx,0x31d0
+      lock_release(&lock);
+ cb0:	68 cc 31 00 00       	push   $0x31cc
+ cb5:	e8 f6 f9 ff ff       	call   6b0 <lock_release>
+      return (void*)(p + 1);
+ cba:	83 c4 10             	add    $0x10,%esp
+}
+ cbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ cc0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ cc3:	5b                   	pop    %ebx
+ cc4:	5e                   	pop    %esi
+ cc5:	5f                   	pop    %edi
+ cc6:	5d                   	pop    %ebp
+ cc7:	c3                   	ret
+ cc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ccf:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ cd0:	c7 05 d0 31 00 00 d4 	movl   $0x31d4,0x31d0
+ cd7:	31 00 00 
+    base.s.size = 0;
+ cda:	bf d4 31 00 00       	mov    $0x31d4,%edi
+    base.s.ptr = freep = prevp = &base;
+ cdf:	c7 05 d4 31 00 00 d4 	movl   $0x31d4,0x31d4
+ ce6:	31 00 00 
+    base.s.size = 0;
+ ce9:	c7 05 d8 31 00 00 00 	movl   $0x0,0x31d8
+ cf0:	00 00 00 
+    if(p->s.size >= nunits){
+ cf3:	e9 31 ff ff ff       	jmp    c29 <malloc+0x39>
+ cf8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d00:	8b 07                	mov    (%edi),%eax
+ d02:	89 02                	mov    %eax,(%edx)
+ d04:	eb a1                	jmp    ca7 <malloc+0xb7>
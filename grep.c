@@ -4,17 +4,64 @@
 #include "stat.h"
 #include "user.h"
 
-char buf[1024];
+// Each file named is searched by a thread of its own, up to
+// NTHREAD at a time.  A thread collects its file's matches in
+// memory so that they come out in the order of the files.
+#define NTHREAD 8
+
+struct job {
+  int fd;
+  int direct;          // write matches straight out, not to out
+  char *out;           // matches collected so far
+  int nout;
+  int cap;
+  char buf[1024];
+};
+
+char *pattern;
+struct job jobs[NTHREAD];
 int match(char*, char*);
 
 void
-grep(char *pattern, int fd)
+emit(struct job *j, char *p, int n)
 {
+  char *out;
+
+  if(!j->direct && j->nout + n > j->cap){
+    j->cap = 2 * (j->nout + n);
+    if((out = malloc(j->cap)) == 0){
+      // Out of memory: give up on the order.
+      write(1, j->out, j->nout);
+      if(j->out)
+        free(j->out);
+      j->out = 0;
+      j->nout = 0;
+      j->direct = 1;
+    } else {
+      memmove(out, j->out, j->nout);
+      if(j->out)
+        free(j->out);
+      j->out = out;
+    }
+  }
+  if(j->direct){
+    write(1, p, n);
+    return;
+  }
+  memmove(j->out + j->nout, p, n);
+  j->nout += n;
+}
+
+void
+grep(void *arg)
+{
+  struct job *j = arg;
+  char *buf = j->buf;
   int n, m;
   char *p, *q;
 
   m = 0;
-  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+  while((n = read(j->fd, buf+m, sizeof(j->buf)-m-1)) > 0){
     m += n;
     buf[m] = '\0';
     p = buf;
@@ -22,7 +69,7 @@ grep(char *pattern, int fd)
       *q = 0;
       if(match(pattern, p)){
         *q = '\n';
-        write(1, p, q+1 - p);
+        emit(j, p, q+1 - p);
       }
       p = q+1;
     }
@@ -38,8 +85,7 @@ grep(char *pattern, int fd)
 int
 main(int argc, char *argv[])
 {
-  int fd, i;
-  char *pattern;
+  int i, k, n, nthread;
 
   if(argc <= 1){
     printf(2, "usage: grep pattern [file ...]\n");
@@ -48,17 +94,37 @@ main(int argc, char *argv[])
   pattern = argv[1];
 
   if(argc <= 2){
-    grep(pattern, 0);
+    jobs[0].fd = 0;
+    jobs[0].direct = 1;
+    grep(&jobs[0]);
     exit();
   }
 
-  for(i = 2; i < argc; i++){
-    if((fd = open(argv[i], 0)) < 0){
-      printf(1, "grep: cannot open %s\n", argv[i]);
+  for(i = 2; i < argc; i += n){
+    nthread = 0;
+    for(n = 0; n < NTHREAD && i+n < argc; n++){
+      if((jobs[n].fd = open(argv[i+n], 0)) < 0)
+        break;
+      if(thread_create(grep, &jobs[n]) >= 0)
+        nthread++;
+      else
+        grep(&jobs[n]);
+    }
+    while(nthread-- > 0)
+      thread_join();
+    for(k = 0; k < n; k++){
+      if(jobs[k].out){
+        write(1, jobs[k].out, jobs[k].nout);
+        free(jobs[k].out);
+      }
+      jobs[k].out = 0;
+      jobs[k].nout = jobs[k].cap = 0;
+      close(jobs[k].fd);
+    }
+    if(n < NTHREAD && i+n < argc){
+      printf(1, "grep: cannot open %s\n", argv[i+n]);
       exit();
     }
-    grep(pattern, fd);
-    close(fd);
   }
   exit();
 }
@@ -1,4 +1,5 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// IDE driver for the primary channel: bus-master DMA when the
+// controller offers it (see idedmainit), PIO otherwise.
 
 #include "types.h"
 #include "defs.h"
@@ -12,6 +13,7 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "iostat.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
@@ -23,16 +25,58 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
+#define IDE_MAXMUL    16  // most sectors per READ/WRITE MULTIPLE
+#define IDE_MAXDMA   128  // most sectors per DMA command
+
+// Bus master IDE registers, from the I/O base in PCI BAR4.
+#define BM_CMD        0   // Command
+#define   BM_START      0x01  // start transfer
+#define   BM_READ       0x08  // transfer is disk to memory
+#define BM_STATUS     2   // Status; write 1 to clear ERR and INTR
+#define   BM_ERR        0x02
+#define   BM_INTR       0x04
+#define BM_PRDT       4   // Physical address of PRD table
+
+// Physical region descriptor: a piece of memory to transfer,
+// which must not cross a 64KB boundary.
+struct prd {
+  uint addr;
+  ushort len;
+  ushort flags;
+};
+#define PRD_EOT       0x8000  // last entry in table
+
+// Requests wait on idequeue, sorted by disk and block number.
+// The disk serves them in one direction, C-SCAN: idestart()
+// takes the first at or after idepos, the position just past
+// the last request, and wraps around to the lowest when there
+// is none.  It merges that request with the ones for the blocks
+// that follow it in the same direction, up to the multiple
+// count of the disk, into one command, and moves their bufs to
+// ideactive, linked through qnext.
 // You must hold idelock while manipulating queue.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static struct buf *ideactive;
+static uint idepos;
 
 static int havedisk1;
-static void idestart(struct buf*);
+static int idemul[2];   // sectors per command, for each disk
+static void idestart(void);
+
+static ushort idebm;      // bus master I/O base, or 0 for PIO only
+static struct prd *ideprd;  // PRD table, one page
+static int idedma;        // active command uses DMA
+
+static struct iostat idestats;
+static uint64 idecycles;
+
+#define IDEKEY(b) ((uint)((b)->dev&1) << 28 | (b)->blockno)
 
 // Wait for IDE disk to become ready.
 static int
@@ -47,6 +91,38 @@ idewait(int checkerr)
   return 0;
 }
 
+// Have disk d transfer up to IDE_MAXMUL sectors per interrupt
+// in READ/WRITE MULTIPLE, or fall back to one at a time.
+static void
+idesetmul(int d)
+{
+  outb(0x1f6, 0xe0 | (d<<4));
+  idewait(0);
+  outb(0x1f2, IDE_MAXMUL);
+  outb(0x1f7, IDE_CMD_SETMUL);
+  idemul[d] = idewait(1) < 0 ? 1 : IDE_MAXMUL;
+}
+
+// Find the IDE controller in PCI space and set it up for
+// bus-master DMA, if it can do that.
+static void
+idedmainit(void)
+{
+  uint tag, bar;
+
+  if(pcifind(0x01, 0x01, &tag) < 0)  // mass storage, IDE
+    return;
+  bar = pciread(tag, 0x20);
+  if((bar & 1) == 0)  // BAR4 must be in I/O space
+    return;
+  // Enable I/O space and bus mastering, leaving status alone.
+  pciwrite(tag, 0x04, (pciread(tag, 0x04) & 0xFFFF) | 0x5);
+  if((ideprd = (struct prd*)kalloc()) == 0)
+    return;
+  idebm = bar & 0xFFFC;
+  cprintf("ide: bus-master DMA at 0x%x\n", idebm);
+}
+
 void
 ideinit(void)
 {
@@ -65,104 +141,260 @@ ideinit(void)
     }
   }
 
+  outb(0x3f6, 2);  // no interrupts until the first request
+  idesetmul(0);
+  if(havedisk1)
+    idesetmul(1);
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
+
+  idedmainit();
+}
+
+// Insert b in idequeue in order.  Caller must hold idelock.
+static void
+idequeueput(struct buf *b)
+{
+  struct buf **pp;
+
+  for(pp=&idequeue; *pp && IDEKEY(*pp) < IDEKEY(b); pp=&(*pp)->qnext)  //DOC:insert-queue
+    ;
+  b->qnext = *pp;
+  *pp = b;
+}
+
+// Point the bus master at the data of the bufs in list b.
+static void
+idedmasetup(struct buf *b)
+{
+  uint pa, len, m;
+  int n;
+
+  n = 0;
+  for(; b; b = b->qnext){
+    for(pa = V2P(b->data), len = BSIZE; len > 0; pa += m, len -= m){
+      m = 0x10000 - (pa & 0xFFFF);
+      if(m > len)
+        m = len;
+      ideprd[n].addr = pa;
+      ideprd[n].len = m;
+      ideprd[n].flags = 0;
+      n++;
+    }
+  }
+  ideprd[n-1].flags = PRD_EOT;
+  outl(idebm + BM_PRDT, V2P(ideprd));
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Start the next request on idequeue, merged with those after
+// it.  Caller must hold idelock.
 static void
-idestart(struct buf *b)
+idestart(void)
 {
-  if(b == 0)
+  struct buf *b, **pp, **first, *last;
+  int sector_per_block =  BSIZE/SECTOR_SIZE;
+  int sector, nsect, maxsect, cmd, write;
+  uint64 t0;
+
+  t0 = rdtsc();
+  if(idequeue == 0)
     panic("idestart");
+  for(first = &idequeue; *first; first = &(*first)->qnext)
+    if(IDEKEY(*first) >= idepos)
+      break;
+  if(*first == 0)
+    first = &idequeue;
+
+  b = *first;
   if(b->blockno >= FSSIZE)
     panic("incorrect blockno");
-  int sector_per_block =  BSIZE/SECTOR_SIZE;
-  int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  if (sector_per_block > IDE_MAXMUL) panic("idestart");
+
+  // Take following blocks going the same way while they fit.
+  maxsect = idebm ? IDE_MAXDMA : idemul[b->dev&1];
+  nsect = sector_per_block;
+  last = b;
+  for(pp = &b->qnext; *pp; pp = &(*pp)->qnext){
+    if(IDEKEY(*pp) != IDEKEY(last) + 1 ||
+       ((*pp)->flags & B_DIRTY) != (b->flags & B_DIRTY) ||
+       nsect + sector_per_block > maxsect ||
+       (*pp)->blockno >= FSSIZE)
+      break;
+    nsect += sector_per_block;
+    last = *pp;
+  }
+  *first = last->qnext;
+  last->qnext = 0;
+  ideactive = b;
+  idepos = IDEKEY(last) + 1;
 
-  if (sector_per_block > 7) panic("idestart");
+  write = (b->flags & B_DIRTY) != 0;
+  idestats.ncmd++;
+  if(write)
+    idestats.nwrite += nsect / sector_per_block;
+  else
+    idestats.nread += nsect / sector_per_block;
+  idedma = idebm != 0;
+  if(idedma){
+    idestats.ndma++;
+    idedmasetup(b);
+    outb(idebm + BM_CMD, write ? 0 : BM_READ);
+    outb(idebm + BM_STATUS, inb(idebm + BM_STATUS) | BM_ERR | BM_INTR);
+  }
 
+  sector = b->blockno * sector_per_block;
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, nsect);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
-    outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+  if(idedma){
+    outb(0x1f7, write ? IDE_CMD_WRDMA : IDE_CMD_RDDMA);
+    outb(idebm + BM_CMD, (write ? 0 : BM_READ) | BM_START);
+  } else if(write){
+    cmd = (nsect == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+    outb(0x1f7, cmd);
+    for(; b; b = b->qnext)
+      outsl(0x1f0, b->data, BSIZE/4);
   } else {
-    outb(0x1f7, read_cmd);
+    cmd = (nsect == 1) ? IDE_CMD_READ : IDE_CMD_RDMUL;
+    outb(0x1f7, cmd);
   }
+  idecycles += rdtsc() - t0;
 }
 
 // Interrupt handler.
 void
 ideintr(void)
 {
-  struct buf *b;
+  struct buf *b, *next, *callback;
+  void (*done)(struct buf*);
+  uint64 t0;
+  int st;
 
-  // First queued buffer is the active request.
+  // ideactive holds the bufs of the command just finished.
   acquire(&idelock);
 
-  if((b = idequeue) == 0){
+  if((b = ideactive) == 0){
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
+  t0 = rdtsc();
+  ideactive = 0;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  if(idedma){
+    // Stop the bus master and acknowledge it.  If the transfer
+    // failed, give up on DMA and do these bufs again by PIO.
+    st = inb(idebm + BM_STATUS);
+    outb(idebm + BM_CMD, 0);
+    outb(idebm + BM_STATUS, st | BM_ERR | BM_INTR);
+    if((st & BM_ERR) || idewait(1) < 0){
+      cprintf("ide: DMA failed, using PIO\n");
+      idebm = 0;
+      for(; b; b = next){
+        next = b->qnext;
+        idequeueput(b);
+      }
+      idecycles += rdtsc() - t0;
+      idestart();
+      release(&idelock);
+      return;
+    }
+  } else if(!(b->flags & B_DIRTY) && idewait(1) >= 0){
+    // Read data if needed.
+    for(next = b; next; next = next->qnext)
+      insl(0x1f0, next->data, BSIZE/4);
+  }
+
+  // Wake processes waiting for these bufs, or collect them
+  // to be called back.
+  callback = 0;
+  for(; b; b = next){
+    next = b->qnext;
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    if(b->done){
+      b->qnext = callback;
+      callback = b;
+    } else
+      wakeup(b);
+  }
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+  idecycles += rdtsc() - t0;
 
-  // Start disk on next buf in queue.
+  // Start disk on next request.
   if(idequeue != 0)
-    idestart(idequeue);
+    idestart();
 
   release(&idelock);
+
+  // Once idelock is released a waiter may reuse its buf, so
+  // only the ones with callbacks are touched.
+  for(b = callback; b; b = next){
+    next = b->qnext;
+    done = b->done;
+    b->done = 0;
+    done(b);
+  }
 }
 
 //PAGEBREAK!
-// Sync buf with disk.
+// Start syncing buf with disk and return without waiting.
 // If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
 // Else if B_VALID is not set, read buf from disk, set B_VALID.
+// When it is done, ideintr() calls b->done(b) if b->done is set,
+// and otherwise wakes up ideiowait(b).
 void
-iderw(struct buf *b)
+idesubmit(struct buf *b)
 {
-  struct buf **pp;
 
   if(!holdingsleep(&b->lock))
-    panic("iderw: buf not locked");
+    panic("idesubmit: buf not locked");
   if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
-    panic("iderw: nothing to do");
+    panic("idesubmit: nothing to do");
   if(b->dev != 0 && !havedisk1)
-    panic("iderw: ide disk 1 not present");
+    panic("idesubmit: ide disk 1 not present");
 
   acquire(&idelock);  //DOC:acquire-lock
 
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
-    ;
-  *pp = b;
+  idequeueput(b);
 
   // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+  if(ideactive == 0)
+    idestart();
+
+  release(&idelock);
+}
 
-  // Wait for request to finish.
+// Wait for the request idesubmit() started for b to finish.
+void
+ideiowait(struct buf *b)
+{
+  acquire(&idelock);
   while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
     sleep(b, &idelock);
   }
+  release(&idelock);
+}
 
+// Sync buf with disk, waiting for it.
+void
+iderw(struct buf *b)
+{
+  b->done = 0;
+  idesubmit(b);
+  ideiowait(b);
+}
 
+// Copy the driver's statistics to st, in kernel memory.
+void
+idestat(struct iostat *st)
+{
+  acquire(&idelock);
+  *st = idestats;
+  st->kcycles = idecycles >> 10;
   release(&idelock);
 }
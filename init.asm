@@ -0,0 +1,630 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 40 04 00 00       	push   $0x440
+  19:	e8 17 01 00 00       	call   135 <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	0f 88 9f 00 00 00    	js     c8 <main+0xc8>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  29:	83 ec 0c             	sub    $0xc,%esp
+  2c:	6a 00                	push   $0x0
+  2e:	e8 3a 01 00 00       	call   16d <dup>
+  dup(0);  // stderr
+  33:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  3a:	e8 2e 01 00 00       	call   16d <dup>
+  3f:	83 c4 10             	add    $0x10,%esp
+  42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  48:	83 ec 08             	sub    $0x8,%esp
+  4b:	68 48 04 00 00       	push   $0x448
+  50:	6a 01                	push   $0x1
+  52:	e8 39 02 00 00       	call   290 <printf>
+    pid = fork();
+  57:	e8 91 00 00 00       	call   ed <fork>
+    if(pid < 0){
+  5c:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  5f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  61:	85 c0                	test   %eax,%eax
+  63:	78 2c                	js     91 <main+0x91>
+      printf(1, "init: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  65:	74 3d                	je     a4 <main+0xa4>
+  67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6e:	66 90                	xchg   %ax,%ax
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+  70:	e8 88 00 00 00       	call   fd <wait>
+  75:	85 c0                	test   %eax,%eax
+  77:	78 cf                	js     48 <main+0x48>
+  79:	39 c3                	cmp    %eax,%ebx
+  7b:	74 cb                	je     48 <main+0x48>
+      printf(1, "zombie!\n");
+  7d:	83 ec 08             	sub    $0x8,%esp
+  80:	68 87 04 00 00       	push   $0x487
+  85:	6a 01                	push   $0x1
+  87:	e8 04 02 00 00       	call   290 <printf>
+  8c:	83 c4 10             	add    $0x10,%esp
+  8f:	eb df                	jmp    70 <main+0x70>
+      printf(1, "init: fork failed\n");
+  91:	53                   	push   %ebx
+  92:	53                   	push   %ebx
+  93:	68 5b 04 00 00       	push   $0x45b
+  98:	6a 01                	push   $0x1
+  9a:	e8 f1 01 00 00       	call   290 <printf>
+      exit();
+  9f:	e8 51 00 00 00       	call   f5 <exit>
+      exec("sh", argv);
+  a4:	50                   	push   %eax
+  a5:	50                   	push   %eax
+  a6:	68 a4 05 00 00       	push   $0x5a4
+  ab:	68 6e 04 00 00       	push   $0x46e
+  b0:	e8 78 00 00 00       	call   12d <exec>
+      printf(1, "init: exec sh failed\n");
+  b5:	5a                   	pop    %edx
+  b6:	59                   	pop    %ecx
+  b7:	68 71 04 00 00       	push   $0x471
+  bc:	6a 01                	push   $0x1
+  be:	e8 cd 01 00 00       	call   290 <printf>
+      exit();
+  c3:	e8 2d 00 00 00       	call   f5 <exit>
+    mknod("console", 1, 1);
+  c8:	50                   	push   %eax
+  c9:	6a 01                	push   $0x1
+  cb:	6a 01                	push   $0x1
+  cd:	68 40 04 00 00       	push   $0x440
+  d2:	e8 66 00 00 00       	call   13d <mknod>
+    open("console", O_RDWR);
+  d7:	58                   	pop    %eax
+  d8:	5a                   	pop    %edx
+  d9:	6a 02                	push   $0x2
+  db:	68 40 04 00 00       	push   $0x440
+  e0:	e8 50 00 00 00       	call   135 <open>
+  e5:	83 c4 10             	add    $0x10,%esp
+  e8:	e9 3c ff ff ff       	jmp    29 <main+0x29>
+
+000000ed <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+  ed:	b8 01 00 00 00       	mov    $0x1,%eax
+  f2:	cd 40                	int    $0x40
+  f4:	c3                   	ret
+
+000000f5 <exit>:
+SYSCALL(exit)
+  f5:	b8 02 00 00 00       	mov    $0x2,%eax
+  fa:	cd 40                	int    $0x40
+  fc:	c3                   	ret
+
+000000fd <wait>:
+SYSCALL(wait)
+  fd:	b8 03 00 00 00       	mov    $0x3,%eax
+ 102:	cd 40                	int    $0x40
+ 104:	c3                   	ret
+
+00000105 <pipe>:
+SYSCALL(pipe)
+ 105:	b8 04 00 00 00       	mov    $0x4,%eax
+ 10a:	cd 40                	int    $0x40
+ 10c:	c3                   	ret
+
+0000010d <read>:
+SYSCALL(read)
+ 10d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 112:	cd 40                	int    $0x40
+ 114:	c3                   	ret
+
+00000115 <write>:
+SYSCALL(write)
+ 115:	b8 10 00 00 00       	mov    $0x10,%eax
+ 11a:	cd 40                	int    $0x40
+ 11c:	c3                   	ret
+
+0000011d <close>:
+SYSCALL(close)
+ 11d:	b8 15 00 00 00       	mov    $0x15,%eax
+ 122:	cd 40                	int    $0x40
+ 124:	c3                   	ret
+
+00000125 <kill>:
+SYSCALL(kill)
+ 125:	b8 06 00 00 00       	mov    $0x6,%eax
+ 12a:	cd 40                	int    $0x40
+ 12c:	c3                   	ret
+
+0000012d <exec>:
+SYSCALL(exec)
+ 12d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 132:	cd 40                	int    $0x40
+ 134:	c3                   	ret
+
+00000135 <open>:
+SYSCALL(open)
+ 135:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 13a:	cd 40                	int    $0x40
+ 13c:	c3                   	ret
+
+0000013d <mknod>:
+SYSCALL(mknod)
+ 13d:	b8 11 00 00 00       	mov    $0x11,%eax
+ 142:	cd 40                	int    $0x40
+ 144:	c3                   	ret
+
+00000145 <unlink>:
+SYSCALL(unlink)
+ 145:	b8 12 00 00 00       	mov    $0x12,%eax
+ 14a:	cd 40                	int    $0x40
+ 14c:	c3                   	ret
+
+0000014d <fstat>:
+SYSCALL(fstat)
+ 14d:	b8 08 00 00 00       	mov    $0x8,%eax
+ 152:	cd 40                	int    $0x40
+ 154:	c3                   	ret
+
+00000155 <link>:
+SYSCALL(link)
+ 155:	b8 13 00 00 00       	mov    $0x13,%eax
+ 15a:	cd 40                	int    $0x40
+ 15c:	c3                   	ret
+
+0000015d <mkdir>:
+SYSCALL(mkdir)
+ 15d:	b8 14 00 00 00       	mov    $0x14,%eax
+ 162:	cd 40                	int    $0x40
+ 164:	c3                   	ret
+
+00000165 <chdir>:
+SYSCALL(chdir)
+ 165:	b8 09 00 00 00       	mov    $0x9,%eax
+ 16a:	cd 40                	int    $0x40
+ 16c:	c3                   	ret
+
+0000016d <dup>:
+SYSCALL(dup)
+ 16d:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 172:	cd 40                	int    $0x40
+ 174:	c3                   	ret
+
+00000175 <getpid>:
+SYSCALL(getpid)
+ 175:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 17a:	cd 40                	int    $0x40
+ 17c:	c3                   	ret
+
+0000017d <sbrk>:
+SYSCALL(sbrk)
+ 17d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 182:	cd 40                	int    $0x40
+ 184:	c3                   	ret
+
+00000185 <sleep>:
+SYSCALL(sleep)
+ 185:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 18a:	cd 40                	int    $0x40
+ 18c:	c3                   	ret
+
+0000018d <uptime>:
+SYSCALL(uptime)
+ 18d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 192:	cd 40                	int    $0x40
+ 194:	c3                   	ret
+
+00000195 <setpriority>:
+SYSCALL(setpriority)
+ 195:	b8 16 00 00 00       	mov    $0x16,%eax
+ 19a:	cd 40                	int    $0x40
+ 19c:	c3                   	ret
+
+0000019d <settickets>:
+SYSCALL(settickets)
+ 19d:	b8 17 00 00 00       	mov    $0x17,%eax
+ 1a2:	cd 40                	int    $0x40
+ 1a4:	c3                   	ret
+
+000001a5 <getpinfo>:
+SYSCALL(getpinfo)
+ 1a5:	b8 18 00 00 00       	mov    $0x18,%eax
+ 1aa:	cd 40                	int    $0x40
+ 1ac:	c3                   	ret
+
+000001ad <nanosleep>:
+SYSCALL(nanosleep)
+ 1ad:	b8 19 00 00 00       	mov    $0x19,%eax
+ 1b2:	cd 40                	int    $0x40
+ 1b4:	c3                   	ret
+
+000001b5 <clone>:
+SYSCALL(clone)
+ 1b5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 1ba:	cd 40                	int    $0x40
+ 1bc:	c3                   	ret
+
+000001bd <join>:
+SYSCALL(join)
+ 1bd:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 1c2:	cd 40                	int    $0x40
+ 1c4:	c3                   	ret
+
+000001c5 <futex_wait>:
+SYSCALL(futex_wait)
+ 1c5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 1ca:	cd 40                	int    $0x40
+ 1cc:	c3                   	ret
+
+000001cd <futex_wake>:
+SYSCALL(futex_wake)
+ 1cd:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 1d2:	cd 40                	int    $0x40
+ 1d4:	c3                   	ret
+
+000001d5 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 1d5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 1da:	cd 40                	int    $0x40
+ 1dc:	c3                   	ret
+
+000001dd <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 1dd:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 1e2:	cd 40                	int    $0x40
+ 1e4:	c3                   	ret
+
+000001e5 <iostat>:
+SYSCALL(iostat)
+ 1e5:	b8 20 00 00 00       	mov    $0x20,%eax
+ 1ea:	cd 40                	int    $0x40
+ 1ec:	c3                   	ret
+ 1ed:	66 90                	xchg   %ax,%ax
+ 1ef:	90                   	nop
+
+000001f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+ 1f4:	56                   	push   %esi
+ 1f5:	53                   	push   %ebx
+ 1f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 1f8:	89 d1                	mov    %edx,%ecx
+{
+ 1fa:	83 ec 3c             	sub    $0x3c,%esp
+ 1fd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 200:	85 d2                	test   %edx,%edx
+ 202:	0f 89 80 00 00 00    	jns    288 <printint+0x98>
+ 208:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 20c:	74 7a                	je     288 <printint+0x98>
+    x = -xx;
+ 20e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 210:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 215:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 218:	31 f6                	xor    %esi,%esi
+ 21a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 220:	89 c8                	mov    %ecx,%eax
+ 222:	31 d2                	xor    %edx,%edx
+ 224:	89 f7                	mov    %esi,%edi
+ 226:	f7 f3                	div    %ebx
+ 228:	8d 76 01             	lea    0x1(%esi),%esi
+ 22b:	0f b6 92 f0 04 00 00 	movzbl 0x4f0(%edx),%edx
+ 232:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 236:	89 ca                	mov    %ecx,%edx
+ 238:	89 c1                	mov    %eax,%ecx
+ 23a:	39 da                	cmp    %ebx,%edx
+ 23c:	73 e2                	jae    220 <printint+0x30>
+  if(neg)
+ 23e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 241:	85 c0                	test   %eax,%eax
+ 243:	74 07                	je     24c <printint+0x5c>
+    buf[i++] = '-';
+ 245:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 24a:	89 f7                	mov    %esi,%edi
+ 24c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 24f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 252:	01 df                	add    %ebx,%edi
+ 254:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 258:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 25b:	83 ec 04             	sub    $0x4,%esp
+ 25e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 261:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 264:	6a 01                	push   $0x1
+ 266:	50                   	push   %eax
+ 267:	56                   	push   %esi
+ 268:	e8 a8 fe ff ff       	call   115 <write>
+  while(--i >= 0)
+ 26d:	89 f8                	mov    %edi,%eax
+ 26f:	83 c4 10             	add    $0x10,%esp
+ 272:	83 ef 01             	sub    $0x1,%edi
+ 275:	39 d8                	cmp    %ebx,%eax
+ 277:	75 df                	jne    258 <printint+0x68>
+}
+ 279:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 27c:	5b                   	pop    %ebx
+ 27d:	5e                   	pop    %esi
+ 27e:	5f                   	pop    %edi
+ 27f:	5d                   	pop    %ebp
+ 280:	c3                   	ret
+ 281:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 288:	31 c0                	xor    %eax,%eax
+ 28a:	eb 89                	jmp    215 <printint+0x25>
+ 28c:	66 90                	xchg   %ax,%ax
+ 28e:	66 90                	xchg   %ax,%ax
+
+00000290 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	53                   	push   %ebx
+ 296:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 299:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 29c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 29f:	0f b6 1e             	movzbl (%esi),%ebx
+ 2a2:	83 c6 01             	add    $0x1,%esi
+ 2a5:	84 db                	test   %bl,%bl
+ 2a7:	74 67                	je     310 <printf+0x80>
+ 2a9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 2ac:	31 d2                	xor    %edx,%edx
+ 2ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 2b1:	eb 34                	jmp    2e7 <printf+0x57>
+ 2b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2b7:	90                   	nop
+ 2b8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 2bb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 2c0:	83 f8 25             	cmp    $0x25,%eax
+ 2c3:	74 18                	je     2dd <printf+0x4d>
+  write(fd, &c, 1);
+ 2c5:	83 ec 04             	sub    $0x4,%esp
+ 2c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 2cb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 2ce:	6a 01                	push   $0x1
+ 2d0:	50                   	push   %eax
+ 2d1:	57                   	push   %edi
+ 2d2:	e8 3e fe ff ff       	call   115 <write>
+ 2d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 2da:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 2dd:	0f b6 1e             	movzbl (%esi),%ebx
+ 2e0:	83 c6 01             	add    $0x1,%esi
+ 2e3:	84 db                	test   %bl,%bl
+ 2e5:	74 29                	je     310 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 2e7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 2ea:	85 d2                	test   %edx,%edx
+ 2ec:	74 ca                	je     2b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 2ee:	83 fa 25             	cmp    $0x25,%edx
+ 2f1:	75 ea                	jne    2dd <printf+0x4d>
+      if(c == 'd'){
+ 2f3:	83 f8 25             	cmp    $0x25,%eax
+ 2f6:	0f 84 24 01 00 00    	je     420 <printf+0x190>
+ 2fc:	83 e8 63             	sub    $0x63,%eax
+ 2ff:	83 f8 15             	cmp    $0x15,%eax
+ 302:	77 1c                	ja     320 <printf+0x90>
+ 304:	ff 24 85 98 04 00 00 	jmp    *0x498(,%eax,4)
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 310:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 313:	5b                   	pop    %ebx
+ 314:	5e                   	pop    %esi
+ 315:	5f                   	pop    %edi
+ 316:	5d                   	pop    %ebp
+ 317:	c3                   	ret
+ 318:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31f:	90                   	nop
+  write(fd, &c, 1);
+ 320:	83 ec 04             	sub    $0x4,%esp
+ 323:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 326:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 32a:	6a 01                	push   $0x1
+ 32c:	52                   	push   %edx
+ 32d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 330:	57                   	push   %edi
+ 331:	e8 df fd ff ff       	call   115 <write>
+ 336:	83 c4 0c             	add    $0xc,%esp
+ 339:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 33c:	6a 01                	push   $0x1
+ 33e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 341:	52                   	push   %edx
+ 342:	57                   	push   %edi
+ 343:	e8 cd fd ff ff       	call   115 <write>
+        putc(fd, c);
+ 348:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 34b:	31 d2                	xor    %edx,%edx
+ 34d:	eb 8e                	jmp    2dd <printf+0x4d>
+ 34f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 350:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 353:	83 ec 0c             	sub    $0xc,%esp
+ 356:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 35b:	8b 13                	mov    (%ebx),%edx
+ 35d:	6a 00                	push   $0x0
+ 35f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 361:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 364:	e8 87 fe ff ff       	call   1f0 <printint>
+        ap++;
+ 369:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 36c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 36f:	31 d2                	xor    %edx,%edx
+ 371:	e9 67 ff ff ff       	jmp    2dd <printf+0x4d>
+ 376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 380:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 383:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 385:	83 c0 04             	add    $0x4,%eax
+ 388:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 38b:	85 db                	test   %ebx,%ebx
+ 38d:	0f 84 9d 00 00 00    	je     430 <printf+0x1a0>
+        while(*s != 0){
+ 393:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 396:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 398:	84 c0                	test   %al,%al
+ 39a:	0f 84 3d ff ff ff    	je     2dd <printf+0x4d>
+ 3a0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 3a3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 3a6:	89 de                	mov    %ebx,%esi
+ 3a8:	89 d3                	mov    %edx,%ebx
+ 3aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 3b0:	83 ec 04             	sub    $0x4,%esp
+ 3b3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 3b6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 3b9:	6a 01                	push   $0x1
+ 3bb:	53                   	push   %ebx
+ 3bc:	57                   	push   %edi
+ 3bd:	e8 53 fd ff ff       	call   115 <write>
+        while(*s != 0){
+ 3c2:	0f b6 06             	movzbl (%esi),%eax
+ 3c5:	83 c4 10             	add    $0x10,%esp
+ 3c8:	84 c0                	test   %al,%al
+ 3ca:	75 e4                	jne    3b0 <printf+0x120>
+      state = 0;
+ 3cc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 3cf:	31 d2                	xor    %edx,%edx
+ 3d1:	e9 07 ff ff ff       	jmp    2dd <printf+0x4d>
+ 3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 3e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 3e3:	83 ec 0c             	sub    $0xc,%esp
+ 3e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 3eb:	8b 13                	mov    (%ebx),%edx
+ 3ed:	6a 01                	push   $0x1
+ 3ef:	e9 6b ff ff ff       	jmp    35f <printf+0xcf>
+ 3f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 3f8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 3fb:	83 ec 04             	sub    $0x4,%esp
+ 3fe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 401:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 403:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 406:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 409:	6a 01                	push   $0x1
+ 40b:	52                   	push   %edx
+ 40c:	57                   	push   %edi
+ 40d:	e8 03 fd ff ff       	call   115 <write>
+        ap++;
+ 412:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 415:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 418:	31 d2                	xor    %edx,%edx
+ 41a:	e9 be fe ff ff       	jmp    2dd <printf+0x4d>
+ 41f:	90                   	nop
+  write(fd, &c, 1);
+ 420:	83 ec 04             	sub    $0x4,%esp
+ 423:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 426:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 429:	6a 01                	push   $0x1
+ 42b:	e9 11 ff ff ff       	jmp    341 <printf+0xb1>
+ 430:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 435:	bb 90 04 00 00       	mov    $0x490,%ebx
+ 43a:	e9 61 ff ff ff       	jmp    3a0 <printf+0x110>
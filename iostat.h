@@ -0,0 +1,8 @@
+// Disk driver statistics, filled in by iostat().
+struct iostat {
+  uint nread;     // blocks read
+  uint nwrite;    // blocks written
+  uint ncmd;      // disk commands
+  uint ndma;      // of those, by bus-master DMA
+  uint kcycles;   // CPU time in the driver, in units of 1024 TSC cycles
+};
@@ -1,6 +1,13 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
-// and pipe buffers. Allocates 4096-byte pages.
+// and pipe buffers. Allocates 4096-byte pages out of the
+// buddy allocator in buddy.c, which owns all of physical memory.
+// Each CPU keeps a small cache of free pages in front of the
+// buddy allocator so that most kalloc()/kfree() calls do not
+// touch buddy_lock at all, plus a pool of pages that the idle
+// loop has already zeroed for kalloc_zeroed().  When the buddy
+// pool runs dry, kalloc() drains the other CPUs' caches back
+// into it before giving up.
 
 #include "types.h"
 #include "defs.h"
@@ -8,22 +15,36 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "buddy.h"
 
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
                    // defined by the kernel linker script in kernel.ld
 
-struct run {
-  struct run *next;
-};
+#define KCACHE  64   // max pages cached per CPU
+#define KBATCH  32   // pages moved between a CPU cache and the buddy pool
+#define KZERO   32   // max pre-zeroed pages per CPU
 
-struct {
+struct kcache {
   struct spinlock lock;
-  int use_lock;
-  struct run *freelist;
-} kmem;
+  int n;                  // number of cached pages
+  char *pages[KCACHE];    // pages[n-1] is the most recently freed
+  int nzero;              // number of pre-zeroed pages
+  char *zeroed[KZERO];    // pages known to be all zero
+};
+
+// Indexed by cpuid().  Each lock is only contended when another
+// CPU drains the cache (see kdrain).
+static struct kcache kcache[NCPU];
 
-// Initialization happens in two phases.
+// Number of page tables mapping each page, indexed by physical
+// page number.  Copy-on-write fork shares user pages between
+// address spaces; kfree() only frees a page once its count
+// drops to zero.  Updated with atomic instructions.
+static ushort pgref[PHYSTOP >> PGSHIFT];
+#define PGREF(v) pgref[V2P(v) >> PGSHIFT]
+
+// Initialization happens in two phases, after buddyinit().
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
 // 2. main() calls kinit2() with the rest of the physical pages
@@ -31,16 +52,60 @@ struct {
 void
 kinit1(void *vstart, void *vend)
 {
-  initlock(&kmem.lock, "kmem");
-  kmem.use_lock = 0;
   freerange(vstart, vend);
 }
 
+// The other CPUs are running by now, but kzeroidle() leaves the
+// buddy pool alone until buddy_use_lock is set, so buddy_test()
+// still has it to itself.
 void
 kinit2(void *vstart, void *vend)
 {
+  int i;
+
+  for(i = 0; i < NCPU; i++)
+    initlock(&kcache[i].lock, "kcache");
   freerange(vstart, vend);
-  kmem.use_lock = 1;
+  buddy_test();    // check split/coalesce on the full pool
+  buddy_use_lock = 1;
+}
+
+// This CPU's page cache, locked.
+static struct kcache*
+kcachelock(void)
+{
+  struct kcache *kc;
+
+  pushcli();
+  kc = &kcache[cpuid()];
+  acquire(&kc->lock);
+  popcli();
+  return kc;
+}
+
+// Give every other CPU's cached and zeroed pages back to the
+// buddy pool.  Returns the number of pages given back.
+static int
+kdrain(void)
+{
+  struct kcache *kc, *me;
+  int n;
+
+  pushcli();
+  me = &kcache[cpuid()];
+  popcli();
+  n = 0;
+  for(kc = kcache; kc < &kcache[NCPU]; kc++){
+    if(kc == me)
+      continue;
+    acquire(&kc->lock);
+    buddy_free_bulk((void**)kc->pages, PGSIZE, kc->n);
+    buddy_free_bulk((void**)kc->zeroed, PGSIZE, kc->nzero);
+    n += kc->n + kc->nzero;
+    kc->n = kc->nzero = 0;
+    release(&kc->lock);
+  }
+  return n;
 }
 
 void
@@ -59,21 +124,38 @@ freerange(void *vstart, void *vend)
 void
 kfree(char *v)
 {
-  struct run *r;
+  struct kcache *kc;
 
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
 
+#ifdef KALLOC_JUNK
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
+#endif
+
+  // Still mapped somewhere else?  (Pages being handed to the
+  // allocator by freerange() have a count of zero.)
+  if(PGREF(v) > 0 && __sync_sub_and_fetch(&PGREF(v), 1) > 0)
+    return;
+
+  // Before kinit2() there is only one CPU and cpuid()
+  // may not work yet, so go straight to the buddy pool.
+  if(!buddy_use_lock){
+    buddy_free(v, PGSIZE);
+    return;
+  }
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-  r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
-  if(kmem.use_lock)
-    release(&kmem.lock);
+  kc = kcachelock();
+  if(kc->n == KCACHE){
+    // Give the oldest (coldest) half back to the buddy pool.
+    buddy_free_bulk((void**)kc->pages, PGSIZE, KBATCH);
+    memmove(kc->pages, kc->pages + KBATCH,
+            (KCACHE - KBATCH) * sizeof(kc->pages[0]));
+    kc->n -= KBATCH;
+  }
+  kc->pages[kc->n++] = v;
+  release(&kc->lock);
 }
 
 // Allocate one 4096-byte page of physical memory.
@@ -82,15 +164,102 @@ kfree(char *v)
 char*
 kalloc(void)
 {
-  struct run *r;
-
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-    kmem.freelist = r->next;
-  if(kmem.use_lock)
-    release(&kmem.lock);
-  return (char*)r;
+  struct kcache *kc;
+  char *v;
+
+  if(!buddy_use_lock){
+    if((v = (char*)buddy_alloc(PGSIZE)) != 0)
+      PGREF(v) = 1;
+    return v;
+  }
+
+  kc = kcachelock();
+  if(kc->n == 0)
+    kc->n = buddy_alloc_bulk(PGSIZE, (void**)kc->pages, KBATCH);
+  v = 0;
+  if(kc->n > 0)
+    v = kc->pages[--kc->n];
+  else if(kc->nzero > 0)
+    v = kc->zeroed[--kc->nzero];
+  release(&kc->lock);
+  if(v == 0 && kdrain() > 0)
+    v = (char*)buddy_alloc(PGSIZE);
+  if(v)
+    PGREF(v) = 1;
+  return v;
 }
 
+// Allocate one 4096-byte page of physical memory filled
+// with zeros, preferably one zeroed ahead of time by kzeroidle().
+// Returns 0 if the memory cannot be allocated.
+char*
+kalloc_zeroed(void)
+{
+  struct kcache *kc;
+  char *v;
+
+  v = 0;
+  if(buddy_use_lock){
+    kc = kcachelock();
+    if(kc->nzero > 0)
+      v = kc->zeroed[--kc->nzero];
+    release(&kc->lock);
+    if(v){
+      PGREF(v) = 1;
+      return v;
+    }
+  }
+  if((v = kalloc()) != 0)
+    memset(v, 0, PGSIZE);
+  return v;
+}
+
+// Zero one free page into this CPU's pool for kalloc_zeroed(),
+// if the pool has room.  Called from scheduler() when there is
+// nothing to run, with interrupts enabled.  Returns 0 if there
+// was nothing to do, as always before kinit2() has finished:
+// until then the buddy pool belongs to the boot CPU.
+int
+kzeroidle(void)
+{
+  struct kcache *kc;
+  char *v;
+  int full;
+
+  if(!buddy_use_lock)
+    return 0;
+  kc = kcachelock();
+  full = kc->nzero == KZERO;
+  release(&kc->lock);
+  if(full || (v = kalloc()) == 0)
+    return 0;
+
+  memset(v, 0, PGSIZE);
+
+  kc = kcachelock();
+  if(kc->nzero < KZERO){
+    kc->zeroed[kc->nzero++] = v;
+    v = 0;
+  }
+  release(&kc->lock);
+  if(v)
+    kfree(v);
+  return 1;
+}
+
+
+// Record one more page table mapping page v.
+void
+kincref(char *v)
+{
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+    panic("kincref");
+  __sync_add_and_fetch(&PGREF(v), 1);
+}
+
+// Number of page tables mapping page v.
+int
+krefcnt(char *v)
+{
+  return PGREF(v);
+}
@@ -0,0 +1,611 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb 01 00 00 00       	mov    $0x1,%ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 31                	mov    (%ecx),%esi
+  1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+  1e:	83 fe 01             	cmp    $0x1,%esi
+  21:	7e 27                	jle    4a <main+0x4a>
+  23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  27:	90                   	nop
+    printf(2, "usage: kill pid...\n");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    kill(atoi(argv[i]));
+  28:	83 ec 0c             	sub    $0xc,%esp
+  2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+  2e:	83 c3 01             	add    $0x1,%ebx
+    kill(atoi(argv[i]));
+  31:	e8 2a 00 00 00       	call   60 <atoi>
+  36:	89 04 24             	mov    %eax,(%esp)
+  39:	e8 96 00 00 00       	call   d4 <kill>
+  for(i=1; i<argc; i++)
+  3e:	83 c4 10             	add    $0x10,%esp
+  41:	39 de                	cmp    %ebx,%esi
+  43:	75 e3                	jne    28 <main+0x28>
+  exit();
+  45:	e8 5a 00 00 00       	call   a4 <exit>
+    printf(2, "usage: kill pid...\n");
+  4a:	50                   	push   %eax
+  4b:	50                   	push   %eax
+  4c:	68 f0 03 00 00       	push   $0x3f0
+  51:	6a 02                	push   $0x2
+  53:	e8 e8 01 00 00       	call   240 <printf>
+    exit();
+  58:	e8 47 00 00 00       	call   a4 <exit>
+    *(char**)stack = freestacks;
+    freestacks = stack;
+    lock_release(&stacklock);
+  }
+  return pid;
+}
+  5d:	66 90                	xchg   %ax,%ax
+  5f:	90                   	nop
+
+00000060 <atoi>:
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	53                   	push   %ebx
+  64:	8b 55 08             	mov    0x8(%ebp),%edx
+  67:	0f be 02             	movsbl (%edx),%eax
+  6a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  6d:	80 f9 09             	cmp    $0x9,%cl
+  70:	b9 00 00 00 00       	mov    $0x0,%ecx
+    *(char**)stack = freestacks;
+  75:	77 1e                	ja     95 <atoi+0x35>
+  77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    freestacks = stack;
+  7e:	66 90                	xchg   %ax,%ax
+  80:	83 c2 01             	add    $0x1,%edx
+  83:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  86:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+}
+  8a:	0f be 02             	movsbl (%edx),%eax
+  8d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  90:	80 fb 09             	cmp    $0x9,%bl
+  93:	76 eb                	jbe    80 <atoi+0x20>
+  95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  98:	89 c8                	mov    %ecx,%eax
+  9a:	c9                   	leave
+  9b:	c3                   	ret
+
+0000009c <fork>:
+  9c:	b8 01 00 00 00       	mov    $0x1,%eax
+  if(stack == 0 && (stack = sbrk(TSTACK)) == (char*)-1)
+  a1:	cd 40                	int    $0x40
+  a3:	c3                   	ret
+
+000000a4 <exit>:
+  a4:	b8 02 00 00 00       	mov    $0x2,%eax
+  a9:	cd 40                	int    $0x40
+  ab:	c3                   	ret
+
+000000ac <wait>:
+  ac:	b8 03 00 00 00       	mov    $0x3,%eax
+  b1:	cd 40                	int    $0x40
+  b3:	c3                   	ret
+
+000000b4 <pipe>:
+  b4:	b8 04 00 00 00       	mov    $0x4,%eax
+  b9:	cd 40                	int    $0x40
+  bb:	c3                   	ret
+
+000000bc <read>:
+    return -1;
+  bc:	b8 05 00 00 00       	mov    $0x5,%eax
+  c1:	cd 40                	int    $0x40
+
+SYSCALL(fork)
+SYSCALL(exit)
+SYSCALL(wait)
+SYSCALL(pipe)
+SYSCALL(read)
+  c3:	c3                   	ret
+
+000000c4 <write>:
+SYSCALL(write)
+  c4:	b8 10 00 00 00       	mov    $0x10,%eax
+  c9:	cd 40                	int    $0x40
+  cb:	c3                   	ret
+
+000000cc <close>:
+SYSCALL(close)
+  cc:	b8 15 00 00 00       	mov    $0x15,%eax
+  d1:	cd 40                	int    $0x40
+  d3:	c3                   	ret
+
+000000d4 <kill>:
+SYSCALL(kill)
+  d4:	b8 06 00 00 00       	mov    $0x6,%eax
+  d9:	cd 40                	int    $0x40
+  db:	c3                   	ret
+
+000000dc <exec>:
+SYSCALL(exec)
+  dc:	b8 07 00 00 00       	mov    $0x7,%eax
+  e1:	cd 40                	int    $0x40
+  e3:	c3                   	ret
+
+000000e4 <open>:
+SYSCALL(open)
+  e4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  e9:	cd 40                	int    $0x40
+  eb:	c3                   	ret
+
+000000ec <mknod>:
+SYSCALL(mknod)
+  ec:	b8 11 00 00 00       	mov    $0x11,%eax
+  f1:	cd 40                	int    $0x40
+  f3:	c3                   	ret
+
+000000f4 <unlink>:
+SYSCALL(unlink)
+  f4:	b8 12 00 00 00       	mov    $0x12,%eax
+  f9:	cd 40                	int    $0x40
+  fb:	c3                   	ret
+
+000000fc <fstat>:
+SYSCALL(fstat)
+  fc:	b8 08 00 00 00       	mov    $0x8,%eax
+ 101:	cd 40                	int    $0x40
+ 103:	c3                   	ret
+
+00000104 <link>:
+SYSCALL(link)
+ 104:	b8 13 00 00 00       	mov    $0x13,%eax
+ 109:	cd 40                	int    $0x40
+ 10b:	c3                   	ret
+
+0000010c <mkdir>:
+SYSCALL(mkdir)
+ 10c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 111:	cd 40                	int    $0x40
+ 113:	c3                   	ret
+
+00000114 <chdir>:
+SYSCALL(chdir)
+ 114:	b8 09 00 00 00       	mov    $0x9,%eax
+ 119:	cd 40                	int    $0x40
+ 11b:	c3                   	ret
+
+0000011c <dup>:
+SYSCALL(dup)
+ 11c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 121:	cd 40                	int    $0x40
+ 123:	c3                   	ret
+
+00000124 <getpid>:
+SYSCALL(getpid)
+ 124:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 129:	cd 40                	int    $0x40
+ 12b:	c3                   	ret
+
+0000012c <sbrk>:
+SYSCALL(sbrk)
+ 12c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 131:	cd 40                	int    $0x40
+ 133:	c3                   	ret
+
+00000134 <sleep>:
+SYSCALL(sleep)
+ 134:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 139:	cd 40                	int    $0x40
+ 13b:	c3                   	ret
+
+0000013c <uptime>:
+SYSCALL(uptime)
+ 13c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 141:	cd 40                	int    $0x40
+ 143:	c3                   	ret
+
+00000144 <setpriority>:
+SYSCALL(setpriority)
+ 144:	b8 16 00 00 00       	mov    $0x16,%eax
+ 149:	cd 40                	int    $0x40
+ 14b:	c3                   	ret
+
+0000014c <settickets>:
+SYSCALL(settickets)
+ 14c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 151:	cd 40                	int    $0x40
+ 153:	c3                   	ret
+
+00000154 <getpinfo>:
+SYSCALL(getpinfo)
+ 154:	b8 18 00 00 00       	mov    $0x18,%eax
+ 159:	cd 40                	int    $0x40
+ 15b:	c3                   	ret
+
+0000015c <nanosleep>:
+SYSCALL(nanosleep)
+ 15c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 161:	cd 40                	int    $0x40
+ 163:	c3                   	ret
+
+00000164 <clone>:
+SYSCALL(clone)
+ 164:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 169:	cd 40                	int    $0x40
+ 16b:	c3                   	ret
+
+0000016c <join>:
+SYSCALL(join)
+ 16c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 171:	cd 40                	int    $0x40
+ 173:	c3                   	ret
+
+00000174 <futex_wait>:
+SYSCALL(futex_wait)
+ 174:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 179:	cd 40                	int    $0x40
+ 17b:	c3                   	ret
+
+0000017c <futex_wake>:
+SYSCALL(futex_wake)
+ 17c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 181:	cd 40                	int    $0x40
+ 183:	c3                   	ret
+
+00000184 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 184:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 189:	cd 40                	int    $0x40
+ 18b:	c3                   	ret
+
+0000018c <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 18c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 191:	cd 40                	int    $0x40
+ 193:	c3                   	ret
+
+00000194 <iostat>:
+SYSCALL(iostat)
+ 194:	b8 20 00 00 00       	mov    $0x20,%eax
+ 199:	cd 40                	int    $0x40
+ 19b:	c3                   	ret
+ 19c:	66 90                	xchg   %ax,%ax
+ 19e:	66 90                	xchg   %ax,%ax
+
+000001a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+ 1a5:	53                   	push   %ebx
+ 1a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 1a8:	89 d1                	mov    %edx,%ecx
+{
+ 1aa:	83 ec 3c             	sub    $0x3c,%esp
+ 1ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 1b0:	85 d2                	test   %edx,%edx
+ 1b2:	0f 89 80 00 00 00    	jns    238 <printint+0x98>
+ 1b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 1bc:	74 7a                	je     238 <printint+0x98>
+    x = -xx;
+ 1be:	f7 d9                	neg    %ecx
+    neg = 1;
+ 1c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 1c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 1c8:	31 f6                	xor    %esi,%esi
+ 1ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 1d0:	89 c8                	mov    %ecx,%eax
+ 1d2:	31 d2                	xor    %edx,%edx
+ 1d4:	89 f7                	mov    %esi,%edi
+ 1d6:	f7 f3                	div    %ebx
+ 1d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 1db:	0f b6 92 64 04 00 00 	movzbl 0x464(%edx),%edx
+ 1e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 1e6:	89 ca                	mov    %ecx,%edx
+ 1e8:	89 c1                	mov    %eax,%ecx
+ 1ea:	39 da                	cmp    %ebx,%edx
+ 1ec:	73 e2                	jae    1d0 <printint+0x30>
+  if(neg)
+ 1ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 1f1:	85 c0                	test   %eax,%eax
+ 1f3:	74 07                	je     1fc <printint+0x5c>
+    buf[i++] = '-';
+ 1f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 1fa:	89 f7                	mov    %esi,%edi
+ 1fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 1ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 202:	01 df                	add    %ebx,%edi
+ 204:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 208:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 20b:	83 ec 04             	sub    $0x4,%esp
+ 20e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 211:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 214:	6a 01                	push   $0x1
+ 216:	50                   	push   %eax
+ 217:	56                   	push   %esi
+ 218:	e8 a7 fe ff ff       	call   c4 <write>
+  while(--i >= 0)
+ 21d:	89 f8                	mov    %edi,%eax
+ 21f:	83 c4 10             	add    $0x10,%esp
+ 222:	83 ef 01             	sub    $0x1,%edi
+ 225:	39 d8                	cmp    %ebx,%eax
+ 227:	75 df                	jne    208 <printint+0x68>
+}
+ 229:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 22c:	5b                   	pop    %ebx
+ 22d:	5e                   	pop    %esi
+ 22e:	5f                   	pop    %edi
+ 22f:	5d                   	pop    %ebp
+ 230:	c3                   	ret
+ 231:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 238:	31 c0                	xor    %eax,%eax
+ 23a:	eb 89                	jmp    1c5 <printint+0x25>
+ 23c:	66 90                	xchg   %ax,%ax
+ 23e:	66 90                	xchg   %ax,%ax
+
+00000240 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+ 245:	53                   	push   %ebx
+ 246:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 249:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 24c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 24f:	0f b6 1e             	movzbl (%esi),%ebx
+ 252:	83 c6 01             	add    $0x1,%esi
+ 255:	84 db                	test   %bl,%bl
+ 257:	74 67                	je     2c0 <printf+0x80>
+ 259:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 25c:	31 d2                	xor    %edx,%edx
+ 25e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 261:	eb 34                	jmp    297 <printf+0x57>
+ 263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 267:	90                   	nop
+ 268:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 26b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 270:	83 f8 25             	cmp    $0x25,%eax
+ 273:	74 18                	je     28d <printf+0x4d>
+  write(fd, &c, 1);
+ 275:	83 ec 04             	sub    $0x4,%esp
+ 278:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 27b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 27e:	6a 01                	push   $0x1
+ 280:	50                   	push   %eax
+ 281:	57                   	push   %edi
+ 282:	e8 3d fe ff ff       	call   c4 <write>
+ 287:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 28a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 28d:	0f b6 1e             	movzbl (%esi),%ebx
+ 290:	83 c6 01             	add    $0x1,%esi
+ 293:	84 db                	test   %bl,%bl
+ 295:	74 29                	je     2c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 297:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 29a:	85 d2                	test   %edx,%edx
+ 29c:	74 ca                	je     268 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 29e:	83 fa 25             	cmp    $0x25,%edx
+ 2a1:	75 ea                	jne    28d <printf+0x4d>
+      if(c == 'd'){
+ 2a3:	83 f8 25             	cmp    $0x25,%eax
+ 2a6:	0f 84 24 01 00 00    	je     3d0 <printf+0x190>
+ 2ac:	83 e8 63             	sub    $0x63,%eax
+ 2af:	83 f8 15             	cmp    $0x15,%eax
+ 2b2:	77 1c                	ja     2d0 <printf+0x90>
+ 2b4:	ff 24 85 0c 04 00 00 	jmp    *0x40c(,%eax,4)
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 2c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2c3:	5b                   	pop    %ebx
+ 2c4:	5e                   	pop    %esi
+ 2c5:	5f                   	pop    %edi
+ 2c6:	5d                   	pop    %ebp
+ 2c7:	c3                   	ret
+ 2c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cf:	90                   	nop
+  write(fd, &c, 1);
+ 2d0:	83 ec 04             	sub    $0x4,%esp
+ 2d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 2d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 2da:	6a 01                	push   $0x1
+ 2dc:	52                   	push   %edx
+ 2dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 2e0:	57                   	push   %edi
+ 2e1:	e8 de fd ff ff       	call   c4 <write>
+ 2e6:	83 c4 0c             	add    $0xc,%esp
+ 2e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 2ec:	6a 01                	push   $0x1
+ 2ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 2f1:	52                   	push   %edx
+ 2f2:	57                   	push   %edi
+ 2f3:	e8 cc fd ff ff       	call   c4 <write>
+        putc(fd, c);
+ 2f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 2fb:	31 d2                	xor    %edx,%edx
+ 2fd:	eb 8e                	jmp    28d <printf+0x4d>
+ 2ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 300:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 303:	83 ec 0c             	sub    $0xc,%esp
+ 306:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 30b:	8b 13                	mov    (%ebx),%edx
+ 30d:	6a 00                	push   $0x0
+ 30f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 311:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 314:	e8 87 fe ff ff       	call   1a0 <printint>
+        ap++;
+ 319:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 31c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 31f:	31 d2                	xor    %edx,%edx
+ 321:	e9 67 ff ff ff       	jmp    28d <printf+0x4d>
+ 326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 330:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 333:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 335:	83 c0 04             	add    $0x4,%eax
+ 338:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 33b:	85 db                	test   %ebx,%ebx
+ 33d:	0f 84 9d 00 00 00    	je     3e0 <printf+0x1a0>
+        while(*s != 0){
+ 343:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 346:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 348:	84 c0                	test   %al,%al
+ 34a:	0f 84 3d ff ff ff    	je     28d <printf+0x4d>
+ 350:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 353:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 356:	89 de                	mov    %ebx,%esi
+ 358:	89 d3                	mov    %edx,%ebx
+ 35a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 360:	83 ec 04             	sub    $0x4,%esp
+ 363:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 366:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 369:	6a 01                	push   $0x1
+ 36b:	53                   	push   %ebx
+ 36c:	57                   	push   %edi
+ 36d:	e8 52 fd ff ff       	call   c4 <write>
+        while(*s != 0){
+ 372:	0f b6 06             	movzbl (%esi),%eax
+ 375:	83 c4 10             	add    $0x10,%esp
+ 378:	84 c0                	test   %al,%al
+ 37a:	75 e4                	jne    360 <printf+0x120>
+      state = 0;
+ 37c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 37f:	31 d2                	xor    %edx,%edx
+ 381:	e9 07 ff ff ff       	jmp    28d <printf+0x4d>
+ 386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 390:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 393:	83 ec 0c             	sub    $0xc,%esp
+ 396:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 39b:	8b 13                	mov    (%ebx),%edx
+ 39d:	6a 01                	push   $0x1
+ 39f:	e9 6b ff ff ff       	jmp    30f <printf+0xcf>
+ 3a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 3a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 3ab:	83 ec 04             	sub    $0x4,%esp
+ 3ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 3b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 3b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 3b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 3b9:	6a 01                	push   $0x1
+ 3bb:	52                   	push   %edx
+ 3bc:	57                   	push   %edi
+ 3bd:	e8 02 fd ff ff       	call   c4 <write>
+        ap++;
+ 3c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 3c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 3c8:	31 d2                	xor    %edx,%edx
+ 3ca:	e9 be fe ff ff       	jmp    28d <printf+0x4d>
+ 3cf:	90                   	nop
+  write(fd, &c, 1);
+ 3d0:	83 ec 04             	sub    $0x4,%esp
+ 3d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 3d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 3d9:	6a 01                	push   $0x1
+ 3db:	e9 11 ff ff ff       	jmp    2f1 <printf+0xb1>
+ 3e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 3e5:	bb 04 04 00 00       	mov    $0x404,%ebx
+ 3ea:	e9 61 ff ff ff       	jmp    350 <printf+0x110>
@@ -38,9 +38,24 @@
 #define ERROR   (0x0370/4)   // Local Vector Table 3 (ERROR)
   #define MASKED     0x00010000   // Interrupt masked
 #define TICR    (0x0380/4)   // Timer Initial Count
+#define IRR     (0x0200/4)   // Interrupt Request (8 registers)
 #define TCCR    (0x0390/4)   // Timer Current Count
 #define TDCR    (0x03E0/4)   // Timer Divide Configuration
 
+// Each CPU keeps local time, in timer counts, off its own lapic
+// timer.  Normally the timer is periodic and interrupts at every
+// tick; for high resolution timers and idle CPUs, timer.c has it
+// count down once to some other time with lapicarm().  Local time
+// stands still while the timer is stopped.
+struct ltimer {
+  uint start;      // Local time the current count-down began
+  uint count;      // Count it began with, 0 if stopped
+  uint tick;       // Local time of the next tick
+  int oneshot;     // Counting down once, not periodic
+};
+
+static struct ltimer ltimer[NCPU];
+
 volatile uint *lapic;  // Initialized in mp.c
 
 //PAGEBREAK!
@@ -54,6 +69,8 @@ lapicw(int index, int value)
 void
 lapicinit(void)
 {
+  struct ltimer *lt;
+
   if(!lapic)
     return;
 
@@ -66,7 +83,12 @@ lapicinit(void)
   // TICR would be calibrated using an external time source.
   lapicw(TDCR, X1);
   lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000);
+  lapicw(TICR, TICKNS);
+  lt = &ltimer[cpuid()];
+  lt->start = 0;
+  lt->count = TICKNS;
+  lt->tick = TICKNS;
+  lt->oneshot = 0;
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -113,6 +135,122 @@ lapiceoi(void)
     lapicw(EOI, 0);
 }
 
+// Interrupt the CPU whose local APIC ID is apicid with vector.
+void
+lapicsend(int apicid, int vector)
+{
+  if(!lapic)
+    return;
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
+// Has the timer interrupted without the interrupt being taken?
+static int
+timerpending(void)
+{
+  int v = T_IRQ0 + IRQ_TIMER;
+
+  return lapic[IRR + (v/32)*4] & (1 << (v%32));
+}
+
+// Local time on this CPU.  Interrupts must be off.
+uint
+lapicnow(void)
+{
+  struct ltimer *lt = &ltimer[cpuid()];
+  uint now;
+
+  if(!lapic)
+    return 0;
+  now = lt->start + lt->count - lapic[TCCR];
+  if(!lt->oneshot && timerpending())
+    now += lt->count;  // restarted, but lapicticks() has not run
+  return now;
+}
+
+// Local time of the next tick.
+uint
+lapicnexttick(void)
+{
+  return ltimer[cpuid()].tick;
+}
+
+// Called on each timer interrupt, and by an idle CPU that woke
+// up.  Returns how many ticks have passed since the last call.
+uint
+lapicticks(void)
+{
+  struct ltimer *lt = &ltimer[cpuid()];
+  uint now, n;
+
+  if(!lapic)
+    return 1;
+  if(!lt->oneshot){
+    // Periodic: the count-down that just ended has restarted.
+    lt->start += lt->count;
+  }
+  now = lapicnow();
+  for(n = 0; (int)(now - lt->tick) >= 0; n++)
+    lt->tick += TICKNS;
+  return n;
+}
+
+// Interrupt at local time t: go on ticking periodically if t is
+// the next tick and a tick has just passed, and otherwise count
+// down once to t.
+void
+lapicarm(uint t)
+{
+  struct ltimer *lt = &ltimer[cpuid()];
+  uint now;
+
+  if(!lapic)
+    return;
+  now = lapicnow();
+  if(t == lt->tick && !lt->oneshot)
+    return;
+  if(t == lt->tick && now == t - TICKNS){
+    lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
+    lapicw(TICR, TICKNS);
+    lt->start = now;
+    lt->count = TICKNS;
+    lt->oneshot = 0;
+    return;
+  }
+  lt->start = now;
+  lt->count = (int)(t - now) > 0 ? t - now : 1;
+  lt->oneshot = 1;
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  lapicw(TICR, lt->count);
+}
+
+// Stop the timer.  For an idle CPU.
+void
+lapicstop(void)
+{
+  struct ltimer *lt = &ltimer[cpuid()];
+
+  if(!lapic)
+    return;
+  lt->start = lapicnow();
+  lt->count = 0;
+  lt->oneshot = 1;
+  lapicw(TICR, 0);
+}
+
+// Has a one-shot count-down run out, with its interrupt
+// not yet taken?  Interrupts must be off.
+int
+lapicexpired(void)
+{
+  struct ltimer *lt = &ltimer[cpuid()];
+
+  return lapic && lt->oneshot && lt->count > 0 && timerpending();
+}
+
 // Spin for a given number of microseconds.
 // On real hardware would want to tune this dynamically.
 void
@@ -0,0 +1,574 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  if(argc != 3){
+   f:	83 39 03             	cmpl   $0x3,(%ecx)
+{
+  12:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc != 3){
+  15:	74 13                	je     2a <main+0x2a>
+    printf(2, "Usage: ln old new\n");
+  17:	52                   	push   %edx
+  18:	52                   	push   %edx
+  19:	68 b0 03 00 00       	push   $0x3b0
+  1e:	6a 02                	push   $0x2
+  20:	e8 db 01 00 00       	call   200 <printf>
+    exit();
+  25:	e8 38 00 00 00       	call   62 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2a:	50                   	push   %eax
+  2b:	50                   	push   %eax
+  2c:	ff 73 08             	push   0x8(%ebx)
+  2f:	ff 73 04             	push   0x4(%ebx)
+  32:	e8 8b 00 00 00       	call   c2 <link>
+  37:	83 c4 10             	add    $0x10,%esp
+  3a:	85 c0                	test   %eax,%eax
+  3c:	78 05                	js     43 <main+0x43>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  exit();
+  3e:	e8 1f 00 00 00       	call   62 <exit>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  43:	ff 73 08             	push   0x8(%ebx)
+  46:	ff 73 04             	push   0x4(%ebx)
+  49:	68 c3 03 00 00       	push   $0x3c3
+  4e:	6a 02                	push   $0x2
+  50:	e8 ab 01 00 00       	call   200 <printf>
+  55:	83 c4 10             	add    $0x10,%esp
+  58:	eb e4                	jmp    3e <main+0x3e>
+
+0000005a <fork>:
+    *(char**)stack = freestacks;
+    freestacks = stack;
+    lock_release(&stacklock);
+  }
+  return pid;
+}
+  5a:	b8 01 00 00 00       	mov    $0x1,%eax
+  5f:	cd 40                	int    $0x40
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+  61:	c3                   	ret
+
+00000062 <exit>:
+  62:	b8 02 00 00 00       	mov    $0x2,%eax
+  67:	cd 40                	int    $0x40
+  69:	c3                   	ret
+
+0000006a <wait>:
+  6a:	b8 03 00 00 00       	mov    $0x3,%eax
+  6f:	cd 40                	int    $0x40
+  while(xchg(&lk->locked, 1) != 0)
+  71:	c3                   	ret
+
+00000072 <pipe>:
+  72:	b8 04 00 00 00       	mov    $0x4,%eax
+    *(char**)stack = freestacks;
+  77:	cd 40                	int    $0x40
+  79:	c3                   	ret
+
+0000007a <read>:
+  7a:	b8 05 00 00 00       	mov    $0x5,%eax
+    freestacks = stack;
+  7f:	cd 40                	int    $0x40
+    *(char**)stack = freestacks;
+  81:	c3                   	ret
+
+00000082 <write>:
+  82:	b8 10 00 00 00       	mov    $0x10,%eax
+  87:	cd 40                	int    $0x40
+  89:	c3                   	ret
+
+0000008a <close>:
+}
+  8a:	b8 15 00 00 00       	mov    $0x15,%eax
+  8f:	cd 40                	int    $0x40
+  91:	c3                   	ret
+
+00000092 <kill>:
+  92:	b8 06 00 00 00       	mov    $0x6,%eax
+  97:	cd 40                	int    $0x40
+  99:	c3                   	ret
+
+0000009a <exec>:
+  9a:	b8 07 00 00 00       	mov    $0x7,%eax
+  9f:	cd 40                	int    $0x40
+  if(stack == 0 && (stack = sbrk(TSTACK)) == (char*)-1)
+  a1:	c3                   	ret
+
+000000a2 <open>:
+  a2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  a7:	cd 40                	int    $0x40
+  a9:	c3                   	ret
+
+000000aa <mknod>:
+  aa:	b8 11 00 00 00       	mov    $0x11,%eax
+  af:	cd 40                	int    $0x40
+  b1:	c3                   	ret
+
+000000b2 <unlink>:
+  b2:	b8 12 00 00 00       	mov    $0x12,%eax
+  b7:	cd 40                	int    $0x40
+  b9:	c3                   	ret
+
+000000ba <fstat>:
+  ba:	b8 08 00 00 00       	mov    $0x8,%eax
+    return -1;
+  bf:	cd 40                	int    $0x40
+  c1:	c3                   	ret
+
+000000c2 <link>:
+  c2:	b8 13 00 00 00       	mov    $0x13,%eax
+SYSCALL(exec)
+SYSCALL(open)
+SYSCALL(mknod)
+SYSCALL(unlink)
+SYSCALL(fstat)
+SYSCALL(link)
+  c7:	cd 40                	int    $0x40
+  c9:	c3                   	ret
+
+000000ca <mkdir>:
+SYSCALL(mkdir)
+  ca:	b8 14 00 00 00       	mov    $0x14,%eax
+  cf:	cd 40                	int    $0x40
+  d1:	c3                   	ret
+
+000000d2 <chdir>:
+SYSCALL(chdir)
+  d2:	b8 09 00 00 00       	mov    $0x9,%eax
+  d7:	cd 40                	int    $0x40
+  d9:	c3                   	ret
+
+000000da <dup>:
+SYSCALL(dup)
+  da:	b8 0a 00 00 00       	mov    $0xa,%eax
+  df:	cd 40                	int    $0x40
+  e1:	c3                   	ret
+
+000000e2 <getpid>:
+SYSCALL(getpid)
+  e2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  e7:	cd 40                	int    $0x40
+  e9:	c3                   	ret
+
+000000ea <sbrk>:
+SYSCALL(sbrk)
+  ea:	b8 0c 00 00 00       	mov    $0xc,%eax
+  ef:	cd 40                	int    $0x40
+  f1:	c3                   	ret
+
+000000f2 <sleep>:
+SYSCALL(sleep)
+  f2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  f7:	cd 40                	int    $0x40
+  f9:	c3                   	ret
+
+000000fa <uptime>:
+SYSCALL(uptime)
+  fa:	b8 0e 00 00 00       	mov    $0xe,%eax
+  ff:	cd 40                	int    $0x40
+ 101:	c3                   	ret
+
+00000102 <setpriority>:
+SYSCALL(setpriority)
+ 102:	b8 16 00 00 00       	mov    $0x16,%eax
+ 107:	cd 40                	int    $0x40
+ 109:	c3                   	ret
+
+0000010a <settickets>:
+SYSCALL(settickets)
+ 10a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 10f:	cd 40                	int    $0x40
+ 111:	c3                   	ret
+
+00000112 <getpinfo>:
+SYSCALL(getpinfo)
+ 112:	b8 18 00 00 00       	mov    $0x18,%eax
+ 117:	cd 40                	int    $0x40
+ 119:	c3                   	ret
+
+0000011a <nanosleep>:
+SYSCALL(nanosleep)
+ 11a:	b8 19 00 00 00       	mov    $0x19,%eax
+ 11f:	cd 40                	int    $0x40
+ 121:	c3                   	ret
+
+00000122 <clone>:
+SYSCALL(clone)
+ 122:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 127:	cd 40                	int    $0x40
+ 129:	c3                   	ret
+
+0000012a <join>:
+SYSCALL(join)
+ 12a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 12f:	cd 40                	int    $0x40
+ 131:	c3                   	ret
+
+00000132 <futex_wait>:
+SYSCALL(futex_wait)
+ 132:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 137:	cd 40                	int    $0x40
+ 139:	c3                   	ret
+
+0000013a <futex_wake>:
+SYSCALL(futex_wake)
+ 13a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 13f:	cd 40                	int    $0x40
+ 141:	c3                   	ret
+
+00000142 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 142:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 147:	cd 40                	int    $0x40
+ 149:	c3                   	ret
+
+0000014a <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 14a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 14f:	cd 40                	int    $0x40
+ 151:	c3                   	ret
+
+00000152 <iostat>:
+SYSCALL(iostat)
+ 152:	b8 20 00 00 00       	mov    $0x20,%eax
+ 157:	cd 40                	int    $0x40
+ 159:	c3                   	ret
+ 15a:	66 90                	xchg   %ax,%ax
+ 15c:	66 90                	xchg   %ax,%ax
+ 15e:	66 90                	xchg   %ax,%ax
+
+00000160 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	57                   	push   %edi
+ 164:	56                   	push   %esi
+ 165:	53                   	push   %ebx
+ 166:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 168:	89 d1                	mov    %edx,%ecx
+{
+ 16a:	83 ec 3c             	sub    $0x3c,%esp
+ 16d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 170:	85 d2                	test   %edx,%edx
+ 172:	0f 89 80 00 00 00    	jns    1f8 <printint+0x98>
+ 178:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 17c:	74 7a                	je     1f8 <printint+0x98>
+    x = -xx;
+ 17e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 180:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 185:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 188:	31 f6                	xor    %esi,%esi
+ 18a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 190:	89 c8                	mov    %ecx,%eax
+ 192:	31 d2                	xor    %edx,%edx
+ 194:	89 f7                	mov    %esi,%edi
+ 196:	f7 f3                	div    %ebx
+ 198:	8d 76 01             	lea    0x1(%esi),%esi
+ 19b:	0f b6 92 38 04 00 00 	movzbl 0x438(%edx),%edx
+ 1a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 1a6:	89 ca                	mov    %ecx,%edx
+ 1a8:	89 c1                	mov    %eax,%ecx
+ 1aa:	39 da                	cmp    %ebx,%edx
+ 1ac:	73 e2                	jae    190 <printint+0x30>
+  if(neg)
+ 1ae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 1b1:	85 c0                	test   %eax,%eax
+ 1b3:	74 07                	je     1bc <printint+0x5c>
+    buf[i++] = '-';
+ 1b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 1ba:	89 f7                	mov    %esi,%edi
+ 1bc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 1bf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 1c2:	01 df                	add    %ebx,%edi
+ 1c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 1c8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 1cb:	83 ec 04             	sub    $0x4,%esp
+ 1ce:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 1d1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 1d4:	6a 01                	push   $0x1
+ 1d6:	50                   	push   %eax
+ 1d7:	56                   	push   %esi
+ 1d8:	e8 a5 fe ff ff       	call   82 <write>
+  while(--i >= 0)
+ 1dd:	89 f8                	mov    %edi,%eax
+ 1df:	83 c4 10             	add    $0x10,%esp
+ 1e2:	83 ef 01             	sub    $0x1,%edi
+ 1e5:	39 d8                	cmp    %ebx,%eax
+ 1e7:	75 df                	jne    1c8 <printint+0x68>
+}
+ 1e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ec:	5b                   	pop    %ebx
+ 1ed:	5e                   	pop    %esi
+ 1ee:	5f                   	pop    %edi
+ 1ef:	5d                   	pop    %ebp
+ 1f0:	c3                   	ret
+ 1f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 1f8:	31 c0                	xor    %eax,%eax
+ 1fa:	eb 89                	jmp    185 <printint+0x25>
+ 1fc:	66 90                	xchg   %ax,%ax
+ 1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	57                   	push   %edi
+ 204:	56                   	push   %esi
+ 205:	53                   	push   %ebx
+ 206:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 209:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 20c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 20f:	0f b6 1e             	movzbl (%esi),%ebx
+ 212:	83 c6 01             	add    $0x1,%esi
+ 215:	84 db                	test   %bl,%bl
+ 217:	74 67                	je     280 <printf+0x80>
+ 219:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 21c:	31 d2                	xor    %edx,%edx
+ 21e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 221:	eb 34                	jmp    257 <printf+0x57>
+ 223:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 227:	90                   	nop
+ 228:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 22b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 230:	83 f8 25             	cmp    $0x25,%eax
+ 233:	74 18                	je     24d <printf+0x4d>
+  write(fd, &c, 1);
+ 235:	83 ec 04             	sub    $0x4,%esp
+ 238:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 23b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 23e:	6a 01                	push   $0x1
+ 240:	50                   	push   %eax
+ 241:	57                   	push   %edi
+ 242:	e8 3b fe ff ff       	call   82 <write>
+ 247:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 24a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 24d:	0f b6 1e             	movzbl (%esi),%ebx
+ 250:	83 c6 01             	add    $0x1,%esi
+ 253:	84 db                	test   %bl,%bl
+ 255:	74 29                	je     280 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 257:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 25a:	85 d2                	test   %edx,%edx
+ 25c:	74 ca                	je     228 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 25e:	83 fa 25             	cmp    $0x25,%edx
+ 261:	75 ea                	jne    24d <printf+0x4d>
+      if(c == 'd'){
+ 263:	83 f8 25             	cmp    $0x25,%eax
+ 266:	0f 84 24 01 00 00    	je     390 <printf+0x190>
+ 26c:	83 e8 63             	sub    $0x63,%eax
+ 26f:	83 f8 15             	cmp    $0x15,%eax
+ 272:	77 1c                	ja     290 <printf+0x90>
+ 274:	ff 24 85 e0 03 00 00 	jmp    *0x3e0(,%eax,4)
+ 27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 280:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 283:	5b                   	pop    %ebx
+ 284:	5e                   	pop    %esi
+ 285:	5f                   	pop    %edi
+ 286:	5d                   	pop    %ebp
+ 287:	c3                   	ret
+ 288:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28f:	90                   	nop
+  write(fd, &c, 1);
+ 290:	83 ec 04             	sub    $0x4,%esp
+ 293:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 296:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 29a:	6a 01                	push   $0x1
+ 29c:	52                   	push   %edx
+ 29d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 2a0:	57                   	push   %edi
+ 2a1:	e8 dc fd ff ff       	call   82 <write>
+ 2a6:	83 c4 0c             	add    $0xc,%esp
+ 2a9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 2ac:	6a 01                	push   $0x1
+ 2ae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 2b1:	52                   	push   %edx
+ 2b2:	57                   	push   %edi
+ 2b3:	e8 ca fd ff ff       	call   82 <write>
+        putc(fd, c);
+ 2b8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 2bb:	31 d2                	xor    %edx,%edx
+ 2bd:	eb 8e                	jmp    24d <printf+0x4d>
+ 2bf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 2c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 2c3:	83 ec 0c             	sub    $0xc,%esp
+ 2c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 2cb:	8b 13                	mov    (%ebx),%edx
+ 2cd:	6a 00                	push   $0x0
+ 2cf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 2d1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 2d4:	e8 87 fe ff ff       	call   160 <printint>
+        ap++;
+ 2d9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 2dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 2df:	31 d2                	xor    %edx,%edx
+ 2e1:	e9 67 ff ff ff       	jmp    24d <printf+0x4d>
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 2f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 2f3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 2f5:	83 c0 04             	add    $0x4,%eax
+ 2f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 2fb:	85 db                	test   %ebx,%ebx
+ 2fd:	0f 84 9d 00 00 00    	je     3a0 <printf+0x1a0>
+        while(*s != 0){
+ 303:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 306:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 308:	84 c0                	test   %al,%al
+ 30a:	0f 84 3d ff ff ff    	je     24d <printf+0x4d>
+ 310:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 313:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 316:	89 de                	mov    %ebx,%esi
+ 318:	89 d3                	mov    %edx,%ebx
+ 31a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 320:	83 ec 04             	sub    $0x4,%esp
+ 323:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 326:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 329:	6a 01                	push   $0x1
+ 32b:	53                   	push   %ebx
+ 32c:	57                   	push   %edi
+ 32d:	e8 50 fd ff ff       	call   82 <write>
+        while(*s != 0){
+ 332:	0f b6 06             	movzbl (%esi),%eax
+ 335:	83 c4 10             	add    $0x10,%esp
+ 338:	84 c0                	test   %al,%al
+ 33a:	75 e4                	jne    320 <printf+0x120>
+      state = 0;
+ 33c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 33f:	31 d2                	xor    %edx,%edx
+ 341:	e9 07 ff ff ff       	jmp    24d <printf+0x4d>
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 350:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 353:	83 ec 0c             	sub    $0xc,%esp
+ 356:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 35b:	8b 13                	mov    (%ebx),%edx
+ 35d:	6a 01                	push   $0x1
+ 35f:	e9 6b ff ff ff       	jmp    2cf <printf+0xcf>
+ 364:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 368:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 36b:	83 ec 04             	sub    $0x4,%esp
+ 36e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 371:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 373:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 376:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 379:	6a 01                	push   $0x1
+ 37b:	52                   	push   %edx
+ 37c:	57                   	push   %edi
+ 37d:	e8 00 fd ff ff       	call   82 <write>
+        ap++;
+ 382:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 385:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 388:	31 d2                	xor    %edx,%edx
+ 38a:	e9 be fe ff ff       	jmp    24d <printf+0x4d>
+ 38f:	90                   	nop
+  write(fd, &c, 1);
+ 390:	83 ec 04             	sub    $0x4,%esp
+ 393:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 396:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 399:	6a 01                	push   $0x1
+ 39b:	e9 11 ff ff ff       	jmp    2b1 <printf+0xb1>
+ 3a0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 3a5:	bb d7 03 00 00       	mov    $0x3d7,%ebx
+ 3aa:	e9 61 ff ff ff       	jmp    310 <printf+0x110>
@@ -65,19 +65,30 @@ initlog(int dev)
   recover_from_log();
 }
 
-// Copy committed blocks from log to their home location
+// Copy committed blocks from log to their home location.
+// All the writes are queued before waiting for any of them.
 static void
 install_trans(void)
 {
+  struct buf *dbuf[LOGSIZE];
   int tail;
 
+  // In recovery, nothing is cached yet: ask for it all at once.
+  for (tail = 0; tail < log.lh.n; tail++) {
+    breadahead(log.dev, log.start+tail+1);
+    breadahead(log.dev, log.lh.block[tail]);
+  }
   for (tail = 0; tail < log.lh.n; tail++) {
     struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
+    dbuf[tail] = bread(log.dev, log.lh.block[tail]); // read dst
+    memmove(dbuf[tail]->data, lbuf->data, BSIZE);  // copy block to dst
     brelse(lbuf);
-    brelse(dbuf);
+    dbuf[tail]->flags |= B_DIRTY;
+    bsubmit(dbuf[tail], 0);  // start writing dst to disk
+  }
+  for (tail = 0; tail < log.lh.n; tail++) {
+    bwait(dbuf[tail]);
+    brelse(dbuf[tail]);
   }
 }
 
@@ -174,18 +185,24 @@ end_op(void)
 }
 
 // Copy modified blocks from cache to log.
+// All the writes are queued before waiting for any of them.
 static void
 write_log(void)
 {
+  struct buf *to[LOGSIZE];
   int tail;
 
   for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
+    to[tail] = bblank(log.dev, log.start+tail+1); // log block, overwritten
     struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
+    memmove(to[tail]->data, from->data, BSIZE);
     brelse(from);
-    brelse(to);
+    to[tail]->flags |= B_VALID | B_DIRTY;
+    bsubmit(to[tail], 0);  // start writing the log
+  }
+  for (tail = 0; tail < log.lh.n; tail++) {
+    bwait(to[tail]);
+    brelse(to[tail]);
   }
 }
 
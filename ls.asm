@@ -0,0 +1,1024 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb 01 00 00 00       	mov    $0x1,%ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 31                	mov    (%ecx),%esi
+  1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+  1e:	83 fe 01             	cmp    $0x1,%esi
+  21:	7e 1f                	jle    42 <main+0x42>
+  23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  27:	90                   	nop
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+  28:	83 ec 0c             	sub    $0xc,%esp
+  2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+  2e:	83 c3 01             	add    $0x1,%ebx
+    ls(argv[i]);
+  31:	e8 ca 00 00 00       	call   100 <ls>
+  for(i=1; i<argc; i++)
+  36:	83 c4 10             	add    $0x10,%esp
+  39:	39 de                	cmp    %ebx,%esi
+  3b:	75 eb                	jne    28 <main+0x28>
+  exit();
+  3d:	e8 01 04 00 00       	call   443 <exit>
+    ls(".");
+  42:	83 ec 0c             	sub    $0xc,%esp
+  45:	68 d8 07 00 00       	push   $0x7d8
+  4a:	e8 b1 00 00 00       	call   100 <ls>
+    exit();
+  4f:	e8 ef 03 00 00       	call   443 <exit>
+    *(char**)stack = freestacks;
+    freestacks = stack;
+    lock_release(&stacklock);
+  }
+  return pid;
+}
+  54:	66 90                	xchg   %ax,%ax
+  56:	66 90                	xchg   %ax,%ax
+  58:	66 90                	xchg   %ax,%ax
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <fmtname>:
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	56                   	push   %esi
+  64:	53                   	push   %ebx
+  65:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+  68:	83 ec 0c             	sub    $0xc,%esp
+  6b:	56                   	push   %esi
+  6c:	e8 ff 02 00 00       	call   370 <strlen>
+  71:	83 c4 10             	add    $0x10,%esp
+  74:	01 f0                	add    %esi,%eax
+  76:	89 c3                	mov    %eax,%ebx
+  78:	73 0f                	jae    89 <fmtname+0x29>
+  7a:	eb 12                	jmp    8e <fmtname+0x2e>
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  83:	39 f0                	cmp    %esi,%eax
+  85:	72 0a                	jb     91 <fmtname+0x31>
+  87:	89 c3                	mov    %eax,%ebx
+  89:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+  8c:	75 f2                	jne    80 <fmtname+0x20>
+  p++;
+  8e:	83 c3 01             	add    $0x1,%ebx
+  if(strlen(p) >= DIRSIZ)
+  91:	83 ec 0c             	sub    $0xc,%esp
+  94:	53                   	push   %ebx
+  95:	e8 d6 02 00 00       	call   370 <strlen>
+  9a:	83 c4 10             	add    $0x10,%esp
+  9d:	83 f8 0d             	cmp    $0xd,%eax
+  a0:	77 4a                	ja     ec <fmtname+0x8c>
+  memmove(buf, p, strlen(p));
+  a2:	83 ec 0c             	sub    $0xc,%esp
+  a5:	53                   	push   %ebx
+  a6:	e8 c5 02 00 00       	call   370 <strlen>
+  ab:	83 c4 0c             	add    $0xc,%esp
+  ae:	50                   	push   %eax
+  af:	53                   	push   %ebx
+  b0:	68 38 0a 00 00       	push   $0xa38
+  b5:	e8 56 03 00 00       	call   410 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ba:	89 1c 24             	mov    %ebx,(%esp)
+  bd:	e8 ae 02 00 00       	call   370 <strlen>
+  c2:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+  c5:	bb 38 0a 00 00       	mov    $0xa38,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ca:	89 c6                	mov    %eax,%esi
+  cc:	e8 9f 02 00 00       	call   370 <strlen>
+  d1:	ba 0e 00 00 00       	mov    $0xe,%edx
+  d6:	83 c4 0c             	add    $0xc,%esp
+  d9:	29 f2                	sub    %esi,%edx
+  db:	05 38 0a 00 00       	add    $0xa38,%eax
+  e0:	52                   	push   %edx
+  e1:	6a 20                	push   $0x20
+  e3:	50                   	push   %eax
+  e4:	e8 b7 02 00 00       	call   3a0 <memset>
+  return buf;
+  e9:	83 c4 10             	add    $0x10,%esp
+}
+  ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  ef:	89 d8                	mov    %ebx,%eax
+  f1:	5b                   	pop    %ebx
+  f2:	5e                   	pop    %esi
+  f3:	5d                   	pop    %ebp
+  f4:	c3                   	ret
+  f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000100 <ls>:
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	57                   	push   %edi
+ 104:	56                   	push   %esi
+ 105:	53                   	push   %ebx
+ 106:	81 ec 64 02 00 00    	sub    $0x264,%esp
+ 10c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((fd = open(path, 0)) < 0){
+ 10f:	6a 00                	push   $0x0
+ 111:	57                   	push   %edi
+ 112:	e8 6c 03 00 00       	call   483 <open>
+ 117:	83 c4 10             	add    $0x10,%esp
+ 11a:	85 c0                	test   %eax,%eax
+ 11c:	0f 88 9e 01 00 00    	js     2c0 <ls+0x1c0>
+  if(fstat(fd, &st) < 0){
+ 122:	83 ec 08             	sub    $0x8,%esp
+ 125:	8d b5 d4 fd ff ff    	lea    -0x22c(%ebp),%esi
+ 12b:	89 c3                	mov    %eax,%ebx
+ 12d:	56                   	push   %esi
+ 12e:	50                   	push   %eax
+ 12f:	e8 67 03 00 00       	call   49b <fstat>
+ 134:	83 c4 10             	add    $0x10,%esp
+ 137:	85 c0                	test   %eax,%eax
+ 139:	0f 88 c1 01 00 00    	js     300 <ls+0x200>
+  switch(st.type){
+ 13f:	0f b7 85 d4 fd ff ff 	movzwl -0x22c(%ebp),%eax
+ 146:	66 83 f8 01          	cmp    $0x1,%ax
+ 14a:	74 64                	je     1b0 <ls+0xb0>
+ 14c:	66 83 f8 02          	cmp    $0x2,%ax
+ 150:	74 1e                	je     170 <ls+0x70>
+  close(fd);
+ 152:	83 ec 0c             	sub    $0xc,%esp
+ 155:	53                   	push   %ebx
+ 156:	e8 10 03 00 00       	call   46b <close>
+ 15b:	83 c4 10             	add    $0x10,%esp
+}
+ 15e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 161:	5b                   	pop    %ebx
+ 162:	5e                   	pop    %esi
+ 163:	5f                   	pop    %edi
+ 164:	5d                   	pop    %ebp
+ 165:	c3                   	ret
+ 166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 170:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+ 176:	83 ec 0c             	sub    $0xc,%esp
+ 179:	8b b5 dc fd ff ff    	mov    -0x224(%ebp),%esi
+ 17f:	89 95 b4 fd ff ff    	mov    %edx,-0x24c(%ebp)
+ 185:	57                   	push   %edi
+ 186:	e8 d5 fe ff ff       	call   60 <fmtname>
+ 18b:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+ 191:	59                   	pop    %ecx
+ 192:	5f                   	pop    %edi
+ 193:	52                   	push   %edx
+ 194:	56                   	push   %esi
+ 195:	6a 02                	push   $0x2
+ 197:	50                   	push   %eax
+ 198:	68 b8 07 00 00       	push   $0x7b8
+ 19d:	6a 01                	push   $0x1
+ 19f:	e8 3c 04 00 00       	call   5e0 <printf>
+    break;
+ 1a4:	83 c4 20             	add    $0x20,%esp
+ 1a7:	eb a9                	jmp    152 <ls+0x52>
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 1b0:	83 ec 0c             	sub    $0xc,%esp
+ 1b3:	57                   	push   %edi
+ 1b4:	e8 b7 01 00 00       	call   370 <strlen>
+ 1b9:	83 c4 10             	add    $0x10,%esp
+ 1bc:	83 c0 10             	add    $0x10,%eax
+ 1bf:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1c4:	0f 87 16 01 00 00    	ja     2e0 <ls+0x1e0>
+    strcpy(buf, path);
+ 1ca:	83 ec 08             	sub    $0x8,%esp
+ 1cd:	57                   	push   %edi
+ 1ce:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+ 1d4:	57                   	push   %edi
+ 1d5:	e8 66 01 00 00       	call   340 <strcpy>
+    p = buf+strlen(buf);
+ 1da:	89 3c 24             	mov    %edi,(%esp)
+ 1dd:	e8 8e 01 00 00       	call   370 <strlen>
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1e2:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+ 1e5:	01 f8                	add    %edi,%eax
+    *p++ = '/';
+ 1e7:	8d 48 01             	lea    0x1(%eax),%ecx
+    p = buf+strlen(buf);
+ 1ea:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+    *p++ = '/';
+ 1f0:	89 8d a4 fd ff ff    	mov    %ecx,-0x25c(%ebp)
+ 1f6:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 200:	83 ec 04             	sub    $0x4,%esp
+ 203:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+ 209:	6a 10                	push   $0x10
+ 20b:	50                   	push   %eax
+ 20c:	53                   	push   %ebx
+ 20d:	e8 49 02 00 00       	call   45b <read>
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	83 f8 10             	cmp    $0x10,%eax
+ 218:	0f 85 34 ff ff ff    	jne    152 <ls+0x52>
+      if(de.inum == 0)
+ 21e:	66 83 bd c4 fd ff ff 	cmpw   $0x0,-0x23c(%ebp)
+ 225:	00 
+ 226:	74 d8                	je     200 <ls+0x100>
+      memmove(p, de.name, DIRSIZ);
+ 228:	83 ec 04             	sub    $0x4,%esp
+ 22b:	8d 85 c6 fd ff ff    	lea    -0x23a(%ebp),%eax
+ 231:	6a 0e                	push   $0xe
+ 233:	50                   	push   %eax
+ 234:	ff b5 a4 fd ff ff    	push   -0x25c(%ebp)
+ 23a:	e8 d1 01 00 00       	call   410 <memmove>
+      p[DIRSIZ] = 0;
+ 23f:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+ 245:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){
+ 249:	58                   	pop    %eax
+ 24a:	5a                   	pop    %edx
+ 24b:	56                   	push   %esi
+ 24c:	57                   	push   %edi
+ 24d:	e8 6e 01 00 00       	call   3c0 <stat>
+ 252:	83 c4 10             	add    $0x10,%esp
+ 255:	85 c0                	test   %eax,%eax
+ 257:	0f 88 cb 00 00 00    	js     328 <ls+0x228>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+ 25d:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+ 263:	8b 95 dc fd ff ff    	mov    -0x224(%ebp),%edx
+ 269:	83 ec 0c             	sub    $0xc,%esp
+ 26c:	0f bf 85 d4 fd ff ff 	movswl -0x22c(%ebp),%eax
+ 273:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+ 279:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+ 27f:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+ 285:	57                   	push   %edi
+ 286:	e8 d5 fd ff ff       	call   60 <fmtname>
+ 28b:	5a                   	pop    %edx
+ 28c:	59                   	pop    %ecx
+ 28d:	8b 8d ac fd ff ff    	mov    -0x254(%ebp),%ecx
+ 293:	51                   	push   %ecx
+ 294:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+ 29a:	52                   	push   %edx
+ 29b:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+ 2a1:	50                   	push   %eax
+ 2a2:	68 b8 07 00 00       	push   $0x7b8
+ 2a7:	6a 01                	push   $0x1
+ 2a9:	e8 32 03 00 00       	call   5e0 <printf>
+ 2ae:	83 c4 20             	add    $0x20,%esp
+ 2b1:	e9 4a ff ff ff       	jmp    200 <ls+0x100>
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot open %s\n", path);
+ 2c0:	83 ec 04             	sub    $0x4,%esp
+ 2c3:	57                   	push   %edi
+ 2c4:	68 90 07 00 00       	push   $0x790
+ 2c9:	6a 02                	push   $0x2
+ 2cb:	e8 10 03 00 00       	call   5e0 <printf>
+    return;
+ 2d0:	83 c4 10             	add    $0x10,%esp
+}
+ 2d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2d6:	5b                   	pop    %ebx
+ 2d7:	5e                   	pop    %esi
+ 2d8:	5f                   	pop    %edi
+ 2d9:	5d                   	pop    %ebp
+ 2da:	c3                   	ret
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+      printf(1, "ls: path too long\n");
+ 2e0:	83 ec 08             	sub    $0x8,%esp
+ 2e3:	68 c5 07 00 00       	push   $0x7c5
+ 2e8:	6a 01                	push   $0x1
+ 2ea:	e8 f1 02 00 00       	call   5e0 <printf>
+      break;
+ 2ef:	83 c4 10             	add    $0x10,%esp
+ 2f2:	e9 5b fe ff ff       	jmp    152 <ls+0x52>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    printf(2, "ls: cannot stat %s\n", path);
+ 300:	83 ec 04             	sub    $0x4,%esp
+ 303:	57                   	push   %edi
+ 304:	68 a4 07 00 00       	push   $0x7a4
+ 309:	6a 02                	push   $0x2
+ 30b:	e8 d0 02 00 00       	call   5e0 <printf>
+    close(fd);
+ 310:	89 1c 24             	mov    %ebx,(%esp)
+ 313:	e8 53 01 00 00       	call   46b <close>
+    return;
+ 318:	83 c4 10             	add    $0x10,%esp
+}
+ 31b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 31e:	5b                   	pop    %ebx
+ 31f:	5e                   	pop    %esi
+ 320:	5f                   	pop    %edi
+ 321:	5d                   	pop    %ebp
+ 322:	c3                   	ret
+ 323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 327:	90                   	nop
+        printf(1, "ls: cannot stat %s\n", buf);
+ 328:	83 ec 04             	sub    $0x4,%esp
+ 32b:	57                   	push   %edi
+ 32c:	68 a4 07 00 00       	push   $0x7a4
+ 331:	6a 01                	push   $0x1
+ 333:	e8 a8 02 00 00       	call   5e0 <printf>
+        continue;
+ 338:	83 c4 10             	add    $0x10,%esp
+ 33b:	e9 c0 fe ff ff       	jmp    200 <ls+0x100>
+
+00000340 <strcpy>:
+{
+ 340:	55                   	push   %ebp
+  while((*s++ = *t++) != 0)
+ 341:	31 c0                	xor    %eax,%eax
+{
+ 343:	89 e5                	mov    %esp,%ebp
+ 345:	53                   	push   %ebx
+ 346:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 349:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 350:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 354:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 357:	83 c0 01             	add    $0x1,%eax
+ 35a:	84 d2                	test   %dl,%dl
+ 35c:	75 f2                	jne    350 <strcpy+0x10>
+}
+ 35e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 361:	89 c8                	mov    %ecx,%eax
+ 363:	c9                   	leave
+ 364:	c3                   	ret
+ 365:	66 90                	xchg   %ax,%ax
+ 367:	66 90                	xchg   %ax,%ax
+ 369:	66 90                	xchg   %ax,%ax
+ 36b:	66 90                	xchg   %ax,%ax
+ 36d:	66 90                	xchg   %ax,%ax
+ 36f:	90                   	nop
+
+00000370 <strlen>:
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+ 376:	80 3a 00             	cmpb   $0x0,(%edx)
+ 379:	74 15                	je     390 <strlen+0x20>
+ 37b:	31 c0                	xor    %eax,%eax
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+ 380:	83 c0 01             	add    $0x1,%eax
+ 383:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 387:	89 c1                	mov    %eax,%ecx
+ 389:	75 f5                	jne    380 <strlen+0x10>
+}
+ 38b:	89 c8                	mov    %ecx,%eax
+ 38d:	5d                   	pop    %ebp
+ 38e:	c3                   	ret
+ 38f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 390:	31 c9                	xor    %ecx,%ecx
+}
+ 392:	5d                   	pop    %ebp
+ 393:	89 c8                	mov    %ecx,%eax
+ 395:	c3                   	ret
+ 396:	66 90                	xchg   %ax,%ax
+ 398:	66 90                	xchg   %ax,%ax
+ 39a:	66 90                	xchg   %ax,%ax
+ 39c:	66 90                	xchg   %ax,%ax
+ 39e:	66 90                	xchg   %ax,%ax
+
+000003a0 <memset>:
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 3a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3ad:	89 d7                	mov    %edx,%edi
+ 3af:	fc                   	cld
+ 3b0:	f3 aa                	rep stos %al,%es:(%edi)
+}
+ 3b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3b5:	89 d0                	mov    %edx,%eax
+ 3b7:	c9                   	leave
+ 3b8:	c3                   	ret
+ 3b9:	66 90                	xchg   %ax,%ax
+ 3bb:	66 90                	xchg   %ax,%ax
+ 3bd:	66 90                	xchg   %ax,%ax
+ 3bf:	90                   	nop
+
+000003c0 <stat>:
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	56                   	push   %esi
+ 3c4:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+ 3c5:	83 ec 08             	sub    $0x8,%esp
+ 3c8:	6a 00                	push   $0x0
+ 3ca:	ff 75 08             	push   0x8(%ebp)
+ 3cd:	e8 b1 00 00 00       	call   483 <open>
+  if(fd < 0)
+ 3d2:	83 c4 10             	add    $0x10,%esp
+ 3d5:	85 c0                	test   %eax,%eax
+ 3d7:	78 27                	js     400 <stat+0x40>
+  r = fstat(fd, st);
+ 3d9:	83 ec 08             	sub    $0x8,%esp
+ 3dc:	ff 75 0c             	push   0xc(%ebp)
+ 3df:	89 c3                	mov    %eax,%ebx
+ 3e1:	50                   	push   %eax
+ 3e2:	e8 b4 00 00 00       	call   49b <fstat>
+  close(fd);
+ 3e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3ec:	e8 7a 00 00 00       	call   46b <close>
+  return r;
+ 3f1:	83 c4 10             	add    $0x10,%esp
+}
+ 3f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3f7:	89 f0                	mov    %esi,%eax
+ 3f9:	5b                   	pop    %ebx
+ 3fa:	5e                   	pop    %esi
+ 3fb:	5d                   	pop    %ebp
+ 3fc:	c3                   	ret
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 400:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 405:	eb ed                	jmp    3f4 <stat+0x34>
+ 407:	66 90                	xchg   %ax,%ax
+ 409:	66 90                	xchg   %ax,%ax
+ 40b:	66 90                	xchg   %ax,%ax
+ 40d:	66 90                	xchg   %ax,%ax
+ 40f:	90                   	nop
+
+00000410 <memmove>:
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	56                   	push   %esi
+ 415:	8b 45 10             	mov    0x10(%ebp),%eax
+ 418:	8b 55 08             	mov    0x8(%ebp),%edx
+ 41b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 41e:	85 c0                	test   %eax,%eax
+ 420:	7e 13                	jle    435 <memmove+0x25>
+ 422:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 424:	89 d7                	mov    %edx,%edi
+ 426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 430:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 431:	39 f8                	cmp    %edi,%eax
+ 433:	75 fb                	jne    430 <memmove+0x20>
+}
+ 435:	5e                   	pop    %esi
+ 436:	89 d0                	mov    %edx,%eax
+ 438:	5f                   	pop    %edi
+ 439:	5d                   	pop    %ebp
+ 43a:	c3                   	ret
+
+0000043b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 43b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <exit>:
+SYSCALL(exit)
+ 443:	b8 02 00 00 00       	mov    $0x2,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <wait>:
+SYSCALL(wait)
+ 44b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <pipe>:
+SYSCALL(pipe)
+ 453:	b8 04 00 00 00       	mov    $0x4,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <read>:
+SYSCALL(read)
+ 45b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <write>:
+SYSCALL(write)
+ 463:	b8 10 00 00 00       	mov    $0x10,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <close>:
+SYSCALL(close)
+ 46b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <kill>:
+SYSCALL(kill)
+ 473:	b8 06 00 00 00       	mov    $0x6,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <exec>:
+SYSCALL(exec)
+ 47b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <open>:
+SYSCALL(open)
+ 483:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <mknod>:
+SYSCALL(mknod)
+ 48b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <unlink>:
+SYSCALL(unlink)
+ 493:	b8 12 00 00 00       	mov    $0x12,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <fstat>:
+SYSCALL(fstat)
+ 49b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <link>:
+SYSCALL(link)
+ 4a3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <mkdir>:
+SYSCALL(mkdir)
+ 4ab:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <chdir>:
+SYSCALL(chdir)
+ 4b3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <dup>:
+SYSCALL(dup)
+ 4bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <getpid>:
+SYSCALL(getpid)
+ 4c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <sbrk>:
+SYSCALL(sbrk)
+ 4cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <sleep>:
+SYSCALL(sleep)
+ 4d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <uptime>:
+SYSCALL(uptime)
+ 4db:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <setpriority>:
+SYSCALL(setpriority)
+ 4e3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <settickets>:
+SYSCALL(settickets)
+ 4eb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <getpinfo>:
+SYSCALL(getpinfo)
+ 4f3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <nanosleep>:
+SYSCALL(nanosleep)
+ 4fb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <clone>:
+SYSCALL(clone)
+ 503:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <join>:
+SYSCALL(join)
+ 50b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <futex_wait>:
+SYSCALL(futex_wait)
+ 513:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <futex_wake>:
+SYSCALL(futex_wake)
+ 51b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 523:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 52b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <iostat>:
+SYSCALL(iostat)
+ 533:	b8 20 00 00 00       	mov    $0x20,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+ 53b:	66 90                	xchg   %ax,%ax
+ 53d:	66 90                	xchg   %ax,%ax
+ 53f:	90                   	nop
+
+00000540 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	57                   	push   %edi
+ 544:	56                   	push   %esi
+ 545:	53                   	push   %ebx
+ 546:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 548:	89 d1                	mov    %edx,%ecx
+{
+ 54a:	83 ec 3c             	sub    $0x3c,%esp
+ 54d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 550:	85 d2                	test   %edx,%edx
+ 552:	0f 89 80 00 00 00    	jns    5d8 <printint+0x98>
+ 558:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 55c:	74 7a                	je     5d8 <printint+0x98>
+    x = -xx;
+ 55e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 560:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 565:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 568:	31 f6                	xor    %esi,%esi
+ 56a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 570:	89 c8                	mov    %ecx,%eax
+ 572:	31 d2                	xor    %edx,%edx
+ 574:	89 f7                	mov    %esi,%edi
+ 576:	f7 f3                	div    %ebx
+ 578:	8d 76 01             	lea    0x1(%esi),%esi
+ 57b:	0f b6 92 3c 08 00 00 	movzbl 0x83c(%edx),%edx
+ 582:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 586:	89 ca                	mov    %ecx,%edx
+ 588:	89 c1                	mov    %eax,%ecx
+ 58a:	39 da                	cmp    %ebx,%edx
+ 58c:	73 e2                	jae    570 <printint+0x30>
+  if(neg)
+ 58e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 591:	85 c0                	test   %eax,%eax
+ 593:	74 07                	je     59c <printint+0x5c>
+    buf[i++] = '-';
+ 595:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 59a:	89 f7                	mov    %esi,%edi
+ 59c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 59f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5a2:	01 df                	add    %ebx,%edi
+ 5a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5a8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5ab:	83 ec 04             	sub    $0x4,%esp
+ 5ae:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5b1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5b4:	6a 01                	push   $0x1
+ 5b6:	50                   	push   %eax
+ 5b7:	56                   	push   %esi
+ 5b8:	e8 a6 fe ff ff       	call   463 <write>
+  while(--i >= 0)
+ 5bd:	89 f8                	mov    %edi,%eax
+ 5bf:	83 c4 10             	add    $0x10,%esp
+ 5c2:	83 ef 01             	sub    $0x1,%edi
+ 5c5:	39 d8                	cmp    %ebx,%eax
+ 5c7:	75 df                	jne    5a8 <printint+0x68>
+}
+ 5c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5cc:	5b                   	pop    %ebx
+ 5cd:	5e                   	pop    %esi
+ 5ce:	5f                   	pop    %edi
+ 5cf:	5d                   	pop    %ebp
+ 5d0:	c3                   	ret
+ 5d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5d8:	31 c0                	xor    %eax,%eax
+ 5da:	eb 89                	jmp    565 <printint+0x25>
+ 5dc:	66 90                	xchg   %ax,%ax
+ 5de:	66 90                	xchg   %ax,%ax
+
+000005e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	57                   	push   %edi
+ 5e4:	56                   	push   %esi
+ 5e5:	53                   	push   %ebx
+ 5e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5ef:	0f b6 1e             	movzbl (%esi),%ebx
+ 5f2:	83 c6 01             	add    $0x1,%esi
+ 5f5:	84 db                	test   %bl,%bl
+ 5f7:	74 67                	je     660 <printf+0x80>
+ 5f9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5fc:	31 d2                	xor    %edx,%edx
+ 5fe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 601:	eb 34                	jmp    637 <printf+0x57>
+ 603:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 607:	90                   	nop
+ 608:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 60b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 610:	83 f8 25             	cmp    $0x25,%eax
+ 613:	74 18                	je     62d <printf+0x4d>
+  write(fd, &c, 1);
+ 615:	83 ec 04             	sub    $0x4,%esp
+ 618:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 61b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 61e:	6a 01                	push   $0x1
+ 620:	50                   	push   %eax
+ 621:	57                   	push   %edi
+ 622:	e8 3c fe ff ff       	call   463 <write>
+ 627:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 62a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 62d:	0f b6 1e             	movzbl (%esi),%ebx
+ 630:	83 c6 01             	add    $0x1,%esi
+ 633:	84 db                	test   %bl,%bl
+ 635:	74 29                	je     660 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 637:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 63a:	85 d2                	test   %edx,%edx
+ 63c:	74 ca                	je     608 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 63e:	83 fa 25             	cmp    $0x25,%edx
+ 641:	75 ea                	jne    62d <printf+0x4d>
+      if(c == 'd'){
+ 643:	83 f8 25             	cmp    $0x25,%eax
+ 646:	0f 84 24 01 00 00    	je     770 <printf+0x190>
+ 64c:	83 e8 63             	sub    $0x63,%eax
+ 64f:	83 f8 15             	cmp    $0x15,%eax
+ 652:	77 1c                	ja     670 <printf+0x90>
+ 654:	ff 24 85 e4 07 00 00 	jmp    *0x7e4(,%eax,4)
+ 65b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 65f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 660:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 663:	5b                   	pop    %ebx
+ 664:	5e                   	pop    %esi
+ 665:	5f                   	pop    %edi
+ 666:	5d                   	pop    %ebp
+ 667:	c3                   	ret
+ 668:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66f:	90                   	nop
+  write(fd, &c, 1);
+ 670:	83 ec 04             	sub    $0x4,%esp
+ 673:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 676:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 67a:	6a 01                	push   $0x1
+ 67c:	52                   	push   %edx
+ 67d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 680:	57                   	push   %edi
+ 681:	e8 dd fd ff ff       	call   463 <write>
+ 686:	83 c4 0c             	add    $0xc,%esp
+ 689:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 68c:	6a 01                	push   $0x1
+ 68e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 691:	52                   	push   %edx
+ 692:	57                   	push   %edi
+ 693:	e8 cb fd ff ff       	call   463 <write>
+        putc(fd, c);
+ 698:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 69b:	31 d2                	xor    %edx,%edx
+ 69d:	eb 8e                	jmp    62d <printf+0x4d>
+ 69f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6a3:	83 ec 0c             	sub    $0xc,%esp
+ 6a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6ab:	8b 13                	mov    (%ebx),%edx
+ 6ad:	6a 00                	push   $0x0
+ 6af:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6b1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6b4:	e8 87 fe ff ff       	call   540 <printint>
+        ap++;
+ 6b9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6bf:	31 d2                	xor    %edx,%edx
+ 6c1:	e9 67 ff ff ff       	jmp    62d <printf+0x4d>
+ 6c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6d3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6d5:	83 c0 04             	add    $0x4,%eax
+ 6d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6db:	85 db                	test   %ebx,%ebx
+ 6dd:	0f 84 9d 00 00 00    	je     780 <printf+0x1a0>
+        while(*s != 0){
+ 6e3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6e6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6e8:	84 c0                	test   %al,%al
+ 6ea:	0f 84 3d ff ff ff    	je     62d <printf+0x4d>
+ 6f0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6f3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6f6:	89 de                	mov    %ebx,%esi
+ 6f8:	89 d3                	mov    %edx,%ebx
+ 6fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 700:	83 ec 04             	sub    $0x4,%esp
+ 703:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 706:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 709:	6a 01                	push   $0x1
+ 70b:	53                   	push   %ebx
+ 70c:	57                   	push   %edi
+ 70d:	e8 51 fd ff ff       	call   463 <write>
+        while(*s != 0){
+ 712:	0f b6 06             	movzbl (%esi),%eax
+ 715:	83 c4 10             	add    $0x10,%esp
+ 718:	84 c0                	test   %al,%al
+ 71a:	75 e4                	jne    700 <printf+0x120>
+      state = 0;
+ 71c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 71f:	31 d2                	xor    %edx,%edx
+ 721:	e9 07 ff ff ff       	jmp    62d <printf+0x4d>
+ 726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 730:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 733:	83 ec 0c             	sub    $0xc,%esp
+ 736:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 73b:	8b 13                	mov    (%ebx),%edx
+ 73d:	6a 01                	push   $0x1
+ 73f:	e9 6b ff ff ff       	jmp    6af <printf+0xcf>
+ 744:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 748:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 74b:	83 ec 04             	sub    $0x4,%esp
+ 74e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 751:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 753:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 756:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 759:	6a 01                	push   $0x1
+ 75b:	52                   	push   %edx
+ 75c:	57                   	push   %edi
+ 75d:	e8 01 fd ff ff       	call   463 <write>
+        ap++;
+ 762:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 765:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 768:	31 d2                	xor    %edx,%edx
+ 76a:	e9 be fe ff ff       	jmp    62d <printf+0x4d>
+ 76f:	90                   	nop
+  write(fd, &c, 1);
+ 770:	83 ec 04             	sub    $0x4,%esp
+ 773:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 776:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 779:	6a 01                	push   $0x1
+ 77b:	e9 11 ff ff ff       	jmp    691 <printf+0xb1>
+ 780:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 785:	bb da 07 00 00       	mov    $0x7da,%ebx
+ 78a:	e9 61 ff ff ff       	jmp    6f0 <printf+0x110>
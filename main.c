@@ -18,6 +18,7 @@ extern char end[]; // first address after kernel loaded from ELF file
 int
 main(void)
 {
+  buddyinit();     // buddy allocator
   kinit1(end, P2V(4*1024*1024)); // phys page allocator
   kvmalloc();      // kernel page table
   mpinit();        // detect other processors
@@ -29,11 +30,16 @@ main(void)
   uartinit();      // serial port
   pinit();         // process table
   tvinit();        // trap vectors
-  binit();         // buffer cache
+  timerinit();     // timers
+  futexinit();     // futex queues
+  icacheinit();    // inode cache
   fileinit();      // file table
+  pipeinit();      // pipe cache
+  pcinit();        // executable page cache
   ideinit();       // disk 
   startothers();   // start other processors
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  binit();         // buffer cache, sized to free memory
   userinit();      // first user process
   mpmain();        // finish this processor's setup
 }
@@ -82,7 +88,7 @@ startothers(void)
     // Tell entryother.S what stack to use, where to enter, and what
     // pgdir to use. We cannot use kpgdir yet, because the AP processor
     // is running in low  memory, so we use entrypgdir for the APs too.
-    stack = buddy_alloc(PGSIZE);
+    stack = kalloc();
     *(void**)(code-4) = stack + KSTACKSIZE;
     *(void(**)(void))(code-8) = mpenter;
     *(int**)(code-12) = (void *) V2P(entrypgdir);
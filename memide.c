@@ -12,17 +12,21 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "iostat.h"
 
 extern uchar _binary_fs_img_start[], _binary_fs_img_size[];
 
 static int disksize;
 static uchar *memdisk;
+static struct spinlock memlock;  // protects memstats
+static struct iostat memstats;
 
 void
 ideinit(void)
 {
   memdisk = _binary_fs_img_start;
   disksize = (uint)_binary_fs_img_size/BSIZE;
+  initlock(&memlock, "memide");
 }
 
 // Interrupt handler.
@@ -35,26 +39,61 @@ ideintr(void)
 // Sync buf with disk.
 // If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
 // Else if B_VALID is not set, read buf from disk, set B_VALID.
+// The copy is done at once, so b is finished on return and
+// b->done, if set, has been called.
 void
-iderw(struct buf *b)
+idesubmit(struct buf *b)
 {
+  void (*done)(struct buf*);
   uchar *p;
 
   if(!holdingsleep(&b->lock))
-    panic("iderw: buf not locked");
+    panic("idesubmit: buf not locked");
   if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
-    panic("iderw: nothing to do");
+    panic("idesubmit: nothing to do");
   if(b->dev != 1)
-    panic("iderw: request not for disk 1");
+    panic("idesubmit: request not for disk 1");
   if(b->blockno >= disksize)
-    panic("iderw: block out of range");
+    panic("idesubmit: block out of range");
 
   p = memdisk + b->blockno*BSIZE;
 
+  acquire(&memlock);
+  memstats.ncmd++;
+  if(b->flags & B_DIRTY)
+    memstats.nwrite++;
+  else
+    memstats.nread++;
+  release(&memlock);
   if(b->flags & B_DIRTY){
     b->flags &= ~B_DIRTY;
     memmove(p, b->data, BSIZE);
   } else
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
+  if((done = b->done) != 0){
+    b->done = 0;
+    done(b);
+  }
+}
+
+void
+ideiowait(struct buf *b)
+{
+  // idesubmit() already finished b.
+}
+
+void
+iderw(struct buf *b)
+{
+  b->done = 0;
+  idesubmit(b);
+}
+
+void
+idestat(struct iostat *st)
+{
+  acquire(&memlock);
+  *st = memstats;
+  release(&memlock);
 }
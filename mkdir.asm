@@ -0,0 +1,599 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 01 00 00 00       	mov    $0x1,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1c:	8b 31                	mov    (%ecx),%esi
+  1e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+  21:	83 fe 01             	cmp    $0x1,%esi
+  24:	7f 14                	jg     3a <main+0x3a>
+  26:	eb 3a                	jmp    62 <main+0x62>
+  28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+    printf(2, "Usage: mkdir files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	83 c7 01             	add    $0x1,%edi
+  33:	83 c3 04             	add    $0x4,%ebx
+  36:	39 fe                	cmp    %edi,%esi
+  38:	74 23                	je     5d <main+0x5d>
+    if(mkdir(argv[i]) < 0){
+  3a:	83 ec 0c             	sub    $0xc,%esp
+  3d:	ff 33                	push   (%ebx)
+  3f:	e8 a1 00 00 00       	call   e5 <mkdir>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	79 e5                	jns    30 <main+0x30>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+  4b:	50                   	push   %eax
+  4c:	ff 33                	push   (%ebx)
+  4e:	68 e7 03 00 00       	push   $0x3e7
+  53:	6a 02                	push   $0x2
+  55:	e8 c6 01 00 00       	call   220 <printf>
+      break;
+  5a:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  5d:	e8 1b 00 00 00       	call   7d <exit>
+    printf(2, "Usage: mkdir files...\n");
+  62:	52                   	push   %edx
+  63:	52                   	push   %edx
+  64:	68 d0 03 00 00       	push   $0x3d0
+  69:	6a 02                	push   $0x2
+  6b:	e8 b0 01 00 00       	call   220 <printf>
+    exit();
+  70:	e8 08 00 00 00       	call   7d <exit>
+
+00000075 <fork>:
+  lock_release(&stacklock);
+  if(stack == 0 && (stack = sbrk(TSTACK)) == (char*)-1)
+    return -1;
+  if((pid = clone(threadstart, fn, arg, stack)) < 0){
+    lock_acquire(&stacklock);
+    *(char**)stack = freestacks;
+  75:	b8 01 00 00 00       	mov    $0x1,%eax
+  7a:	cd 40                	int    $0x40
+    freestacks = stack;
+  7c:	c3                   	ret
+
+0000007d <exit>:
+  7d:	b8 02 00 00 00       	mov    $0x2,%eax
+    *(char**)stack = freestacks;
+  82:	cd 40                	int    $0x40
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+  84:	c3                   	ret
+
+00000085 <wait>:
+  85:	b8 03 00 00 00       	mov    $0x3,%eax
+    lock_release(&stacklock);
+  }
+  return pid;
+}
+  8a:	cd 40                	int    $0x40
+  8c:	c3                   	ret
+
+0000008d <pipe>:
+  8d:	b8 04 00 00 00       	mov    $0x4,%eax
+  92:	cd 40                	int    $0x40
+  94:	c3                   	ret
+
+00000095 <read>:
+  95:	b8 05 00 00 00       	mov    $0x5,%eax
+  9a:	cd 40                	int    $0x40
+  9c:	c3                   	ret
+
+0000009d <write>:
+  9d:	b8 10 00 00 00       	mov    $0x10,%eax
+  if(stack == 0 && (stack = sbrk(TSTACK)) == (char*)-1)
+  a2:	cd 40                	int    $0x40
+  a4:	c3                   	ret
+
+000000a5 <close>:
+  a5:	b8 15 00 00 00       	mov    $0x15,%eax
+  aa:	cd 40                	int    $0x40
+  ac:	c3                   	ret
+
+000000ad <kill>:
+  ad:	b8 06 00 00 00       	mov    $0x6,%eax
+  b2:	cd 40                	int    $0x40
+  b4:	c3                   	ret
+
+000000b5 <exec>:
+  b5:	b8 07 00 00 00       	mov    $0x7,%eax
+  ba:	cd 40                	int    $0x40
+    return -1;
+  bc:	c3                   	ret
+
+000000bd <open>:
+  bd:	b8 0f 00 00 00       	mov    $0xf,%eax
+  c2:	cd 40                	int    $0x40
+SYSCALL(read)
+SYSCALL(write)
+SYSCALL(close)
+SYSCALL(kill)
+SYSCALL(exec)
+SYSCALL(open)
+  c4:	c3                   	ret
+
+000000c5 <mknod>:
+SYSCALL(mknod)
+  c5:	b8 11 00 00 00       	mov    $0x11,%eax
+  ca:	cd 40                	int    $0x40
+  cc:	c3                   	ret
+
+000000cd <unlink>:
+SYSCALL(unlink)
+  cd:	b8 12 00 00 00       	mov    $0x12,%eax
+  d2:	cd 40                	int    $0x40
+  d4:	c3                   	ret
+
+000000d5 <fstat>:
+SYSCALL(fstat)
+  d5:	b8 08 00 00 00       	mov    $0x8,%eax
+  da:	cd 40                	int    $0x40
+  dc:	c3                   	ret
+
+000000dd <link>:
+SYSCALL(link)
+  dd:	b8 13 00 00 00       	mov    $0x13,%eax
+  e2:	cd 40                	int    $0x40
+  e4:	c3                   	ret
+
+000000e5 <mkdir>:
+SYSCALL(mkdir)
+  e5:	b8 14 00 00 00       	mov    $0x14,%eax
+  ea:	cd 40                	int    $0x40
+  ec:	c3                   	ret
+
+000000ed <chdir>:
+SYSCALL(chdir)
+  ed:	b8 09 00 00 00       	mov    $0x9,%eax
+  f2:	cd 40                	int    $0x40
+  f4:	c3                   	ret
+
+000000f5 <dup>:
+SYSCALL(dup)
+  f5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  fa:	cd 40                	int    $0x40
+  fc:	c3                   	ret
+
+000000fd <getpid>:
+SYSCALL(getpid)
+  fd:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 102:	cd 40                	int    $0x40
+ 104:	c3                   	ret
+
+00000105 <sbrk>:
+SYSCALL(sbrk)
+ 105:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 10a:	cd 40                	int    $0x40
+ 10c:	c3                   	ret
+
+0000010d <sleep>:
+SYSCALL(sleep)
+ 10d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 112:	cd 40                	int    $0x40
+ 114:	c3                   	ret
+
+00000115 <uptime>:
+SYSCALL(uptime)
+ 115:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 11a:	cd 40                	int    $0x40
+ 11c:	c3                   	ret
+
+0000011d <setpriority>:
+SYSCALL(setpriority)
+ 11d:	b8 16 00 00 00       	mov    $0x16,%eax
+ 122:	cd 40                	int    $0x40
+ 124:	c3                   	ret
+
+00000125 <settickets>:
+SYSCALL(settickets)
+ 125:	b8 17 00 00 00       	mov    $0x17,%eax
+ 12a:	cd 40                	int    $0x40
+ 12c:	c3                   	ret
+
+0000012d <getpinfo>:
+SYSCALL(getpinfo)
+ 12d:	b8 18 00 00 00       	mov    $0x18,%eax
+ 132:	cd 40                	int    $0x40
+ 134:	c3                   	ret
+
+00000135 <nanosleep>:
+SYSCALL(nanosleep)
+ 135:	b8 19 00 00 00       	mov    $0x19,%eax
+ 13a:	cd 40                	int    $0x40
+ 13c:	c3                   	ret
+
+0000013d <clone>:
+SYSCALL(clone)
+ 13d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 142:	cd 40                	int    $0x40
+ 144:	c3                   	ret
+
+00000145 <join>:
+SYSCALL(join)
+ 145:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 14a:	cd 40                	int    $0x40
+ 14c:	c3                   	ret
+
+0000014d <futex_wait>:
+SYSCALL(futex_wait)
+ 14d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 152:	cd 40                	int    $0x40
+ 154:	c3                   	ret
+
+00000155 <futex_wake>:
+SYSCALL(futex_wake)
+ 155:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 15a:	cd 40                	int    $0x40
+ 15c:	c3                   	ret
+
+0000015d <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 15d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 162:	cd 40                	int    $0x40
+ 164:	c3                   	ret
+
+00000165 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 165:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 16a:	cd 40                	int    $0x40
+ 16c:	c3                   	ret
+
+0000016d <iostat>:
+SYSCALL(iostat)
+ 16d:	b8 20 00 00 00       	mov    $0x20,%eax
+ 172:	cd 40                	int    $0x40
+ 174:	c3                   	ret
+ 175:	66 90                	xchg   %ax,%ax
+ 177:	66 90                	xchg   %ax,%ax
+ 179:	66 90                	xchg   %ax,%ax
+ 17b:	66 90                	xchg   %ax,%ax
+ 17d:	66 90                	xchg   %ax,%ax
+ 17f:	90                   	nop
+
+00000180 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	56                   	push   %esi
+ 185:	53                   	push   %ebx
+ 186:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 188:	89 d1                	mov    %edx,%ecx
+{
+ 18a:	83 ec 3c             	sub    $0x3c,%esp
+ 18d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 190:	85 d2                	test   %edx,%edx
+ 192:	0f 89 80 00 00 00    	jns    218 <printint+0x98>
+ 198:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 19c:	74 7a                	je     218 <printint+0x98>
+    x = -xx;
+ 19e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 1a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 1a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 1a8:	31 f6                	xor    %esi,%esi
+ 1aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 1b0:	89 c8                	mov    %ecx,%eax
+ 1b2:	31 d2                	xor    %edx,%edx
+ 1b4:	89 f7                	mov    %esi,%edi
+ 1b6:	f7 f3                	div    %ebx
+ 1b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 1bb:	0f b6 92 64 04 00 00 	movzbl 0x464(%edx),%edx
+ 1c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 1c6:	89 ca                	mov    %ecx,%edx
+ 1c8:	89 c1                	mov    %eax,%ecx
+ 1ca:	39 da                	cmp    %ebx,%edx
+ 1cc:	73 e2                	jae    1b0 <printint+0x30>
+  if(neg)
+ 1ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 1d1:	85 c0                	test   %eax,%eax
+ 1d3:	74 07                	je     1dc <printint+0x5c>
+    buf[i++] = '-';
+ 1d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 1da:	89 f7                	mov    %esi,%edi
+ 1dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 1df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 1e2:	01 df                	add    %ebx,%edi
+ 1e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 1e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 1eb:	83 ec 04             	sub    $0x4,%esp
+ 1ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 1f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 1f4:	6a 01                	push   $0x1
+ 1f6:	50                   	push   %eax
+ 1f7:	56                   	push   %esi
+ 1f8:	e8 a0 fe ff ff       	call   9d <write>
+  while(--i >= 0)
+ 1fd:	89 f8                	mov    %edi,%eax
+ 1ff:	83 c4 10             	add    $0x10,%esp
+ 202:	83 ef 01             	sub    $0x1,%edi
+ 205:	39 d8                	cmp    %ebx,%eax
+ 207:	75 df                	jne    1e8 <printint+0x68>
+}
+ 209:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 20c:	5b                   	pop    %ebx
+ 20d:	5e                   	pop    %esi
+ 20e:	5f                   	pop    %edi
+ 20f:	5d                   	pop    %ebp
+ 210:	c3                   	ret
+ 211:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 218:	31 c0                	xor    %eax,%eax
+ 21a:	eb 89                	jmp    1a5 <printint+0x25>
+ 21c:	66 90                	xchg   %ax,%ax
+ 21e:	66 90                	xchg   %ax,%ax
+
+00000220 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	57                   	push   %edi
+ 224:	56                   	push   %esi
+ 225:	53                   	push   %ebx
+ 226:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 229:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 22c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 22f:	0f b6 1e             	movzbl (%esi),%ebx
+ 232:	83 c6 01             	add    $0x1,%esi
+ 235:	84 db                	test   %bl,%bl
+ 237:	74 67                	je     2a0 <printf+0x80>
+ 239:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 23c:	31 d2                	xor    %edx,%edx
+ 23e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 241:	eb 34                	jmp    277 <printf+0x57>
+ 243:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 247:	90                   	nop
+ 248:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 24b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 250:	83 f8 25             	cmp    $0x25,%eax
+ 253:	74 18                	je     26d <printf+0x4d>
+  write(fd, &c, 1);
+ 255:	83 ec 04             	sub    $0x4,%esp
+ 258:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 25b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 25e:	6a 01                	push   $0x1
+ 260:	50                   	push   %eax
+ 261:	57                   	push   %edi
+ 262:	e8 36 fe ff ff       	call   9d <write>
+ 267:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 26a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 26d:	0f b6 1e             	movzbl (%esi),%ebx
+ 270:	83 c6 01             	add    $0x1,%esi
+ 273:	84 db                	test   %bl,%bl
+ 275:	74 29                	je     2a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 277:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 27a:	85 d2                	test   %edx,%edx
+ 27c:	74 ca                	je     248 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 27e:	83 fa 25             	cmp    $0x25,%edx
+ 281:	75 ea                	jne    26d <printf+0x4d>
+      if(c == 'd'){
+ 283:	83 f8 25             	cmp    $0x25,%eax
+ 286:	0f 84 24 01 00 00    	je     3b0 <printf+0x190>
+ 28c:	83 e8 63             	sub    $0x63,%eax
+ 28f:	83 f8 15             	cmp    $0x15,%eax
+ 292:	77 1c                	ja     2b0 <printf+0x90>
+ 294:	ff 24 85 0c 04 00 00 	jmp    *0x40c(,%eax,4)
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 2a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2a3:	5b                   	pop    %ebx
+ 2a4:	5e                   	pop    %esi
+ 2a5:	5f                   	pop    %edi
+ 2a6:	5d                   	pop    %ebp
+ 2a7:	c3                   	ret
+ 2a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+  write(fd, &c, 1);
+ 2b0:	83 ec 04             	sub    $0x4,%esp
+ 2b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 2b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 2ba:	6a 01                	push   $0x1
+ 2bc:	52                   	push   %edx
+ 2bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 2c0:	57                   	push   %edi
+ 2c1:	e8 d7 fd ff ff       	call   9d <write>
+ 2c6:	83 c4 0c             	add    $0xc,%esp
+ 2c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 2cc:	6a 01                	push   $0x1
+ 2ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 2d1:	52                   	push   %edx
+ 2d2:	57                   	push   %edi
+ 2d3:	e8 c5 fd ff ff       	call   9d <write>
+        putc(fd, c);
+ 2d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 2db:	31 d2                	xor    %edx,%edx
+ 2dd:	eb 8e                	jmp    26d <printf+0x4d>
+ 2df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 2e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 2e3:	83 ec 0c             	sub    $0xc,%esp
+ 2e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 2eb:	8b 13                	mov    (%ebx),%edx
+ 2ed:	6a 00                	push   $0x0
+ 2ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 2f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 2f4:	e8 87 fe ff ff       	call   180 <printint>
+        ap++;
+ 2f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 2fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 2ff:	31 d2                	xor    %edx,%edx
+ 301:	e9 67 ff ff ff       	jmp    26d <printf+0x4d>
+ 306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 310:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 313:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 315:	83 c0 04             	add    $0x4,%eax
+ 318:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 31b:	85 db                	test   %ebx,%ebx
+ 31d:	0f 84 9d 00 00 00    	je     3c0 <printf+0x1a0>
+        while(*s != 0){
+ 323:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 326:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 328:	84 c0                	test   %al,%al
+ 32a:	0f 84 3d ff ff ff    	je     26d <printf+0x4d>
+ 330:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 333:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 336:	89 de                	mov    %ebx,%esi
+ 338:	89 d3                	mov    %edx,%ebx
+ 33a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 340:	83 ec 04             	sub    $0x4,%esp
+ 343:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 346:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 349:	6a 01                	push   $0x1
+ 34b:	53                   	push   %ebx
+ 34c:	57                   	push   %edi
+ 34d:	e8 4b fd ff ff       	call   9d <write>
+        while(*s != 0){
+ 352:	0f b6 06             	movzbl (%esi),%eax
+ 355:	83 c4 10             	add    $0x10,%esp
+ 358:	84 c0                	test   %al,%al
+ 35a:	75 e4                	jne    340 <printf+0x120>
+      state = 0;
+ 35c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 35f:	31 d2                	xor    %edx,%edx
+ 361:	e9 07 ff ff ff       	jmp    26d <printf+0x4d>
+ 366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 370:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 373:	83 ec 0c             	sub    $0xc,%esp
+ 376:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 37b:	8b 13                	mov    (%ebx),%edx
+ 37d:	6a 01                	push   $0x1
+ 37f:	e9 6b ff ff ff       	jmp    2ef <printf+0xcf>
+ 384:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 388:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 38b:	83 ec 04             	sub    $0x4,%esp
+ 38e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 391:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 393:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 396:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 399:	6a 01                	push   $0x1
+ 39b:	52                   	push   %edx
+ 39c:	57                   	push   %edi
+ 39d:	e8 fb fc ff ff       	call   9d <write>
+        ap++;
+ 3a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 3a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 3a8:	31 d2                	xor    %edx,%edx
+ 3aa:	e9 be fe ff ff       	jmp    26d <printf+0x4d>
+ 3af:	90                   	nop
+  write(fd, &c, 1);
+ 3b0:	83 ec 04             	sub    $0x4,%esp
+ 3b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 3b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 3b9:	6a 01                	push   $0x1
+ 3bb:	e9 11 ff ff ff       	jmp    2d1 <printf+0xb1>
+ 3c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 3c5:	bb 03 04 00 00       	mov    $0x403,%ebx
+ 3ca:	e9 61 ff ff ff       	jmp    330 <printf+0x110>
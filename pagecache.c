@@ -0,0 +1,160 @@
+// Page cache for executable file contents.
+//
+// segfault() in vm.c maps pages of program segments straight
+// out of this cache, copy-on-write, so every process running
+// the same binary shares one physical copy of each page it
+// has not written (in practice, its text).
+//
+// Entries are keyed by (dev, inum, offset) and hashed by
+// (dev, inum) so that all pages of one file share a bucket.
+// The cache holds one reference (see kincref) on each page.
+// writei() and itrunc() call pcinval() so the cache never
+// serves stale file contents.
+//
+// Pages of one inode are only added with that inode locked,
+// which is also true of pcinval(), so they cannot race.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+
+#define NPCHASH  64    // hash buckets
+#define NPCPAGE  1024  // max pages held by the cache
+
+struct pcentry {
+  uint dev;
+  uint inum;
+  uint off;              // file offset of page
+  char *page;
+  struct pcentry *next;  // hash chain
+};
+
+struct {
+  struct spinlock lock;
+  struct kmem_cache *cache;
+  struct pcentry *hash[NPCHASH];
+  int npage;
+  uint hits;
+  uint misses;
+} pcache;
+
+#define PCHASH(dev, inum) (((dev) * 31 + (inum)) % NPCHASH)
+
+void
+pcinit(void)
+{
+  initlock(&pcache.lock, "pcache");
+  pcache.cache = kmem_cache_create("pcentry", sizeof(struct pcentry));
+}
+
+// Drop one entry whose page nobody maps any more, to make room.
+// Caller holds pcache.lock.  Returns 0 if every page is in use.
+static int
+pcevict(void)
+{
+  struct pcentry **pp, *e;
+  int h;
+
+  for(h = 0; h < NPCHASH; h++){
+    for(pp = &pcache.hash[h]; (e = *pp) != 0; pp = &e->next){
+      if(krefcnt(e->page) == 1){
+        *pp = e->next;
+        kfree(e->page);
+        kmem_cache_free(pcache.cache, e);
+        pcache.npage--;
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+// Return the page holding bytes [off, off+PGSIZE) of ip, with
+// a reference for the caller, reading it in on a miss.  The
+// whole page must lie within the file.  Caller holds ip->lock.
+// Returns 0 if memory is exhausted or the read fails.
+char*
+pcget(struct inode *ip, uint off)
+{
+  struct pcentry *e;
+  char *page;
+  int h;
+
+  h = PCHASH(ip->dev, ip->inum);
+  acquire(&pcache.lock);
+  for(e = pcache.hash[h]; e; e = e->next){
+    if(e->dev == ip->dev && e->inum == ip->inum && e->off == off){
+      kincref(e->page);
+      pcache.hits++;
+      release(&pcache.lock);
+      return e->page;
+    }
+  }
+  pcache.misses++;
+  release(&pcache.lock);
+
+  if((page = kalloc()) == 0)
+    return 0;
+  if(readi(ip, page, off, PGSIZE) != PGSIZE){
+    kfree(page);
+    return 0;
+  }
+
+  // If the cache is full of pages in use, hand out a
+  // private page instead.
+  acquire(&pcache.lock);
+  if(pcache.npage < NPCPAGE || pcevict()){
+    if((e = kmem_cache_alloc(pcache.cache)) != 0){
+      e->dev = ip->dev;
+      e->inum = ip->inum;
+      e->off = off;
+      e->page = page;
+      e->next = pcache.hash[h];
+      pcache.hash[h] = e;
+      pcache.npage++;
+      kincref(page);
+    }
+  }
+  release(&pcache.lock);
+  return page;
+}
+
+// Forget all cached pages of ip, whose contents are changing.
+// Processes already mapping them keep their copies.
+// Caller holds ip->lock.
+void
+pcinval(struct inode *ip)
+{
+  struct pcentry **pp, *e;
+  int h;
+
+  h = PCHASH(ip->dev, ip->inum);
+  if(pcache.hash[h] == 0)  // common case: nothing cached nearby
+    return;
+
+  acquire(&pcache.lock);
+  pp = &pcache.hash[h];
+  while((e = *pp) != 0){
+    if(e->dev == ip->dev && e->inum == ip->inum){
+      *pp = e->next;
+      kfree(e->page);
+      kmem_cache_free(pcache.cache, e);
+      pcache.npage--;
+    } else
+      pp = &e->next;
+  }
+  release(&pcache.lock);
+}
+
+// Print cache statistics.  For procdump(); takes no lock.
+void
+pcdump(void)
+{
+  cprintf("page cache: %d pages, %d hits, %d misses\n",
+          pcache.npage, pcache.hits, pcache.misses);
+}
@@ -0,0 +1,59 @@
+// PCI configuration space, through configuration mechanism #1:
+// write the address of a register to CONFIG_ADDRESS, then read
+// or write it at CONFIG_DATA.  Only bus 0 is scanned, which is
+// where QEMU's PC puts its devices.
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+
+#define CONFIG_ADDRESS 0xCF8
+#define CONFIG_DATA    0xCFC
+
+#define PCI_ID         0x00  // Register: device and vendor ID
+#define PCI_CLASS      0x08  // Register: class, subclass, prog IF, revision
+#define PCI_HEADER     0x0C  // Register: header type in bits 16-23
+
+// A device's function is named by a tag: bus, device and function
+// as they go in CONFIG_ADDRESS.
+#define PCITAG(bus, dev, func) ((bus) << 16 | (dev) << 11 | (func) << 8)
+
+uint
+pciread(uint tag, int reg)
+{
+  outl(CONFIG_ADDRESS, 0x80000000 | tag | (reg & 0xFC));
+  return inl(CONFIG_DATA);
+}
+
+void
+pciwrite(uint tag, int reg, uint val)
+{
+  outl(CONFIG_ADDRESS, 0x80000000 | tag | (reg & 0xFC));
+  outl(CONFIG_DATA, val);
+}
+
+// Find the first function on bus 0 of the given class and
+// subclass and store its tag in *tag.  Returns -1 if none.
+int
+pcifind(int class, int subclass, uint *tag)
+{
+  int dev, func, nfunc;
+  uint t, c;
+
+  for(dev = 0; dev < 32; dev++){
+    nfunc = 1;
+    for(func = 0; func < nfunc; func++){
+      t = PCITAG(0, dev, func);
+      if((pciread(t, PCI_ID) & 0xFFFF) == 0xFFFF)
+        continue;
+      if(func == 0 && (pciread(t, PCI_HEADER) & 0x800000))
+        nfunc = 8;  // multi-function device
+      c = pciread(t, PCI_CLASS);
+      if((c >> 24) == class && ((c >> 16) & 0xFF) == subclass){
+        *tag = t;
+        return 0;
+      }
+    }
+  }
+  return -1;
+}
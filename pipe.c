@@ -7,7 +7,6 @@
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
-#include "buddy.h"
 
 #define PIPESIZE 512
 
@@ -20,6 +19,14 @@ struct pipe {
   int writeopen;  // write fd is still open
 };
 
+static struct kmem_cache *pipecache;
+
+void
+pipeinit(void)
+{
+  pipecache = kmem_cache_create("pipe", sizeof(struct pipe));
+}
+
 int
 pipealloc(struct file **f0, struct file **f1)
 {
@@ -29,7 +36,7 @@ pipealloc(struct file **f0, struct file **f1)
   *f0 = *f1 = 0;
   if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
     goto bad;
-  if((p = (struct pipe*)buddy_alloc(PGSIZE)) == 0)
+  if((p = (struct pipe*)kmem_cache_alloc(pipecache)) == 0)
     goto bad;
   p->readopen = 1;
   p->writeopen = 1;
@@ -49,7 +56,7 @@ pipealloc(struct file **f0, struct file **f1)
 //PAGEBREAK: 20
  bad:
   if(p)
-    kfree((char*)p);
+    kmem_cache_free(pipecache, p);
   if(*f0)
     fileclose(*f0);
   if(*f1)
@@ -70,39 +77,52 @@ pipeclose(struct pipe *p, int writable)
   }
   if(p->readopen == 0 && p->writeopen == 0){
     release(&p->lock);
-    kfree((char*)p);
+    kmem_cache_free(pipecache, p);
   } else
     release(&p->lock);
 }
 
 //PAGEBREAK: 40
+// User memory is copied through buf on the kernel stack: the
+// kernel must not touch it, and maybe fault, holding p->lock.
+// buf holds as much as the pipe, so a read gets everything there
+// is, and a write of up to PIPESIZE bytes only lets others in
+// while the pipe is full, as it would writing straight from addr.
 int
 pipewrite(struct pipe *p, char *addr, int n)
 {
-  int i;
+  char buf[PIPESIZE];
+  int i, j, m;
 
-  acquire(&p->lock);
-  for(i = 0; i < n; i++){
-    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
-      if(p->readopen == 0 || myproc()->killed){
-        release(&p->lock);
-        return -1;
+  for(i = 0; i < n; i += m){
+    m = n - i < PIPESIZE ? n - i : PIPESIZE;
+    memmove(buf, addr + i, m);
+    acquire(&p->lock);
+    for(j = 0; j < m; j++){
+      while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+        if(p->readopen == 0 || myproc()->killed){
+          release(&p->lock);
+          return -1;
+        }
+        wakeup(&p->nread);
+        sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
       }
-      wakeup(&p->nread);
-      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+      p->data[p->nwrite++ % PIPESIZE] = buf[j];
     }
-    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+    wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+    release(&p->lock);
   }
-  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
-  release(&p->lock);
   return n;
 }
 
 int
 piperead(struct pipe *p, char *addr, int n)
 {
+  char buf[PIPESIZE];
   int i;
 
+  if(n > PIPESIZE)
+    n = PIPESIZE;  // all the pipe can hold
   acquire(&p->lock);
   while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
     if(myproc()->killed){
@@ -114,9 +134,10 @@ piperead(struct pipe *p, char *addr, int n)
   for(i = 0; i < n; i++){  //DOC: piperead-copy
     if(p->nread == p->nwrite)
       break;
-    addr[i] = p->data[p->nread++ % PIPESIZE];
+    buf[i] = p->data[p->nread++ % PIPESIZE];
   }
   wakeup(&p->nwrite);  //DOC: piperead-wakeup
   release(&p->lock);
+  memmove(addr, buf, i);
   return i;
 }
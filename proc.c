@@ -6,25 +6,402 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
-#include "buddy.h"
+#include "sleeplock.h"
+#include "pstat.h"
+#include "traps.h"
 
 struct {
   struct spinlock lock;
   struct proc proc[NPROC];
 } ptable;
 
+// Per-CPU run queues of RUNNABLE processes.
+// A process is on the queue of p->cpu, and only that CPU runs it;
+// an idle CPU may steal() a waiting process and make it its own.
+//
+// Each queue is a multilevel feedback queue: NPRIO first-in
+// first-out lists, and the scheduler always runs the first
+// process of the highest non-empty level (level 0 is highest).
+// A process starts at the top and drops a level each time it
+// uses up the quantum of its current level, so processes that
+// mostly sleep, like sh, stay above CPU hogs.  Every BOOSTTICKS
+// the timer calls prioboost() to move everyone back to the top,
+// so that hogs are not starved.  setpriority() caps how high a
+// process may go.
+//
+// Within a level, processes run in order of their stride
+// scheduling pass: each run tick advances p->pass by
+// STRIDE1/p->tickets, so over time processes at the same level
+// get CPU in proportion to their tickets (see settickets()).
+//
+// The queue's lock takes the place of ptable.lock in the xv6
+// switching protocol: a process calls sched() holding only its
+// CPU's run queue lock, and the scheduler keeps holding it until
+// it has switched to the next process, which releases it.
+// ptable.lock still guards exit/wait and kill.  Locks are
+// acquired in the order ptable.lock, wait queue, run queue.
+// p->prio and p->used only change under p's run queue lock or
+// while p is running.
+struct runq {
+  struct spinlock lock;
+  struct proc *head[NPRIO];
+  struct proc *tail[NPRIO];
+  int n;                       // Processes on the queue
+  uint vpass;                  // Pass of the process run last
+  uint boostgen;               // Value of boostgen at last boost
+  uint nsteal;                 // Processes stolen from other CPUs
+} runq[NCPU];
+
+// Timer ticks a process may run at each level before it drops
+// to the next one.
+static int quantum[NPRIO] = { 1, 2, 4, 8 };
+
+// One tick's worth of pass for a process with one ticket.
+#define STRIDE1 (1 << 20)
+
+// Bumped by prioboost(); processes and queues that have not
+// seen the latest value are boosted the next time the
+// scheduler looks at them.
+static uint boostgen;
+
+// Sleeping processes, hashed by wait channel, so that wakeup()
+// only looks at processes sleeping on channels that hash alike.
+// A queue's lock guards its list and the p->chan and SLEEPING
+// state of the processes on it.
+#define NWAITQ 64
+
+struct waitq {
+  struct spinlock lock;
+  struct proc *head;           // Linked through p->wnext
+} waitq[NWAITQ];
+
+#define WAITQ(chan) (&waitq[((uint)(chan) >> 3) % NWAITQ])
+
+// An address space: the user part of a page table, which all
+// the threads of a process share (see clone).  Its lock
+// serializes changes to the page table: page faults, growproc()
+// and fork().  The page table goes when the last thread using
+// it has been waited for.
+struct uvm {
+  struct sleeplock lock;
+  int ref;                     // Threads using it
+};
+
+static struct kmem_cache *uvmcache;
+
 static struct proc *initproc;
 
 int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
 
 void
 pinit(void)
 {
+  int i;
+
   initlock(&ptable.lock, "ptable");
+  for(i = 0; i < NCPU; i++)
+    initlock(&runq[i].lock, "runq");
+  for(i = 0; i < NWAITQ; i++)
+    initlock(&waitq[i].lock, "waitq");
+  uvmcache = kmem_cache_create("uvm", sizeof(struct uvm));
+}
+
+// Make a new address space, used by one thread.
+struct uvm*
+uvmalloc(void)
+{
+  struct uvm *u;
+
+  if((u = kmem_cache_alloc(uvmcache)) == 0)
+    return 0;
+  initsleeplock(&u->lock, "uvm");
+  u->ref = 1;
+  return u;
+}
+
+// Drop a thread's use of address space u, whose page table
+// is pgdir, freeing both after the last.
+void
+uvmput(struct uvm *u, pde_t *pgdir)
+{
+  if(__sync_sub_and_fetch(&u->ref, 1) > 0)
+    return;
+  freevm(pgdir);
+  kmem_cache_free(uvmcache, u);
+}
+
+// Lock p's page table against changes by its other threads.
+void
+uvmlock(struct proc *p)
+{
+  acquiresleep(&p->uvm->lock);
+}
+
+void
+uvmunlock(struct proc *p)
+{
+  releasesleep(&p->uvm->lock);
+}
+
+// Run queue of this CPU.  Must be called with interrupts disabled.
+static struct runq*
+thisrunq(void)
+{
+  return &runq[cpuid()];
+}
+
+// Insert p into rq at its level, in pass order, first applying
+// any boost it has missed.  A process coming back from sleep or
+// from another CPU starts no earlier than the process that ran
+// last here, so it cannot bank CPU time while away.
+// Caller holds rq->lock.
+static void
+runqput(struct runq *rq, struct proc *p)
+{
+  struct proc **pp;
+  int l;
+
+  if(p->boostgen != boostgen){
+    p->boostgen = boostgen;
+    p->prio = 0;
+    p->used = 0;
+  }
+  if(p->prio < p->nice)
+    p->prio = p->nice;
+  if((int)(p->pass - rq->vpass) < 0)
+    p->pass = rq->vpass;
+  l = p->prio;
+  for(pp = &rq->head[l]; *pp && (int)((*pp)->pass - p->pass) <= 0;
+      pp = &(*pp)->rqnext)
+    ;
+  p->rqnext = *pp;
+  *pp = p;
+  if(p->rqnext == 0)
+    rq->tail[l] = p;
+  rq->n++;
+}
+
+// Unlink p, which is on rq.  Caller holds rq->lock.
+static void
+runqdel(struct runq *rq, struct proc *p)
+{
+  struct proc **pp, *prev;
+  int l;
+
+  l = p->prio;
+  prev = 0;
+  for(pp = &rq->head[l]; *pp != p; pp = &(*pp)->rqnext)
+    prev = *pp;
+  *pp = p->rqnext;
+  if(rq->tail[l] == p)
+    rq->tail[l] = prev;
+  p->rqnext = 0;
+  rq->n--;
+}
+
+// Move every process on rq back to the top level.
+// Caller holds rq->lock.
+static void
+runqboost(struct runq *rq)
+{
+  struct proc *p, *list[NPROC];
+  int i, l, n;
+
+  n = 0;
+  for(l = 0; l < NPRIO; l++)
+    while((p = rq->head[l]) != 0){
+      runqdel(rq, p);
+      list[n++] = p;
+    }
+  rq->boostgen = boostgen;
+  for(i = 0; i < n; i++)
+    runqput(rq, list[i]);
+}
+
+// Remove and return the first process at the highest
+// non-empty level of rq, or 0 if it is empty.
+// Caller holds rq->lock.
+static struct proc*
+runqget(struct runq *rq)
+{
+  struct proc *p;
+  int l;
+
+  if(rq->boostgen != boostgen)
+    runqboost(rq);
+  for(l = 0; l < NPRIO; l++){
+    if((p = rq->head[l]) != 0){
+      runqdel(rq, p);
+      rq->vpass = p->pass;
+      return p;
+    }
+  }
+  return 0;
+}
+
+// Interrupt CPU i if it is halted in idle().
+void
+kickcpu(int i)
+{
+  if(cpus[i].idle)
+    lapicsend(cpus[i].apicid, T_IRQ0 + IRQ_WAKE);
+}
+
+// Make p RUNNABLE on the run queue of p->cpu, and wake that
+// CPU if it is idle, or else some idle CPU to steal() work
+// if p has to wait behind others.
+// Caller holds the lock of p's wait queue, or ptable.lock
+// if p is new.
+static void
+setrunnable(struct proc *p)
+{
+  struct runq *rq = &runq[p->cpu];
+  int i, n;
+
+  acquire(&rq->lock);
+  p->state = RUNNABLE;
+  runqput(rq, p);
+  n = rq->n;
+  release(&rq->lock);
+
+  __sync_synchronize();  // the put before reading idle; see idle()
+  if(cpus[p->cpu].idle)
+    kickcpu(p->cpu);
+  else if(n > 1){
+    for(i = 0; i < ncpu; i++)
+      if(cpus[i].idle){
+        kickcpu(i);
+        break;
+      }
+  }
+}
+
+// A process that ran less than HOTTICKS ago probably still has
+// its working set in its CPU's cache and is left where it is.
+#define HOTTICKS 2
+
+// Take a process from the busiest other CPU's run queue and put
+// it on ours, preferring the first one, by priority, whose cache
+// state has gone cold.  If every waiting process is hot but more
+// than one is waiting, take the last, which would wait longest
+// where it is.  Processes whose affinity excludes us stay put.
+// Called with no locks held.  Returns 0 if there was nothing
+// worth stealing.
+static int
+steal(void)
+{
+  struct runq *rq, *from;
+  struct proc *p, *victim;
+  int i, l, me;
+
+  pushcli();
+  me = cpuid();
+  popcli();
+
+  from = 0;
+  for(i = 0; i < ncpu; i++)
+    if(i != me && runq[i].n > 0 && (from == 0 || runq[i].n > from->n))
+      from = &runq[i];
+  if(from == 0)
+    return 0;
+
+  acquire(&from->lock);
+  victim = 0;
+  for(l = 0; l < NPRIO && victim == 0; l++)
+    for(p = from->head[l]; p; p = p->rqnext)
+      if(ticks - p->lastrun >= HOTTICKS && (p->affinity & (1 << me))){
+        victim = p;
+        break;
+      }
+  if(victim == 0 && from->n >= 2)
+    for(l = NPRIO-1; l >= 0 && victim == 0; l--)
+      for(p = from->head[l]; p; p = p->rqnext)
+        if(p->affinity & (1 << me))
+          victim = p;
+  if(victim == 0){
+    release(&from->lock);
+    return 0;
+  }
+  runqdel(from, victim);
+  release(&from->lock);
+
+  // victim is on no queue for a moment, which is fine: nothing
+  // but a scheduler touches a RUNNABLE process.
+  rq = &runq[me];
+  acquire(&rq->lock);
+  victim->cpu = me;
+  runqput(rq, victim);
+  rq->nsteal++;
+  release(&rq->lock);
+  return 1;
+}
+
+// Nothing to run on this CPU: halt until an interrupt.
+// An idle CPU stops its timer too, except that CPU 0 keeps the
+// clock: it only stops ticking when every other CPU is idle as
+// well, and then sets its timer for the next timer on the wheel.
+// A CPU with high resolution timers pending keeps ticking (see
+// timeridle()).  A CPU leaving idle kicks CPU 0 to resume ticking.
+static void
+idle(void)
+{
+  struct cpu *c;
+  int i, me;
+  uint n;
+
+  cli();
+  c = mycpu();
+  me = c - cpus;
+
+  // Announce that we are idle before the last look at the
+  // queue; setrunnable() looks at idle after its put, so one
+  // of us sees the other.  xchg is a full barrier.
+  xchg(&c->idle, 1);
+  if(runq[me].n > 0){
+    xchg(&c->idle, 0);
+    sti();
+    return;
+  }
+
+  n = 0;
+  if(me == 0){
+    for(i = 1; i < ncpu; i++)
+      if(!cpus[i].idle)
+        break;
+    if(i == ncpu)
+      n = clockidle();
+  }
+  timeridle(n);
+
+  stihlt();
+  cli();
+
+  n = timerwake();
+  if(me == 0)
+    clockskip(n);
+  xchg(&c->idle, 0);
+  if(me != 0)
+    kickcpu(0);
+  sti();
+}
+
+// Pick a CPU for a new process, or one that has to move: the
+// one with the shortest run queue among those in mask.  The
+// lengths are read without locks; an occasional stale value
+// only costs some balance.
+static int
+pickcpu(uint mask)
+{
+  int i, best;
+
+  best = -1;
+  for(i = 0; i < ncpu; i++)
+    if((mask & (1 << i)) && (best < 0 || runq[i].n < runq[best].n))
+      best = i;
+  return best < 0 ? 0 : best;
 }
 
 // Must be called with interrupts disabled
@@ -89,11 +466,21 @@ allocproc(void)
 found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->nice = 0;
+  p->prio = 0;
+  p->used = 0;
+  p->boostgen = boostgen;
+  p->tickets = DEFTICKETS;
+  p->pass = 0;
+  p->ticks = 0;
+  p->affinity = ~0;
+  p->lastcpu = -1;
+  p->nmigrate = 0;
 
   release(&ptable.lock);
 
   // Allocate kernel stack.
-  if((p->kstack = buddy_alloc(PGSIZE)) == 0){
+  if((p->kstack = kalloc()) == 0){
     p->state = UNUSED;
     return 0;
   }
@@ -127,7 +514,7 @@ userinit(void)
   p = allocproc();
   
   initproc = p;
-  if((p->pgdir = setupkvm()) == 0)
+  if((p->pgdir = setupkvm()) == 0 || (p->uvm = uvmalloc()) == 0)
     panic("userinit: out of memory?");
   inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
   p->sz = PGSIZE;
@@ -143,36 +530,52 @@ userinit(void)
   safestrcpy(p->name, "initcode", sizeof(p->name));
   p->cwd = namei("/");
 
-  // this assignment to p->state lets other cores
+  // putting p on a run queue lets other cores
   // run this process. the acquire forces the above
-  // writes to be visible, and the lock is also needed
-  // because the assignment might not be atomic.
+  // writes to be visible.
   acquire(&ptable.lock);
 
-  p->state = RUNNABLE;
+  p->cpu = pickcpu(p->affinity);
+  setrunnable(p);
 
   release(&ptable.lock);
 }
 
 // Grow current process's memory by n bytes.
-// Return 0 on success, -1 on failure.
+// Growing only moves sz; lazyfault() maps zeroed pages
+// on first touch.  Every thread sharing the page table
+// gets the new size.  Shrinking frees the pages only after
+// deallocuvm() has flushed them from every TLB; a thread still
+// using them in a system call is killed (see trap).
+// Return the old size, or -1 on failure.
 int
 growproc(int n)
 {
-  uint sz;
+  uint sz, oldsz;
+  struct proc *p;
   struct proc *curproc = myproc();
 
-  sz = curproc->sz;
+  uvmlock(curproc);
+  sz = oldsz = curproc->sz;
   if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    if(sz + n < sz || sz + n >= KERNBASE){
+      uvmunlock(curproc);
       return -1;
+    }
+    sz += n;
   } else if(n < 0){
-    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0){
+      uvmunlock(curproc);
       return -1;
+    }
   }
-  curproc->sz = sz;
-  switchuvm(curproc);
-  return 0;
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if(p->uvm == curproc->uvm)
+      p->sz = sz;
+  release(&ptable.lock);
+  uvmunlock(curproc);
+  return oldsz;
 }
 
 // Create a new process copying p as the parent.
@@ -191,7 +594,18 @@ fork(void)
   }
 
   // Copy process state from proc.
-  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+  if((np->uvm = uvmalloc()) == 0){
+    kfree(np->kstack);
+    np->kstack = 0;
+    np->state = UNUSED;
+    return -1;
+  }
+  uvmlock(curproc);
+  np->pgdir = copyuvm(curproc->pgdir, curproc->sz);
+  uvmunlock(curproc);
+  if(np->pgdir == 0){
+    kmem_cache_free(uvmcache, np->uvm);
+    np->uvm = 0;
     kfree(np->kstack);
     np->kstack = 0;
     np->state = UNUSED;
@@ -208,14 +622,93 @@ fork(void)
     if(curproc->ofile[i])
       np->ofile[i] = filedup(curproc->ofile[i]);
   np->cwd = idup(curproc->cwd);
+  dupsegs(np->seg, curproc->seg);
+
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+  np->nice = curproc->nice;
+  np->tickets = curproc->tickets;
+  np->pass = curproc->pass;
+  np->affinity = curproc->affinity;
+
+  pid = np->pid;
+
+  acquire(&ptable.lock);
+
+  np->cpu = pickcpu(np->affinity);
+  setrunnable(np);
+
+  release(&ptable.lock);
+
+  return pid;
+}
+
+// Create a thread: a new process sharing the current one's
+// page table, which starts running fn(arg1, arg2) on the
+// one-page user stack at ustack.  Open files and the current
+// directory are shared as after fork.  fn must not return;
+// the thread ends by calling exit().
+// Returns the new thread's pid, or -1 on error.
+int
+clone(uint fn, uint arg1, uint arg2, uint ustack)
+{
+  int i, pid;
+  uint sp, args[3];
+  struct proc *np;
+  struct proc *curproc = myproc();
+
+  if(ustack % 4 || ustack + PGSIZE < ustack || ustack + PGSIZE > curproc->sz)
+    return -1;
+
+  // Push the arguments and a fake return PC.
+  sp = ustack + PGSIZE - sizeof(args);
+  args[0] = 0xffffffff;
+  args[1] = arg1;
+  args[2] = arg2;
+  if(prefault(curproc, sp, sizeof(args), 1) < 0)
+    return -1;
+
+  if((np = allocproc()) == 0)
+    return -1;
+
+  // Under the lock, so growproc() cannot miss np, and
+  // copyout() may break copy-on-write for a sibling's fork.
+  uvmlock(curproc);
+  if(copyout(curproc->pgdir, sp, args, sizeof(args)) < 0){
+    uvmunlock(curproc);
+    kfree(np->kstack);
+    np->kstack = 0;
+    np->state = UNUSED;
+    return -1;
+  }
+  np->pgdir = curproc->pgdir;
+  np->uvm = curproc->uvm;
+  __sync_add_and_fetch(&np->uvm->ref, 1);
+  np->sz = curproc->sz;
+  uvmunlock(curproc);
+  np->parent = curproc;
+  np->ustack = ustack;
+  *np->tf = *curproc->tf;
+  np->tf->eip = fn;
+  np->tf->esp = sp;
+
+  for(i = 0; i < NOFILE; i++)
+    if(curproc->ofile[i])
+      np->ofile[i] = filedup(curproc->ofile[i]);
+  np->cwd = idup(curproc->cwd);
+  dupsegs(np->seg, curproc->seg);
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+  np->nice = curproc->nice;
+  np->tickets = curproc->tickets;
+  np->pass = curproc->pass;
+  np->affinity = curproc->affinity;
 
   pid = np->pid;
 
   acquire(&ptable.lock);
 
-  np->state = RUNNABLE;
+  np->cpu = pickcpu(np->affinity);
+  setrunnable(np);
 
   release(&ptable.lock);
 
@@ -245,33 +738,66 @@ exit(void)
 
   begin_op();
   iput(curproc->cwd);
+  freesegs(curproc->seg);
   end_op();
   curproc->cwd = 0;
 
   acquire(&ptable.lock);
 
   // Parent might be sleeping in wait().
-  wakeup1(curproc->parent);
+  wakeup(curproc->parent);
 
   // Pass abandoned children to init.
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->parent == curproc){
       p->parent = initproc;
       if(p->state == ZOMBIE)
-        wakeup1(initproc);
+        wakeup(initproc);
     }
   }
 
   // Jump into the scheduler, never to return.
+  // wait() can see the zombie as soon as ptable.lock is
+  // released, but will not free it until this CPU's run
+  // queue lock shows that it is off its stack.
   curproc->state = ZOMBIE;
+  acquire(&thisrunq()->lock);
+  release(&ptable.lock);
   sched();
   panic("zombie exit");
 }
 
-// Wait for a child process to exit and return its pid.
-// Return -1 if this process has no children.
-int
-wait(void)
+// Free zombie p, a child of the caller, which holds ptable.lock.
+// Returns p's pid.
+static int
+freeproc(struct proc *p)
+{
+  int pid;
+
+  // Wait for it to get off its stack and out of its page
+  // table.  See exit().
+  acquire(&runq[p->cpu].lock);
+  release(&runq[p->cpu].lock);
+  pid = p->pid;
+  kfree(p->kstack);
+  p->kstack = 0;
+  uvmput(p->uvm, p->pgdir);
+  p->uvm = 0;
+  p->pgdir = 0;
+  p->pid = 0;
+  p->parent = 0;
+  p->name[0] = 0;
+  p->killed = 0;
+  p->state = UNUSED;
+  return pid;
+}
+
+// Wait for a child process, or if thread is set, for a child
+// thread sharing the caller's address space, to exit.
+// Return its pid, and set *ustack to a thread's user stack.
+// Return -1 if there is no such child.
+static int
+waitchild(int thread, uint *ustack)
 {
   struct proc *p;
   int havekids, pid;
@@ -282,20 +808,14 @@ wait(void)
     // Scan through table looking for exited children.
     havekids = 0;
     for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != curproc)
+      if(p->parent != curproc || (p->uvm == curproc->uvm) != thread)
         continue;
       havekids = 1;
       if(p->state == ZOMBIE){
         // Found one.
-        pid = p->pid;
-        kfree(p->kstack);
-        p->kstack = 0;
-        freevm(p->pgdir);
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        p->state = UNUSED;
+        if(ustack)
+          *ustack = p->ustack;
+        pid = freeproc(p);
         release(&ptable.lock);
         return pid;
       }
@@ -307,11 +827,29 @@ wait(void)
       return -1;
     }
 
-    // Wait for children to exit.  (See wakeup1 call in proc_exit.)
+    // Wait for children to exit.  (See wakeup call in proc_exit.)
     sleep(curproc, &ptable.lock);  //DOC: wait-sleep
   }
 }
 
+// Wait for a child process to exit and return its pid.
+// Return -1 if this process has no children.
+// Threads created by clone() are waited for with join().
+int
+wait(void)
+{
+  return waitchild(0, 0);
+}
+
+// Wait for a thread created by clone() to exit and return
+// its pid, setting *ustack to the stack it was given.
+// Return -1 if this process has no child threads.
+int
+join(uint *ustack)
+{
+  return waitchild(1, ustack);
+}
+
 //PAGEBREAK: 42
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
@@ -323,41 +861,76 @@ wait(void)
 void
 scheduler(void)
 {
-  struct proc *p;
+  struct proc *p, *last;
   struct cpu *c = mycpu();
+  struct runq *rq = thisrunq();
+  int me = c - cpus;
   c->proc = 0;
+  last = 0;
   
   for(;;){
     // Enable interrupts on this processor.
     sti();
 
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
+    // Run processes off this CPU's queue until it is empty.
+    // rq->lock is held throughout, except while a process
+    // runs, so a process that is still last here cannot have
+    // run elsewhere, or been freed, since it left the CPU.
+    acquire(&rq->lock);
+    while((p = runqget(rq)) != 0){
+      // If p may no longer run here (see setaffinity), send
+      // it to a CPU where it may.  Drop our page table first:
+      // p may run, and be freed, before we choose again.
+      if(!(p->affinity & (1 << me))){
+        if(last){
+          switchkvm();
+          last = 0;
+        }
+        release(&rq->lock);
+        p->cpu = pickcpu(p->affinity);
+        setrunnable(p);
+        acquire(&rq->lock);
         continue;
+      }
+      if(p->lastcpu != me){
+        if(p->lastcpu >= 0)
+          p->nmigrate++;
+        p->lastcpu = me;
+      }
 
       // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
-      // before jumping back to us.
+      // to release rq->lock and then reacquire it
+      // before jumping back to us.  If p was the last
+      // process to run here, its TSS and page table are
+      // still loaded and its TLB entries still good.
       c->proc = p;
-      switchuvm(p);
+      if(p != last)
+        switchuvm(p);
       p->state = RUNNING;
 
       swtch(&(c->scheduler), p->context);
-      switchkvm();
 
       // Process is done running for now.
       // It should have changed its p->state before coming back.
       c->proc = 0;
+      p->lastrun = ticks;
+      last = p;
     }
-    release(&ptable.lock);
+    if(last){
+      switchkvm();
+      last = 0;
+    }
+    release(&rq->lock);
 
+    // Nothing to run here: help out a busier CPU, or get
+    // some pages ready for kalloc_zeroed(), or halt.
+    if(!steal() && !kzeroidle())
+      idle();
   }
 }
 
-// Enter scheduler.  Must hold only ptable.lock
-// and have changed proc->state. Saves and restores
+// Enter scheduler.  Must hold only this CPU's run queue
+// lock and have changed proc->state. Saves and restores
 // intena because intena is a property of this
 // kernel thread, not this CPU. It should
 // be proc->intena and proc->ncli, but that would
@@ -369,8 +942,8 @@ sched(void)
   int intena;
   struct proc *p = myproc();
 
-  if(!holding(&ptable.lock))
-    panic("sched ptable.lock");
+  if(!holding(&thisrunq()->lock))
+    panic("sched runq lock");
   if(mycpu()->ncli != 1)
     panic("sched locks");
   if(p->state == RUNNING)
@@ -386,10 +959,147 @@ sched(void)
 void
 yield(void)
 {
-  acquire(&ptable.lock);  //DOC: yieldlock
-  myproc()->state = RUNNABLE;
+  struct runq *rq;
+  struct proc *p = myproc();
+
+  pushcli();
+  rq = thisrunq();
+  acquire(&rq->lock);  //DOC: yieldlock
+  popcli();
+  if(p->used >= quantum[p->prio]){
+    if(p->prio < NPRIO-1)
+      p->prio++;
+    p->used = 0;
+  }
+  p->state = RUNNABLE;
+  runqput(rq, p);
   sched();
+  release(&thisrunq()->lock);
+}
+
+// Charge a timer tick to the running process.  Returns 1 if it
+// should yield: it has used up its quantum at this level, or a
+// process at a higher level is waiting on this CPU.
+// Called from trap() with interrupts disabled.
+int
+quantumtick(void)
+{
+  struct proc *p = myproc();
+  struct runq *rq = thisrunq();
+  int l;
+
+  p->ticks++;
+  p->pass += STRIDE1 / p->tickets;
+  if(++p->used >= quantum[p->prio])
+    return 1;
+  for(l = 0; l < p->prio; l++)
+    if(rq->head[l])
+      return 1;
+  return 0;
+}
+
+// Move every process back to the top level soon.  Called from
+// trap() every BOOSTTICKS timer ticks.
+void
+prioboost(void)
+{
+  boostgen++;
+}
+
+// Give the current process n tickets, for a CPU share in
+// proportion to n among processes at its level.
+int
+settickets(int n)
+{
+  if(n < 1 || n > STRIDE1)
+    return -1;
+  myproc()->tickets = n;
+  return 0;
+}
+
+// Fill in *ps with the scheduling state of every process.
+void
+getpinfo(struct pstat *ps)
+{
+  struct proc *p;
+  int i;
+
+  acquire(&ptable.lock);
+  for(i = 0; i < NPROC; i++){
+    p = &ptable.proc[i];
+    ps->inuse[i] = p->state != UNUSED;
+    ps->pid[i] = p->pid;
+    ps->tickets[i] = p->tickets;
+    ps->prio[i] = p->prio;
+    ps->ticks[i] = p->ticks;
+  }
+  release(&ptable.lock);
+}
+
+// Keep process pid at level prio or below from now on.
+// Lowering a process takes effect the next time it is queued,
+// raising it at the next boost.
+int
+setpriority(int pid, int prio)
+{
+  struct proc *p;
+
+  if(prio < 0 || prio >= NPRIO)
+    return -1;
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->pid == pid && p->state != UNUSED){
+      p->nice = prio;
+      release(&ptable.lock);
+      return 0;
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Let process pid run only on the CPUs in mask, a bit for
+// each.  A process on some other CPU moves when that CPU's
+// scheduler next picks it; if it is the caller, right away.
+int
+setaffinity(int pid, uint mask)
+{
+  struct proc *p;
+
+  mask &= (1 << ncpu) - 1;
+  if(mask == 0)
+    return -1;
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->pid == pid && p->state != UNUSED){
+      p->affinity = mask;
+      release(&ptable.lock);
+      if(p == myproc() && !(mask & (1 << p->cpu)))
+        yield();
+      return 0;
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// The CPUs process pid may run on, or -1.
+int
+getaffinity(int pid)
+{
+  struct proc *p;
+  int mask;
+
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->pid == pid && p->state != UNUSED){
+      mask = p->affinity & ((1 << ncpu) - 1);
+      release(&ptable.lock);
+      return mask;
+    }
+  }
   release(&ptable.lock);
+  return -1;
 }
 
 // A fork child's very first scheduling by scheduler()
@@ -398,8 +1108,8 @@ void
 forkret(void)
 {
   static int first = 1;
-  // Still holding ptable.lock from scheduler.
-  release(&ptable.lock);
+  // Still holding the run queue lock from scheduler.
+  release(&thisrunq()->lock);
 
   if (first) {
     // Some initialization functions must be run in the context
@@ -419,6 +1129,7 @@ void
 sleep(void *chan, struct spinlock *lk)
 {
   struct proc *p = myproc();
+  struct waitq *wq = WAITQ(chan);
   
   if(p == 0)
     panic("sleep");
@@ -426,52 +1137,78 @@ sleep(void *chan, struct spinlock *lk)
   if(lk == 0)
     panic("sleep without lk");
 
-  // Must acquire ptable.lock in order to
-  // change p->state and then call sched.
-  // Once we hold ptable.lock, we can be
+  // Must acquire wq->lock in order to
+  // change p->state.
+  // Once we hold wq->lock, we can be
   // guaranteed that we won't miss any wakeup
-  // (wakeup runs with ptable.lock locked),
+  // (wakeup runs with wq->lock locked),
   // so it's okay to release lk.
-  if(lk != &ptable.lock){  //DOC: sleeplock0
-    acquire(&ptable.lock);  //DOC: sleeplock1
-    release(lk);
-  }
+  acquire(&wq->lock);  //DOC: sleeplock1
+  release(lk);
+
   // Go to sleep.
   p->chan = chan;
   p->state = SLEEPING;
-
+  p->wnext = wq->head;
+  wq->head = p;
+
+  // Swap wq->lock for our run queue lock to call sched.
+  // A wakeup from here on puts p back on this same queue,
+  // so it has to wait until p is off the CPU.
+  acquire(&thisrunq()->lock);
+  release(&wq->lock);
   sched();
-
-  // Tidy up.
-  p->chan = 0;
+  release(&thisrunq()->lock);
 
   // Reacquire original lock.
-  if(lk != &ptable.lock){  //DOC: sleeplock2
-    release(&ptable.lock);
-    acquire(lk);
-  }
+  acquire(lk);
 }
 
 //PAGEBREAK!
 // Wake up all processes sleeping on chan.
-// The ptable lock must be held.
-static void
-wakeup1(void *chan)
+void
+wakeup(void *chan)
 {
-  struct proc *p;
-
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+  struct waitq *wq = WAITQ(chan);
+  struct proc **pp, *p;
+
+  acquire(&wq->lock);
+  pp = &wq->head;
+  while((p = *pp) != 0){
+    if(p->chan == chan){
+      *pp = p->wnext;
+      p->chan = 0;
+      setrunnable(p);
+    } else
+      pp = &p->wnext;
+  }
+  release(&wq->lock);
 }
 
-// Wake up all processes sleeping on chan.
-void
-wakeup(void *chan)
+// Mark p killed and wake it if it sleeps.
+// Caller holds ptable.lock.
+static void
+killproc(struct proc *p)
 {
-  acquire(&ptable.lock);
-  wakeup1(chan);
-  release(&ptable.lock);
+  struct proc **pp;
+  struct waitq *wq;
+  void *chan;
+
+  p->killed = 1;
+  // Wake process from sleep if necessary.  p->chan
+  // can only be trusted under its wait queue's lock.
+  if((chan = p->chan) != 0){
+    wq = WAITQ(chan);
+    acquire(&wq->lock);
+    if(p->state == SLEEPING && p->chan == chan){
+      for(pp = &wq->head; *pp != p; pp = &(*pp)->wnext)
+        ;
+      *pp = p->wnext;
+      p->chan = 0;
+      setrunnable(p);
+    }
+    release(&wq->lock);
+  }
 }
 
 // Kill the process with the given pid.
@@ -485,10 +1222,7 @@ kill(int pid)
   acquire(&ptable.lock);
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->pid == pid){
-      p->killed = 1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
+      killproc(p);
       release(&ptable.lock);
       return 0;
     }
@@ -497,6 +1231,19 @@ kill(int pid)
   return -1;
 }
 
+// Kill p and every thread sharing its address space.
+void
+uvmkill(struct proc *p)
+{
+  struct proc *q;
+
+  acquire(&ptable.lock);
+  for(q = ptable.proc; q < &ptable.proc[NPROC]; q++)
+    if(q->state != UNUSED && q->uvm == p->uvm)
+      killproc(q);
+  release(&ptable.lock);
+}
+
 //PAGEBREAK: 36
 // Print a process listing to console.  For debugging.
 // Runs when user types ^P on console.
@@ -512,7 +1259,7 @@ procdump(void)
   [RUNNING]  = "run   ",
   [ZOMBIE]   = "zombie"
   };
-  int i;
+  int i, shared, private;
   struct proc *p;
   char *state;
   uint pc[10];
@@ -524,7 +1271,13 @@ procdump(void)
       state = states[p->state];
     else
       state = "???";
-    cprintf("%d %s %s", p->pid, state, p->name);
+    cprintf("%d %s %s prio %d", p->pid, state, p->name, p->prio);
+    if(p->lastcpu >= 0)
+      cprintf(" cpu %d migrated %d", p->lastcpu, p->nmigrate);
+    if(p->pgdir && p->state != EMBRYO){
+      uvmcount(p->pgdir, p->sz, &shared, &private);
+      cprintf(" shared %d private %d", shared, private);
+    }
     if(p->state == SLEEPING){
       getcallerpcs((uint*)p->context->ebp+2, pc);
       for(i=0; i<10 && pc[i] != 0; i++)
@@ -532,4 +1285,7 @@ procdump(void)
     }
     cprintf("\n");
   }
+  for(i = 0; i < ncpu; i++)
+    cprintf("cpu%d: %d runnable, %d stolen\n", i, runq[i].n, runq[i].nsteal);
+  pcdump();
 }
@@ -8,6 +8,10 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  volatile uint idle;          // Halted in idle(); wake with kickcpu()
+  pde_t *pgdir;                // User page table loaded, or 0
+  volatile uint tlbreq;        // TLB flushes asked for by shootdown()
+  volatile uint tlbdone;       // Last request tlbintr() has flushed for
 };
 
 extern struct cpu cpus[NCPU];
@@ -32,22 +36,49 @@ struct context {
   uint eip;
 };
 
+// A range of user memory backed by an executable file, read in
+// a page at a time on first touch (see exec and pagefault).
+struct pseg {
+  struct inode *ip;            // Executable, or 0 if slot is unused
+  uint va;                     // Start address, page aligned
+  uint memsz;                  // Size in memory
+  uint off;                    // File offset of va
+  uint filesz;                 // Bytes from va onward that come from the file
+};
+
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
 // Per-process state
 struct proc {
   uint sz;                     // Size of process memory (bytes)
   pde_t* pgdir;                // Page table
+  struct uvm *uvm;             // Address space, shared by threads
   char *kstack;                // Bottom of kernel stack for this process
   enum procstate state;        // Process state
   int pid;                     // Process ID
   struct proc *parent;         // Parent process
+  uint ustack;                 // Thread's user stack, for join()
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
+  struct proc *wnext;          // Next on chan's wait queue
+  int cpu;                     // Run queue (CPU index) p belongs to
+  uint affinity;               // CPUs p may run on, a bit for each
+  int lastcpu;                 // CPU p last ran on, or -1
+  int nmigrate;                // Times p ran on a different CPU than last
+  struct proc *rqnext;         // Next on run queue
+  uint lastrun;                // ticks when p last left a CPU
+  int prio;                    // Scheduling level, 0 is highest
+  int nice;                    // Highest level p may run at
+  int used;                    // Ticks used at this level
+  uint boostgen;               // Last priority boost applied to p
+  int tickets;                 // Stride scheduling share
+  uint pass;                   // Stride scheduling virtual time
+  uint ticks;                  // Timer ticks spent running
   int killed;                  // If non-zero, have been killed
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
+  struct pseg seg[NPSEG];      // Demand-paged program segments
   char name[16];               // Process name (debugging)
 };
 
@@ -0,0 +1,9 @@
+// Per-process scheduling statistics, filled in by getpinfo().
+// Indexed by process table slot.
+struct pstat {
+  int inuse[NPROC];    // whether this slot is in use
+  int pid[NPROC];
+  int tickets[NPROC];  // stride scheduling tickets
+  int prio[NPROC];     // current scheduling level
+  int ticks[NPROC];    // timer ticks spent running
+};
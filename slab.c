@@ -0,0 +1,189 @@
+// Slab allocator for small, fixed-size kernel objects.
+//
+// A cache hands out objects of one size.  Objects are carved out
+// of slabs, each one page from kalloc(), with a struct slab header
+// at the start of the page; free objects in a slab are chained
+// through their first word.  Since every slab is page aligned,
+// PGROUNDDOWN of an object finds its slab.
+//
+// Each CPU keeps a small stack of free objects per cache, so
+// most allocations and frees touch neither the cache lock nor
+// the slab lists.
+//
+// Interface:
+// * kmem_cache_create(name, size) makes a cache; only called
+//     from main() while the boot CPU is running alone.
+// * kmem_cache_alloc(c) returns an object or 0 if out of memory.
+//     Contents are undefined.
+// * kmem_cache_free(c, p) gives back an object from c.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "list.h"
+#include <stddef.h>
+
+#define NCACHE    16  // max number of caches
+#define SLABCPU   16  // max free objects cached per CPU
+#define SLABBATCH  8  // objects moved between a CPU and the slabs
+
+struct slab {
+  struct list_head list;    // on cache's partial list
+  struct kmem_cache *cache;
+  void *freelist;           // free objects, linked through first word
+  int inuse;                // objects handed out
+};
+
+struct kmem_cache {
+  struct spinlock lock;
+  char *name;
+  uint size;                // object size, rounded up
+  int perslab;              // objects per slab
+  struct list_head partial; // slabs with at least one free object
+  int nslab;                // slabs (pages) owned by this cache
+  struct {
+    int n;
+    void *objs[SLABCPU];
+  } cpu[NCPU];
+};
+
+struct {
+  struct kmem_cache cache[NCACHE];
+  int n;
+} slabtable;
+
+#define SLABHDR ((sizeof(struct slab) + 7) & ~7)
+
+// Create a cache for objects of size bytes.
+struct kmem_cache*
+kmem_cache_create(char *name, uint size)
+{
+  struct kmem_cache *c;
+
+  size = (size + 7) & ~7;
+  if(size < sizeof(void*) || size > PGSIZE - SLABHDR)
+    panic("kmem_cache_create: bad size");
+
+  if(slabtable.n == NCACHE)
+    panic("kmem_cache_create: too many caches");
+  c = &slabtable.cache[slabtable.n++];
+
+  initlock(&c->lock, name);
+  c->name = name;
+  c->size = size;
+  c->perslab = (PGSIZE - SLABHDR) / size;
+  INIT_LIST_HEAD(&c->partial);
+  return c;
+}
+
+// Allocate a fresh slab for c and put it on the partial list.
+// Caller holds c->lock.
+static struct slab*
+slabgrow(struct kmem_cache *c)
+{
+  struct slab *s;
+  char *p;
+  int i;
+
+  if((s = (struct slab*)kalloc()) == 0)
+    return 0;
+  s->cache = c;
+  s->inuse = 0;
+  s->freelist = 0;
+  p = (char*)s + SLABHDR;
+  for(i = 0; i < c->perslab; i++, p += c->size){
+    *(void**)p = s->freelist;
+    s->freelist = p;
+  }
+  list_add(&s->list, &c->partial);
+  c->nslab++;
+  return s;
+}
+
+// Take one object off the partial list.  Caller holds c->lock.
+static void*
+slabget(struct kmem_cache *c)
+{
+  struct slab *s;
+  void *p;
+
+  if(list_empty(&c->partial) && slabgrow(c) == 0)
+    return 0;
+  s = list_entry(c->partial.next, struct slab, list);
+  p = s->freelist;
+  s->freelist = *(void**)p;
+  if(++s->inuse == c->perslab)
+    list_del(&s->list);
+  return p;
+}
+
+// Give one object back to its slab, releasing the slab's
+// page once it is empty.  Caller holds c->lock.
+static void
+slabput(struct kmem_cache *c, void *p)
+{
+  struct slab *s;
+
+  s = (struct slab*)PGROUNDDOWN((uint)p);
+  if(s->cache != c)
+    panic("kmem_cache_free: wrong cache");
+  if(s->inuse == c->perslab)
+    list_add(&s->list, &c->partial);
+  *(void**)p = s->freelist;
+  s->freelist = p;
+  if(--s->inuse == 0){
+    list_del(&s->list);
+    c->nslab--;
+    kfree((char*)s);
+  }
+}
+
+void*
+kmem_cache_alloc(struct kmem_cache *c)
+{
+  void *p, **objs;
+  int n;
+
+  pushcli();
+  objs = c->cpu[cpuid()].objs;
+  n = c->cpu[cpuid()].n;
+  if(n == 0){
+    acquire(&c->lock);
+    for(; n < SLABBATCH; n++)
+      if((objs[n] = slabget(c)) == 0)
+        break;
+    release(&c->lock);
+  }
+  p = 0;
+  if(n > 0)
+    p = objs[--n];
+  c->cpu[cpuid()].n = n;
+  popcli();
+  return p;
+}
+
+void
+kmem_cache_free(struct kmem_cache *c, void *p)
+{
+  void **objs;
+  int i, n;
+
+  pushcli();
+  objs = c->cpu[cpuid()].objs;
+  n = c->cpu[cpuid()].n;
+  if(n == SLABCPU){
+    acquire(&c->lock);
+    for(i = 0; i < SLABBATCH; i++)
+      slabput(c, objs[i]);
+    release(&c->lock);
+    memmove(objs, objs + SLABBATCH, (SLABCPU - SLABBATCH) * sizeof(objs[0]));
+    n -= SLABBATCH;
+  }
+  objs[n++] = p;
+  c->cpu[cpuid()].n = n;
+  popcli();
+}
@@ -0,0 +1,686 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+   7:	b8 30 00 00 00       	mov    $0x30,%eax
+{
+   c:	ff 71 fc             	push   -0x4(%ecx)
+   f:	55                   	push   %ebp
+  10:	89 e5                	mov    %esp,%ebp
+  12:	57                   	push   %edi
+  13:	56                   	push   %esi
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  memset(data, 'a', sizeof(data));
+  14:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+{
+  1a:	53                   	push   %ebx
+
+  for(i = 0; i < 4; i++)
+  1b:	31 db                	xor    %ebx,%ebx
+{
+  1d:	51                   	push   %ecx
+  1e:	81 ec 20 02 00 00    	sub    $0x220,%esp
+  char path[] = "stressfs0";
+  24:	66 89 85 e6 fd ff ff 	mov    %ax,-0x21a(%ebp)
+  2b:	c7 85 de fd ff ff 73 	movl   $0x65727473,-0x222(%ebp)
+  32:	74 72 65 
+  35:	c7 85 e2 fd ff ff 73 	movl   $0x73667373,-0x21e(%ebp)
+  3c:	73 66 73 
+  printf(1, "stressfs starting\n");
+  3f:	68 90 04 00 00       	push   $0x490
+  44:	6a 01                	push   $0x1
+  46:	e8 95 02 00 00       	call   2e0 <printf>
+  memset(data, 'a', sizeof(data));
+  4b:	83 c4 0c             	add    $0xc,%esp
+  4e:	68 00 02 00 00       	push   $0x200
+  53:	6a 61                	push   $0x61
+  55:	56                   	push   %esi
+  56:	e8 c5 00 00 00       	call   120 <memset>
+  5b:	83 c4 10             	add    $0x10,%esp
+    if(fork() > 0)
+  5e:	e8 d6 00 00 00       	call   139 <fork>
+  63:	85 c0                	test   %eax,%eax
+  65:	7f 08                	jg     6f <main+0x6f>
+  for(i = 0; i < 4; i++)
+  67:	83 c3 01             	add    $0x1,%ebx
+  6a:	83 fb 04             	cmp    $0x4,%ebx
+  6d:	75 ef                	jne    5e <main+0x5e>
+      break;
+
+  printf(1, "write %d\n", i);
+  6f:	83 ec 04             	sub    $0x4,%esp
+  72:	53                   	push   %ebx
+  73:	68 a3 04 00 00       	push   $0x4a3
+  78:	6a 01                	push   $0x1
+  7a:	e8 61 02 00 00       	call   2e0 <printf>
+
+  path[8] += i;
+  7f:	00 9d e6 fd ff ff    	add    %bl,-0x21a(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  85:	5f                   	pop    %edi
+  86:	bb 14 00 00 00       	mov    $0x14,%ebx
+  8b:	58                   	pop    %eax
+  8c:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  92:	68 02 02 00 00       	push   $0x202
+  97:	50                   	push   %eax
+  98:	e8 e4 00 00 00       	call   181 <open>
+  9d:	83 c4 10             	add    $0x10,%esp
+  a0:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 20; i++)
+  a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  a8:	83 ec 04             	sub    $0x4,%esp
+  ab:	68 00 02 00 00       	push   $0x200
+  b0:	56                   	push   %esi
+  b1:	57                   	push   %edi
+  b2:	e8 aa 00 00 00       	call   161 <write>
+  for(i = 0; i < 20; i++)
+  b7:	83 c4 10             	add    $0x10,%esp
+  ba:	83 eb 01             	sub    $0x1,%ebx
+  bd:	75 e9                	jne    a8 <main+0xa8>
+  close(fd);
+  bf:	83 ec 0c             	sub    $0xc,%esp
+  c2:	57                   	push   %edi
+  c3:	e8 a1 00 00 00       	call   169 <close>
+
+  printf(1, "read\n");
+  c8:	58                   	pop    %eax
+  c9:	5a                   	pop    %edx
+  ca:	68 ad 04 00 00       	push   $0x4ad
+  cf:	6a 01                	push   $0x1
+  d1:	e8 0a 02 00 00       	call   2e0 <printf>
+
+  fd = open(path, O_RDONLY);
+  d6:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  dc:	59                   	pop    %ecx
+  dd:	5b                   	pop    %ebx
+  de:	6a 00                	push   $0x0
+  e0:	bb 14 00 00 00       	mov    $0x14,%ebx
+  e5:	50                   	push   %eax
+  e6:	e8 96 00 00 00       	call   181 <open>
+  eb:	83 c4 10             	add    $0x10,%esp
+  ee:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < 20; i++)
+    read(fd, data, sizeof(data));
+  f0:	83 ec 04             	sub    $0x4,%esp
+  f3:	68 00 02 00 00       	push   $0x200
+  f8:	56                   	push   %esi
+  f9:	57                   	push   %edi
+  fa:	e8 5a 00 00 00       	call   159 <read>
+  for (i = 0; i < 20; i++)
+  ff:	83 c4 10             	add    $0x10,%esp
+ 102:	83 eb 01             	sub    $0x1,%ebx
+ 105:	75 e9                	jne    f0 <main+0xf0>
+  close(fd);
+ 107:	83 ec 0c             	sub    $0xc,%esp
+ 10a:	57                   	push   %edi
+ 10b:	e8 59 00 00 00       	call   169 <close>
+
+  wait();
+ 110:	e8 34 00 00 00       	call   149 <wait>
+
+  exit();
+ 115:	e8 27 00 00 00       	call   141 <exit>
+ 11a:	66 90                	xchg   %ax,%ax
+ 11c:	66 90                	xchg   %ax,%ax
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <memset>:
+  return n;
+}
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	57                   	push   %edi
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 127:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 12a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 12d:	89 d7                	mov    %edx,%edi
+ 12f:	fc                   	cld
+ 130:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 132:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 135:	89 d0                	mov    %edx,%eax
+ 137:	c9                   	leave
+ 138:	c3                   	ret
+
+00000139 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 139:	b8 01 00 00 00       	mov    $0x1,%eax
+ 13e:	cd 40                	int    $0x40
+ 140:	c3                   	ret
+
+00000141 <exit>:
+SYSCALL(exit)
+ 141:	b8 02 00 00 00       	mov    $0x2,%eax
+ 146:	cd 40                	int    $0x40
+ 148:	c3                   	ret
+
+00000149 <wait>:
+SYSCALL(wait)
+ 149:	b8 03 00 00 00       	mov    $0x3,%eax
+ 14e:	cd 40                	int    $0x40
+ 150:	c3                   	ret
+
+00000151 <pipe>:
+SYSCALL(pipe)
+ 151:	b8 04 00 00 00       	mov    $0x4,%eax
+ 156:	cd 40                	int    $0x40
+ 158:	c3                   	ret
+
+00000159 <read>:
+SYSCALL(read)
+ 159:	b8 05 00 00 00       	mov    $0x5,%eax
+ 15e:	cd 40                	int    $0x40
+ 160:	c3                   	ret
+
+00000161 <write>:
+SYSCALL(write)
+ 161:	b8 10 00 00 00       	mov    $0x10,%eax
+ 166:	cd 40                	int    $0x40
+ 168:	c3                   	ret
+
+00000169 <close>:
+SYSCALL(close)
+ 169:	b8 15 00 00 00       	mov    $0x15,%eax
+ 16e:	cd 40                	int    $0x40
+ 170:	c3                   	ret
+
+00000171 <kill>:
+SYSCALL(kill)
+ 171:	b8 06 00 00 00       	mov    $0x6,%eax
+ 176:	cd 40                	int    $0x40
+ 178:	c3                   	ret
+
+00000179 <exec>:
+SYSCALL(exec)
+ 179:	b8 07 00 00 00       	mov    $0x7,%eax
+ 17e:	cd 40                	int    $0x40
+ 180:	c3                   	ret
+
+00000181 <open>:
+SYSCALL(open)
+ 181:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 186:	cd 40                	int    $0x40
+ 188:	c3                   	ret
+
+00000189 <mknod>:
+SYSCALL(mknod)
+ 189:	b8 11 00 00 00       	mov    $0x11,%eax
+ 18e:	cd 40                	int    $0x40
+ 190:	c3                   	ret
+
+00000191 <unlink>:
+SYSCALL(unlink)
+ 191:	b8 12 00 00 00       	mov    $0x12,%eax
+ 196:	cd 40                	int    $0x40
+ 198:	c3                   	ret
+
+00000199 <fstat>:
+SYSCALL(fstat)
+ 199:	b8 08 00 00 00       	mov    $0x8,%eax
+ 19e:	cd 40                	int    $0x40
+ 1a0:	c3                   	ret
+
+000001a1 <link>:
+SYSCALL(link)
+ 1a1:	b8 13 00 00 00       	mov    $0x13,%eax
+ 1a6:	cd 40                	int    $0x40
+ 1a8:	c3                   	ret
+
+000001a9 <mkdir>:
+SYSCALL(mkdir)
+ 1a9:	b8 14 00 00 00       	mov    $0x14,%eax
+ 1ae:	cd 40                	int    $0x40
+ 1b0:	c3                   	ret
+
+000001b1 <chdir>:
+SYSCALL(chdir)
+ 1b1:	b8 09 00 00 00       	mov    $0x9,%eax
+ 1b6:	cd 40                	int    $0x40
+ 1b8:	c3                   	ret
+
+000001b9 <dup>:
+SYSCALL(dup)
+ 1b9:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 1be:	cd 40                	int    $0x40
+ 1c0:	c3                   	ret
+
+000001c1 <getpid>:
+SYSCALL(getpid)
+ 1c1:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 1c6:	cd 40                	int    $0x40
+ 1c8:	c3                   	ret
+
+000001c9 <sbrk>:
+SYSCALL(sbrk)
+ 1c9:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 1ce:	cd 40                	int    $0x40
+ 1d0:	c3                   	ret
+
+000001d1 <sleep>:
+SYSCALL(sleep)
+ 1d1:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 1d6:	cd 40                	int    $0x40
+ 1d8:	c3                   	ret
+
+000001d9 <uptime>:
+SYSCALL(uptime)
+ 1d9:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 1de:	cd 40                	int    $0x40
+ 1e0:	c3                   	ret
+
+000001e1 <setpriority>:
+SYSCALL(setpriority)
+ 1e1:	b8 16 00 00 00       	mov    $0x16,%eax
+ 1e6:	cd 40                	int    $0x40
+ 1e8:	c3                   	ret
+
+000001e9 <settickets>:
+SYSCALL(settickets)
+ 1e9:	b8 17 00 00 00       	mov    $0x17,%eax
+ 1ee:	cd 40                	int    $0x40
+ 1f0:	c3                   	ret
+
+000001f1 <getpinfo>:
+SYSCALL(getpinfo)
+ 1f1:	b8 18 00 00 00       	mov    $0x18,%eax
+ 1f6:	cd 40                	int    $0x40
+ 1f8:	c3                   	ret
+
+000001f9 <nanosleep>:
+SYSCALL(nanosleep)
+ 1f9:	b8 19 00 00 00       	mov    $0x19,%eax
+ 1fe:	cd 40                	int    $0x40
+ 200:	c3                   	ret
+
+00000201 <clone>:
+SYSCALL(clone)
+ 201:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 206:	cd 40                	int    $0x40
+ 208:	c3                   	ret
+
+00000209 <join>:
+SYSCALL(join)
+ 209:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 20e:	cd 40                	int    $0x40
+ 210:	c3                   	ret
+
+00000211 <futex_wait>:
+SYSCALL(futex_wait)
+ 211:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 216:	cd 40                	int    $0x40
+ 218:	c3                   	ret
+
+00000219 <futex_wake>:
+SYSCALL(futex_wake)
+ 219:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 21e:	cd 40                	int    $0x40
+ 220:	c3                   	ret
+
+00000221 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 221:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 226:	cd 40                	int    $0x40
+ 228:	c3                   	ret
+
+00000229 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 229:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 22e:	cd 40                	int    $0x40
+ 230:	c3                   	ret
+
+00000231 <iostat>:
+SYSCALL(iostat)
+ 231:	b8 20 00 00 00       	mov    $0x20,%eax
+ 236:	cd 40                	int    $0x40
+ 238:	c3                   	ret
+ 239:	66 90                	xchg   %ax,%ax
+ 23b:	66 90                	xchg   %ax,%ax
+ 23d:	66 90                	xchg   %ax,%ax
+ 23f:	90                   	nop
+
+00000240 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+ 245:	53                   	push   %ebx
+ 246:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 248:	89 d1                	mov    %edx,%ecx
+{
+ 24a:	83 ec 3c             	sub    $0x3c,%esp
+ 24d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 250:	85 d2                	test   %edx,%edx
+ 252:	0f 89 80 00 00 00    	jns    2d8 <printint+0x98>
+ 258:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 25c:	74 7a                	je     2d8 <printint+0x98>
+    x = -xx;
+ 25e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 260:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 265:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 268:	31 f6                	xor    %esi,%esi
+ 26a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 270:	89 c8                	mov    %ecx,%eax
+ 272:	31 d2                	xor    %edx,%edx
+ 274:	89 f7                	mov    %esi,%edi
+ 276:	f7 f3                	div    %ebx
+ 278:	8d 76 01             	lea    0x1(%esi),%esi
+ 27b:	0f b6 92 14 05 00 00 	movzbl 0x514(%edx),%edx
+ 282:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 286:	89 ca                	mov    %ecx,%edx
+ 288:	89 c1                	mov    %eax,%ecx
+ 28a:	39 da                	cmp    %ebx,%edx
+ 28c:	73 e2                	jae    270 <printint+0x30>
+  if(neg)
+ 28e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 291:	85 c0                	test   %eax,%eax
+ 293:	74 07                	je     29c <printint+0x5c>
+    buf[i++] = '-';
+ 295:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 29a:	89 f7                	mov    %esi,%edi
+ 29c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 29f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 2a2:	01 df                	add    %ebx,%edi
+ 2a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 2a8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 2ab:	83 ec 04             	sub    $0x4,%esp
+ 2ae:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 2b1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 2b4:	6a 01                	push   $0x1
+ 2b6:	50                   	push   %eax
+ 2b7:	56                   	push   %esi
+ 2b8:	e8 a4 fe ff ff       	call   161 <write>
+  while(--i >= 0)
+ 2bd:	89 f8                	mov    %edi,%eax
+ 2bf:	83 c4 10             	add    $0x10,%esp
+ 2c2:	83 ef 01             	sub    $0x1,%edi
+ 2c5:	39 d8                	cmp    %ebx,%eax
+ 2c7:	75 df                	jne    2a8 <printint+0x68>
+}
+ 2c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2cc:	5b                   	pop    %ebx
+ 2cd:	5e                   	pop    %esi
+ 2ce:	5f                   	pop    %edi
+ 2cf:	5d                   	pop    %ebp
+ 2d0:	c3                   	ret
+ 2d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 2d8:	31 c0                	xor    %eax,%eax
+ 2da:	eb 89                	jmp    265 <printint+0x25>
+ 2dc:	66 90                	xchg   %ax,%ax
+ 2de:	66 90                	xchg   %ax,%ax
+
+000002e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	56                   	push   %esi
+ 2e5:	53                   	push   %ebx
+ 2e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 2e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 2ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 2ef:	0f b6 1e             	movzbl (%esi),%ebx
+ 2f2:	83 c6 01             	add    $0x1,%esi
+ 2f5:	84 db                	test   %bl,%bl
+ 2f7:	74 67                	je     360 <printf+0x80>
+ 2f9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 2fc:	31 d2                	xor    %edx,%edx
+ 2fe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 301:	eb 34                	jmp    337 <printf+0x57>
+ 303:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 307:	90                   	nop
+ 308:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 30b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 310:	83 f8 25             	cmp    $0x25,%eax
+ 313:	74 18                	je     32d <printf+0x4d>
+  write(fd, &c, 1);
+ 315:	83 ec 04             	sub    $0x4,%esp
+ 318:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 31b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 31e:	6a 01                	push   $0x1
+ 320:	50                   	push   %eax
+ 321:	57                   	push   %edi
+ 322:	e8 3a fe ff ff       	call   161 <write>
+ 327:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 32a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 32d:	0f b6 1e             	movzbl (%esi),%ebx
+ 330:	83 c6 01             	add    $0x1,%esi
+ 333:	84 db                	test   %bl,%bl
+ 335:	74 29                	je     360 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 337:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 33a:	85 d2                	test   %edx,%edx
+ 33c:	74 ca                	je     308 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 33e:	83 fa 25             	cmp    $0x25,%edx
+ 341:	75 ea                	jne    32d <printf+0x4d>
+      if(c == 'd'){
+ 343:	83 f8 25             	cmp    $0x25,%eax
+ 346:	0f 84 24 01 00 00    	je     470 <printf+0x190>
+ 34c:	83 e8 63             	sub    $0x63,%eax
+ 34f:	83 f8 15             	cmp    $0x15,%eax
+ 352:	77 1c                	ja     370 <printf+0x90>
+ 354:	ff 24 85 bc 04 00 00 	jmp    *0x4bc(,%eax,4)
+ 35b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 35f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 360:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 363:	5b                   	pop    %ebx
+ 364:	5e                   	pop    %esi
+ 365:	5f                   	pop    %edi
+ 366:	5d                   	pop    %ebp
+ 367:	c3                   	ret
+ 368:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36f:	90                   	nop
+  write(fd, &c, 1);
+ 370:	83 ec 04             	sub    $0x4,%esp
+ 373:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 376:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 37a:	6a 01                	push   $0x1
+ 37c:	52                   	push   %edx
+ 37d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 380:	57                   	push   %edi
+ 381:	e8 db fd ff ff       	call   161 <write>
+ 386:	83 c4 0c             	add    $0xc,%esp
+ 389:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 38c:	6a 01                	push   $0x1
+ 38e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 391:	52                   	push   %edx
+ 392:	57                   	push   %edi
+ 393:	e8 c9 fd ff ff       	call   161 <write>
+        putc(fd, c);
+ 398:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 39b:	31 d2                	xor    %edx,%edx
+ 39d:	eb 8e                	jmp    32d <printf+0x4d>
+ 39f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 3a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 3a3:	83 ec 0c             	sub    $0xc,%esp
+ 3a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 3ab:	8b 13                	mov    (%ebx),%edx
+ 3ad:	6a 00                	push   $0x0
+ 3af:	89 f8                	mov    %edi,%eax
+        ap++;
+ 3b1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 3b4:	e8 87 fe ff ff       	call   240 <printint>
+        ap++;
+ 3b9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 3bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 3bf:	31 d2                	xor    %edx,%edx
+ 3c1:	e9 67 ff ff ff       	jmp    32d <printf+0x4d>
+ 3c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 3d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 3d3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 3d5:	83 c0 04             	add    $0x4,%eax
+ 3d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 3db:	85 db                	test   %ebx,%ebx
+ 3dd:	0f 84 9d 00 00 00    	je     480 <printf+0x1a0>
+        while(*s != 0){
+ 3e3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 3e6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 3e8:	84 c0                	test   %al,%al
+ 3ea:	0f 84 3d ff ff ff    	je     32d <printf+0x4d>
+ 3f0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 3f3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 3f6:	89 de                	mov    %ebx,%esi
+ 3f8:	89 d3                	mov    %edx,%ebx
+ 3fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 400:	83 ec 04             	sub    $0x4,%esp
+ 403:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 406:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 409:	6a 01                	push   $0x1
+ 40b:	53                   	push   %ebx
+ 40c:	57                   	push   %edi
+ 40d:	e8 4f fd ff ff       	call   161 <write>
+        while(*s != 0){
+ 412:	0f b6 06             	movzbl (%esi),%eax
+ 415:	83 c4 10             	add    $0x10,%esp
+ 418:	84 c0                	test   %al,%al
+ 41a:	75 e4                	jne    400 <printf+0x120>
+      state = 0;
+ 41c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 41f:	31 d2                	xor    %edx,%edx
+ 421:	e9 07 ff ff ff       	jmp    32d <printf+0x4d>
+ 426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 430:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 433:	83 ec 0c             	sub    $0xc,%esp
+ 436:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 43b:	8b 13                	mov    (%ebx),%edx
+ 43d:	6a 01                	push   $0x1
+ 43f:	e9 6b ff ff ff       	jmp    3af <printf+0xcf>
+ 444:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 448:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 44b:	83 ec 04             	sub    $0x4,%esp
+ 44e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 451:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 453:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 456:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 459:	6a 01                	push   $0x1
+ 45b:	52                   	push   %edx
+ 45c:	57                   	push   %edi
+ 45d:	e8 ff fc ff ff       	call   161 <write>
+        ap++;
+ 462:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 465:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 468:	31 d2                	xor    %edx,%edx
+ 46a:	e9 be fe ff ff       	jmp    32d <printf+0x4d>
+ 46f:	90                   	nop
+  write(fd, &c, 1);
+ 470:	83 ec 04             	sub    $0x4,%esp
+ 473:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 476:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 479:	6a 01                	push   $0x1
+ 47b:	e9 11 ff ff ff       	jmp    391 <printf+0xb1>
+ 480:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 485:	bb b3 04 00 00       	mov    $0x4b3,%ebx
+ 48a:	e9 61 ff ff ff       	jmp    3f0 <printf+0x110>
@@ -20,3 +20,14 @@
 #define SYS_link   19
 #define SYS_mkdir  20
 #define SYS_close  21
+#define SYS_setpriority 22
+#define SYS_settickets 23
+#define SYS_getpinfo 24
+#define SYS_nanosleep 25
+#define SYS_clone  26
+#define SYS_join   27
+#define SYS_futex_wait 28
+#define SYS_futex_wake 29
+#define SYS_sched_setaffinity 30
+#define SYS_sched_getaffinity 31
+#define SYS_iostat 32
@@ -6,6 +6,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "pstat.h"
 
 int
 sys_fork(void)
@@ -50,8 +51,8 @@ sys_sbrk(void)
 
   if(argint(0, &n) < 0)
     return -1;
-  addr = myproc()->sz;
-  if(growproc(n) < 0)
+  // Not myproc()->sz: another thread may grow it first.
+  if((addr = growproc(n)) == -1)
     return -1;
   return addr;
 }
@@ -60,21 +61,22 @@ int
 sys_sleep(void)
 {
   int n;
-  uint ticks0;
 
   if(argint(0, &n) < 0)
     return -1;
-  acquire(&tickslock);
-  ticks0 = ticks;
-  while(ticks - ticks0 < n){
-    if(myproc()->killed){
-      release(&tickslock);
-      return -1;
-    }
-    sleep(&ticks, &tickslock);
-  }
-  release(&tickslock);
-  return 0;
+  return sleepticks(n);
+}
+
+// Sleep for a number of nanoseconds, to the resolution of the
+// lapic timer rather than of the clock tick.
+int
+sys_nanosleep(void)
+{
+  int ns;
+
+  if(argint(0, &ns) < 0 || ns < 0)
+    return -1;
+  return nanosleep(ns);
 }
 
 // return how many clock tick interrupts have occurred
@@ -89,3 +91,111 @@ sys_uptime(void)
   release(&tickslock);
   return xticks;
 }
+
+// Keep a process at or below a scheduling level (0 is highest).
+int
+sys_setpriority(void)
+{
+  int pid, prio;
+
+  if(argint(0, &pid) < 0 || argint(1, &prio) < 0)
+    return -1;
+  return setpriority(pid, prio);
+}
+
+int
+sys_sched_setaffinity(void)
+{
+  int pid, mask;
+
+  if(argint(0, &pid) < 0 || argint(1, &mask) < 0)
+    return -1;
+  return setaffinity(pid, mask);
+}
+
+int
+sys_sched_getaffinity(void)
+{
+  int pid;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  return getaffinity(pid);
+}
+
+int
+sys_settickets(void)
+{
+  int n;
+
+  if(argint(0, &n) < 0)
+    return -1;
+  return settickets(n);
+}
+
+int
+sys_getpinfo(void)
+{
+  struct pstat *ps, *k;
+
+  if(argptr(0, (void*)&ps, sizeof(*ps), 1) < 0)
+    return -1;
+  // getpinfo() holds ptable.lock, so it must not touch user
+  // memory; fill a kernel copy.
+  if((k = (struct pstat*)kalloc()) == 0)
+    return -1;
+  getpinfo(k);
+  memmove(ps, k, sizeof(*ps));
+  kfree((char*)k);
+  return 0;
+}
+
+// Create a thread running fn(arg1, arg2) on a one-page stack.
+int
+sys_clone(void)
+{
+  int fn, arg1, arg2, stack;
+
+  if(argint(0, &fn) < 0 || argint(1, &arg1) < 0 ||
+     argint(2, &arg2) < 0 || argint(3, &stack) < 0)
+    return -1;
+  return clone(fn, arg1, arg2, stack);
+}
+
+// Wait for a thread to exit; return its pid and store
+// the stack it was created with.
+int
+sys_join(void)
+{
+  char *stack;
+  uint ustack;
+  int pid;
+
+  if(argptr(0, &stack, sizeof(uint), 1) < 0)
+    return -1;
+  if((pid = join(&ustack)) >= 0)
+    *(uint*)stack = ustack;
+  return pid;
+}
+
+// Sleep while the word at addr holds val, until futex_wake(addr).
+int
+sys_futex_wait(void)
+{
+  int addr, val;
+
+  if(argint(0, &addr) < 0 || argint(1, &val) < 0)
+    return -1;
+  return futexwait(addr, val);
+}
+
+// Wake up to n threads waiting in futex_wait(addr).
+int
+sys_futex_wake(void)
+{
+  int addr, n;
+
+  if(argint(0, &addr) < 0 || argint(1, &n) < 0)
+    return -1;
+  return futexwake(addr, n);
+}
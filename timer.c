@@ -0,0 +1,305 @@
+// Timers.
+//
+// Sleeps measured in clock ticks wait on a hierarchical timer
+// wheel: NLEVEL levels of WHEELSIZE slots, where a slot of level
+// l holds the timers due within one span of WHEELSIZE^l ticks.
+// Each tick empties one level 0 slot, waking only the processes
+// whose time has come, and every WHEELSIZE ticks one slot of the
+// level above is cascaded down.  The wheel runs on CPU 0's ticks
+// and is protected by tickslock.
+//
+// nanosleep() needs better than a tick: it sleeps whole ticks on
+// the wheel, then puts the rest on a high resolution timer on its
+// own CPU, which has its lapic timer count down to the deadline
+// (see lapicarm()).  Each CPU's high resolution timers are
+// protected by its own lock.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+
+#define WHEELBITS 6
+#define WHEELSIZE (1 << WHEELBITS)
+#define WHEELMASK (WHEELSIZE - 1)
+#define NLEVEL    3   // later timers wait at the top and cascade again
+
+struct timer {
+  uint expires;            // Tick to fire at
+  int fired;
+  struct timer *next;      // Slot list
+  struct timer **pprev;
+};
+
+static struct timer *wheel[NLEVEL][WHEELSIZE];
+static uint wheeltime;     // Last tick the wheel has run
+
+// Put t in the slot for t->expires.  Caller holds tickslock.
+static void
+timeradd(struct timer *t)
+{
+  struct timer **slot;
+  uint d;
+  int l;
+
+  d = t->expires - wheeltime;
+  if((int)d <= 0){
+    t->fired = 1;
+    t->pprev = 0;
+    return;
+  }
+  for(l = 0; l < NLEVEL-1; l++)
+    if(d < 1 << (WHEELBITS * (l + 1)))
+      break;
+  if(d >= 1 << (WHEELBITS * NLEVEL))
+    slot = &wheel[l][((wheeltime >> (WHEELBITS * l)) - 1) & WHEELMASK];
+  else
+    slot = &wheel[l][(t->expires >> (WHEELBITS * l)) & WHEELMASK];
+  t->fired = 0;
+  t->next = *slot;
+  if(t->next)
+    t->next->pprev = &t->next;
+  t->pprev = slot;
+  *slot = t;
+}
+
+// Take t off the wheel.  Caller holds tickslock.
+static void
+timerdel(struct timer *t)
+{
+  if(t->pprev == 0)
+    return;
+  *t->pprev = t->next;
+  if(t->next)
+    t->next->pprev = t->pprev;
+  t->pprev = 0;
+}
+
+// Re-add every timer in slot i of level l, moving each one down
+// to the level its remaining time calls for.
+static void
+cascade(int l, int i)
+{
+  struct timer *t, *list;
+
+  list = wheel[l][i];
+  wheel[l][i] = 0;
+  while((t = list) != 0){
+    list = t->next;
+    timeradd(t);
+    if(t->fired)
+      wakeup(t);
+  }
+}
+
+// Run the wheel for one more tick.  Called by clockadvance()
+// for each tick, holding tickslock.
+void
+timertick(void)
+{
+  struct timer *t;
+  int l;
+
+  wheeltime++;
+  for(l = 1; l < NLEVEL; l++){
+    if((wheeltime & ((1 << (WHEELBITS * l)) - 1)) != 0)
+      break;
+    cascade(l, (wheeltime >> (WHEELBITS * l)) & WHEELMASK);
+  }
+  while((t = wheel[0][wheeltime & WHEELMASK]) != 0){
+    timerdel(t);
+    t->fired = 1;
+    wakeup(t);
+  }
+}
+
+// How many ticks until the wheel next has something to do,
+// up to max.  Caller holds tickslock.
+uint
+timernext(uint max)
+{
+  uint d;
+  int l;
+
+  for(d = 1; d < WHEELSIZE && d < max; d++)
+    if(wheel[0][(wheeltime + d) & WHEELMASK])
+      return d;
+  for(l = 1; l < NLEVEL; l++)
+    for(d = 0; d < WHEELSIZE; d++)
+      if(wheel[l][d]){
+        // Nothing fires before the next cascade.
+        d = WHEELSIZE - (wheeltime & WHEELMASK);
+        return d < max ? d : max;
+      }
+  return max;
+}
+
+// Sleep for n ticks.  Returns -1 if killed first.
+int
+sleepticks(uint n)
+{
+  struct timer t;
+
+  acquire(&tickslock);
+  t.expires = ticks + n;
+  timeradd(&t);
+  kickcpu(0);  // it may be idle with a later timeout
+  while(!t.fired){
+    if(myproc()->killed){
+      timerdel(&t);
+      release(&tickslock);
+      return -1;
+    }
+    sleep(&t, &tickslock);
+  }
+  release(&tickslock);
+  return 0;
+}
+
+//PAGEBREAK!
+// High resolution timers.
+
+struct hrtimer {
+  uint expires;            // Local time on its CPU to fire at
+  int fired;
+  struct hrtimer *next;
+};
+
+static struct hrcpu {
+  struct spinlock lock;
+  struct hrtimer *q;       // Pending, soonest first
+  int stopped;             // Timer no longer ticks; see timeridle()
+} hrcpu[NCPU];
+
+void
+timerinit(void)
+{
+  int i;
+
+  for(i = 0; i < NCPU; i++)
+    initlock(&hrcpu[i].lock, "hrtimer");
+}
+
+// This CPU's timers, locked.
+static struct hrcpu*
+hrlock(void)
+{
+  struct hrcpu *c;
+
+  pushcli();
+  c = &hrcpu[cpuid()];
+  acquire(&c->lock);
+  popcli();
+  return c;
+}
+
+// Set this CPU's timer for the next tick or high resolution
+// timer, whichever is first.  Caller holds c->lock.
+static void
+hrarm(struct hrcpu *c)
+{
+  struct hrtimer *t = c->q;
+  uint next;
+
+  next = lapicnexttick();
+  if(t && (int)(t->expires - next) < 0)
+    next = t->expires;
+  lapicarm(next);
+}
+
+// Fire this CPU's expired high resolution timers and set the
+// timer for whatever is next.  Called on each timer interrupt.
+void
+hrtimerintr(void)
+{
+  struct hrcpu *c;
+  struct hrtimer **q, *t;
+  uint now;
+
+  c = hrlock();
+  q = &c->q;
+  now = lapicnow();
+  while((t = *q) != 0 && (int)(t->expires - now) <= 0){
+    *q = t->next;
+    t->fired = 1;
+    wakeup(t);
+  }
+  c->stopped = 0;
+  hrarm(c);
+  release(&c->lock);
+}
+
+// Sleep for ns nanoseconds.  Returns -1 if killed during the
+// part measured in ticks; the rest is less than a tick and is
+// always slept out.
+int
+nanosleep(uint ns)
+{
+  struct hrcpu *c;
+  struct hrtimer t, **q;
+
+  if(ns >= TICKNS && sleepticks(ns / TICKNS) < 0)
+    return -1;
+  ns %= TICKNS;
+  if(ns == 0)
+    return 0;
+
+  c = hrlock();
+  t.expires = lapicnow() + ns;
+  t.fired = 0;
+  for(q = &c->q; *q && (int)((*q)->expires - t.expires) <= 0;
+      q = &(*q)->next)
+    ;
+  t.next = *q;
+  *q = &t;
+  hrarm(c);
+  // Fired by this CPU, though the process may wake on another.
+  while(!t.fired)
+    sleep(&t, &c->lock);
+  release(&c->lock);
+  return 0;
+}
+
+// This CPU has nothing to do and is about to halt.  Unless it
+// has high resolution timers pending, stop its timer, or for
+// CPU 0, which keeps the clock, skip the next n-1 ticks (if n is
+// not 0).  Interrupts are off.
+void
+timeridle(uint n)
+{
+  struct hrcpu *c;
+
+  c = hrlock();
+  if(c->q == 0){
+    if(c != &hrcpu[0]){
+      lapicstop();
+      c->stopped = 1;
+    } else if(n > 1){
+      lapicarm(lapicnexttick() + (n - 1) * TICKNS);
+      c->stopped = 1;
+    }
+  }
+  release(&c->lock);
+}
+
+// This CPU woke up from idle: catch up and go back to ticking,
+// unless a timer interrupt is already on its way to do so.
+// Returns the ticks that passed while its timer was stopped.
+uint
+timerwake(void)
+{
+  struct hrcpu *c;
+  uint n;
+
+  n = 0;
+  c = hrlock();
+  if(c->stopped && !lapicexpired()){
+    n = lapicticks();
+    c->stopped = 0;
+    hrarm(c);
+  }
+  release(&c->lock);
+  return n;
+}
@@ -14,6 +14,9 @@ extern uint vectors[];  // in vectors.S: array of 256 entry pointers
 struct spinlock tickslock;
 uint ticks;
 
+// Most ticks an idle CPU 0 goes without a timer interrupt.
+#define MAXIDLE 100
+
 void
 tvinit(void)
 {
@@ -32,10 +35,51 @@ idtinit(void)
   lidt(idt, sizeof(idt));
 }
 
+// Advance the clock by n ticks.  Caller holds tickslock.
+static void
+clockadvance(uint n)
+{
+  uint t0;
+
+  t0 = ticks;
+  ticks += n;
+  if(ticks / BOOSTTICKS != t0 / BOOSTTICKS)
+    prioboost();
+  while(n-- > 0)
+    timertick();
+}
+
+// How many ticks idle CPU 0 can let pass without a timer
+// interrupt: up to the next timer on the wheel.
+uint
+clockidle(void)
+{
+  uint n;
+
+  acquire(&tickslock);
+  n = timernext(MAXIDLE);
+  release(&tickslock);
+  return n;
+}
+
+// CPU 0 was idle, not counting ticks, while n passed.
+void
+clockskip(uint n)
+{
+  if(n == 0)
+    return;
+  acquire(&tickslock);
+  clockadvance(n);
+  release(&tickslock);
+}
+
 //PAGEBREAK: 41
 void
 trap(struct trapframe *tf)
 {
+  uint n;
+  int tick;
+
   if(tf->trapno == T_SYSCALL){
     if(myproc()->killed)
       exit();
@@ -46,14 +90,27 @@ trap(struct trapframe *tf)
     return;
   }
 
+  tick = 0;
   switch(tf->trapno){
   case T_IRQ0 + IRQ_TIMER:
-    if(cpuid() == 0){
-      acquire(&tickslock);
-      ticks++;
-      wakeup(&ticks);
-      release(&tickslock);
+    // A tick, a high resolution timer, or both.
+    if((n = lapicticks()) > 0){
+      tick = 1;
+      if(cpuid() == 0){
+        acquire(&tickslock);
+        clockadvance(n);
+        release(&tickslock);
+      }
     }
+    hrtimerintr();
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_WAKE:
+    // Only here to end an idle CPU's hlt.
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_TLB:
+    tlbintr();
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE:
@@ -71,6 +128,23 @@ trap(struct trapframe *tf)
     uartintr();
     lapiceoi();
     break;
+  case T_PGFLT:
+    // From user space, or from the kernel touching user
+    // memory during a system call, which it never does
+    // holding a spinlock: resolving the fault may sleep and
+    // wait for other CPUs.
+    if(myproc() == 0 || ((tf->cs&3) == 0 && mycpu()->ncli > 0))
+      goto bad;
+    if(pagefault(myproc(), rcr2()) == 0)
+      break;
+    if((tf->cs&3) == 0 && junkfault(myproc(), rcr2()) == 0){
+      // The process gave the kernel memory it cannot have.
+      cprintf("pid %d %s: bad address 0x%x in system call"
+              "--kill proc\n", myproc()->pid, myproc()->name, rcr2());
+      uvmkill(myproc());
+      break;
+    }
+    goto bad;
   case T_IRQ0 + 7:
   case T_IRQ0 + IRQ_SPURIOUS:
     cprintf("cpu%d: spurious interrupt at %x:%x\n",
@@ -80,6 +154,7 @@ trap(struct trapframe *tf)
 
   //PAGEBREAK: 13
   default:
+  bad:
     if(myproc() == 0 || (tf->cs&3) == 0){
       // In kernel, it must be our mistake.
       cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
@@ -103,7 +178,7 @@ trap(struct trapframe *tf)
   // Force process to give up CPU on clock tick.
   // If interrupts were on while locks held, would need to check nlock.
   if(myproc() && myproc()->state == RUNNING &&
-     tf->trapno == T_IRQ0+IRQ_TIMER)
+     tick && quantumtick())
     yield();
 
   // Check if the process has been killed since we yielded
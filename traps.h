@@ -34,5 +34,7 @@
 #define IRQ_COM1         4
 #define IRQ_IDE         14
 #define IRQ_ERROR       19
+#define IRQ_WAKE        20      // IPI: wake an idle CPU
+#define IRQ_TLB         21      // IPI: flush the TLB (see shootdown)
 #define IRQ_SPURIOUS    31
 
@@ -104,3 +104,146 @@ memmove(void *vdst, const void *vsrc, int n)
     *dst++ = *src++;
   return vdst;
 }
+
+// Spin locks for threads.
+void
+lock_init(lock_t *lk)
+{
+  lk->locked = 0;
+}
+
+void
+lock_acquire(lock_t *lk)
+{
+  while(xchg(&lk->locked, 1) != 0)
+    ;
+}
+
+void
+lock_release(lock_t *lk)
+{
+  xchg(&lk->locked, 0);
+}
+
+// Mutexes that sleep in the kernel, with futex_wait(), only
+// when contended (after Drepper, "Futexes Are Tricky").
+// state is 0 if unlocked, 1 if locked, and 2 if locked with
+// threads perhaps waiting, which unlock must then wake.
+void
+mutex_init(mutex_t *m)
+{
+  m->state = 0;
+}
+
+void
+mutex_lock(mutex_t *m)
+{
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    return;
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+}
+
+void
+mutex_unlock(mutex_t *m)
+{
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    xchg(&m->state, 0);
+    futex_wake(&m->state, 1);
+  }
+}
+
+// Condition variables.  A waiter sleeps until seq moves on
+// from the value it saw while holding the mutex.
+void
+cond_init(cond_t *c)
+{
+  c->seq = 0;
+}
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+  uint seq;
+
+  seq = c->seq;
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+  // Others may have been woken too: lock as contended.
+  while(xchg(&m->state, 2) != 0)
+    futex_wait(&m->state, 2);
+}
+
+void
+cond_signal(cond_t *c)
+{
+  __sync_add_and_fetch(&c->seq, 1);
+  futex_wake(&c->seq, 1);
+}
+
+void
+cond_broadcast(cond_t *c)
+{
+  __sync_add_and_fetch(&c->seq, 1);
+  futex_wake(&c->seq, 0x7fffffff);
+}
+
+// Threads.  Each one runs on a one-page stack, reused from a
+// thread that has been joined or else fresh from sbrk(), so
+// that programs linked without malloc can use threads too.
+#define TSTACK 4096  // the kernel's PGSIZE; see clone()
+
+static lock_t stacklock;
+static char *freestacks;  // linked through their first word
+
+static void
+threadstart(void *fn, void *arg)
+{
+  ((void (*)(void*))fn)(arg);
+  exit();
+}
+
+// Start a thread running fn(arg).  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+  char *stack;
+  int pid;
+
+  lock_acquire(&stacklock);
+  if((stack = freestacks) != 0)
+    freestacks = *(char**)stack;
+  lock_release(&stacklock);
+  if(stack == 0 && (stack = sbrk(TSTACK)) == (char*)-1)
+    return -1;
+  if((pid = clone(threadstart, fn, arg, stack)) < 0){
+    lock_acquire(&stacklock);
+    *(char**)stack = freestacks;
+    freestacks = stack;
+    lock_release(&stacklock);
+  }
+  return pid;
+}
+
+// Wait for a thread started by thread_create() to finish.
+// Returns its pid, or -1 if there are none.
+int
+thread_join(void)
+{
+  char *stack;
+  int pid;
+
+  if((pid = join((void**)&stack)) < 0)
+    return -1;
+  lock_acquire(&stacklock);
+  *(char**)stack = freestacks;
+  freestacks = stack;
+  lock_release(&stacklock);
+  return pid;
+}
@@ -20,9 +20,10 @@ typedef union header Header;
 
 static Header base;
 static Header *freep;
+static lock_t lock;  // for programs using threads
 
-void
-free(void *ap)
+static void
+freeblock(void *ap)
 {
   Header *bp, *p;
 
@@ -43,6 +44,14 @@ free(void *ap)
   freep = p;
 }
 
+void
+free(void *ap)
+{
+  lock_acquire(&lock);
+  freeblock(ap);
+  lock_release(&lock);
+}
+
 static Header*
 morecore(uint nu)
 {
@@ -56,7 +65,7 @@ morecore(uint nu)
     return 0;
   hp = (Header*)p;
   hp->s.size = nu;
-  free((void*)(hp + 1));
+  freeblock((void*)(hp + 1));
   return freep;
 }
 
@@ -67,6 +76,7 @@ malloc(uint nbytes)
   uint nunits;
 
   nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+  lock_acquire(&lock);
   if((prevp = freep) == 0){
     base.s.ptr = freep = prevp = &base;
     base.s.size = 0;
@@ -81,10 +91,13 @@ malloc(uint nbytes)
         p->s.size = nunits;
       }
       freep = prevp;
+      lock_release(&lock);
       return (void*)(p + 1);
     }
     if(p == freep)
-      if((p = morecore(nunits)) == 0)
+      if((p = morecore(nunits)) == 0){
+        lock_release(&lock);
         return 0;
+      }
   }
 }
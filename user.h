@@ -1,5 +1,19 @@
 struct stat;
 struct rtcdate;
+struct iostat;
+struct pstat;
+
+typedef struct {
+  volatile uint locked;
+} lock_t;
+
+typedef struct {
+  volatile uint state;
+} mutex_t;
+
+typedef struct {
+  volatile uint seq;
+} cond_t;
 
 // system calls
 int fork(void);
@@ -23,6 +37,17 @@ int getpid(void);
 char* sbrk(int);
 int sleep(int);
 int uptime(void);
+int setpriority(int, int);
+int settickets(int);
+int getpinfo(struct pstat*);
+int nanosleep(int);
+int clone(void (*)(void*, void*), void*, void*, void*);
+int join(void**);
+int futex_wait(volatile uint*, uint);
+int futex_wake(volatile uint*, int);
+int sched_setaffinity(int, int);
+int sched_getaffinity(int);
+int iostat(struct iostat*);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -37,3 +62,15 @@ void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
 int atoi(const char*);
+void lock_init(lock_t*);
+void lock_acquire(lock_t*);
+void lock_release(lock_t*);
+void mutex_init(mutex_t*);
+void mutex_lock(mutex_t*);
+void mutex_unlock(mutex_t*);
+void cond_init(cond_t*);
+void cond_wait(cond_t*, mutex_t*);
+void cond_signal(cond_t*);
+void cond_broadcast(cond_t*);
+int thread_create(void (*)(void*), void*);
+int thread_join(void);
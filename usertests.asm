@@ -0,0 +1,6834 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(stdout, "thread test ok\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 3e 51 00 00       	push   $0x513e
+      16:	6a 01                	push   $0x1
+      18:	e8 e3 3c 00 00       	call   3d00 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 52 51 00 00       	push   $0x5152
+      26:	e8 73 3b 00 00       	call   3b9e <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 e0 58 00 00       	push   $0x58e0
+      39:	6a 01                	push   $0x1
+      3b:	e8 c0 3c 00 00       	call   3d00 <printf>
+    exit();
+      40:	e8 19 3b 00 00       	call   3b5e <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 52 51 00 00       	push   $0x5152
+      51:	e8 48 3b 00 00       	call   3b9e <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 28 3b 00 00       	call   3b86 <close>
+
+  argptest();
+      5e:	e8 5d 37 00 00       	call   37c0 <argptest>
+  createdelete();
+      63:	e8 28 12 00 00       	call   1290 <createdelete>
+  linkunlink();
+      68:	e8 c3 1a 00 00       	call   1b30 <linkunlink>
+  concreate();
+      6d:	e8 be 17 00 00       	call   1830 <concreate>
+  fourfiles();
+      72:	e8 19 10 00 00       	call   1090 <fourfiles>
+  sharedfd();
+      77:	e8 54 0e 00 00       	call   ed0 <sharedfd>
+
+  bigargtest();
+      7c:	e8 ff 33 00 00       	call   3480 <bigargtest>
+  bigwrite();
+      81:	e8 ca 23 00 00       	call   2450 <bigwrite>
+  bigargtest();
+      86:	e8 f5 33 00 00       	call   3480 <bigargtest>
+  bsstest();
+      8b:	e8 80 33 00 00       	call   3410 <bsstest>
+  sbrktest();
+      90:	e8 fb 2c 00 00       	call   2d90 <sbrktest>
+  validatetest();
+      95:	e8 c6 32 00 00       	call   3360 <validatetest>
+
+  opentest();
+      9a:	e8 b1 03 00 00       	call   450 <opentest>
+  writetest();
+      9f:	e8 3c 04 00 00       	call   4e0 <writetest>
+  writetest1();
+      a4:	e8 17 06 00 00       	call   6c0 <writetest1>
+  createtest();
+      a9:	e8 e2 07 00 00       	call   890 <createtest>
+
+  openiputtest();
+      ae:	e8 9d 02 00 00       	call   350 <openiputtest>
+  exitiputtest();
+      b3:	e8 98 01 00 00       	call   250 <exitiputtest>
+  iputtest();
+      b8:	e8 b3 00 00 00       	call   170 <iputtest>
+
+  mem();
+      bd:	e8 2e 0d 00 00       	call   df0 <mem>
+  pipe1();
+      c2:	e8 a9 09 00 00       	call   a70 <pipe1>
+  preempt();
+      c7:	e8 44 0b 00 00       	call   c10 <preempt>
+  exitwait();
+      cc:	e8 9f 0c 00 00       	call   d70 <exitwait>
+
+  rmdot();
+      d1:	e8 6a 27 00 00       	call   2840 <rmdot>
+  fourteen();
+      d6:	e8 25 26 00 00       	call   2700 <fourteen>
+  bigfile();
+      db:	e8 50 24 00 00       	call   2530 <bigfile>
+  subdir();
+      e0:	e8 8b 1c 00 00       	call   1d70 <subdir>
+  linktest();
+      e5:	e8 36 15 00 00       	call   1620 <linktest>
+  unlinkread();
+      ea:	e8 a1 13 00 00       	call   1490 <unlinkread>
+  dirfile();
+      ef:	e8 cc 28 00 00       	call   29c0 <dirfile>
+  iref();
+      f4:	e8 c7 2a 00 00       	call   2bc0 <iref>
+  forktest();
+      f9:	e8 e2 2b 00 00       	call   2ce0 <forktest>
+  threadtest();
+      fe:	e8 4d 37 00 00       	call   3850 <threadtest>
+  bigdir(); // slow
+     103:	e8 38 1b 00 00       	call   1c40 <bigdir>
+
+  uio();
+     108:	e8 43 36 00 00       	call   3750 <uio>
+
+  exectest();
+     10d:	e8 0e 09 00 00       	call   a20 <exectest>
+
+  exit();
+     112:	e8 47 3a 00 00       	call   3b5e <exit>
+     117:	66 90                	xchg   %ax,%ax
+     119:	66 90                	xchg   %ax,%ax
+     11b:	66 90                	xchg   %ax,%ax
+     11d:	66 90                	xchg   %ax,%ax
+     11f:	90                   	nop
+
+00000120 <threadinc>:
+{
+     120:	55                   	push   %ebp
+     121:	89 e5                	mov    %esp,%ebp
+     123:	53                   	push   %ebx
+     124:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+     129:	83 ec 04             	sub    $0x4,%esp
+     12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    lock_acquire(&tlock);
+     130:	83 ec 0c             	sub    $0xc,%esp
+     133:	68 80 62 00 00       	push   $0x6280
+     138:	e8 c3 38 00 00       	call   3a00 <lock_acquire>
+    tcount++;
+     13d:	83 05 84 62 00 00 01 	addl   $0x1,0x6284
+    lock_release(&tlock);
+     144:	c7 04 24 80 62 00 00 	movl   $0x6280,(%esp)
+     14b:	e8 d0 38 00 00       	call   3a20 <lock_release>
+  for(i = 0; i < 1000; i++){
+     150:	83 c4 10             	add    $0x10,%esp
+     153:	83 eb 01             	sub    $0x1,%ebx
+     156:	75 d8                	jne    130 <threadinc+0x10>
+  *(int*)arg = getpid();
+     158:	e8 81 3a 00 00       	call   3bde <getpid>
+     15d:	8b 55 08             	mov    0x8(%ebp),%edx
+     160:	89 02                	mov    %eax,(%edx)
+}
+     162:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     165:	c9                   	leave
+     166:	c3                   	ret
+     167:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     16e:	66 90                	xchg   %ax,%ax
+
+00000170 <iputtest>:
+{
+     170:	55                   	push   %ebp
+     171:	89 e5                	mov    %esp,%ebp
+     173:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     176:	68 0c 41 00 00       	push   $0x410c
+     17b:	ff 35 4c 62 00 00    	push   0x624c
+     181:	e8 7a 3b 00 00       	call   3d00 <printf>
+  if(mkdir("iputdir") < 0){
+     186:	c7 04 24 9f 40 00 00 	movl   $0x409f,(%esp)
+     18d:	e8 34 3a 00 00       	call   3bc6 <mkdir>
+     192:	83 c4 10             	add    $0x10,%esp
+     195:	85 c0                	test   %eax,%eax
+     197:	78 58                	js     1f1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     199:	83 ec 0c             	sub    $0xc,%esp
+     19c:	68 9f 40 00 00       	push   $0x409f
+     1a1:	e8 28 3a 00 00       	call   3bce <chdir>
+     1a6:	83 c4 10             	add    $0x10,%esp
+     1a9:	85 c0                	test   %eax,%eax
+     1ab:	0f 88 85 00 00 00    	js     236 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     1b1:	83 ec 0c             	sub    $0xc,%esp
+     1b4:	68 9c 40 00 00       	push   $0x409c
+     1b9:	e8 f0 39 00 00       	call   3bae <unlink>
+     1be:	83 c4 10             	add    $0x10,%esp
+     1c1:	85 c0                	test   %eax,%eax
+     1c3:	78 5a                	js     21f <iputtest+0xaf>
+  if(chdir("/") < 0){
+     1c5:	83 ec 0c             	sub    $0xc,%esp
+     1c8:	68 c1 40 00 00       	push   $0x40c1
+     1cd:	e8 fc 39 00 00       	call   3bce <chdir>
+     1d2:	83 c4 10             	add    $0x10,%esp
+     1d5:	85 c0                	test   %eax,%eax
+     1d7:	78 2f                	js     208 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     1d9:	83 ec 08             	sub    $0x8,%esp
+     1dc:	68 44 41 00 00       	push   $0x4144
+     1e1:	ff 35 4c 62 00 00    	push   0x624c
+     1e7:	e8 14 3b 00 00       	call   3d00 <printf>
+}
+     1ec:	83 c4 10             	add    $0x10,%esp
+     1ef:	c9                   	leave
+     1f0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     1f1:	50                   	push   %eax
+     1f2:	50                   	push   %eax
+     1f3:	68 78 40 00 00       	push   $0x4078
+     1f8:	ff 35 4c 62 00 00    	push   0x624c
+     1fe:	e8 fd 3a 00 00       	call   3d00 <printf>
+    exit();
+     203:	e8 56 39 00 00       	call   3b5e <exit>
+    printf(stdout, "chdir / failed\n");
+     208:	50                   	push   %eax
+     209:	50                   	push   %eax
+     20a:	68 c3 40 00 00       	push   $0x40c3
+     20f:	ff 35 4c 62 00 00    	push   0x624c
+     215:	e8 e6 3a 00 00       	call   3d00 <printf>
+    exit();
+     21a:	e8 3f 39 00 00       	call   3b5e <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     21f:	52                   	push   %edx
+     220:	52                   	push   %edx
+     221:	68 a7 40 00 00       	push   $0x40a7
+     226:	ff 35 4c 62 00 00    	push   0x624c
+     22c:	e8 cf 3a 00 00       	call   3d00 <printf>
+    exit();
+     231:	e8 28 39 00 00       	call   3b5e <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     236:	51                   	push   %ecx
+     237:	51                   	push   %ecx
+     238:	68 86 40 00 00       	push   $0x4086
+     23d:	ff 35 4c 62 00 00    	push   0x624c
+     243:	e8 b8 3a 00 00       	call   3d00 <printf>
+    exit();
+     248:	e8 11 39 00 00       	call   3b5e <exit>
+     24d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000250 <exitiputtest>:
+{
+     250:	55                   	push   %ebp
+     251:	89 e5                	mov    %esp,%ebp
+     253:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     256:	68 d3 40 00 00       	push   $0x40d3
+     25b:	ff 35 4c 62 00 00    	push   0x624c
+     261:	e8 9a 3a 00 00       	call   3d00 <printf>
+  pid = fork();
+     266:	e8 eb 38 00 00       	call   3b56 <fork>
+  if(pid < 0){
+     26b:	83 c4 10             	add    $0x10,%esp
+     26e:	85 c0                	test   %eax,%eax
+     270:	0f 88 8a 00 00 00    	js     300 <exitiputtest+0xb0>
+  if(pid == 0){
+     276:	75 50                	jne    2c8 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     278:	83 ec 0c             	sub    $0xc,%esp
+     27b:	68 9f 40 00 00       	push   $0x409f
+     280:	e8 41 39 00 00       	call   3bc6 <mkdir>
+     285:	83 c4 10             	add    $0x10,%esp
+     288:	85 c0                	test   %eax,%eax
+     28a:	0f 88 87 00 00 00    	js     317 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     290:	83 ec 0c             	sub    $0xc,%esp
+     293:	68 9f 40 00 00       	push   $0x409f
+     298:	e8 31 39 00 00       	call   3bce <chdir>
+     29d:	83 c4 10             	add    $0x10,%esp
+     2a0:	85 c0                	test   %eax,%eax
+     2a2:	0f 88 86 00 00 00    	js     32e <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     2a8:	83 ec 0c             	sub    $0xc,%esp
+     2ab:	68 9c 40 00 00       	push   $0x409c
+     2b0:	e8 f9 38 00 00       	call   3bae <unlink>
+     2b5:	83 c4 10             	add    $0x10,%esp
+     2b8:	85 c0                	test   %eax,%eax
+     2ba:	78 2c                	js     2e8 <exitiputtest+0x98>
+    exit();
+     2bc:	e8 9d 38 00 00       	call   3b5e <exit>
+     2c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     2c8:	e8 99 38 00 00       	call   3b66 <wait>
+  printf(stdout, "exitiput test ok\n");
+     2cd:	83 ec 08             	sub    $0x8,%esp
+     2d0:	68 f6 40 00 00       	push   $0x40f6
+     2d5:	ff 35 4c 62 00 00    	push   0x624c
+     2db:	e8 20 3a 00 00       	call   3d00 <printf>
+}
+     2e0:	83 c4 10             	add    $0x10,%esp
+     2e3:	c9                   	leave
+     2e4:	c3                   	ret
+     2e5:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     2e8:	83 ec 08             	sub    $0x8,%esp
+     2eb:	68 a7 40 00 00       	push   $0x40a7
+     2f0:	ff 35 4c 62 00 00    	push   0x624c
+     2f6:	e8 05 3a 00 00       	call   3d00 <printf>
+      exit();
+     2fb:	e8 5e 38 00 00       	call   3b5e <exit>
+    printf(stdout, "fork failed\n");
+     300:	51                   	push   %ecx
+     301:	51                   	push   %ecx
+     302:	68 fc 4f 00 00       	push   $0x4ffc
+     307:	ff 35 4c 62 00 00    	push   0x624c
+     30d:	e8 ee 39 00 00       	call   3d00 <printf>
+    exit();
+     312:	e8 47 38 00 00       	call   3b5e <exit>
+      printf(stdout, "mkdir failed\n");
+     317:	52                   	push   %edx
+     318:	52                   	push   %edx
+     319:	68 78 40 00 00       	push   $0x4078
+     31e:	ff 35 4c 62 00 00    	push   0x624c
+     324:	e8 d7 39 00 00       	call   3d00 <printf>
+      exit();
+     329:	e8 30 38 00 00       	call   3b5e <exit>
+      printf(stdout, "child chdir failed\n");
+     32e:	50                   	push   %eax
+     32f:	50                   	push   %eax
+     330:	68 e2 40 00 00       	push   $0x40e2
+     335:	ff 35 4c 62 00 00    	push   0x624c
+     33b:	e8 c0 39 00 00       	call   3d00 <printf>
+      exit();
+     340:	e8 19 38 00 00       	call   3b5e <exit>
+     345:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <openiputtest>:
+{
+     350:	55                   	push   %ebp
+     351:	89 e5                	mov    %esp,%ebp
+     353:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     356:	68 08 41 00 00       	push   $0x4108
+     35b:	ff 35 4c 62 00 00    	push   0x624c
+     361:	e8 9a 39 00 00       	call   3d00 <printf>
+  if(mkdir("oidir") < 0){
+     366:	c7 04 24 17 41 00 00 	movl   $0x4117,(%esp)
+     36d:	e8 54 38 00 00       	call   3bc6 <mkdir>
+     372:	83 c4 10             	add    $0x10,%esp
+     375:	85 c0                	test   %eax,%eax
+     377:	0f 88 9f 00 00 00    	js     41c <openiputtest+0xcc>
+  pid = fork();
+     37d:	e8 d4 37 00 00       	call   3b56 <fork>
+  if(pid < 0){
+     382:	85 c0                	test   %eax,%eax
+     384:	78 7f                	js     405 <openiputtest+0xb5>
+  if(pid == 0){
+     386:	75 38                	jne    3c0 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     388:	83 ec 08             	sub    $0x8,%esp
+     38b:	6a 02                	push   $0x2
+     38d:	68 17 41 00 00       	push   $0x4117
+     392:	e8 07 38 00 00       	call   3b9e <open>
+    if(fd >= 0){
+     397:	83 c4 10             	add    $0x10,%esp
+     39a:	85 c0                	test   %eax,%eax
+     39c:	78 62                	js     400 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     39e:	83 ec 08             	sub    $0x8,%esp
+     3a1:	68 74 51 00 00       	push   $0x5174
+     3a6:	ff 35 4c 62 00 00    	push   0x624c
+     3ac:	e8 4f 39 00 00       	call   3d00 <printf>
+      exit();
+     3b1:	e8 a8 37 00 00       	call   3b5e <exit>
+     3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3bd:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     3c0:	83 ec 0c             	sub    $0xc,%esp
+     3c3:	6a 01                	push   $0x1
+     3c5:	e8 24 38 00 00       	call   3bee <sleep>
+  if(unlink("oidir") != 0){
+     3ca:	c7 04 24 17 41 00 00 	movl   $0x4117,(%esp)
+     3d1:	e8 d8 37 00 00       	call   3bae <unlink>
+     3d6:	83 c4 10             	add    $0x10,%esp
+     3d9:	85 c0                	test   %eax,%eax
+     3db:	75 56                	jne    433 <openiputtest+0xe3>
+  wait();
+     3dd:	e8 84 37 00 00       	call   3b66 <wait>
+  printf(stdout, "openiput test ok\n");
+     3e2:	83 ec 08             	sub    $0x8,%esp
+     3e5:	68 40 41 00 00       	push   $0x4140
+     3ea:	ff 35 4c 62 00 00    	push   0x624c
+     3f0:	e8 0b 39 00 00       	call   3d00 <printf>
+}
+     3f5:	83 c4 10             	add    $0x10,%esp
+     3f8:	c9                   	leave
+     3f9:	c3                   	ret
+     3fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     400:	e8 59 37 00 00       	call   3b5e <exit>
+    printf(stdout, "fork failed\n");
+     405:	52                   	push   %edx
+     406:	52                   	push   %edx
+     407:	68 fc 4f 00 00       	push   $0x4ffc
+     40c:	ff 35 4c 62 00 00    	push   0x624c
+     412:	e8 e9 38 00 00       	call   3d00 <printf>
+    exit();
+     417:	e8 42 37 00 00       	call   3b5e <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     41c:	51                   	push   %ecx
+     41d:	51                   	push   %ecx
+     41e:	68 1d 41 00 00       	push   $0x411d
+     423:	ff 35 4c 62 00 00    	push   0x624c
+     429:	e8 d2 38 00 00       	call   3d00 <printf>
+    exit();
+     42e:	e8 2b 37 00 00       	call   3b5e <exit>
+    printf(stdout, "unlink failed\n");
+     433:	50                   	push   %eax
+     434:	50                   	push   %eax
+     435:	68 31 41 00 00       	push   $0x4131
+     43a:	ff 35 4c 62 00 00    	push   0x624c
+     440:	e8 bb 38 00 00       	call   3d00 <printf>
+    exit();
+     445:	e8 14 37 00 00       	call   3b5e <exit>
+     44a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000450 <opentest>:
+{
+     450:	55                   	push   %ebp
+     451:	89 e5                	mov    %esp,%ebp
+     453:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     456:	68 52 41 00 00       	push   $0x4152
+     45b:	ff 35 4c 62 00 00    	push   0x624c
+     461:	e8 9a 38 00 00       	call   3d00 <printf>
+  fd = open("echo", 0);
+     466:	58                   	pop    %eax
+     467:	5a                   	pop    %edx
+     468:	6a 00                	push   $0x0
+     46a:	68 5d 41 00 00       	push   $0x415d
+     46f:	e8 2a 37 00 00       	call   3b9e <open>
+  if(fd < 0){
+     474:	83 c4 10             	add    $0x10,%esp
+     477:	85 c0                	test   %eax,%eax
+     479:	78 36                	js     4b1 <opentest+0x61>
+  close(fd);
+     47b:	83 ec 0c             	sub    $0xc,%esp
+     47e:	50                   	push   %eax
+     47f:	e8 02 37 00 00       	call   3b86 <close>
+  fd = open("doesnotexist", 0);
+     484:	5a                   	pop    %edx
+     485:	59                   	pop    %ecx
+     486:	6a 00                	push   $0x0
+     488:	68 75 41 00 00       	push   $0x4175
+     48d:	e8 0c 37 00 00       	call   3b9e <open>
+  if(fd >= 0){
+     492:	83 c4 10             	add    $0x10,%esp
+     495:	85 c0                	test   %eax,%eax
+     497:	79 2f                	jns    4c8 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     499:	83 ec 08             	sub    $0x8,%esp
+     49c:	68 a0 41 00 00       	push   $0x41a0
+     4a1:	ff 35 4c 62 00 00    	push   0x624c
+     4a7:	e8 54 38 00 00       	call   3d00 <printf>
+}
+     4ac:	83 c4 10             	add    $0x10,%esp
+     4af:	c9                   	leave
+     4b0:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     4b1:	50                   	push   %eax
+     4b2:	50                   	push   %eax
+     4b3:	68 62 41 00 00       	push   $0x4162
+     4b8:	ff 35 4c 62 00 00    	push   0x624c
+     4be:	e8 3d 38 00 00       	call   3d00 <printf>
+    exit();
+     4c3:	e8 96 36 00 00       	call   3b5e <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     4c8:	50                   	push   %eax
+     4c9:	50                   	push   %eax
+     4ca:	68 82 41 00 00       	push   $0x4182
+     4cf:	ff 35 4c 62 00 00    	push   0x624c
+     4d5:	e8 26 38 00 00       	call   3d00 <printf>
+    exit();
+     4da:	e8 7f 36 00 00       	call   3b5e <exit>
+     4df:	90                   	nop
+
+000004e0 <writetest>:
+{
+     4e0:	55                   	push   %ebp
+     4e1:	89 e5                	mov    %esp,%ebp
+     4e3:	56                   	push   %esi
+     4e4:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     4e5:	83 ec 08             	sub    $0x8,%esp
+     4e8:	68 ae 41 00 00       	push   $0x41ae
+     4ed:	ff 35 4c 62 00 00    	push   0x624c
+     4f3:	e8 08 38 00 00       	call   3d00 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     4f8:	58                   	pop    %eax
+     4f9:	5a                   	pop    %edx
+     4fa:	68 02 02 00 00       	push   $0x202
+     4ff:	68 bf 41 00 00       	push   $0x41bf
+     504:	e8 95 36 00 00       	call   3b9e <open>
+  if(fd >= 0){
+     509:	83 c4 10             	add    $0x10,%esp
+     50c:	85 c0                	test   %eax,%eax
+     50e:	0f 88 88 01 00 00    	js     69c <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     514:	83 ec 08             	sub    $0x8,%esp
+     517:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     519:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     51b:	68 c5 41 00 00       	push   $0x41c5
+     520:	ff 35 4c 62 00 00    	push   0x624c
+     526:	e8 d5 37 00 00       	call   3d00 <printf>
+     52b:	83 c4 10             	add    $0x10,%esp
+     52e:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     530:	83 ec 04             	sub    $0x4,%esp
+     533:	6a 0a                	push   $0xa
+     535:	68 fc 41 00 00       	push   $0x41fc
+     53a:	56                   	push   %esi
+     53b:	e8 3e 36 00 00       	call   3b7e <write>
+     540:	83 c4 10             	add    $0x10,%esp
+     543:	83 f8 0a             	cmp    $0xa,%eax
+     546:	0f 85 d9 00 00 00    	jne    625 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     54c:	83 ec 04             	sub    $0x4,%esp
+     54f:	6a 0a                	push   $0xa
+     551:	68 07 42 00 00       	push   $0x4207
+     556:	56                   	push   %esi
+     557:	e8 22 36 00 00       	call   3b7e <write>
+     55c:	83 c4 10             	add    $0x10,%esp
+     55f:	83 f8 0a             	cmp    $0xa,%eax
+     562:	0f 85 d6 00 00 00    	jne    63e <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     568:	83 c3 01             	add    $0x1,%ebx
+     56b:	83 fb 64             	cmp    $0x64,%ebx
+     56e:	75 c0                	jne    530 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     570:	83 ec 08             	sub    $0x8,%esp
+     573:	68 12 42 00 00       	push   $0x4212
+     578:	ff 35 4c 62 00 00    	push   0x624c
+     57e:	e8 7d 37 00 00       	call   3d00 <printf>
+  close(fd);
+     583:	89 34 24             	mov    %esi,(%esp)
+     586:	e8 fb 35 00 00       	call   3b86 <close>
+  fd = open("small", O_RDONLY);
+     58b:	5b                   	pop    %ebx
+     58c:	5e                   	pop    %esi
+     58d:	6a 00                	push   $0x0
+     58f:	68 bf 41 00 00       	push   $0x41bf
+     594:	e8 05 36 00 00       	call   3b9e <open>
+  if(fd >= 0){
+     599:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     59c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     59e:	85 c0                	test   %eax,%eax
+     5a0:	0f 88 b1 00 00 00    	js     657 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     5a6:	83 ec 08             	sub    $0x8,%esp
+     5a9:	68 1d 42 00 00       	push   $0x421d
+     5ae:	ff 35 4c 62 00 00    	push   0x624c
+     5b4:	e8 47 37 00 00       	call   3d00 <printf>
+  i = read(fd, buf, 2000);
+     5b9:	83 c4 0c             	add    $0xc,%esp
+     5bc:	68 d0 07 00 00       	push   $0x7d0
+     5c1:	68 c0 89 00 00       	push   $0x89c0
+     5c6:	53                   	push   %ebx
+     5c7:	e8 aa 35 00 00       	call   3b76 <read>
+  if(i == 2000){
+     5cc:	83 c4 10             	add    $0x10,%esp
+     5cf:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     5d4:	0f 85 94 00 00 00    	jne    66e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     5da:	83 ec 08             	sub    $0x8,%esp
+     5dd:	68 51 42 00 00       	push   $0x4251
+     5e2:	ff 35 4c 62 00 00    	push   0x624c
+     5e8:	e8 13 37 00 00       	call   3d00 <printf>
+  close(fd);
+     5ed:	89 1c 24             	mov    %ebx,(%esp)
+     5f0:	e8 91 35 00 00       	call   3b86 <close>
+  if(unlink("small") < 0){
+     5f5:	c7 04 24 bf 41 00 00 	movl   $0x41bf,(%esp)
+     5fc:	e8 ad 35 00 00       	call   3bae <unlink>
+     601:	83 c4 10             	add    $0x10,%esp
+     604:	85 c0                	test   %eax,%eax
+     606:	78 7d                	js     685 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     608:	83 ec 08             	sub    $0x8,%esp
+     60b:	68 79 42 00 00       	push   $0x4279
+     610:	ff 35 4c 62 00 00    	push   0x624c
+     616:	e8 e5 36 00 00       	call   3d00 <printf>
+}
+     61b:	83 c4 10             	add    $0x10,%esp
+     61e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     621:	5b                   	pop    %ebx
+     622:	5e                   	pop    %esi
+     623:	5d                   	pop    %ebp
+     624:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     625:	83 ec 04             	sub    $0x4,%esp
+     628:	53                   	push   %ebx
+     629:	68 98 51 00 00       	push   $0x5198
+     62e:	ff 35 4c 62 00 00    	push   0x624c
+     634:	e8 c7 36 00 00       	call   3d00 <printf>
+      exit();
+     639:	e8 20 35 00 00       	call   3b5e <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     63e:	83 ec 04             	sub    $0x4,%esp
+     641:	53                   	push   %ebx
+     642:	68 bc 51 00 00       	push   $0x51bc
+     647:	ff 35 4c 62 00 00    	push   0x624c
+     64d:	e8 ae 36 00 00       	call   3d00 <printf>
+      exit();
+     652:	e8 07 35 00 00       	call   3b5e <exit>
+    printf(stdout, "error: open small failed!\n");
+     657:	51                   	push   %ecx
+     658:	51                   	push   %ecx
+     659:	68 36 42 00 00       	push   $0x4236
+     65e:	ff 35 4c 62 00 00    	push   0x624c
+     664:	e8 97 36 00 00       	call   3d00 <printf>
+    exit();
+     669:	e8 f0 34 00 00       	call   3b5e <exit>
+    printf(stdout, "read failed\n");
+     66e:	52                   	push   %edx
+     66f:	52                   	push   %edx
+     670:	68 7d 45 00 00       	push   $0x457d
+     675:	ff 35 4c 62 00 00    	push   0x624c
+     67b:	e8 80 36 00 00       	call   3d00 <printf>
+    exit();
+     680:	e8 d9 34 00 00       	call   3b5e <exit>
+    printf(stdout, "unlink small failed\n");
+     685:	50                   	push   %eax
+     686:	50                   	push   %eax
+     687:	68 64 42 00 00       	push   $0x4264
+     68c:	ff 35 4c 62 00 00    	push   0x624c
+     692:	e8 69 36 00 00       	call   3d00 <printf>
+    exit();
+     697:	e8 c2 34 00 00       	call   3b5e <exit>
+    printf(stdout, "error: creat small failed!\n");
+     69c:	50                   	push   %eax
+     69d:	50                   	push   %eax
+     69e:	68 e0 41 00 00       	push   $0x41e0
+     6a3:	ff 35 4c 62 00 00    	push   0x624c
+     6a9:	e8 52 36 00 00       	call   3d00 <printf>
+    exit();
+     6ae:	e8 ab 34 00 00       	call   3b5e <exit>
+     6b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006c0 <writetest1>:
+{
+     6c0:	55                   	push   %ebp
+     6c1:	89 e5                	mov    %esp,%ebp
+     6c3:	56                   	push   %esi
+     6c4:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     6c5:	83 ec 08             	sub    $0x8,%esp
+     6c8:	68 8d 42 00 00       	push   $0x428d
+     6cd:	ff 35 4c 62 00 00    	push   0x624c
+     6d3:	e8 28 36 00 00       	call   3d00 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     6d8:	58                   	pop    %eax
+     6d9:	5a                   	pop    %edx
+     6da:	68 02 02 00 00       	push   $0x202
+     6df:	68 07 43 00 00       	push   $0x4307
+     6e4:	e8 b5 34 00 00       	call   3b9e <open>
+  if(fd < 0){
+     6e9:	83 c4 10             	add    $0x10,%esp
+     6ec:	85 c0                	test   %eax,%eax
+     6ee:	0f 88 61 01 00 00    	js     855 <writetest1+0x195>
+     6f4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < MAXFILE; i++){
+     6f6:	31 db                	xor    %ebx,%ebx
+     6f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ff:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     700:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     703:	89 1d c0 89 00 00    	mov    %ebx,0x89c0
+    if(write(fd, buf, 512) != 512){
+     709:	68 00 02 00 00       	push   $0x200
+     70e:	68 c0 89 00 00       	push   $0x89c0
+     713:	56                   	push   %esi
+     714:	e8 65 34 00 00       	call   3b7e <write>
+     719:	83 c4 10             	add    $0x10,%esp
+     71c:	3d 00 02 00 00       	cmp    $0x200,%eax
+     721:	0f 85 b3 00 00 00    	jne    7da <writetest1+0x11a>
+  for(i = 0; i < MAXFILE; i++){
+     727:	83 c3 01             	add    $0x1,%ebx
+     72a:	81 fb 8c 00 00 00    	cmp    $0x8c,%ebx
+     730:	75 ce                	jne    700 <writetest1+0x40>
+  close(fd);
+     732:	83 ec 0c             	sub    $0xc,%esp
+     735:	56                   	push   %esi
+     736:	e8 4b 34 00 00       	call   3b86 <close>
+  fd = open("big", O_RDONLY);
+     73b:	5b                   	pop    %ebx
+     73c:	5e                   	pop    %esi
+     73d:	6a 00                	push   $0x0
+     73f:	68 07 43 00 00       	push   $0x4307
+     744:	e8 55 34 00 00       	call   3b9e <open>
+  if(fd < 0){
+     749:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     74c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     74e:	85 c0                	test   %eax,%eax
+     750:	0f 88 e8 00 00 00    	js     83e <writetest1+0x17e>
+  n = 0;
+     756:	31 f6                	xor    %esi,%esi
+     758:	eb 1d                	jmp    777 <writetest1+0xb7>
+     75a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     760:	3d 00 02 00 00       	cmp    $0x200,%eax
+     765:	0f 85 9f 00 00 00    	jne    80a <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     76b:	a1 c0 89 00 00       	mov    0x89c0,%eax
+     770:	39 f0                	cmp    %esi,%eax
+     772:	75 7f                	jne    7f3 <writetest1+0x133>
+    n++;
+     774:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     777:	83 ec 04             	sub    $0x4,%esp
+     77a:	68 00 02 00 00       	push   $0x200
+     77f:	68 c0 89 00 00       	push   $0x89c0
+     784:	53                   	push   %ebx
+     785:	e8 ec 33 00 00       	call   3b76 <read>
+    if(i == 0){
+     78a:	83 c4 10             	add    $0x10,%esp
+     78d:	85 c0                	test   %eax,%eax
+     78f:	75 cf                	jne    760 <writetest1+0xa0>
+      if(n == MAXFILE - 1){
+     791:	81 fe 8b 00 00 00    	cmp    $0x8b,%esi
+     797:	0f 84 86 00 00 00    	je     823 <writetest1+0x163>
+  close(fd);
+     79d:	83 ec 0c             	sub    $0xc,%esp
+     7a0:	53                   	push   %ebx
+     7a1:	e8 e0 33 00 00       	call   3b86 <close>
+  if(unlink("big") < 0){
+     7a6:	c7 04 24 07 43 00 00 	movl   $0x4307,(%esp)
+     7ad:	e8 fc 33 00 00       	call   3bae <unlink>
+     7b2:	83 c4 10             	add    $0x10,%esp
+     7b5:	85 c0                	test   %eax,%eax
+     7b7:	0f 88 af 00 00 00    	js     86c <writetest1+0x1ac>
+  printf(stdout, "big files ok\n");
+     7bd:	83 ec 08             	sub    $0x8,%esp
+     7c0:	68 2e 43 00 00       	push   $0x432e
+     7c5:	ff 35 4c 62 00 00    	push   0x624c
+     7cb:	e8 30 35 00 00       	call   3d00 <printf>
+}
+     7d0:	83 c4 10             	add    $0x10,%esp
+     7d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7d6:	5b                   	pop    %ebx
+     7d7:	5e                   	pop    %esi
+     7d8:	5d                   	pop    %ebp
+     7d9:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     7da:	83 ec 04             	sub    $0x4,%esp
+     7dd:	53                   	push   %ebx
+     7de:	68 b7 42 00 00       	push   $0x42b7
+     7e3:	ff 35 4c 62 00 00    	push   0x624c
+     7e9:	e8 12 35 00 00       	call   3d00 <printf>
+      exit();
+     7ee:	e8 6b 33 00 00       	call   3b5e <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     7f3:	50                   	push   %eax
+     7f4:	56                   	push   %esi
+     7f5:	68 e0 51 00 00       	push   $0x51e0
+     7fa:	ff 35 4c 62 00 00    	push   0x624c
+     800:	e8 fb 34 00 00       	call   3d00 <printf>
+      exit();
+     805:	e8 54 33 00 00       	call   3b5e <exit>
+      printf(stdout, "read failed %d\n", i);
+     80a:	83 ec 04             	sub    $0x4,%esp
+     80d:	50                   	push   %eax
+     80e:	68 0b 43 00 00       	push   $0x430b
+     813:	ff 35 4c 62 00 00    	push   0x624c
+     819:	e8 e2 34 00 00       	call   3d00 <printf>
+      exit();
+     81e:	e8 3b 33 00 00       	call   3b5e <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     823:	52                   	push   %edx
+     824:	68 8b 00 00 00       	push   $0x8b
+     829:	68 ee 42 00 00       	push   $0x42ee
+     82e:	ff 35 4c 62 00 00    	push   0x624c
+     834:	e8 c7 34 00 00       	call   3d00 <printf>
+        exit();
+     839:	e8 20 33 00 00       	call   3b5e <exit>
+    printf(stdout, "error: open big failed!\n");
+     83e:	51                   	push   %ecx
+     83f:	51                   	push   %ecx
+     840:	68 d5 42 00 00       	push   $0x42d5
+     845:	ff 35 4c 62 00 00    	push   0x624c
+     84b:	e8 b0 34 00 00       	call   3d00 <printf>
+    exit();
+     850:	e8 09 33 00 00       	call   3b5e <exit>
+    printf(stdout, "error: creat big failed!\n");
+     855:	50                   	push   %eax
+     856:	50                   	push   %eax
+     857:	68 9d 42 00 00       	push   $0x429d
+     85c:	ff 35 4c 62 00 00    	push   0x624c
+     862:	e8 99 34 00 00       	call   3d00 <printf>
+    exit();
+     867:	e8 f2 32 00 00       	call   3b5e <exit>
+    printf(stdout, "unlink big failed\n");
+     86c:	50                   	push   %eax
+     86d:	50                   	push   %eax
+     86e:	68 1b 43 00 00       	push   $0x431b
+     873:	ff 35 4c 62 00 00    	push   0x624c
+     879:	e8 82 34 00 00       	call   3d00 <printf>
+    exit();
+     87e:	e8 db 32 00 00       	call   3b5e <exit>
+     883:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     88a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000890 <createtest>:
+{
+     890:	55                   	push   %ebp
+     891:	89 e5                	mov    %esp,%ebp
+     893:	53                   	push   %ebx
+  name[2] = '\0';
+     894:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     899:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     89c:	68 00 52 00 00       	push   $0x5200
+     8a1:	ff 35 4c 62 00 00    	push   0x624c
+     8a7:	e8 54 34 00 00       	call   3d00 <printf>
+  name[0] = 'a';
+     8ac:	c6 05 b0 89 00 00 61 	movb   $0x61,0x89b0
+  name[2] = '\0';
+     8b3:	83 c4 10             	add    $0x10,%esp
+     8b6:	c6 05 b2 89 00 00 00 	movb   $0x0,0x89b2
+  for(i = 0; i < 52; i++){
+     8bd:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     8c0:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     8c3:	88 1d b1 89 00 00    	mov    %bl,0x89b1
+  for(i = 0; i < 52; i++){
+     8c9:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     8cc:	68 02 02 00 00       	push   $0x202
+     8d1:	68 b0 89 00 00       	push   $0x89b0
+     8d6:	e8 c3 32 00 00       	call   3b9e <open>
+    close(fd);
+     8db:	89 04 24             	mov    %eax,(%esp)
+     8de:	e8 a3 32 00 00       	call   3b86 <close>
+  for(i = 0; i < 52; i++){
+     8e3:	83 c4 10             	add    $0x10,%esp
+     8e6:	80 fb 64             	cmp    $0x64,%bl
+     8e9:	75 d5                	jne    8c0 <createtest+0x30>
+  name[0] = 'a';
+     8eb:	c6 05 b0 89 00 00 61 	movb   $0x61,0x89b0
+  name[2] = '\0';
+     8f2:	bb 30 00 00 00       	mov    $0x30,%ebx
+     8f7:	c6 05 b2 89 00 00 00 	movb   $0x0,0x89b2
+  for(i = 0; i < 52; i++){
+     8fe:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     900:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     903:	88 1d b1 89 00 00    	mov    %bl,0x89b1
+  for(i = 0; i < 52; i++){
+     909:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     90c:	68 b0 89 00 00       	push   $0x89b0
+     911:	e8 98 32 00 00       	call   3bae <unlink>
+  for(i = 0; i < 52; i++){
+     916:	83 c4 10             	add    $0x10,%esp
+     919:	80 fb 64             	cmp    $0x64,%bl
+     91c:	75 e2                	jne    900 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     91e:	83 ec 08             	sub    $0x8,%esp
+     921:	68 28 52 00 00       	push   $0x5228
+     926:	ff 35 4c 62 00 00    	push   0x624c
+     92c:	e8 cf 33 00 00       	call   3d00 <printf>
+}
+     931:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     934:	83 c4 10             	add    $0x10,%esp
+     937:	c9                   	leave
+     938:	c3                   	ret
+     939:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000940 <dirtest>:
+{
+     940:	55                   	push   %ebp
+     941:	89 e5                	mov    %esp,%ebp
+     943:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     946:	68 3c 43 00 00       	push   $0x433c
+     94b:	ff 35 4c 62 00 00    	push   0x624c
+     951:	e8 aa 33 00 00       	call   3d00 <printf>
+  if(mkdir("dir0") < 0){
+     956:	c7 04 24 48 43 00 00 	movl   $0x4348,(%esp)
+     95d:	e8 64 32 00 00       	call   3bc6 <mkdir>
+     962:	83 c4 10             	add    $0x10,%esp
+     965:	85 c0                	test   %eax,%eax
+     967:	78 58                	js     9c1 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     969:	83 ec 0c             	sub    $0xc,%esp
+     96c:	68 48 43 00 00       	push   $0x4348
+     971:	e8 58 32 00 00       	call   3bce <chdir>
+     976:	83 c4 10             	add    $0x10,%esp
+     979:	85 c0                	test   %eax,%eax
+     97b:	0f 88 85 00 00 00    	js     a06 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     981:	83 ec 0c             	sub    $0xc,%esp
+     984:	68 ed 48 00 00       	push   $0x48ed
+     989:	e8 40 32 00 00       	call   3bce <chdir>
+     98e:	83 c4 10             	add    $0x10,%esp
+     991:	85 c0                	test   %eax,%eax
+     993:	78 5a                	js     9ef <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     995:	83 ec 0c             	sub    $0xc,%esp
+     998:	68 48 43 00 00       	push   $0x4348
+     99d:	e8 0c 32 00 00       	call   3bae <unlink>
+     9a2:	83 c4 10             	add    $0x10,%esp
+     9a5:	85 c0                	test   %eax,%eax
+     9a7:	78 2f                	js     9d8 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     9a9:	83 ec 08             	sub    $0x8,%esp
+     9ac:	68 85 43 00 00       	push   $0x4385
+     9b1:	ff 35 4c 62 00 00    	push   0x624c
+     9b7:	e8 44 33 00 00       	call   3d00 <printf>
+}
+     9bc:	83 c4 10             	add    $0x10,%esp
+     9bf:	c9                   	leave
+     9c0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     9c1:	50                   	push   %eax
+     9c2:	50                   	push   %eax
+     9c3:	68 78 40 00 00       	push   $0x4078
+     9c8:	ff 35 4c 62 00 00    	push   0x624c
+     9ce:	e8 2d 33 00 00       	call   3d00 <printf>
+    exit();
+     9d3:	e8 86 31 00 00       	call   3b5e <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     9d8:	50                   	push   %eax
+     9d9:	50                   	push   %eax
+     9da:	68 71 43 00 00       	push   $0x4371
+     9df:	ff 35 4c 62 00 00    	push   0x624c
+     9e5:	e8 16 33 00 00       	call   3d00 <printf>
+    exit();
+     9ea:	e8 6f 31 00 00       	call   3b5e <exit>
+    printf(stdout, "chdir .. failed\n");
+     9ef:	52                   	push   %edx
+     9f0:	52                   	push   %edx
+     9f1:	68 60 43 00 00       	push   $0x4360
+     9f6:	ff 35 4c 62 00 00    	push   0x624c
+     9fc:	e8 ff 32 00 00       	call   3d00 <printf>
+    exit();
+     a01:	e8 58 31 00 00       	call   3b5e <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     a06:	51                   	push   %ecx
+     a07:	51                   	push   %ecx
+     a08:	68 4d 43 00 00       	push   $0x434d
+     a0d:	ff 35 4c 62 00 00    	push   0x624c
+     a13:	e8 e8 32 00 00       	call   3d00 <printf>
+    exit();
+     a18:	e8 41 31 00 00       	call   3b5e <exit>
+     a1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a20 <exectest>:
+{
+     a20:	55                   	push   %ebp
+     a21:	89 e5                	mov    %esp,%ebp
+     a23:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     a26:	68 94 43 00 00       	push   $0x4394
+     a2b:	ff 35 4c 62 00 00    	push   0x624c
+     a31:	e8 ca 32 00 00       	call   3d00 <printf>
+  if(exec("echo", echoargv) < 0){
+     a36:	5a                   	pop    %edx
+     a37:	59                   	pop    %ecx
+     a38:	68 50 62 00 00       	push   $0x6250
+     a3d:	68 5d 41 00 00       	push   $0x415d
+     a42:	e8 4f 31 00 00       	call   3b96 <exec>
+     a47:	83 c4 10             	add    $0x10,%esp
+     a4a:	85 c0                	test   %eax,%eax
+     a4c:	78 02                	js     a50 <exectest+0x30>
+}
+     a4e:	c9                   	leave
+     a4f:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     a50:	50                   	push   %eax
+     a51:	50                   	push   %eax
+     a52:	68 9f 43 00 00       	push   $0x439f
+     a57:	ff 35 4c 62 00 00    	push   0x624c
+     a5d:	e8 9e 32 00 00       	call   3d00 <printf>
+    exit();
+     a62:	e8 f7 30 00 00       	call   3b5e <exit>
+     a67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a6e:	66 90                	xchg   %ax,%ax
+
+00000a70 <pipe1>:
+{
+     a70:	55                   	push   %ebp
+     a71:	89 e5                	mov    %esp,%ebp
+     a73:	57                   	push   %edi
+     a74:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     a75:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     a78:	53                   	push   %ebx
+     a79:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     a7c:	50                   	push   %eax
+     a7d:	e8 ec 30 00 00       	call   3b6e <pipe>
+     a82:	83 c4 10             	add    $0x10,%esp
+     a85:	85 c0                	test   %eax,%eax
+     a87:	0f 85 41 01 00 00    	jne    bce <pipe1+0x15e>
+     a8d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     a8f:	e8 c2 30 00 00       	call   3b56 <fork>
+  if(pid == 0){
+     a94:	85 c0                	test   %eax,%eax
+     a96:	0f 84 92 00 00 00    	je     b2e <pipe1+0xbe>
+  } else if(pid > 0){
+     a9c:	0f 8e 3f 01 00 00    	jle    be1 <pipe1+0x171>
+    close(fds[1]);
+     aa2:	83 ec 0c             	sub    $0xc,%esp
+     aa5:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     aa8:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     aaa:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     aaf:	e8 d2 30 00 00       	call   3b86 <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     ab4:	83 c4 10             	add    $0x10,%esp
+     ab7:	83 ec 04             	sub    $0x4,%esp
+     aba:	57                   	push   %edi
+     abb:	68 c0 89 00 00       	push   $0x89c0
+     ac0:	ff 75 e0             	push   -0x20(%ebp)
+     ac3:	e8 ae 30 00 00       	call   3b76 <read>
+     ac8:	83 c4 10             	add    $0x10,%esp
+     acb:	89 c1                	mov    %eax,%ecx
+     acd:	85 c0                	test   %eax,%eax
+     acf:	0f 8e b8 00 00 00    	jle    b8d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     ad5:	89 f0                	mov    %esi,%eax
+     ad7:	32 05 c0 89 00 00    	xor    0x89c0,%al
+     add:	0f b6 c0             	movzbl %al,%eax
+     ae0:	85 c0                	test   %eax,%eax
+     ae2:	75 30                	jne    b14 <pipe1+0xa4>
+     ae4:	83 c6 01             	add    $0x1,%esi
+     ae7:	eb 0f                	jmp    af8 <pipe1+0x88>
+     ae9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     af0:	38 90 c0 89 00 00    	cmp    %dl,0x89c0(%eax)
+     af6:	75 1c                	jne    b14 <pipe1+0xa4>
+     af8:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     afb:	83 c0 01             	add    $0x1,%eax
+     afe:	39 c1                	cmp    %eax,%ecx
+     b00:	75 ee                	jne    af0 <pipe1+0x80>
+      cc = cc * 2;
+     b02:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     b04:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     b09:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     b0b:	89 d6                	mov    %edx,%esi
+     b0d:	39 c7                	cmp    %eax,%edi
+     b0f:	0f 4f f8             	cmovg  %eax,%edi
+     b12:	eb a3                	jmp    ab7 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     b14:	83 ec 08             	sub    $0x8,%esp
+     b17:	68 ce 43 00 00       	push   $0x43ce
+     b1c:	6a 01                	push   $0x1
+     b1e:	e8 dd 31 00 00       	call   3d00 <printf>
+     b23:	83 c4 10             	add    $0x10,%esp
+}
+     b26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b29:	5b                   	pop    %ebx
+     b2a:	5e                   	pop    %esi
+     b2b:	5f                   	pop    %edi
+     b2c:	5d                   	pop    %ebp
+     b2d:	c3                   	ret
+    close(fds[0]);
+     b2e:	83 ec 0c             	sub    $0xc,%esp
+     b31:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     b34:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     b36:	e8 4b 30 00 00       	call   3b86 <close>
+     b3b:	83 c4 10             	add    $0x10,%esp
+     b3e:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     b40:	31 c0                	xor    %eax,%eax
+     b42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     b48:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     b4b:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     b4e:	88 90 bf 89 00 00    	mov    %dl,0x89bf(%eax)
+      for(i = 0; i < 1033; i++)
+     b54:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b59:	75 ed                	jne    b48 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     b5b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     b5e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     b64:	68 09 04 00 00       	push   $0x409
+     b69:	68 c0 89 00 00       	push   $0x89c0
+     b6e:	ff 75 e4             	push   -0x1c(%ebp)
+     b71:	e8 08 30 00 00       	call   3b7e <write>
+     b76:	83 c4 10             	add    $0x10,%esp
+     b79:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b7e:	75 74                	jne    bf4 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     b80:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b86:	75 b8                	jne    b40 <pipe1+0xd0>
+    exit();
+     b88:	e8 d1 2f 00 00       	call   3b5e <exit>
+    if(total != 5 * 1033){
+     b8d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b93:	75 26                	jne    bbb <pipe1+0x14b>
+    close(fds[0]);
+     b95:	83 ec 0c             	sub    $0xc,%esp
+     b98:	ff 75 e0             	push   -0x20(%ebp)
+     b9b:	e8 e6 2f 00 00       	call   3b86 <close>
+    wait();
+     ba0:	e8 c1 2f 00 00       	call   3b66 <wait>
+  printf(1, "pipe1 ok\n");
+     ba5:	5a                   	pop    %edx
+     ba6:	59                   	pop    %ecx
+     ba7:	68 f3 43 00 00       	push   $0x43f3
+     bac:	6a 01                	push   $0x1
+     bae:	e8 4d 31 00 00       	call   3d00 <printf>
+     bb3:	83 c4 10             	add    $0x10,%esp
+     bb6:	e9 6b ff ff ff       	jmp    b26 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     bbb:	56                   	push   %esi
+     bbc:	53                   	push   %ebx
+     bbd:	68 dc 43 00 00       	push   $0x43dc
+     bc2:	6a 01                	push   $0x1
+     bc4:	e8 37 31 00 00       	call   3d00 <printf>
+      exit();
+     bc9:	e8 90 2f 00 00       	call   3b5e <exit>
+    printf(1, "pipe() failed\n");
+     bce:	50                   	push   %eax
+     bcf:	50                   	push   %eax
+     bd0:	68 b1 43 00 00       	push   $0x43b1
+     bd5:	6a 01                	push   $0x1
+     bd7:	e8 24 31 00 00       	call   3d00 <printf>
+    exit();
+     bdc:	e8 7d 2f 00 00       	call   3b5e <exit>
+    printf(1, "fork() failed\n");
+     be1:	50                   	push   %eax
+     be2:	50                   	push   %eax
+     be3:	68 fd 43 00 00       	push   $0x43fd
+     be8:	6a 01                	push   $0x1
+     bea:	e8 11 31 00 00       	call   3d00 <printf>
+    exit();
+     bef:	e8 6a 2f 00 00       	call   3b5e <exit>
+        printf(1, "pipe1 oops 1\n");
+     bf4:	57                   	push   %edi
+     bf5:	57                   	push   %edi
+     bf6:	68 c0 43 00 00       	push   $0x43c0
+     bfb:	6a 01                	push   $0x1
+     bfd:	e8 fe 30 00 00       	call   3d00 <printf>
+        exit();
+     c02:	e8 57 2f 00 00       	call   3b5e <exit>
+     c07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c0e:	66 90                	xchg   %ax,%ax
+
+00000c10 <preempt>:
+{
+     c10:	55                   	push   %ebp
+     c11:	89 e5                	mov    %esp,%ebp
+     c13:	57                   	push   %edi
+     c14:	56                   	push   %esi
+     c15:	53                   	push   %ebx
+     c16:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+     c19:	68 0c 44 00 00       	push   $0x440c
+     c1e:	6a 01                	push   $0x1
+     c20:	e8 db 30 00 00       	call   3d00 <printf>
+  pid1 = fork();
+     c25:	e8 2c 2f 00 00       	call   3b56 <fork>
+  if(pid1 == 0)
+     c2a:	83 c4 10             	add    $0x10,%esp
+     c2d:	85 c0                	test   %eax,%eax
+     c2f:	75 07                	jne    c38 <preempt+0x28>
+    for(;;)
+     c31:	eb fe                	jmp    c31 <preempt+0x21>
+     c33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c37:	90                   	nop
+     c38:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+     c3a:	e8 17 2f 00 00       	call   3b56 <fork>
+     c3f:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     c41:	85 c0                	test   %eax,%eax
+     c43:	75 0b                	jne    c50 <preempt+0x40>
+    for(;;)
+     c45:	eb fe                	jmp    c45 <preempt+0x35>
+     c47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4e:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+     c50:	83 ec 0c             	sub    $0xc,%esp
+     c53:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     c56:	50                   	push   %eax
+     c57:	e8 12 2f 00 00       	call   3b6e <pipe>
+  pid3 = fork();
+     c5c:	e8 f5 2e 00 00       	call   3b56 <fork>
+  if(pid3 == 0){
+     c61:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     c64:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     c66:	85 c0                	test   %eax,%eax
+     c68:	75 3e                	jne    ca8 <preempt+0x98>
+    close(pfds[0]);
+     c6a:	83 ec 0c             	sub    $0xc,%esp
+     c6d:	ff 75 e0             	push   -0x20(%ebp)
+     c70:	e8 11 2f 00 00       	call   3b86 <close>
+    if(write(pfds[1], "x", 1) != 1)
+     c75:	83 c4 0c             	add    $0xc,%esp
+     c78:	6a 01                	push   $0x1
+     c7a:	68 d1 49 00 00       	push   $0x49d1
+     c7f:	ff 75 e4             	push   -0x1c(%ebp)
+     c82:	e8 f7 2e 00 00       	call   3b7e <write>
+     c87:	83 c4 10             	add    $0x10,%esp
+     c8a:	83 f8 01             	cmp    $0x1,%eax
+     c8d:	0f 85 b8 00 00 00    	jne    d4b <preempt+0x13b>
+    close(pfds[1]);
+     c93:	83 ec 0c             	sub    $0xc,%esp
+     c96:	ff 75 e4             	push   -0x1c(%ebp)
+     c99:	e8 e8 2e 00 00       	call   3b86 <close>
+     c9e:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     ca1:	eb fe                	jmp    ca1 <preempt+0x91>
+     ca3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ca7:	90                   	nop
+  close(pfds[1]);
+     ca8:	83 ec 0c             	sub    $0xc,%esp
+     cab:	ff 75 e4             	push   -0x1c(%ebp)
+     cae:	e8 d3 2e 00 00       	call   3b86 <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     cb3:	83 c4 0c             	add    $0xc,%esp
+     cb6:	68 00 20 00 00       	push   $0x2000
+     cbb:	68 c0 89 00 00       	push   $0x89c0
+     cc0:	ff 75 e0             	push   -0x20(%ebp)
+     cc3:	e8 ae 2e 00 00       	call   3b76 <read>
+     cc8:	83 c4 10             	add    $0x10,%esp
+     ccb:	83 f8 01             	cmp    $0x1,%eax
+     cce:	75 67                	jne    d37 <preempt+0x127>
+  close(pfds[0]);
+     cd0:	83 ec 0c             	sub    $0xc,%esp
+     cd3:	ff 75 e0             	push   -0x20(%ebp)
+     cd6:	e8 ab 2e 00 00       	call   3b86 <close>
+  printf(1, "kill... ");
+     cdb:	58                   	pop    %eax
+     cdc:	5a                   	pop    %edx
+     cdd:	68 3d 44 00 00       	push   $0x443d
+     ce2:	6a 01                	push   $0x1
+     ce4:	e8 17 30 00 00       	call   3d00 <printf>
+  kill(pid1);
+     ce9:	89 1c 24             	mov    %ebx,(%esp)
+     cec:	e8 9d 2e 00 00       	call   3b8e <kill>
+  kill(pid2);
+     cf1:	89 34 24             	mov    %esi,(%esp)
+     cf4:	e8 95 2e 00 00       	call   3b8e <kill>
+  kill(pid3);
+     cf9:	89 3c 24             	mov    %edi,(%esp)
+     cfc:	e8 8d 2e 00 00       	call   3b8e <kill>
+  printf(1, "wait... ");
+     d01:	59                   	pop    %ecx
+     d02:	5b                   	pop    %ebx
+     d03:	68 46 44 00 00       	push   $0x4446
+     d08:	6a 01                	push   $0x1
+     d0a:	e8 f1 2f 00 00       	call   3d00 <printf>
+  wait();
+     d0f:	e8 52 2e 00 00       	call   3b66 <wait>
+  wait();
+     d14:	e8 4d 2e 00 00       	call   3b66 <wait>
+  wait();
+     d19:	e8 48 2e 00 00       	call   3b66 <wait>
+  printf(1, "preempt ok\n");
+     d1e:	5e                   	pop    %esi
+     d1f:	5f                   	pop    %edi
+     d20:	68 4f 44 00 00       	push   $0x444f
+     d25:	6a 01                	push   $0x1
+     d27:	e8 d4 2f 00 00       	call   3d00 <printf>
+     d2c:	83 c4 10             	add    $0x10,%esp
+}
+     d2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d32:	5b                   	pop    %ebx
+     d33:	5e                   	pop    %esi
+     d34:	5f                   	pop    %edi
+     d35:	5d                   	pop    %ebp
+     d36:	c3                   	ret
+    printf(1, "preempt read error");
+     d37:	83 ec 08             	sub    $0x8,%esp
+     d3a:	68 2a 44 00 00       	push   $0x442a
+     d3f:	6a 01                	push   $0x1
+     d41:	e8 ba 2f 00 00       	call   3d00 <printf>
+     d46:	83 c4 10             	add    $0x10,%esp
+     d49:	eb e4                	jmp    d2f <preempt+0x11f>
+      printf(1, "preempt write error");
+     d4b:	83 ec 08             	sub    $0x8,%esp
+     d4e:	68 16 44 00 00       	push   $0x4416
+     d53:	6a 01                	push   $0x1
+     d55:	e8 a6 2f 00 00       	call   3d00 <printf>
+     d5a:	83 c4 10             	add    $0x10,%esp
+     d5d:	e9 31 ff ff ff       	jmp    c93 <preempt+0x83>
+     d62:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d70 <exitwait>:
+{
+     d70:	55                   	push   %ebp
+     d71:	89 e5                	mov    %esp,%ebp
+     d73:	56                   	push   %esi
+     d74:	be 64 00 00 00       	mov    $0x64,%esi
+     d79:	53                   	push   %ebx
+     d7a:	eb 14                	jmp    d90 <exitwait+0x20>
+     d7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+     d80:	74 68                	je     dea <exitwait+0x7a>
+      if(wait() != pid){
+     d82:	e8 df 2d 00 00       	call   3b66 <wait>
+     d87:	39 d8                	cmp    %ebx,%eax
+     d89:	75 2d                	jne    db8 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+     d8b:	83 ee 01             	sub    $0x1,%esi
+     d8e:	74 41                	je     dd1 <exitwait+0x61>
+    pid = fork();
+     d90:	e8 c1 2d 00 00       	call   3b56 <fork>
+     d95:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     d97:	85 c0                	test   %eax,%eax
+     d99:	79 e5                	jns    d80 <exitwait+0x10>
+      printf(1, "fork failed\n");
+     d9b:	83 ec 08             	sub    $0x8,%esp
+     d9e:	68 fc 4f 00 00       	push   $0x4ffc
+     da3:	6a 01                	push   $0x1
+     da5:	e8 56 2f 00 00       	call   3d00 <printf>
+      return;
+     daa:	83 c4 10             	add    $0x10,%esp
+}
+     dad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     db0:	5b                   	pop    %ebx
+     db1:	5e                   	pop    %esi
+     db2:	5d                   	pop    %ebp
+     db3:	c3                   	ret
+     db4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+     db8:	83 ec 08             	sub    $0x8,%esp
+     dbb:	68 5b 44 00 00       	push   $0x445b
+     dc0:	6a 01                	push   $0x1
+     dc2:	e8 39 2f 00 00       	call   3d00 <printf>
+        return;
+     dc7:	83 c4 10             	add    $0x10,%esp
+}
+     dca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     dcd:	5b                   	pop    %ebx
+     dce:	5e                   	pop    %esi
+     dcf:	5d                   	pop    %ebp
+     dd0:	c3                   	ret
+  printf(1, "exitwait ok\n");
+     dd1:	83 ec 08             	sub    $0x8,%esp
+     dd4:	68 6b 44 00 00       	push   $0x446b
+     dd9:	6a 01                	push   $0x1
+     ddb:	e8 20 2f 00 00       	call   3d00 <printf>
+     de0:	83 c4 10             	add    $0x10,%esp
+}
+     de3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     de6:	5b                   	pop    %ebx
+     de7:	5e                   	pop    %esi
+     de8:	5d                   	pop    %ebp
+     de9:	c3                   	ret
+      exit();
+     dea:	e8 6f 2d 00 00       	call   3b5e <exit>
+     def:	90                   	nop
+
+00000df0 <mem>:
+{
+     df0:	55                   	push   %ebp
+     df1:	89 e5                	mov    %esp,%ebp
+     df3:	56                   	push   %esi
+     df4:	53                   	push   %ebx
+     df5:	31 db                	xor    %ebx,%ebx
+  printf(1, "mem test\n");
+     df7:	83 ec 08             	sub    $0x8,%esp
+     dfa:	68 78 44 00 00       	push   $0x4478
+     dff:	6a 01                	push   $0x1
+     e01:	e8 fa 2e 00 00       	call   3d00 <printf>
+  ppid = getpid();
+     e06:	e8 d3 2d 00 00       	call   3bde <getpid>
+     e0b:	89 c6                	mov    %eax,%esi
+  if((pid = fork()) == 0){
+     e0d:	e8 44 2d 00 00       	call   3b56 <fork>
+     e12:	83 c4 10             	add    $0x10,%esp
+     e15:	85 c0                	test   %eax,%eax
+     e17:	74 1f                	je     e38 <mem+0x48>
+     e19:	e9 9a 00 00 00       	jmp    eb8 <mem+0xc8>
+     e1e:	66 90                	xchg   %ax,%ax
+    while(sbrk(0) < (char*)(32*1024*1024) && (m2 = malloc(10001)) != 0){
+     e20:	83 ec 0c             	sub    $0xc,%esp
+     e23:	68 11 27 00 00       	push   $0x2711
+     e28:	e8 33 31 00 00       	call   3f60 <malloc>
+     e2d:	83 c4 10             	add    $0x10,%esp
+     e30:	85 c0                	test   %eax,%eax
+     e32:	74 2c                	je     e60 <mem+0x70>
+      *(char**)m2 = m1;
+     e34:	89 18                	mov    %ebx,(%eax)
+     e36:	89 c3                	mov    %eax,%ebx
+    while(sbrk(0) < (char*)(32*1024*1024) && (m2 = malloc(10001)) != 0){
+     e38:	83 ec 0c             	sub    $0xc,%esp
+     e3b:	6a 00                	push   $0x0
+     e3d:	e8 a4 2d 00 00       	call   3be6 <sbrk>
+     e42:	83 c4 10             	add    $0x10,%esp
+     e45:	3d ff ff ff 01       	cmp    $0x1ffffff,%eax
+     e4a:	76 d4                	jbe    e20 <mem+0x30>
+    while(m1){
+     e4c:	85 db                	test   %ebx,%ebx
+     e4e:	74 14                	je     e64 <mem+0x74>
+      m2 = *(char**)m1;
+     e50:	89 d8                	mov    %ebx,%eax
+      free(m1);
+     e52:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+     e55:	8b 1b                	mov    (%ebx),%ebx
+      free(m1);
+     e57:	50                   	push   %eax
+     e58:	e8 d3 30 00 00       	call   3f30 <free>
+    while(m1){
+     e5d:	83 c4 10             	add    $0x10,%esp
+     e60:	85 db                	test   %ebx,%ebx
+     e62:	75 ec                	jne    e50 <mem+0x60>
+    m1 = malloc(1024*20);
+     e64:	83 ec 0c             	sub    $0xc,%esp
+     e67:	68 00 50 00 00       	push   $0x5000
+     e6c:	e8 ef 30 00 00       	call   3f60 <malloc>
+    if(m1 == 0){
+     e71:	83 c4 10             	add    $0x10,%esp
+     e74:	85 c0                	test   %eax,%eax
+     e76:	74 20                	je     e98 <mem+0xa8>
+    free(m1);
+     e78:	83 ec 0c             	sub    $0xc,%esp
+     e7b:	50                   	push   %eax
+     e7c:	e8 af 30 00 00       	call   3f30 <free>
+    printf(1, "mem ok\n");
+     e81:	58                   	pop    %eax
+     e82:	5a                   	pop    %edx
+     e83:	68 9c 44 00 00       	push   $0x449c
+     e88:	6a 01                	push   $0x1
+     e8a:	e8 71 2e 00 00       	call   3d00 <printf>
+    exit();
+     e8f:	e8 ca 2c 00 00       	call   3b5e <exit>
+     e94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+     e98:	83 ec 08             	sub    $0x8,%esp
+     e9b:	68 82 44 00 00       	push   $0x4482
+     ea0:	6a 01                	push   $0x1
+     ea2:	e8 59 2e 00 00       	call   3d00 <printf>
+      kill(ppid);
+     ea7:	89 34 24             	mov    %esi,(%esp)
+     eaa:	e8 df 2c 00 00       	call   3b8e <kill>
+      exit();
+     eaf:	e8 aa 2c 00 00       	call   3b5e <exit>
+     eb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+     eb8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ebb:	5b                   	pop    %ebx
+     ebc:	5e                   	pop    %esi
+     ebd:	5d                   	pop    %ebp
+    wait();
+     ebe:	e9 a3 2c 00 00       	jmp    3b66 <wait>
+     ec3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ed0 <sharedfd>:
+{
+     ed0:	55                   	push   %ebp
+     ed1:	89 e5                	mov    %esp,%ebp
+     ed3:	57                   	push   %edi
+     ed4:	56                   	push   %esi
+     ed5:	53                   	push   %ebx
+     ed6:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+     ed9:	68 a4 44 00 00       	push   $0x44a4
+     ede:	6a 01                	push   $0x1
+     ee0:	e8 1b 2e 00 00       	call   3d00 <printf>
+  unlink("sharedfd");
+     ee5:	c7 04 24 b3 44 00 00 	movl   $0x44b3,(%esp)
+     eec:	e8 bd 2c 00 00       	call   3bae <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+     ef1:	5b                   	pop    %ebx
+     ef2:	5e                   	pop    %esi
+     ef3:	68 02 02 00 00       	push   $0x202
+     ef8:	68 b3 44 00 00       	push   $0x44b3
+     efd:	e8 9c 2c 00 00       	call   3b9e <open>
+  if(fd < 0){
+     f02:	83 c4 10             	add    $0x10,%esp
+     f05:	85 c0                	test   %eax,%eax
+     f07:	0f 88 2a 01 00 00    	js     1037 <sharedfd+0x167>
+     f0d:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     f0f:	8d 75 de             	lea    -0x22(%ebp),%esi
+     f12:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+     f17:	e8 3a 2c 00 00       	call   3b56 <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     f1c:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+     f1f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     f22:	19 c0                	sbb    %eax,%eax
+     f24:	83 ec 04             	sub    $0x4,%esp
+     f27:	83 e0 f3             	and    $0xfffffff3,%eax
+     f2a:	6a 0a                	push   $0xa
+     f2c:	83 c0 70             	add    $0x70,%eax
+     f2f:	50                   	push   %eax
+     f30:	56                   	push   %esi
+     f31:	e8 9a 2a 00 00       	call   39d0 <memset>
+     f36:	83 c4 10             	add    $0x10,%esp
+     f39:	eb 0a                	jmp    f45 <sharedfd+0x75>
+     f3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f3f:	90                   	nop
+  for(i = 0; i < 1000; i++){
+     f40:	83 eb 01             	sub    $0x1,%ebx
+     f43:	74 26                	je     f6b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     f45:	83 ec 04             	sub    $0x4,%esp
+     f48:	6a 0a                	push   $0xa
+     f4a:	56                   	push   %esi
+     f4b:	57                   	push   %edi
+     f4c:	e8 2d 2c 00 00       	call   3b7e <write>
+     f51:	83 c4 10             	add    $0x10,%esp
+     f54:	83 f8 0a             	cmp    $0xa,%eax
+     f57:	74 e7                	je     f40 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+     f59:	83 ec 08             	sub    $0x8,%esp
+     f5c:	68 7c 52 00 00       	push   $0x527c
+     f61:	6a 01                	push   $0x1
+     f63:	e8 98 2d 00 00       	call   3d00 <printf>
+      break;
+     f68:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+     f6b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     f6e:	85 c9                	test   %ecx,%ecx
+     f70:	0f 84 f5 00 00 00    	je     106b <sharedfd+0x19b>
+    wait();
+     f76:	e8 eb 2b 00 00       	call   3b66 <wait>
+  close(fd);
+     f7b:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+     f7e:	31 db                	xor    %ebx,%ebx
+  close(fd);
+     f80:	57                   	push   %edi
+     f81:	8d 7d e8             	lea    -0x18(%ebp),%edi
+     f84:	e8 fd 2b 00 00       	call   3b86 <close>
+  fd = open("sharedfd", 0);
+     f89:	58                   	pop    %eax
+     f8a:	5a                   	pop    %edx
+     f8b:	6a 00                	push   $0x0
+     f8d:	68 b3 44 00 00       	push   $0x44b3
+     f92:	e8 07 2c 00 00       	call   3b9e <open>
+  if(fd < 0){
+     f97:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+     f9a:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+     f9c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+     f9f:	85 c0                	test   %eax,%eax
+     fa1:	0f 88 aa 00 00 00    	js     1051 <sharedfd+0x181>
+     fa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fae:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+     fb0:	83 ec 04             	sub    $0x4,%esp
+     fb3:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     fb6:	6a 0a                	push   $0xa
+     fb8:	56                   	push   %esi
+     fb9:	ff 75 d0             	push   -0x30(%ebp)
+     fbc:	e8 b5 2b 00 00       	call   3b76 <read>
+     fc1:	83 c4 10             	add    $0x10,%esp
+     fc4:	85 c0                	test   %eax,%eax
+     fc6:	7e 28                	jle    ff0 <sharedfd+0x120>
+     fc8:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     fcb:	89 f0                	mov    %esi,%eax
+     fcd:	eb 13                	jmp    fe2 <sharedfd+0x112>
+     fcf:	90                   	nop
+        np++;
+     fd0:	80 f9 70             	cmp    $0x70,%cl
+     fd3:	0f 94 c1             	sete   %cl
+     fd6:	0f b6 c9             	movzbl %cl,%ecx
+     fd9:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+     fdb:	83 c0 01             	add    $0x1,%eax
+     fde:	39 f8                	cmp    %edi,%eax
+     fe0:	74 ce                	je     fb0 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+     fe2:	0f b6 08             	movzbl (%eax),%ecx
+     fe5:	80 f9 63             	cmp    $0x63,%cl
+     fe8:	75 e6                	jne    fd0 <sharedfd+0x100>
+        nc++;
+     fea:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+     fed:	eb ec                	jmp    fdb <sharedfd+0x10b>
+     fef:	90                   	nop
+  close(fd);
+     ff0:	83 ec 0c             	sub    $0xc,%esp
+     ff3:	ff 75 d0             	push   -0x30(%ebp)
+     ff6:	e8 8b 2b 00 00       	call   3b86 <close>
+  unlink("sharedfd");
+     ffb:	c7 04 24 b3 44 00 00 	movl   $0x44b3,(%esp)
+    1002:	e8 a7 2b 00 00       	call   3bae <unlink>
+  if(nc == 10000 && np == 10000){
+    1007:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    100a:	83 c4 10             	add    $0x10,%esp
+    100d:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+    1013:	75 5b                	jne    1070 <sharedfd+0x1a0>
+    1015:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    101b:	75 53                	jne    1070 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+    101d:	83 ec 08             	sub    $0x8,%esp
+    1020:	68 bc 44 00 00       	push   $0x44bc
+    1025:	6a 01                	push   $0x1
+    1027:	e8 d4 2c 00 00       	call   3d00 <printf>
+    102c:	83 c4 10             	add    $0x10,%esp
+}
+    102f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1032:	5b                   	pop    %ebx
+    1033:	5e                   	pop    %esi
+    1034:	5f                   	pop    %edi
+    1035:	5d                   	pop    %ebp
+    1036:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    1037:	83 ec 08             	sub    $0x8,%esp
+    103a:	68 50 52 00 00       	push   $0x5250
+    103f:	6a 01                	push   $0x1
+    1041:	e8 ba 2c 00 00       	call   3d00 <printf>
+    return;
+    1046:	83 c4 10             	add    $0x10,%esp
+}
+    1049:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    104c:	5b                   	pop    %ebx
+    104d:	5e                   	pop    %esi
+    104e:	5f                   	pop    %edi
+    104f:	5d                   	pop    %ebp
+    1050:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    1051:	83 ec 08             	sub    $0x8,%esp
+    1054:	68 9c 52 00 00       	push   $0x529c
+    1059:	6a 01                	push   $0x1
+    105b:	e8 a0 2c 00 00       	call   3d00 <printf>
+    return;
+    1060:	83 c4 10             	add    $0x10,%esp
+}
+    1063:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1066:	5b                   	pop    %ebx
+    1067:	5e                   	pop    %esi
+    1068:	5f                   	pop    %edi
+    1069:	5d                   	pop    %ebp
+    106a:	c3                   	ret
+    exit();
+    106b:	e8 ee 2a 00 00       	call   3b5e <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    1070:	53                   	push   %ebx
+    1071:	52                   	push   %edx
+    1072:	68 c9 44 00 00       	push   $0x44c9
+    1077:	6a 01                	push   $0x1
+    1079:	e8 82 2c 00 00       	call   3d00 <printf>
+    exit();
+    107e:	e8 db 2a 00 00       	call   3b5e <exit>
+    1083:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    108a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001090 <fourfiles>:
+{
+    1090:	55                   	push   %ebp
+    1091:	89 e5                	mov    %esp,%ebp
+    1093:	57                   	push   %edi
+    1094:	56                   	push   %esi
+    1095:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    1096:	31 db                	xor    %ebx,%ebx
+{
+    1098:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    109b:	c7 45 d8 de 44 00 00 	movl   $0x44de,-0x28(%ebp)
+    10a2:	c7 45 dc 27 46 00 00 	movl   $0x4627,-0x24(%ebp)
+    10a9:	c7 45 e0 2b 46 00 00 	movl   $0x462b,-0x20(%ebp)
+    10b0:	c7 45 e4 e1 44 00 00 	movl   $0x44e1,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    10b7:	68 e4 44 00 00       	push   $0x44e4
+    10bc:	6a 01                	push   $0x1
+    10be:	e8 3d 2c 00 00       	call   3d00 <printf>
+    10c3:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    10c6:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    10ca:	83 ec 0c             	sub    $0xc,%esp
+    10cd:	56                   	push   %esi
+    10ce:	e8 db 2a 00 00       	call   3bae <unlink>
+    pid = fork();
+    10d3:	e8 7e 2a 00 00       	call   3b56 <fork>
+    if(pid < 0){
+    10d8:	83 c4 10             	add    $0x10,%esp
+    10db:	85 c0                	test   %eax,%eax
+    10dd:	0f 88 65 01 00 00    	js     1248 <fourfiles+0x1b8>
+    if(pid == 0){
+    10e3:	0f 84 eb 00 00 00    	je     11d4 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    10e9:	83 c3 01             	add    $0x1,%ebx
+    10ec:	83 fb 04             	cmp    $0x4,%ebx
+    10ef:	75 d5                	jne    10c6 <fourfiles+0x36>
+    wait();
+    10f1:	e8 70 2a 00 00       	call   3b66 <wait>
+  for(i = 0; i < 2; i++){
+    10f6:	31 f6                	xor    %esi,%esi
+    wait();
+    10f8:	e8 69 2a 00 00       	call   3b66 <wait>
+    10fd:	e8 64 2a 00 00       	call   3b66 <wait>
+    1102:	e8 5f 2a 00 00       	call   3b66 <wait>
+    fname = names[i];
+    1107:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    110b:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    110e:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    1110:	6a 00                	push   $0x0
+    1112:	53                   	push   %ebx
+    1113:	e8 86 2a 00 00       	call   3b9e <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1118:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    111b:	83 c4 10             	add    $0x10,%esp
+    111e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    1121:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1128:	83 ec 04             	sub    $0x4,%esp
+    112b:	68 00 20 00 00       	push   $0x2000
+    1130:	68 c0 89 00 00       	push   $0x89c0
+    1135:	ff 75 d4             	push   -0x2c(%ebp)
+    1138:	e8 39 2a 00 00       	call   3b76 <read>
+    113d:	83 c4 10             	add    $0x10,%esp
+    1140:	89 c3                	mov    %eax,%ebx
+    1142:	85 c0                	test   %eax,%eax
+    1144:	7e 28                	jle    116e <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    1146:	31 c0                	xor    %eax,%eax
+    1148:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    114f:	90                   	nop
+        if(buf[j] != '0'+i){
+    1150:	83 fe 01             	cmp    $0x1,%esi
+    1153:	0f be 88 c0 89 00 00 	movsbl 0x89c0(%eax),%ecx
+    115a:	19 d2                	sbb    %edx,%edx
+    115c:	83 c2 31             	add    $0x31,%edx
+    115f:	39 d1                	cmp    %edx,%ecx
+    1161:	75 5d                	jne    11c0 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    1163:	83 c0 01             	add    $0x1,%eax
+    1166:	39 c3                	cmp    %eax,%ebx
+    1168:	75 e6                	jne    1150 <fourfiles+0xc0>
+      total += n;
+    116a:	01 df                	add    %ebx,%edi
+    116c:	eb ba                	jmp    1128 <fourfiles+0x98>
+    close(fd);
+    116e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1171:	83 ec 0c             	sub    $0xc,%esp
+    1174:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1177:	51                   	push   %ecx
+    1178:	e8 09 2a 00 00       	call   3b86 <close>
+    if(total != 12*500){
+    117d:	83 c4 10             	add    $0x10,%esp
+    1180:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    1186:	0f 85 d0 00 00 00    	jne    125c <fourfiles+0x1cc>
+    unlink(fname);
+    118c:	83 ec 0c             	sub    $0xc,%esp
+    118f:	53                   	push   %ebx
+    1190:	e8 19 2a 00 00       	call   3bae <unlink>
+  for(i = 0; i < 2; i++){
+    1195:	83 c4 10             	add    $0x10,%esp
+    1198:	85 f6                	test   %esi,%esi
+    119a:	75 0a                	jne    11a6 <fourfiles+0x116>
+    119c:	be 01 00 00 00       	mov    $0x1,%esi
+    11a1:	e9 61 ff ff ff       	jmp    1107 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    11a6:	83 ec 08             	sub    $0x8,%esp
+    11a9:	68 22 45 00 00       	push   $0x4522
+    11ae:	6a 01                	push   $0x1
+    11b0:	e8 4b 2b 00 00       	call   3d00 <printf>
+}
+    11b5:	83 c4 10             	add    $0x10,%esp
+    11b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11bb:	5b                   	pop    %ebx
+    11bc:	5e                   	pop    %esi
+    11bd:	5f                   	pop    %edi
+    11be:	5d                   	pop    %ebp
+    11bf:	c3                   	ret
+          printf(1, "wrong char\n");
+    11c0:	83 ec 08             	sub    $0x8,%esp
+    11c3:	68 05 45 00 00       	push   $0x4505
+    11c8:	6a 01                	push   $0x1
+    11ca:	e8 31 2b 00 00       	call   3d00 <printf>
+          exit();
+    11cf:	e8 8a 29 00 00       	call   3b5e <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    11d4:	83 ec 08             	sub    $0x8,%esp
+    11d7:	68 02 02 00 00       	push   $0x202
+    11dc:	56                   	push   %esi
+    11dd:	e8 bc 29 00 00       	call   3b9e <open>
+      if(fd < 0){
+    11e2:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    11e5:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    11e7:	85 c0                	test   %eax,%eax
+    11e9:	78 45                	js     1230 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    11eb:	83 ec 04             	sub    $0x4,%esp
+    11ee:	83 c3 30             	add    $0x30,%ebx
+    11f1:	68 00 02 00 00       	push   $0x200
+    11f6:	53                   	push   %ebx
+    11f7:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    11fc:	68 c0 89 00 00       	push   $0x89c0
+    1201:	e8 ca 27 00 00       	call   39d0 <memset>
+    1206:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    1209:	83 ec 04             	sub    $0x4,%esp
+    120c:	68 f4 01 00 00       	push   $0x1f4
+    1211:	68 c0 89 00 00       	push   $0x89c0
+    1216:	56                   	push   %esi
+    1217:	e8 62 29 00 00       	call   3b7e <write>
+    121c:	83 c4 10             	add    $0x10,%esp
+    121f:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    1224:	75 49                	jne    126f <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    1226:	83 eb 01             	sub    $0x1,%ebx
+    1229:	75 de                	jne    1209 <fourfiles+0x179>
+      exit();
+    122b:	e8 2e 29 00 00       	call   3b5e <exit>
+        printf(1, "create failed\n");
+    1230:	51                   	push   %ecx
+    1231:	51                   	push   %ecx
+    1232:	68 7f 47 00 00       	push   $0x477f
+    1237:	6a 01                	push   $0x1
+    1239:	e8 c2 2a 00 00       	call   3d00 <printf>
+        exit();
+    123e:	e8 1b 29 00 00       	call   3b5e <exit>
+    1243:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1247:	90                   	nop
+      printf(1, "fork failed\n");
+    1248:	83 ec 08             	sub    $0x8,%esp
+    124b:	68 fc 4f 00 00       	push   $0x4ffc
+    1250:	6a 01                	push   $0x1
+    1252:	e8 a9 2a 00 00       	call   3d00 <printf>
+      exit();
+    1257:	e8 02 29 00 00       	call   3b5e <exit>
+      printf(1, "wrong length %d\n", total);
+    125c:	50                   	push   %eax
+    125d:	57                   	push   %edi
+    125e:	68 11 45 00 00       	push   $0x4511
+    1263:	6a 01                	push   $0x1
+    1265:	e8 96 2a 00 00       	call   3d00 <printf>
+      exit();
+    126a:	e8 ef 28 00 00       	call   3b5e <exit>
+          printf(1, "write failed %d\n", n);
+    126f:	52                   	push   %edx
+    1270:	50                   	push   %eax
+    1271:	68 f4 44 00 00       	push   $0x44f4
+    1276:	6a 01                	push   $0x1
+    1278:	e8 83 2a 00 00       	call   3d00 <printf>
+          exit();
+    127d:	e8 dc 28 00 00       	call   3b5e <exit>
+    1282:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001290 <createdelete>:
+{
+    1290:	55                   	push   %ebp
+    1291:	89 e5                	mov    %esp,%ebp
+    1293:	57                   	push   %edi
+    1294:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    1295:	31 f6                	xor    %esi,%esi
+{
+    1297:	53                   	push   %ebx
+    1298:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    129b:	68 30 45 00 00       	push   $0x4530
+    12a0:	6a 01                	push   $0x1
+    12a2:	e8 59 2a 00 00       	call   3d00 <printf>
+    12a7:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    12aa:	e8 a7 28 00 00       	call   3b56 <fork>
+    12af:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    12b1:	85 c0                	test   %eax,%eax
+    12b3:	0f 88 ac 01 00 00    	js     1465 <createdelete+0x1d5>
+    if(pid == 0){
+    12b9:	0f 84 01 01 00 00    	je     13c0 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    12bf:	83 c6 01             	add    $0x1,%esi
+    12c2:	83 fe 04             	cmp    $0x4,%esi
+    12c5:	75 e3                	jne    12aa <createdelete+0x1a>
+    wait();
+    12c7:	e8 9a 28 00 00       	call   3b66 <wait>
+  for(i = 0; i < N; i++){
+    12cc:	31 ff                	xor    %edi,%edi
+    12ce:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    12d1:	e8 90 28 00 00       	call   3b66 <wait>
+    12d6:	e8 8b 28 00 00       	call   3b66 <wait>
+    12db:	e8 86 28 00 00       	call   3b66 <wait>
+  name[0] = name[1] = name[2] = 0;
+    12e0:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    12e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    12e8:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    12ea:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    12ed:	bb 70 00 00 00       	mov    $0x70,%ebx
+    12f2:	0f 94 c2             	sete   %dl
+    12f5:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    12f8:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    12fb:	0f 9f c0             	setg   %al
+    12fe:	09 c2                	or     %eax,%edx
+    1300:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    1303:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    1307:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    130a:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    130d:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    1310:	6a 00                	push   $0x0
+    1312:	56                   	push   %esi
+    1313:	e8 86 28 00 00       	call   3b9e <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    1318:	83 c4 10             	add    $0x10,%esp
+    131b:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    131f:	74 7f                	je     13a0 <createdelete+0x110>
+    1321:	85 c0                	test   %eax,%eax
+    1323:	0f 88 27 01 00 00    	js     1450 <createdelete+0x1c0>
+        close(fd);
+    1329:	83 ec 0c             	sub    $0xc,%esp
+    132c:	50                   	push   %eax
+    132d:	e8 54 28 00 00       	call   3b86 <close>
+    1332:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    1335:	83 c3 01             	add    $0x1,%ebx
+    1338:	80 fb 74             	cmp    $0x74,%bl
+    133b:	75 c6                	jne    1303 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    133d:	83 c7 01             	add    $0x1,%edi
+    1340:	83 ff 14             	cmp    $0x14,%edi
+    1343:	75 a3                	jne    12e8 <createdelete+0x58>
+    1345:	bf 70 00 00 00       	mov    $0x70,%edi
+    134a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    1350:	8d 47 c0             	lea    -0x40(%edi),%eax
+    1353:	bb 04 00 00 00       	mov    $0x4,%ebx
+    1358:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    135b:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    135d:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    1360:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    1363:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    1367:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    136a:	56                   	push   %esi
+    136b:	e8 3e 28 00 00       	call   3bae <unlink>
+    for(pi = 0; pi < 4; pi++){
+    1370:	83 c4 10             	add    $0x10,%esp
+    1373:	83 eb 01             	sub    $0x1,%ebx
+    1376:	75 e3                	jne    135b <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    1378:	83 c7 01             	add    $0x1,%edi
+    137b:	89 f8                	mov    %edi,%eax
+    137d:	3c 84                	cmp    $0x84,%al
+    137f:	75 cf                	jne    1350 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    1381:	83 ec 08             	sub    $0x8,%esp
+    1384:	68 43 45 00 00       	push   $0x4543
+    1389:	6a 01                	push   $0x1
+    138b:	e8 70 29 00 00       	call   3d00 <printf>
+}
+    1390:	83 c4 10             	add    $0x10,%esp
+    1393:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1396:	5b                   	pop    %ebx
+    1397:	5e                   	pop    %esi
+    1398:	5f                   	pop    %edi
+    1399:	5d                   	pop    %ebp
+    139a:	c3                   	ret
+    139b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    139f:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    13a0:	85 c0                	test   %eax,%eax
+    13a2:	78 91                	js     1335 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    13a4:	50                   	push   %eax
+    13a5:	56                   	push   %esi
+    13a6:	68 ec 52 00 00       	push   $0x52ec
+    13ab:	6a 01                	push   $0x1
+    13ad:	e8 4e 29 00 00       	call   3d00 <printf>
+        exit();
+    13b2:	e8 a7 27 00 00       	call   3b5e <exit>
+    13b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13be:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    13c0:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    13c3:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    13c7:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    13ca:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    13cd:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    13d0:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    13d3:	8d 43 30             	lea    0x30(%ebx),%eax
+    13d6:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    13d9:	68 02 02 00 00       	push   $0x202
+    13de:	56                   	push   %esi
+    13df:	e8 ba 27 00 00       	call   3b9e <open>
+        if(fd < 0){
+    13e4:	83 c4 10             	add    $0x10,%esp
+    13e7:	85 c0                	test   %eax,%eax
+    13e9:	0f 88 8a 00 00 00    	js     1479 <createdelete+0x1e9>
+        close(fd);
+    13ef:	83 ec 0c             	sub    $0xc,%esp
+    13f2:	50                   	push   %eax
+    13f3:	e8 8e 27 00 00       	call   3b86 <close>
+        if(i > 0 && (i % 2 ) == 0){
+    13f8:	83 c4 10             	add    $0x10,%esp
+    13fb:	85 db                	test   %ebx,%ebx
+    13fd:	74 19                	je     1418 <createdelete+0x188>
+    13ff:	f6 c3 01             	test   $0x1,%bl
+    1402:	74 1b                	je     141f <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    1404:	83 c3 01             	add    $0x1,%ebx
+    1407:	83 fb 14             	cmp    $0x14,%ebx
+    140a:	75 c4                	jne    13d0 <createdelete+0x140>
+      exit();
+    140c:	e8 4d 27 00 00       	call   3b5e <exit>
+    1411:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    1418:	bb 01 00 00 00       	mov    $0x1,%ebx
+    141d:	eb b1                	jmp    13d0 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    141f:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    1421:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    1424:	d1 f8                	sar    %eax
+    1426:	83 c0 30             	add    $0x30,%eax
+    1429:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    142c:	56                   	push   %esi
+    142d:	e8 7c 27 00 00       	call   3bae <unlink>
+    1432:	83 c4 10             	add    $0x10,%esp
+    1435:	85 c0                	test   %eax,%eax
+    1437:	79 cb                	jns    1404 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    1439:	52                   	push   %edx
+    143a:	52                   	push   %edx
+    143b:	68 31 41 00 00       	push   $0x4131
+    1440:	6a 01                	push   $0x1
+    1442:	e8 b9 28 00 00       	call   3d00 <printf>
+            exit();
+    1447:	e8 12 27 00 00       	call   3b5e <exit>
+    144c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    1450:	83 ec 04             	sub    $0x4,%esp
+    1453:	56                   	push   %esi
+    1454:	68 c8 52 00 00       	push   $0x52c8
+    1459:	6a 01                	push   $0x1
+    145b:	e8 a0 28 00 00       	call   3d00 <printf>
+        exit();
+    1460:	e8 f9 26 00 00       	call   3b5e <exit>
+      printf(1, "fork failed\n");
+    1465:	83 ec 08             	sub    $0x8,%esp
+    1468:	68 fc 4f 00 00       	push   $0x4ffc
+    146d:	6a 01                	push   $0x1
+    146f:	e8 8c 28 00 00       	call   3d00 <printf>
+      exit();
+    1474:	e8 e5 26 00 00       	call   3b5e <exit>
+          printf(1, "create failed\n");
+    1479:	83 ec 08             	sub    $0x8,%esp
+    147c:	68 7f 47 00 00       	push   $0x477f
+    1481:	6a 01                	push   $0x1
+    1483:	e8 78 28 00 00       	call   3d00 <printf>
+          exit();
+    1488:	e8 d1 26 00 00       	call   3b5e <exit>
+    148d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001490 <unlinkread>:
+{
+    1490:	55                   	push   %ebp
+    1491:	89 e5                	mov    %esp,%ebp
+    1493:	56                   	push   %esi
+    1494:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    1495:	83 ec 08             	sub    $0x8,%esp
+    1498:	68 54 45 00 00       	push   $0x4554
+    149d:	6a 01                	push   $0x1
+    149f:	e8 5c 28 00 00       	call   3d00 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    14a4:	5b                   	pop    %ebx
+    14a5:	5e                   	pop    %esi
+    14a6:	68 02 02 00 00       	push   $0x202
+    14ab:	68 65 45 00 00       	push   $0x4565
+    14b0:	e8 e9 26 00 00       	call   3b9e <open>
+  if(fd < 0){
+    14b5:	83 c4 10             	add    $0x10,%esp
+    14b8:	85 c0                	test   %eax,%eax
+    14ba:	0f 88 e6 00 00 00    	js     15a6 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    14c0:	83 ec 04             	sub    $0x4,%esp
+    14c3:	89 c3                	mov    %eax,%ebx
+    14c5:	6a 05                	push   $0x5
+    14c7:	68 8a 45 00 00       	push   $0x458a
+    14cc:	50                   	push   %eax
+    14cd:	e8 ac 26 00 00       	call   3b7e <write>
+  close(fd);
+    14d2:	89 1c 24             	mov    %ebx,(%esp)
+    14d5:	e8 ac 26 00 00       	call   3b86 <close>
+  fd = open("unlinkread", O_RDWR);
+    14da:	58                   	pop    %eax
+    14db:	5a                   	pop    %edx
+    14dc:	6a 02                	push   $0x2
+    14de:	68 65 45 00 00       	push   $0x4565
+    14e3:	e8 b6 26 00 00       	call   3b9e <open>
+  if(fd < 0){
+    14e8:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    14eb:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    14ed:	85 c0                	test   %eax,%eax
+    14ef:	0f 88 10 01 00 00    	js     1605 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    14f5:	83 ec 0c             	sub    $0xc,%esp
+    14f8:	68 65 45 00 00       	push   $0x4565
+    14fd:	e8 ac 26 00 00       	call   3bae <unlink>
+    1502:	83 c4 10             	add    $0x10,%esp
+    1505:	85 c0                	test   %eax,%eax
+    1507:	0f 85 e5 00 00 00    	jne    15f2 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    150d:	83 ec 08             	sub    $0x8,%esp
+    1510:	68 02 02 00 00       	push   $0x202
+    1515:	68 65 45 00 00       	push   $0x4565
+    151a:	e8 7f 26 00 00       	call   3b9e <open>
+  write(fd1, "yyy", 3);
+    151f:	83 c4 0c             	add    $0xc,%esp
+    1522:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    1524:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    1526:	68 c2 45 00 00       	push   $0x45c2
+    152b:	50                   	push   %eax
+    152c:	e8 4d 26 00 00       	call   3b7e <write>
+  close(fd1);
+    1531:	89 34 24             	mov    %esi,(%esp)
+    1534:	e8 4d 26 00 00       	call   3b86 <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1539:	83 c4 0c             	add    $0xc,%esp
+    153c:	68 00 20 00 00       	push   $0x2000
+    1541:	68 c0 89 00 00       	push   $0x89c0
+    1546:	53                   	push   %ebx
+    1547:	e8 2a 26 00 00       	call   3b76 <read>
+    154c:	83 c4 10             	add    $0x10,%esp
+    154f:	83 f8 05             	cmp    $0x5,%eax
+    1552:	0f 85 87 00 00 00    	jne    15df <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    1558:	80 3d c0 89 00 00 68 	cmpb   $0x68,0x89c0
+    155f:	75 6b                	jne    15cc <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    1561:	83 ec 04             	sub    $0x4,%esp
+    1564:	6a 0a                	push   $0xa
+    1566:	68 c0 89 00 00       	push   $0x89c0
+    156b:	53                   	push   %ebx
+    156c:	e8 0d 26 00 00       	call   3b7e <write>
+    1571:	83 c4 10             	add    $0x10,%esp
+    1574:	83 f8 0a             	cmp    $0xa,%eax
+    1577:	75 40                	jne    15b9 <unlinkread+0x129>
+  close(fd);
+    1579:	83 ec 0c             	sub    $0xc,%esp
+    157c:	53                   	push   %ebx
+    157d:	e8 04 26 00 00       	call   3b86 <close>
+  unlink("unlinkread");
+    1582:	c7 04 24 65 45 00 00 	movl   $0x4565,(%esp)
+    1589:	e8 20 26 00 00       	call   3bae <unlink>
+  printf(1, "unlinkread ok\n");
+    158e:	58                   	pop    %eax
+    158f:	5a                   	pop    %edx
+    1590:	68 0d 46 00 00       	push   $0x460d
+    1595:	6a 01                	push   $0x1
+    1597:	e8 64 27 00 00       	call   3d00 <printf>
+}
+    159c:	83 c4 10             	add    $0x10,%esp
+    159f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    15a2:	5b                   	pop    %ebx
+    15a3:	5e                   	pop    %esi
+    15a4:	5d                   	pop    %ebp
+    15a5:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    15a6:	51                   	push   %ecx
+    15a7:	51                   	push   %ecx
+    15a8:	68 70 45 00 00       	push   $0x4570
+    15ad:	6a 01                	push   $0x1
+    15af:	e8 4c 27 00 00       	call   3d00 <printf>
+    exit();
+    15b4:	e8 a5 25 00 00       	call   3b5e <exit>
+    printf(1, "unlinkread write failed\n");
+    15b9:	51                   	push   %ecx
+    15ba:	51                   	push   %ecx
+    15bb:	68 f4 45 00 00       	push   $0x45f4
+    15c0:	6a 01                	push   $0x1
+    15c2:	e8 39 27 00 00       	call   3d00 <printf>
+    exit();
+    15c7:	e8 92 25 00 00       	call   3b5e <exit>
+    printf(1, "unlinkread wrong data\n");
+    15cc:	53                   	push   %ebx
+    15cd:	53                   	push   %ebx
+    15ce:	68 dd 45 00 00       	push   $0x45dd
+    15d3:	6a 01                	push   $0x1
+    15d5:	e8 26 27 00 00       	call   3d00 <printf>
+    exit();
+    15da:	e8 7f 25 00 00       	call   3b5e <exit>
+    printf(1, "unlinkread read failed");
+    15df:	56                   	push   %esi
+    15e0:	56                   	push   %esi
+    15e1:	68 c6 45 00 00       	push   $0x45c6
+    15e6:	6a 01                	push   $0x1
+    15e8:	e8 13 27 00 00       	call   3d00 <printf>
+    exit();
+    15ed:	e8 6c 25 00 00       	call   3b5e <exit>
+    printf(1, "unlink unlinkread failed\n");
+    15f2:	50                   	push   %eax
+    15f3:	50                   	push   %eax
+    15f4:	68 a8 45 00 00       	push   $0x45a8
+    15f9:	6a 01                	push   $0x1
+    15fb:	e8 00 27 00 00       	call   3d00 <printf>
+    exit();
+    1600:	e8 59 25 00 00       	call   3b5e <exit>
+    printf(1, "open unlinkread failed\n");
+    1605:	50                   	push   %eax
+    1606:	50                   	push   %eax
+    1607:	68 90 45 00 00       	push   $0x4590
+    160c:	6a 01                	push   $0x1
+    160e:	e8 ed 26 00 00       	call   3d00 <printf>
+    exit();
+    1613:	e8 46 25 00 00       	call   3b5e <exit>
+    1618:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    161f:	90                   	nop
+
+00001620 <linktest>:
+{
+    1620:	55                   	push   %ebp
+    1621:	89 e5                	mov    %esp,%ebp
+    1623:	53                   	push   %ebx
+    1624:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    1627:	68 1c 46 00 00       	push   $0x461c
+    162c:	6a 01                	push   $0x1
+    162e:	e8 cd 26 00 00       	call   3d00 <printf>
+  unlink("lf1");
+    1633:	c7 04 24 26 46 00 00 	movl   $0x4626,(%esp)
+    163a:	e8 6f 25 00 00       	call   3bae <unlink>
+  unlink("lf2");
+    163f:	c7 04 24 2a 46 00 00 	movl   $0x462a,(%esp)
+    1646:	e8 63 25 00 00       	call   3bae <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    164b:	58                   	pop    %eax
+    164c:	5a                   	pop    %edx
+    164d:	68 02 02 00 00       	push   $0x202
+    1652:	68 26 46 00 00       	push   $0x4626
+    1657:	e8 42 25 00 00       	call   3b9e <open>
+  if(fd < 0){
+    165c:	83 c4 10             	add    $0x10,%esp
+    165f:	85 c0                	test   %eax,%eax
+    1661:	0f 88 1e 01 00 00    	js     1785 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    1667:	83 ec 04             	sub    $0x4,%esp
+    166a:	89 c3                	mov    %eax,%ebx
+    166c:	6a 05                	push   $0x5
+    166e:	68 8a 45 00 00       	push   $0x458a
+    1673:	50                   	push   %eax
+    1674:	e8 05 25 00 00       	call   3b7e <write>
+    1679:	83 c4 10             	add    $0x10,%esp
+    167c:	83 f8 05             	cmp    $0x5,%eax
+    167f:	0f 85 98 01 00 00    	jne    181d <linktest+0x1fd>
+  close(fd);
+    1685:	83 ec 0c             	sub    $0xc,%esp
+    1688:	53                   	push   %ebx
+    1689:	e8 f8 24 00 00       	call   3b86 <close>
+  if(link("lf1", "lf2") < 0){
+    168e:	5b                   	pop    %ebx
+    168f:	58                   	pop    %eax
+    1690:	68 2a 46 00 00       	push   $0x462a
+    1695:	68 26 46 00 00       	push   $0x4626
+    169a:	e8 1f 25 00 00       	call   3bbe <link>
+    169f:	83 c4 10             	add    $0x10,%esp
+    16a2:	85 c0                	test   %eax,%eax
+    16a4:	0f 88 60 01 00 00    	js     180a <linktest+0x1ea>
+  unlink("lf1");
+    16aa:	83 ec 0c             	sub    $0xc,%esp
+    16ad:	68 26 46 00 00       	push   $0x4626
+    16b2:	e8 f7 24 00 00       	call   3bae <unlink>
+  if(open("lf1", 0) >= 0){
+    16b7:	58                   	pop    %eax
+    16b8:	5a                   	pop    %edx
+    16b9:	6a 00                	push   $0x0
+    16bb:	68 26 46 00 00       	push   $0x4626
+    16c0:	e8 d9 24 00 00       	call   3b9e <open>
+    16c5:	83 c4 10             	add    $0x10,%esp
+    16c8:	85 c0                	test   %eax,%eax
+    16ca:	0f 89 27 01 00 00    	jns    17f7 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    16d0:	83 ec 08             	sub    $0x8,%esp
+    16d3:	6a 00                	push   $0x0
+    16d5:	68 2a 46 00 00       	push   $0x462a
+    16da:	e8 bf 24 00 00       	call   3b9e <open>
+  if(fd < 0){
+    16df:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    16e2:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    16e4:	85 c0                	test   %eax,%eax
+    16e6:	0f 88 f8 00 00 00    	js     17e4 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    16ec:	83 ec 04             	sub    $0x4,%esp
+    16ef:	68 00 20 00 00       	push   $0x2000
+    16f4:	68 c0 89 00 00       	push   $0x89c0
+    16f9:	50                   	push   %eax
+    16fa:	e8 77 24 00 00       	call   3b76 <read>
+    16ff:	83 c4 10             	add    $0x10,%esp
+    1702:	83 f8 05             	cmp    $0x5,%eax
+    1705:	0f 85 c6 00 00 00    	jne    17d1 <linktest+0x1b1>
+  close(fd);
+    170b:	83 ec 0c             	sub    $0xc,%esp
+    170e:	53                   	push   %ebx
+    170f:	e8 72 24 00 00       	call   3b86 <close>
+  if(link("lf2", "lf2") >= 0){
+    1714:	58                   	pop    %eax
+    1715:	5a                   	pop    %edx
+    1716:	68 2a 46 00 00       	push   $0x462a
+    171b:	68 2a 46 00 00       	push   $0x462a
+    1720:	e8 99 24 00 00       	call   3bbe <link>
+    1725:	83 c4 10             	add    $0x10,%esp
+    1728:	85 c0                	test   %eax,%eax
+    172a:	0f 89 8e 00 00 00    	jns    17be <linktest+0x19e>
+  unlink("lf2");
+    1730:	83 ec 0c             	sub    $0xc,%esp
+    1733:	68 2a 46 00 00       	push   $0x462a
+    1738:	e8 71 24 00 00       	call   3bae <unlink>
+  if(link("lf2", "lf1") >= 0){
+    173d:	59                   	pop    %ecx
+    173e:	5b                   	pop    %ebx
+    173f:	68 26 46 00 00       	push   $0x4626
+    1744:	68 2a 46 00 00       	push   $0x462a
+    1749:	e8 70 24 00 00       	call   3bbe <link>
+    174e:	83 c4 10             	add    $0x10,%esp
+    1751:	85 c0                	test   %eax,%eax
+    1753:	79 56                	jns    17ab <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    1755:	83 ec 08             	sub    $0x8,%esp
+    1758:	68 26 46 00 00       	push   $0x4626
+    175d:	68 ee 48 00 00       	push   $0x48ee
+    1762:	e8 57 24 00 00       	call   3bbe <link>
+    1767:	83 c4 10             	add    $0x10,%esp
+    176a:	85 c0                	test   %eax,%eax
+    176c:	79 2a                	jns    1798 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    176e:	83 ec 08             	sub    $0x8,%esp
+    1771:	68 c4 46 00 00       	push   $0x46c4
+    1776:	6a 01                	push   $0x1
+    1778:	e8 83 25 00 00       	call   3d00 <printf>
+}
+    177d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1780:	83 c4 10             	add    $0x10,%esp
+    1783:	c9                   	leave
+    1784:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1785:	50                   	push   %eax
+    1786:	50                   	push   %eax
+    1787:	68 2e 46 00 00       	push   $0x462e
+    178c:	6a 01                	push   $0x1
+    178e:	e8 6d 25 00 00       	call   3d00 <printf>
+    exit();
+    1793:	e8 c6 23 00 00       	call   3b5e <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1798:	50                   	push   %eax
+    1799:	50                   	push   %eax
+    179a:	68 a8 46 00 00       	push   $0x46a8
+    179f:	6a 01                	push   $0x1
+    17a1:	e8 5a 25 00 00       	call   3d00 <printf>
+    exit();
+    17a6:	e8 b3 23 00 00       	call   3b5e <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    17ab:	52                   	push   %edx
+    17ac:	52                   	push   %edx
+    17ad:	68 34 53 00 00       	push   $0x5334
+    17b2:	6a 01                	push   $0x1
+    17b4:	e8 47 25 00 00       	call   3d00 <printf>
+    exit();
+    17b9:	e8 a0 23 00 00       	call   3b5e <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    17be:	50                   	push   %eax
+    17bf:	50                   	push   %eax
+    17c0:	68 8a 46 00 00       	push   $0x468a
+    17c5:	6a 01                	push   $0x1
+    17c7:	e8 34 25 00 00       	call   3d00 <printf>
+    exit();
+    17cc:	e8 8d 23 00 00       	call   3b5e <exit>
+    printf(1, "read lf2 failed\n");
+    17d1:	51                   	push   %ecx
+    17d2:	51                   	push   %ecx
+    17d3:	68 79 46 00 00       	push   $0x4679
+    17d8:	6a 01                	push   $0x1
+    17da:	e8 21 25 00 00       	call   3d00 <printf>
+    exit();
+    17df:	e8 7a 23 00 00       	call   3b5e <exit>
+    printf(1, "open lf2 failed\n");
+    17e4:	53                   	push   %ebx
+    17e5:	53                   	push   %ebx
+    17e6:	68 68 46 00 00       	push   $0x4668
+    17eb:	6a 01                	push   $0x1
+    17ed:	e8 0e 25 00 00       	call   3d00 <printf>
+    exit();
+    17f2:	e8 67 23 00 00       	call   3b5e <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    17f7:	50                   	push   %eax
+    17f8:	50                   	push   %eax
+    17f9:	68 0c 53 00 00       	push   $0x530c
+    17fe:	6a 01                	push   $0x1
+    1800:	e8 fb 24 00 00       	call   3d00 <printf>
+    exit();
+    1805:	e8 54 23 00 00       	call   3b5e <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    180a:	51                   	push   %ecx
+    180b:	51                   	push   %ecx
+    180c:	68 53 46 00 00       	push   $0x4653
+    1811:	6a 01                	push   $0x1
+    1813:	e8 e8 24 00 00       	call   3d00 <printf>
+    exit();
+    1818:	e8 41 23 00 00       	call   3b5e <exit>
+    printf(1, "write lf1 failed\n");
+    181d:	50                   	push   %eax
+    181e:	50                   	push   %eax
+    181f:	68 41 46 00 00       	push   $0x4641
+    1824:	6a 01                	push   $0x1
+    1826:	e8 d5 24 00 00       	call   3d00 <printf>
+    exit();
+    182b:	e8 2e 23 00 00       	call   3b5e <exit>
+
+00001830 <concreate>:
+{
+    1830:	55                   	push   %ebp
+    1831:	89 e5                	mov    %esp,%ebp
+    1833:	57                   	push   %edi
+    1834:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    1835:	31 f6                	xor    %esi,%esi
+{
+    1837:	53                   	push   %ebx
+    1838:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    183b:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    183e:	68 d1 46 00 00       	push   $0x46d1
+    1843:	6a 01                	push   $0x1
+    1845:	e8 b6 24 00 00       	call   3d00 <printf>
+  file[0] = 'C';
+    184a:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    184e:	83 c4 10             	add    $0x10,%esp
+    1851:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    1855:	eb 4c                	jmp    18a3 <concreate+0x73>
+    1857:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    185e:	66 90                	xchg   %ax,%ax
+    1860:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    1866:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    186b:	0f 83 8f 00 00 00    	jae    1900 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    1871:	83 ec 08             	sub    $0x8,%esp
+    1874:	68 02 02 00 00       	push   $0x202
+    1879:	53                   	push   %ebx
+    187a:	e8 1f 23 00 00       	call   3b9e <open>
+      if(fd < 0){
+    187f:	83 c4 10             	add    $0x10,%esp
+    1882:	85 c0                	test   %eax,%eax
+    1884:	78 63                	js     18e9 <concreate+0xb9>
+      close(fd);
+    1886:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    1889:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    188c:	50                   	push   %eax
+    188d:	e8 f4 22 00 00       	call   3b86 <close>
+    1892:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1895:	e8 cc 22 00 00       	call   3b66 <wait>
+  for(i = 0; i < 40; i++){
+    189a:	83 fe 28             	cmp    $0x28,%esi
+    189d:	0f 84 7f 00 00 00    	je     1922 <concreate+0xf2>
+    unlink(file);
+    18a3:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    18a6:	8d 46 30             	lea    0x30(%esi),%eax
+    18a9:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    18ac:	53                   	push   %ebx
+    18ad:	e8 fc 22 00 00       	call   3bae <unlink>
+    pid = fork();
+    18b2:	e8 9f 22 00 00       	call   3b56 <fork>
+    if(pid && (i % 3) == 1){
+    18b7:	83 c4 10             	add    $0x10,%esp
+    18ba:	85 c0                	test   %eax,%eax
+    18bc:	75 a2                	jne    1860 <concreate+0x30>
+      link("C0", file);
+    18be:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    18c4:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    18ca:	0f 83 d0 00 00 00    	jae    19a0 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    18d0:	83 ec 08             	sub    $0x8,%esp
+    18d3:	68 02 02 00 00       	push   $0x202
+    18d8:	53                   	push   %ebx
+    18d9:	e8 c0 22 00 00       	call   3b9e <open>
+      if(fd < 0){
+    18de:	83 c4 10             	add    $0x10,%esp
+    18e1:	85 c0                	test   %eax,%eax
+    18e3:	0f 89 ea 01 00 00    	jns    1ad3 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    18e9:	83 ec 04             	sub    $0x4,%esp
+    18ec:	53                   	push   %ebx
+    18ed:	68 e4 46 00 00       	push   $0x46e4
+    18f2:	6a 01                	push   $0x1
+    18f4:	e8 07 24 00 00       	call   3d00 <printf>
+        exit();
+    18f9:	e8 60 22 00 00       	call   3b5e <exit>
+    18fe:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    1900:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    1903:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    1906:	53                   	push   %ebx
+    1907:	68 e1 46 00 00       	push   $0x46e1
+    190c:	e8 ad 22 00 00       	call   3bbe <link>
+    1911:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1914:	e8 4d 22 00 00       	call   3b66 <wait>
+  for(i = 0; i < 40; i++){
+    1919:	83 fe 28             	cmp    $0x28,%esi
+    191c:	0f 85 81 ff ff ff    	jne    18a3 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    1922:	83 ec 04             	sub    $0x4,%esp
+    1925:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    1928:	6a 28                	push   $0x28
+    192a:	6a 00                	push   $0x0
+    192c:	50                   	push   %eax
+    192d:	e8 9e 20 00 00       	call   39d0 <memset>
+  fd = open(".", 0);
+    1932:	5e                   	pop    %esi
+    1933:	5f                   	pop    %edi
+    1934:	6a 00                	push   $0x0
+    1936:	68 ee 48 00 00       	push   $0x48ee
+    193b:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    193e:	e8 5b 22 00 00       	call   3b9e <open>
+  n = 0;
+    1943:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    194a:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    194d:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    194f:	90                   	nop
+    1950:	83 ec 04             	sub    $0x4,%esp
+    1953:	6a 10                	push   $0x10
+    1955:	57                   	push   %edi
+    1956:	56                   	push   %esi
+    1957:	e8 1a 22 00 00       	call   3b76 <read>
+    195c:	83 c4 10             	add    $0x10,%esp
+    195f:	85 c0                	test   %eax,%eax
+    1961:	7e 5d                	jle    19c0 <concreate+0x190>
+    if(de.inum == 0)
+    1963:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    1968:	74 e6                	je     1950 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    196a:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    196e:	75 e0                	jne    1950 <concreate+0x120>
+    1970:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    1974:	75 da                	jne    1950 <concreate+0x120>
+      i = de.name[1] - '0';
+    1976:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    197a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    197d:	83 f8 27             	cmp    $0x27,%eax
+    1980:	0f 87 5e 01 00 00    	ja     1ae4 <concreate+0x2b4>
+      if(fa[i]){
+    1986:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    198b:	0f 85 7e 01 00 00    	jne    1b0f <concreate+0x2df>
+      n++;
+    1991:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    1995:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    199a:	eb b4                	jmp    1950 <concreate+0x120>
+    199c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    19a0:	83 ec 08             	sub    $0x8,%esp
+    19a3:	53                   	push   %ebx
+    19a4:	68 e1 46 00 00       	push   $0x46e1
+    19a9:	e8 10 22 00 00       	call   3bbe <link>
+    19ae:	83 c4 10             	add    $0x10,%esp
+      exit();
+    19b1:	e8 a8 21 00 00       	call   3b5e <exit>
+    19b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19bd:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    19c0:	83 ec 0c             	sub    $0xc,%esp
+    19c3:	56                   	push   %esi
+    19c4:	e8 bd 21 00 00       	call   3b86 <close>
+  if(n != 40){
+    19c9:	83 c4 10             	add    $0x10,%esp
+    19cc:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    19d0:	0f 85 26 01 00 00    	jne    1afc <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    19d6:	31 f6                	xor    %esi,%esi
+    19d8:	eb 48                	jmp    1a22 <concreate+0x1f2>
+    19da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    19e0:	85 ff                	test   %edi,%edi
+    19e2:	74 05                	je     19e9 <concreate+0x1b9>
+    19e4:	83 f8 01             	cmp    $0x1,%eax
+    19e7:	74 68                	je     1a51 <concreate+0x221>
+      unlink(file);
+    19e9:	83 ec 0c             	sub    $0xc,%esp
+    19ec:	53                   	push   %ebx
+    19ed:	e8 bc 21 00 00       	call   3bae <unlink>
+      unlink(file);
+    19f2:	89 1c 24             	mov    %ebx,(%esp)
+    19f5:	e8 b4 21 00 00       	call   3bae <unlink>
+      unlink(file);
+    19fa:	89 1c 24             	mov    %ebx,(%esp)
+    19fd:	e8 ac 21 00 00       	call   3bae <unlink>
+      unlink(file);
+    1a02:	89 1c 24             	mov    %ebx,(%esp)
+    1a05:	e8 a4 21 00 00       	call   3bae <unlink>
+    1a0a:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    1a0d:	85 ff                	test   %edi,%edi
+    1a0f:	74 a0                	je     19b1 <concreate+0x181>
+      wait();
+    1a11:	e8 50 21 00 00       	call   3b66 <wait>
+  for(i = 0; i < 40; i++){
+    1a16:	83 c6 01             	add    $0x1,%esi
+    1a19:	83 fe 28             	cmp    $0x28,%esi
+    1a1c:	0f 84 86 00 00 00    	je     1aa8 <concreate+0x278>
+    file[1] = '0' + i;
+    1a22:	8d 46 30             	lea    0x30(%esi),%eax
+    1a25:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    1a28:	e8 29 21 00 00       	call   3b56 <fork>
+    1a2d:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    1a2f:	85 c0                	test   %eax,%eax
+    1a31:	0f 88 88 00 00 00    	js     1abf <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    1a37:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    1a3c:	f7 e6                	mul    %esi
+    1a3e:	89 d0                	mov    %edx,%eax
+    1a40:	83 e2 fe             	and    $0xfffffffe,%edx
+    1a43:	d1 e8                	shr    %eax
+    1a45:	01 c2                	add    %eax,%edx
+    1a47:	89 f0                	mov    %esi,%eax
+    1a49:	29 d0                	sub    %edx,%eax
+    1a4b:	89 c1                	mov    %eax,%ecx
+    1a4d:	09 f9                	or     %edi,%ecx
+    1a4f:	75 8f                	jne    19e0 <concreate+0x1b0>
+      close(open(file, 0));
+    1a51:	83 ec 08             	sub    $0x8,%esp
+    1a54:	6a 00                	push   $0x0
+    1a56:	53                   	push   %ebx
+    1a57:	e8 42 21 00 00       	call   3b9e <open>
+    1a5c:	89 04 24             	mov    %eax,(%esp)
+    1a5f:	e8 22 21 00 00       	call   3b86 <close>
+      close(open(file, 0));
+    1a64:	58                   	pop    %eax
+    1a65:	5a                   	pop    %edx
+    1a66:	6a 00                	push   $0x0
+    1a68:	53                   	push   %ebx
+    1a69:	e8 30 21 00 00       	call   3b9e <open>
+    1a6e:	89 04 24             	mov    %eax,(%esp)
+    1a71:	e8 10 21 00 00       	call   3b86 <close>
+      close(open(file, 0));
+    1a76:	59                   	pop    %ecx
+    1a77:	58                   	pop    %eax
+    1a78:	6a 00                	push   $0x0
+    1a7a:	53                   	push   %ebx
+    1a7b:	e8 1e 21 00 00       	call   3b9e <open>
+    1a80:	89 04 24             	mov    %eax,(%esp)
+    1a83:	e8 fe 20 00 00       	call   3b86 <close>
+      close(open(file, 0));
+    1a88:	58                   	pop    %eax
+    1a89:	5a                   	pop    %edx
+    1a8a:	6a 00                	push   $0x0
+    1a8c:	53                   	push   %ebx
+    1a8d:	e8 0c 21 00 00       	call   3b9e <open>
+    1a92:	89 04 24             	mov    %eax,(%esp)
+    1a95:	e8 ec 20 00 00       	call   3b86 <close>
+    1a9a:	83 c4 10             	add    $0x10,%esp
+    1a9d:	e9 6b ff ff ff       	jmp    1a0d <concreate+0x1dd>
+    1aa2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    1aa8:	83 ec 08             	sub    $0x8,%esp
+    1aab:	68 36 47 00 00       	push   $0x4736
+    1ab0:	6a 01                	push   $0x1
+    1ab2:	e8 49 22 00 00       	call   3d00 <printf>
+}
+    1ab7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1aba:	5b                   	pop    %ebx
+    1abb:	5e                   	pop    %esi
+    1abc:	5f                   	pop    %edi
+    1abd:	5d                   	pop    %ebp
+    1abe:	c3                   	ret
+      printf(1, "fork failed\n");
+    1abf:	83 ec 08             	sub    $0x8,%esp
+    1ac2:	68 fc 4f 00 00       	push   $0x4ffc
+    1ac7:	6a 01                	push   $0x1
+    1ac9:	e8 32 22 00 00       	call   3d00 <printf>
+      exit();
+    1ace:	e8 8b 20 00 00       	call   3b5e <exit>
+      close(fd);
+    1ad3:	83 ec 0c             	sub    $0xc,%esp
+    1ad6:	50                   	push   %eax
+    1ad7:	e8 aa 20 00 00       	call   3b86 <close>
+    1adc:	83 c4 10             	add    $0x10,%esp
+    1adf:	e9 cd fe ff ff       	jmp    19b1 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    1ae4:	83 ec 04             	sub    $0x4,%esp
+    1ae7:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1aea:	50                   	push   %eax
+    1aeb:	68 00 47 00 00       	push   $0x4700
+    1af0:	6a 01                	push   $0x1
+    1af2:	e8 09 22 00 00       	call   3d00 <printf>
+        exit();
+    1af7:	e8 62 20 00 00       	call   3b5e <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    1afc:	51                   	push   %ecx
+    1afd:	51                   	push   %ecx
+    1afe:	68 58 53 00 00       	push   $0x5358
+    1b03:	6a 01                	push   $0x1
+    1b05:	e8 f6 21 00 00       	call   3d00 <printf>
+    exit();
+    1b0a:	e8 4f 20 00 00       	call   3b5e <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1b0f:	83 ec 04             	sub    $0x4,%esp
+    1b12:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1b15:	50                   	push   %eax
+    1b16:	68 19 47 00 00       	push   $0x4719
+    1b1b:	6a 01                	push   $0x1
+    1b1d:	e8 de 21 00 00       	call   3d00 <printf>
+        exit();
+    1b22:	e8 37 20 00 00       	call   3b5e <exit>
+    1b27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b2e:	66 90                	xchg   %ax,%ax
+
+00001b30 <linkunlink>:
+{
+    1b30:	55                   	push   %ebp
+    1b31:	89 e5                	mov    %esp,%ebp
+    1b33:	57                   	push   %edi
+    1b34:	56                   	push   %esi
+    1b35:	53                   	push   %ebx
+    1b36:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    1b39:	68 44 47 00 00       	push   $0x4744
+    1b3e:	6a 01                	push   $0x1
+    1b40:	e8 bb 21 00 00       	call   3d00 <printf>
+  unlink("x");
+    1b45:	c7 04 24 d1 49 00 00 	movl   $0x49d1,(%esp)
+    1b4c:	e8 5d 20 00 00       	call   3bae <unlink>
+  pid = fork();
+    1b51:	e8 00 20 00 00       	call   3b56 <fork>
+  if(pid < 0){
+    1b56:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    1b59:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    1b5c:	85 c0                	test   %eax,%eax
+    1b5e:	0f 88 b6 00 00 00    	js     1c1a <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    1b64:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    1b68:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    1b6d:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    1b72:	19 ff                	sbb    %edi,%edi
+    1b74:	83 e7 60             	and    $0x60,%edi
+    1b77:	83 c7 01             	add    $0x1,%edi
+    1b7a:	eb 1e                	jmp    1b9a <linkunlink+0x6a>
+    1b7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    1b80:	83 f8 01             	cmp    $0x1,%eax
+    1b83:	74 7b                	je     1c00 <linkunlink+0xd0>
+      unlink("x");
+    1b85:	83 ec 0c             	sub    $0xc,%esp
+    1b88:	68 d1 49 00 00       	push   $0x49d1
+    1b8d:	e8 1c 20 00 00       	call   3bae <unlink>
+    1b92:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1b95:	83 eb 01             	sub    $0x1,%ebx
+    1b98:	74 41                	je     1bdb <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    1b9a:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    1ba0:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    1ba6:	89 f8                	mov    %edi,%eax
+    1ba8:	f7 e6                	mul    %esi
+    1baa:	89 d0                	mov    %edx,%eax
+    1bac:	83 e2 fe             	and    $0xfffffffe,%edx
+    1baf:	d1 e8                	shr    %eax
+    1bb1:	01 c2                	add    %eax,%edx
+    1bb3:	89 f8                	mov    %edi,%eax
+    1bb5:	29 d0                	sub    %edx,%eax
+    1bb7:	75 c7                	jne    1b80 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    1bb9:	83 ec 08             	sub    $0x8,%esp
+    1bbc:	68 02 02 00 00       	push   $0x202
+    1bc1:	68 d1 49 00 00       	push   $0x49d1
+    1bc6:	e8 d3 1f 00 00       	call   3b9e <open>
+    1bcb:	89 04 24             	mov    %eax,(%esp)
+    1bce:	e8 b3 1f 00 00       	call   3b86 <close>
+    1bd3:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1bd6:	83 eb 01             	sub    $0x1,%ebx
+    1bd9:	75 bf                	jne    1b9a <linkunlink+0x6a>
+  if(pid)
+    1bdb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1bde:	85 c0                	test   %eax,%eax
+    1be0:	74 4b                	je     1c2d <linkunlink+0xfd>
+    wait();
+    1be2:	e8 7f 1f 00 00       	call   3b66 <wait>
+  printf(1, "linkunlink ok\n");
+    1be7:	83 ec 08             	sub    $0x8,%esp
+    1bea:	68 59 47 00 00       	push   $0x4759
+    1bef:	6a 01                	push   $0x1
+    1bf1:	e8 0a 21 00 00       	call   3d00 <printf>
+}
+    1bf6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1bf9:	5b                   	pop    %ebx
+    1bfa:	5e                   	pop    %esi
+    1bfb:	5f                   	pop    %edi
+    1bfc:	5d                   	pop    %ebp
+    1bfd:	c3                   	ret
+    1bfe:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    1c00:	83 ec 08             	sub    $0x8,%esp
+    1c03:	68 d1 49 00 00       	push   $0x49d1
+    1c08:	68 55 47 00 00       	push   $0x4755
+    1c0d:	e8 ac 1f 00 00       	call   3bbe <link>
+    1c12:	83 c4 10             	add    $0x10,%esp
+    1c15:	e9 7b ff ff ff       	jmp    1b95 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    1c1a:	52                   	push   %edx
+    1c1b:	52                   	push   %edx
+    1c1c:	68 fc 4f 00 00       	push   $0x4ffc
+    1c21:	6a 01                	push   $0x1
+    1c23:	e8 d8 20 00 00       	call   3d00 <printf>
+    exit();
+    1c28:	e8 31 1f 00 00       	call   3b5e <exit>
+    exit();
+    1c2d:	e8 2c 1f 00 00       	call   3b5e <exit>
+    1c32:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001c40 <bigdir>:
+{
+    1c40:	55                   	push   %ebp
+    1c41:	89 e5                	mov    %esp,%ebp
+    1c43:	57                   	push   %edi
+    1c44:	56                   	push   %esi
+    1c45:	53                   	push   %ebx
+    1c46:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    1c49:	68 68 47 00 00       	push   $0x4768
+    1c4e:	6a 01                	push   $0x1
+    1c50:	e8 ab 20 00 00       	call   3d00 <printf>
+  unlink("bd");
+    1c55:	c7 04 24 75 47 00 00 	movl   $0x4775,(%esp)
+    1c5c:	e8 4d 1f 00 00       	call   3bae <unlink>
+  fd = open("bd", O_CREATE);
+    1c61:	5a                   	pop    %edx
+    1c62:	59                   	pop    %ecx
+    1c63:	68 00 02 00 00       	push   $0x200
+    1c68:	68 75 47 00 00       	push   $0x4775
+    1c6d:	e8 2c 1f 00 00       	call   3b9e <open>
+  if(fd < 0){
+    1c72:	83 c4 10             	add    $0x10,%esp
+    1c75:	85 c0                	test   %eax,%eax
+    1c77:	0f 88 de 00 00 00    	js     1d5b <bigdir+0x11b>
+  close(fd);
+    1c7d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    1c80:	31 f6                	xor    %esi,%esi
+    1c82:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    1c85:	50                   	push   %eax
+    1c86:	e8 fb 1e 00 00       	call   3b86 <close>
+    1c8b:	83 c4 10             	add    $0x10,%esp
+    1c8e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    1c90:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    1c92:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    1c95:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1c99:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1c9c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1ca0:	83 c0 30             	add    $0x30,%eax
+    1ca3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1ca6:	89 f0                	mov    %esi,%eax
+    1ca8:	83 e0 3f             	and    $0x3f,%eax
+    1cab:	83 c0 30             	add    $0x30,%eax
+    1cae:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    1cb1:	57                   	push   %edi
+    1cb2:	68 75 47 00 00       	push   $0x4775
+    1cb7:	e8 02 1f 00 00       	call   3bbe <link>
+    1cbc:	83 c4 10             	add    $0x10,%esp
+    1cbf:	89 c3                	mov    %eax,%ebx
+    1cc1:	85 c0                	test   %eax,%eax
+    1cc3:	75 6e                	jne    1d33 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    1cc5:	83 c6 01             	add    $0x1,%esi
+    1cc8:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    1cce:	75 c0                	jne    1c90 <bigdir+0x50>
+  unlink("bd");
+    1cd0:	83 ec 0c             	sub    $0xc,%esp
+    1cd3:	68 75 47 00 00       	push   $0x4775
+    1cd8:	e8 d1 1e 00 00       	call   3bae <unlink>
+    1cdd:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    1ce0:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    1ce2:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    1ce5:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1ce9:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1cec:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1cf0:	83 c0 30             	add    $0x30,%eax
+    1cf3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1cf6:	89 d8                	mov    %ebx,%eax
+    1cf8:	83 e0 3f             	and    $0x3f,%eax
+    1cfb:	83 c0 30             	add    $0x30,%eax
+    1cfe:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    1d01:	57                   	push   %edi
+    1d02:	e8 a7 1e 00 00       	call   3bae <unlink>
+    1d07:	83 c4 10             	add    $0x10,%esp
+    1d0a:	85 c0                	test   %eax,%eax
+    1d0c:	75 39                	jne    1d47 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    1d0e:	83 c3 01             	add    $0x1,%ebx
+    1d11:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    1d17:	75 c7                	jne    1ce0 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    1d19:	83 ec 08             	sub    $0x8,%esp
+    1d1c:	68 b7 47 00 00       	push   $0x47b7
+    1d21:	6a 01                	push   $0x1
+    1d23:	e8 d8 1f 00 00       	call   3d00 <printf>
+    1d28:	83 c4 10             	add    $0x10,%esp
+}
+    1d2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d2e:	5b                   	pop    %ebx
+    1d2f:	5e                   	pop    %esi
+    1d30:	5f                   	pop    %edi
+    1d31:	5d                   	pop    %ebp
+    1d32:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    1d33:	83 ec 08             	sub    $0x8,%esp
+    1d36:	68 8e 47 00 00       	push   $0x478e
+    1d3b:	6a 01                	push   $0x1
+    1d3d:	e8 be 1f 00 00       	call   3d00 <printf>
+      exit();
+    1d42:	e8 17 1e 00 00       	call   3b5e <exit>
+      printf(1, "bigdir unlink failed");
+    1d47:	83 ec 08             	sub    $0x8,%esp
+    1d4a:	68 a2 47 00 00       	push   $0x47a2
+    1d4f:	6a 01                	push   $0x1
+    1d51:	e8 aa 1f 00 00       	call   3d00 <printf>
+      exit();
+    1d56:	e8 03 1e 00 00       	call   3b5e <exit>
+    printf(1, "bigdir create failed\n");
+    1d5b:	50                   	push   %eax
+    1d5c:	50                   	push   %eax
+    1d5d:	68 78 47 00 00       	push   $0x4778
+    1d62:	6a 01                	push   $0x1
+    1d64:	e8 97 1f 00 00       	call   3d00 <printf>
+    exit();
+    1d69:	e8 f0 1d 00 00       	call   3b5e <exit>
+    1d6e:	66 90                	xchg   %ax,%ax
+
+00001d70 <subdir>:
+{
+    1d70:	55                   	push   %ebp
+    1d71:	89 e5                	mov    %esp,%ebp
+    1d73:	53                   	push   %ebx
+    1d74:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    1d77:	68 c2 47 00 00       	push   $0x47c2
+    1d7c:	6a 01                	push   $0x1
+    1d7e:	e8 7d 1f 00 00       	call   3d00 <printf>
+  unlink("ff");
+    1d83:	c7 04 24 4b 48 00 00 	movl   $0x484b,(%esp)
+    1d8a:	e8 1f 1e 00 00       	call   3bae <unlink>
+  if(mkdir("dd") != 0){
+    1d8f:	c7 04 24 e8 48 00 00 	movl   $0x48e8,(%esp)
+    1d96:	e8 2b 1e 00 00       	call   3bc6 <mkdir>
+    1d9b:	83 c4 10             	add    $0x10,%esp
+    1d9e:	85 c0                	test   %eax,%eax
+    1da0:	0f 85 b3 05 00 00    	jne    2359 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1da6:	83 ec 08             	sub    $0x8,%esp
+    1da9:	68 02 02 00 00       	push   $0x202
+    1dae:	68 21 48 00 00       	push   $0x4821
+    1db3:	e8 e6 1d 00 00       	call   3b9e <open>
+  if(fd < 0){
+    1db8:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1dbb:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1dbd:	85 c0                	test   %eax,%eax
+    1dbf:	0f 88 81 05 00 00    	js     2346 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    1dc5:	83 ec 04             	sub    $0x4,%esp
+    1dc8:	6a 02                	push   $0x2
+    1dca:	68 4b 48 00 00       	push   $0x484b
+    1dcf:	50                   	push   %eax
+    1dd0:	e8 a9 1d 00 00       	call   3b7e <write>
+  close(fd);
+    1dd5:	89 1c 24             	mov    %ebx,(%esp)
+    1dd8:	e8 a9 1d 00 00       	call   3b86 <close>
+  if(unlink("dd") >= 0){
+    1ddd:	c7 04 24 e8 48 00 00 	movl   $0x48e8,(%esp)
+    1de4:	e8 c5 1d 00 00       	call   3bae <unlink>
+    1de9:	83 c4 10             	add    $0x10,%esp
+    1dec:	85 c0                	test   %eax,%eax
+    1dee:	0f 89 3f 05 00 00    	jns    2333 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    1df4:	83 ec 0c             	sub    $0xc,%esp
+    1df7:	68 fc 47 00 00       	push   $0x47fc
+    1dfc:	e8 c5 1d 00 00       	call   3bc6 <mkdir>
+    1e01:	83 c4 10             	add    $0x10,%esp
+    1e04:	85 c0                	test   %eax,%eax
+    1e06:	0f 85 14 05 00 00    	jne    2320 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1e0c:	83 ec 08             	sub    $0x8,%esp
+    1e0f:	68 02 02 00 00       	push   $0x202
+    1e14:	68 1e 48 00 00       	push   $0x481e
+    1e19:	e8 80 1d 00 00       	call   3b9e <open>
+  if(fd < 0){
+    1e1e:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1e21:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1e23:	85 c0                	test   %eax,%eax
+    1e25:	0f 88 24 04 00 00    	js     224f <subdir+0x4df>
+  write(fd, "FF", 2);
+    1e2b:	83 ec 04             	sub    $0x4,%esp
+    1e2e:	6a 02                	push   $0x2
+    1e30:	68 3f 48 00 00       	push   $0x483f
+    1e35:	50                   	push   %eax
+    1e36:	e8 43 1d 00 00       	call   3b7e <write>
+  close(fd);
+    1e3b:	89 1c 24             	mov    %ebx,(%esp)
+    1e3e:	e8 43 1d 00 00       	call   3b86 <close>
+  fd = open("dd/dd/../ff", 0);
+    1e43:	58                   	pop    %eax
+    1e44:	5a                   	pop    %edx
+    1e45:	6a 00                	push   $0x0
+    1e47:	68 42 48 00 00       	push   $0x4842
+    1e4c:	e8 4d 1d 00 00       	call   3b9e <open>
+  if(fd < 0){
+    1e51:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    1e54:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1e56:	85 c0                	test   %eax,%eax
+    1e58:	0f 88 de 03 00 00    	js     223c <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    1e5e:	83 ec 04             	sub    $0x4,%esp
+    1e61:	68 00 20 00 00       	push   $0x2000
+    1e66:	68 c0 89 00 00       	push   $0x89c0
+    1e6b:	50                   	push   %eax
+    1e6c:	e8 05 1d 00 00       	call   3b76 <read>
+  if(cc != 2 || buf[0] != 'f'){
+    1e71:	83 c4 10             	add    $0x10,%esp
+    1e74:	83 f8 02             	cmp    $0x2,%eax
+    1e77:	0f 85 3a 03 00 00    	jne    21b7 <subdir+0x447>
+    1e7d:	80 3d c0 89 00 00 66 	cmpb   $0x66,0x89c0
+    1e84:	0f 85 2d 03 00 00    	jne    21b7 <subdir+0x447>
+  close(fd);
+    1e8a:	83 ec 0c             	sub    $0xc,%esp
+    1e8d:	53                   	push   %ebx
+    1e8e:	e8 f3 1c 00 00       	call   3b86 <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    1e93:	59                   	pop    %ecx
+    1e94:	5b                   	pop    %ebx
+    1e95:	68 82 48 00 00       	push   $0x4882
+    1e9a:	68 1e 48 00 00       	push   $0x481e
+    1e9f:	e8 1a 1d 00 00       	call   3bbe <link>
+    1ea4:	83 c4 10             	add    $0x10,%esp
+    1ea7:	85 c0                	test   %eax,%eax
+    1ea9:	0f 85 c6 03 00 00    	jne    2275 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    1eaf:	83 ec 0c             	sub    $0xc,%esp
+    1eb2:	68 1e 48 00 00       	push   $0x481e
+    1eb7:	e8 f2 1c 00 00       	call   3bae <unlink>
+    1ebc:	83 c4 10             	add    $0x10,%esp
+    1ebf:	85 c0                	test   %eax,%eax
+    1ec1:	0f 85 16 03 00 00    	jne    21dd <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1ec7:	83 ec 08             	sub    $0x8,%esp
+    1eca:	6a 00                	push   $0x0
+    1ecc:	68 1e 48 00 00       	push   $0x481e
+    1ed1:	e8 c8 1c 00 00       	call   3b9e <open>
+    1ed6:	83 c4 10             	add    $0x10,%esp
+    1ed9:	85 c0                	test   %eax,%eax
+    1edb:	0f 89 2c 04 00 00    	jns    230d <subdir+0x59d>
+  if(chdir("dd") != 0){
+    1ee1:	83 ec 0c             	sub    $0xc,%esp
+    1ee4:	68 e8 48 00 00       	push   $0x48e8
+    1ee9:	e8 e0 1c 00 00       	call   3bce <chdir>
+    1eee:	83 c4 10             	add    $0x10,%esp
+    1ef1:	85 c0                	test   %eax,%eax
+    1ef3:	0f 85 01 04 00 00    	jne    22fa <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    1ef9:	83 ec 0c             	sub    $0xc,%esp
+    1efc:	68 b6 48 00 00       	push   $0x48b6
+    1f01:	e8 c8 1c 00 00       	call   3bce <chdir>
+    1f06:	83 c4 10             	add    $0x10,%esp
+    1f09:	85 c0                	test   %eax,%eax
+    1f0b:	0f 85 b9 02 00 00    	jne    21ca <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    1f11:	83 ec 0c             	sub    $0xc,%esp
+    1f14:	68 dc 48 00 00       	push   $0x48dc
+    1f19:	e8 b0 1c 00 00       	call   3bce <chdir>
+    1f1e:	83 c4 10             	add    $0x10,%esp
+    1f21:	85 c0                	test   %eax,%eax
+    1f23:	0f 85 a1 02 00 00    	jne    21ca <subdir+0x45a>
+  if(chdir("./..") != 0){
+    1f29:	83 ec 0c             	sub    $0xc,%esp
+    1f2c:	68 eb 48 00 00       	push   $0x48eb
+    1f31:	e8 98 1c 00 00       	call   3bce <chdir>
+    1f36:	83 c4 10             	add    $0x10,%esp
+    1f39:	85 c0                	test   %eax,%eax
+    1f3b:	0f 85 21 03 00 00    	jne    2262 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    1f41:	83 ec 08             	sub    $0x8,%esp
+    1f44:	6a 00                	push   $0x0
+    1f46:	68 82 48 00 00       	push   $0x4882
+    1f4b:	e8 4e 1c 00 00       	call   3b9e <open>
+  if(fd < 0){
+    1f50:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    1f53:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1f55:	85 c0                	test   %eax,%eax
+    1f57:	0f 88 e0 04 00 00    	js     243d <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    1f5d:	83 ec 04             	sub    $0x4,%esp
+    1f60:	68 00 20 00 00       	push   $0x2000
+    1f65:	68 c0 89 00 00       	push   $0x89c0
+    1f6a:	50                   	push   %eax
+    1f6b:	e8 06 1c 00 00       	call   3b76 <read>
+    1f70:	83 c4 10             	add    $0x10,%esp
+    1f73:	83 f8 02             	cmp    $0x2,%eax
+    1f76:	0f 85 ae 04 00 00    	jne    242a <subdir+0x6ba>
+  close(fd);
+    1f7c:	83 ec 0c             	sub    $0xc,%esp
+    1f7f:	53                   	push   %ebx
+    1f80:	e8 01 1c 00 00       	call   3b86 <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1f85:	58                   	pop    %eax
+    1f86:	5a                   	pop    %edx
+    1f87:	6a 00                	push   $0x0
+    1f89:	68 1e 48 00 00       	push   $0x481e
+    1f8e:	e8 0b 1c 00 00       	call   3b9e <open>
+    1f93:	83 c4 10             	add    $0x10,%esp
+    1f96:	85 c0                	test   %eax,%eax
+    1f98:	0f 89 65 02 00 00    	jns    2203 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    1f9e:	83 ec 08             	sub    $0x8,%esp
+    1fa1:	68 02 02 00 00       	push   $0x202
+    1fa6:	68 36 49 00 00       	push   $0x4936
+    1fab:	e8 ee 1b 00 00       	call   3b9e <open>
+    1fb0:	83 c4 10             	add    $0x10,%esp
+    1fb3:	85 c0                	test   %eax,%eax
+    1fb5:	0f 89 35 02 00 00    	jns    21f0 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    1fbb:	83 ec 08             	sub    $0x8,%esp
+    1fbe:	68 02 02 00 00       	push   $0x202
+    1fc3:	68 5b 49 00 00       	push   $0x495b
+    1fc8:	e8 d1 1b 00 00       	call   3b9e <open>
+    1fcd:	83 c4 10             	add    $0x10,%esp
+    1fd0:	85 c0                	test   %eax,%eax
+    1fd2:	0f 89 0f 03 00 00    	jns    22e7 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    1fd8:	83 ec 08             	sub    $0x8,%esp
+    1fdb:	68 00 02 00 00       	push   $0x200
+    1fe0:	68 e8 48 00 00       	push   $0x48e8
+    1fe5:	e8 b4 1b 00 00       	call   3b9e <open>
+    1fea:	83 c4 10             	add    $0x10,%esp
+    1fed:	85 c0                	test   %eax,%eax
+    1fef:	0f 89 df 02 00 00    	jns    22d4 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    1ff5:	83 ec 08             	sub    $0x8,%esp
+    1ff8:	6a 02                	push   $0x2
+    1ffa:	68 e8 48 00 00       	push   $0x48e8
+    1fff:	e8 9a 1b 00 00       	call   3b9e <open>
+    2004:	83 c4 10             	add    $0x10,%esp
+    2007:	85 c0                	test   %eax,%eax
+    2009:	0f 89 b2 02 00 00    	jns    22c1 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    200f:	83 ec 08             	sub    $0x8,%esp
+    2012:	6a 01                	push   $0x1
+    2014:	68 e8 48 00 00       	push   $0x48e8
+    2019:	e8 80 1b 00 00       	call   3b9e <open>
+    201e:	83 c4 10             	add    $0x10,%esp
+    2021:	85 c0                	test   %eax,%eax
+    2023:	0f 89 85 02 00 00    	jns    22ae <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    2029:	83 ec 08             	sub    $0x8,%esp
+    202c:	68 ca 49 00 00       	push   $0x49ca
+    2031:	68 36 49 00 00       	push   $0x4936
+    2036:	e8 83 1b 00 00       	call   3bbe <link>
+    203b:	83 c4 10             	add    $0x10,%esp
+    203e:	85 c0                	test   %eax,%eax
+    2040:	0f 84 55 02 00 00    	je     229b <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    2046:	83 ec 08             	sub    $0x8,%esp
+    2049:	68 ca 49 00 00       	push   $0x49ca
+    204e:	68 5b 49 00 00       	push   $0x495b
+    2053:	e8 66 1b 00 00       	call   3bbe <link>
+    2058:	83 c4 10             	add    $0x10,%esp
+    205b:	85 c0                	test   %eax,%eax
+    205d:	0f 84 25 02 00 00    	je     2288 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2063:	83 ec 08             	sub    $0x8,%esp
+    2066:	68 82 48 00 00       	push   $0x4882
+    206b:	68 21 48 00 00       	push   $0x4821
+    2070:	e8 49 1b 00 00       	call   3bbe <link>
+    2075:	83 c4 10             	add    $0x10,%esp
+    2078:	85 c0                	test   %eax,%eax
+    207a:	0f 84 a9 01 00 00    	je     2229 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    2080:	83 ec 0c             	sub    $0xc,%esp
+    2083:	68 36 49 00 00       	push   $0x4936
+    2088:	e8 39 1b 00 00       	call   3bc6 <mkdir>
+    208d:	83 c4 10             	add    $0x10,%esp
+    2090:	85 c0                	test   %eax,%eax
+    2092:	0f 84 7e 01 00 00    	je     2216 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    2098:	83 ec 0c             	sub    $0xc,%esp
+    209b:	68 5b 49 00 00       	push   $0x495b
+    20a0:	e8 21 1b 00 00       	call   3bc6 <mkdir>
+    20a5:	83 c4 10             	add    $0x10,%esp
+    20a8:	85 c0                	test   %eax,%eax
+    20aa:	0f 84 67 03 00 00    	je     2417 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    20b0:	83 ec 0c             	sub    $0xc,%esp
+    20b3:	68 82 48 00 00       	push   $0x4882
+    20b8:	e8 09 1b 00 00       	call   3bc6 <mkdir>
+    20bd:	83 c4 10             	add    $0x10,%esp
+    20c0:	85 c0                	test   %eax,%eax
+    20c2:	0f 84 3c 03 00 00    	je     2404 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    20c8:	83 ec 0c             	sub    $0xc,%esp
+    20cb:	68 5b 49 00 00       	push   $0x495b
+    20d0:	e8 d9 1a 00 00       	call   3bae <unlink>
+    20d5:	83 c4 10             	add    $0x10,%esp
+    20d8:	85 c0                	test   %eax,%eax
+    20da:	0f 84 11 03 00 00    	je     23f1 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    20e0:	83 ec 0c             	sub    $0xc,%esp
+    20e3:	68 36 49 00 00       	push   $0x4936
+    20e8:	e8 c1 1a 00 00       	call   3bae <unlink>
+    20ed:	83 c4 10             	add    $0x10,%esp
+    20f0:	85 c0                	test   %eax,%eax
+    20f2:	0f 84 e6 02 00 00    	je     23de <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    20f8:	83 ec 0c             	sub    $0xc,%esp
+    20fb:	68 21 48 00 00       	push   $0x4821
+    2100:	e8 c9 1a 00 00       	call   3bce <chdir>
+    2105:	83 c4 10             	add    $0x10,%esp
+    2108:	85 c0                	test   %eax,%eax
+    210a:	0f 84 bb 02 00 00    	je     23cb <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    2110:	83 ec 0c             	sub    $0xc,%esp
+    2113:	68 cd 49 00 00       	push   $0x49cd
+    2118:	e8 b1 1a 00 00       	call   3bce <chdir>
+    211d:	83 c4 10             	add    $0x10,%esp
+    2120:	85 c0                	test   %eax,%eax
+    2122:	0f 84 90 02 00 00    	je     23b8 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    2128:	83 ec 0c             	sub    $0xc,%esp
+    212b:	68 82 48 00 00       	push   $0x4882
+    2130:	e8 79 1a 00 00       	call   3bae <unlink>
+    2135:	83 c4 10             	add    $0x10,%esp
+    2138:	85 c0                	test   %eax,%eax
+    213a:	0f 85 9d 00 00 00    	jne    21dd <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    2140:	83 ec 0c             	sub    $0xc,%esp
+    2143:	68 21 48 00 00       	push   $0x4821
+    2148:	e8 61 1a 00 00       	call   3bae <unlink>
+    214d:	83 c4 10             	add    $0x10,%esp
+    2150:	85 c0                	test   %eax,%eax
+    2152:	0f 85 4d 02 00 00    	jne    23a5 <subdir+0x635>
+  if(unlink("dd") == 0){
+    2158:	83 ec 0c             	sub    $0xc,%esp
+    215b:	68 e8 48 00 00       	push   $0x48e8
+    2160:	e8 49 1a 00 00       	call   3bae <unlink>
+    2165:	83 c4 10             	add    $0x10,%esp
+    2168:	85 c0                	test   %eax,%eax
+    216a:	0f 84 22 02 00 00    	je     2392 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    2170:	83 ec 0c             	sub    $0xc,%esp
+    2173:	68 fd 47 00 00       	push   $0x47fd
+    2178:	e8 31 1a 00 00       	call   3bae <unlink>
+    217d:	83 c4 10             	add    $0x10,%esp
+    2180:	85 c0                	test   %eax,%eax
+    2182:	0f 88 f7 01 00 00    	js     237f <subdir+0x60f>
+  if(unlink("dd") < 0){
+    2188:	83 ec 0c             	sub    $0xc,%esp
+    218b:	68 e8 48 00 00       	push   $0x48e8
+    2190:	e8 19 1a 00 00       	call   3bae <unlink>
+    2195:	83 c4 10             	add    $0x10,%esp
+    2198:	85 c0                	test   %eax,%eax
+    219a:	0f 88 cc 01 00 00    	js     236c <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    21a0:	83 ec 08             	sub    $0x8,%esp
+    21a3:	68 ca 4a 00 00       	push   $0x4aca
+    21a8:	6a 01                	push   $0x1
+    21aa:	e8 51 1b 00 00       	call   3d00 <printf>
+}
+    21af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    21b2:	83 c4 10             	add    $0x10,%esp
+    21b5:	c9                   	leave
+    21b6:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    21b7:	50                   	push   %eax
+    21b8:	50                   	push   %eax
+    21b9:	68 67 48 00 00       	push   $0x4867
+    21be:	6a 01                	push   $0x1
+    21c0:	e8 3b 1b 00 00       	call   3d00 <printf>
+    exit();
+    21c5:	e8 94 19 00 00       	call   3b5e <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    21ca:	50                   	push   %eax
+    21cb:	50                   	push   %eax
+    21cc:	68 c2 48 00 00       	push   $0x48c2
+    21d1:	6a 01                	push   $0x1
+    21d3:	e8 28 1b 00 00       	call   3d00 <printf>
+    exit();
+    21d8:	e8 81 19 00 00       	call   3b5e <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    21dd:	50                   	push   %eax
+    21de:	50                   	push   %eax
+    21df:	68 8d 48 00 00       	push   $0x488d
+    21e4:	6a 01                	push   $0x1
+    21e6:	e8 15 1b 00 00       	call   3d00 <printf>
+    exit();
+    21eb:	e8 6e 19 00 00       	call   3b5e <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    21f0:	51                   	push   %ecx
+    21f1:	51                   	push   %ecx
+    21f2:	68 3f 49 00 00       	push   $0x493f
+    21f7:	6a 01                	push   $0x1
+    21f9:	e8 02 1b 00 00       	call   3d00 <printf>
+    exit();
+    21fe:	e8 5b 19 00 00       	call   3b5e <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    2203:	53                   	push   %ebx
+    2204:	53                   	push   %ebx
+    2205:	68 fc 53 00 00       	push   $0x53fc
+    220a:	6a 01                	push   $0x1
+    220c:	e8 ef 1a 00 00       	call   3d00 <printf>
+    exit();
+    2211:	e8 48 19 00 00       	call   3b5e <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    2216:	51                   	push   %ecx
+    2217:	51                   	push   %ecx
+    2218:	68 d3 49 00 00       	push   $0x49d3
+    221d:	6a 01                	push   $0x1
+    221f:	e8 dc 1a 00 00       	call   3d00 <printf>
+    exit();
+    2224:	e8 35 19 00 00       	call   3b5e <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    2229:	53                   	push   %ebx
+    222a:	53                   	push   %ebx
+    222b:	68 6c 54 00 00       	push   $0x546c
+    2230:	6a 01                	push   $0x1
+    2232:	e8 c9 1a 00 00       	call   3d00 <printf>
+    exit();
+    2237:	e8 22 19 00 00       	call   3b5e <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    223c:	50                   	push   %eax
+    223d:	50                   	push   %eax
+    223e:	68 4e 48 00 00       	push   $0x484e
+    2243:	6a 01                	push   $0x1
+    2245:	e8 b6 1a 00 00       	call   3d00 <printf>
+    exit();
+    224a:	e8 0f 19 00 00       	call   3b5e <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    224f:	51                   	push   %ecx
+    2250:	51                   	push   %ecx
+    2251:	68 27 48 00 00       	push   $0x4827
+    2256:	6a 01                	push   $0x1
+    2258:	e8 a3 1a 00 00       	call   3d00 <printf>
+    exit();
+    225d:	e8 fc 18 00 00       	call   3b5e <exit>
+    printf(1, "chdir ./.. failed\n");
+    2262:	50                   	push   %eax
+    2263:	50                   	push   %eax
+    2264:	68 f0 48 00 00       	push   $0x48f0
+    2269:	6a 01                	push   $0x1
+    226b:	e8 90 1a 00 00       	call   3d00 <printf>
+    exit();
+    2270:	e8 e9 18 00 00       	call   3b5e <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    2275:	52                   	push   %edx
+    2276:	52                   	push   %edx
+    2277:	68 b4 53 00 00       	push   $0x53b4
+    227c:	6a 01                	push   $0x1
+    227e:	e8 7d 1a 00 00       	call   3d00 <printf>
+    exit();
+    2283:	e8 d6 18 00 00       	call   3b5e <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    2288:	50                   	push   %eax
+    2289:	50                   	push   %eax
+    228a:	68 48 54 00 00       	push   $0x5448
+    228f:	6a 01                	push   $0x1
+    2291:	e8 6a 1a 00 00       	call   3d00 <printf>
+    exit();
+    2296:	e8 c3 18 00 00       	call   3b5e <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    229b:	50                   	push   %eax
+    229c:	50                   	push   %eax
+    229d:	68 24 54 00 00       	push   $0x5424
+    22a2:	6a 01                	push   $0x1
+    22a4:	e8 57 1a 00 00       	call   3d00 <printf>
+    exit();
+    22a9:	e8 b0 18 00 00       	call   3b5e <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    22ae:	50                   	push   %eax
+    22af:	50                   	push   %eax
+    22b0:	68 af 49 00 00       	push   $0x49af
+    22b5:	6a 01                	push   $0x1
+    22b7:	e8 44 1a 00 00       	call   3d00 <printf>
+    exit();
+    22bc:	e8 9d 18 00 00       	call   3b5e <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    22c1:	50                   	push   %eax
+    22c2:	50                   	push   %eax
+    22c3:	68 96 49 00 00       	push   $0x4996
+    22c8:	6a 01                	push   $0x1
+    22ca:	e8 31 1a 00 00       	call   3d00 <printf>
+    exit();
+    22cf:	e8 8a 18 00 00       	call   3b5e <exit>
+    printf(1, "create dd succeeded!\n");
+    22d4:	50                   	push   %eax
+    22d5:	50                   	push   %eax
+    22d6:	68 80 49 00 00       	push   $0x4980
+    22db:	6a 01                	push   $0x1
+    22dd:	e8 1e 1a 00 00       	call   3d00 <printf>
+    exit();
+    22e2:	e8 77 18 00 00       	call   3b5e <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    22e7:	52                   	push   %edx
+    22e8:	52                   	push   %edx
+    22e9:	68 64 49 00 00       	push   $0x4964
+    22ee:	6a 01                	push   $0x1
+    22f0:	e8 0b 1a 00 00       	call   3d00 <printf>
+    exit();
+    22f5:	e8 64 18 00 00       	call   3b5e <exit>
+    printf(1, "chdir dd failed\n");
+    22fa:	50                   	push   %eax
+    22fb:	50                   	push   %eax
+    22fc:	68 a5 48 00 00       	push   $0x48a5
+    2301:	6a 01                	push   $0x1
+    2303:	e8 f8 19 00 00       	call   3d00 <printf>
+    exit();
+    2308:	e8 51 18 00 00       	call   3b5e <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    230d:	50                   	push   %eax
+    230e:	50                   	push   %eax
+    230f:	68 d8 53 00 00       	push   $0x53d8
+    2314:	6a 01                	push   $0x1
+    2316:	e8 e5 19 00 00       	call   3d00 <printf>
+    exit();
+    231b:	e8 3e 18 00 00       	call   3b5e <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    2320:	53                   	push   %ebx
+    2321:	53                   	push   %ebx
+    2322:	68 03 48 00 00       	push   $0x4803
+    2327:	6a 01                	push   $0x1
+    2329:	e8 d2 19 00 00       	call   3d00 <printf>
+    exit();
+    232e:	e8 2b 18 00 00       	call   3b5e <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    2333:	50                   	push   %eax
+    2334:	50                   	push   %eax
+    2335:	68 8c 53 00 00       	push   $0x538c
+    233a:	6a 01                	push   $0x1
+    233c:	e8 bf 19 00 00       	call   3d00 <printf>
+    exit();
+    2341:	e8 18 18 00 00       	call   3b5e <exit>
+    printf(1, "create dd/ff failed\n");
+    2346:	50                   	push   %eax
+    2347:	50                   	push   %eax
+    2348:	68 e7 47 00 00       	push   $0x47e7
+    234d:	6a 01                	push   $0x1
+    234f:	e8 ac 19 00 00       	call   3d00 <printf>
+    exit();
+    2354:	e8 05 18 00 00       	call   3b5e <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    2359:	50                   	push   %eax
+    235a:	50                   	push   %eax
+    235b:	68 cf 47 00 00       	push   $0x47cf
+    2360:	6a 01                	push   $0x1
+    2362:	e8 99 19 00 00       	call   3d00 <printf>
+    exit();
+    2367:	e8 f2 17 00 00       	call   3b5e <exit>
+    printf(1, "unlink dd failed\n");
+    236c:	50                   	push   %eax
+    236d:	50                   	push   %eax
+    236e:	68 b8 4a 00 00       	push   $0x4ab8
+    2373:	6a 01                	push   $0x1
+    2375:	e8 86 19 00 00       	call   3d00 <printf>
+    exit();
+    237a:	e8 df 17 00 00       	call   3b5e <exit>
+    printf(1, "unlink dd/dd failed\n");
+    237f:	52                   	push   %edx
+    2380:	52                   	push   %edx
+    2381:	68 a3 4a 00 00       	push   $0x4aa3
+    2386:	6a 01                	push   $0x1
+    2388:	e8 73 19 00 00       	call   3d00 <printf>
+    exit();
+    238d:	e8 cc 17 00 00       	call   3b5e <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    2392:	51                   	push   %ecx
+    2393:	51                   	push   %ecx
+    2394:	68 90 54 00 00       	push   $0x5490
+    2399:	6a 01                	push   $0x1
+    239b:	e8 60 19 00 00       	call   3d00 <printf>
+    exit();
+    23a0:	e8 b9 17 00 00       	call   3b5e <exit>
+    printf(1, "unlink dd/ff failed\n");
+    23a5:	53                   	push   %ebx
+    23a6:	53                   	push   %ebx
+    23a7:	68 8e 4a 00 00       	push   $0x4a8e
+    23ac:	6a 01                	push   $0x1
+    23ae:	e8 4d 19 00 00       	call   3d00 <printf>
+    exit();
+    23b3:	e8 a6 17 00 00       	call   3b5e <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    23b8:	50                   	push   %eax
+    23b9:	50                   	push   %eax
+    23ba:	68 76 4a 00 00       	push   $0x4a76
+    23bf:	6a 01                	push   $0x1
+    23c1:	e8 3a 19 00 00       	call   3d00 <printf>
+    exit();
+    23c6:	e8 93 17 00 00       	call   3b5e <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    23cb:	50                   	push   %eax
+    23cc:	50                   	push   %eax
+    23cd:	68 5e 4a 00 00       	push   $0x4a5e
+    23d2:	6a 01                	push   $0x1
+    23d4:	e8 27 19 00 00       	call   3d00 <printf>
+    exit();
+    23d9:	e8 80 17 00 00       	call   3b5e <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    23de:	50                   	push   %eax
+    23df:	50                   	push   %eax
+    23e0:	68 42 4a 00 00       	push   $0x4a42
+    23e5:	6a 01                	push   $0x1
+    23e7:	e8 14 19 00 00       	call   3d00 <printf>
+    exit();
+    23ec:	e8 6d 17 00 00       	call   3b5e <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    23f1:	50                   	push   %eax
+    23f2:	50                   	push   %eax
+    23f3:	68 26 4a 00 00       	push   $0x4a26
+    23f8:	6a 01                	push   $0x1
+    23fa:	e8 01 19 00 00       	call   3d00 <printf>
+    exit();
+    23ff:	e8 5a 17 00 00       	call   3b5e <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    2404:	50                   	push   %eax
+    2405:	50                   	push   %eax
+    2406:	68 09 4a 00 00       	push   $0x4a09
+    240b:	6a 01                	push   $0x1
+    240d:	e8 ee 18 00 00       	call   3d00 <printf>
+    exit();
+    2412:	e8 47 17 00 00       	call   3b5e <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    2417:	52                   	push   %edx
+    2418:	52                   	push   %edx
+    2419:	68 ee 49 00 00       	push   $0x49ee
+    241e:	6a 01                	push   $0x1
+    2420:	e8 db 18 00 00       	call   3d00 <printf>
+    exit();
+    2425:	e8 34 17 00 00       	call   3b5e <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    242a:	51                   	push   %ecx
+    242b:	51                   	push   %ecx
+    242c:	68 1b 49 00 00       	push   $0x491b
+    2431:	6a 01                	push   $0x1
+    2433:	e8 c8 18 00 00       	call   3d00 <printf>
+    exit();
+    2438:	e8 21 17 00 00       	call   3b5e <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    243d:	53                   	push   %ebx
+    243e:	53                   	push   %ebx
+    243f:	68 03 49 00 00       	push   $0x4903
+    2444:	6a 01                	push   $0x1
+    2446:	e8 b5 18 00 00       	call   3d00 <printf>
+    exit();
+    244b:	e8 0e 17 00 00       	call   3b5e <exit>
+
+00002450 <bigwrite>:
+{
+    2450:	55                   	push   %ebp
+    2451:	89 e5                	mov    %esp,%ebp
+    2453:	56                   	push   %esi
+    2454:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    2455:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    245a:	83 ec 08             	sub    $0x8,%esp
+    245d:	68 d5 4a 00 00       	push   $0x4ad5
+    2462:	6a 01                	push   $0x1
+    2464:	e8 97 18 00 00       	call   3d00 <printf>
+  unlink("bigwrite");
+    2469:	c7 04 24 e4 4a 00 00 	movl   $0x4ae4,(%esp)
+    2470:	e8 39 17 00 00       	call   3bae <unlink>
+    2475:	83 c4 10             	add    $0x10,%esp
+    2478:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    247f:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2480:	83 ec 08             	sub    $0x8,%esp
+    2483:	68 02 02 00 00       	push   $0x202
+    2488:	68 e4 4a 00 00       	push   $0x4ae4
+    248d:	e8 0c 17 00 00       	call   3b9e <open>
+    if(fd < 0){
+    2492:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2495:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    2497:	85 c0                	test   %eax,%eax
+    2499:	78 7e                	js     2519 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    249b:	83 ec 04             	sub    $0x4,%esp
+    249e:	53                   	push   %ebx
+    249f:	68 c0 89 00 00       	push   $0x89c0
+    24a4:	50                   	push   %eax
+    24a5:	e8 d4 16 00 00       	call   3b7e <write>
+      if(cc != sz){
+    24aa:	83 c4 10             	add    $0x10,%esp
+    24ad:	39 d8                	cmp    %ebx,%eax
+    24af:	75 55                	jne    2506 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    24b1:	83 ec 04             	sub    $0x4,%esp
+    24b4:	53                   	push   %ebx
+    24b5:	68 c0 89 00 00       	push   $0x89c0
+    24ba:	56                   	push   %esi
+    24bb:	e8 be 16 00 00       	call   3b7e <write>
+      if(cc != sz){
+    24c0:	83 c4 10             	add    $0x10,%esp
+    24c3:	39 c3                	cmp    %eax,%ebx
+    24c5:	75 3f                	jne    2506 <bigwrite+0xb6>
+    close(fd);
+    24c7:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    24ca:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    24d0:	56                   	push   %esi
+    24d1:	e8 b0 16 00 00       	call   3b86 <close>
+    unlink("bigwrite");
+    24d6:	c7 04 24 e4 4a 00 00 	movl   $0x4ae4,(%esp)
+    24dd:	e8 cc 16 00 00       	call   3bae <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    24e2:	83 c4 10             	add    $0x10,%esp
+    24e5:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    24eb:	75 93                	jne    2480 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    24ed:	83 ec 08             	sub    $0x8,%esp
+    24f0:	68 17 4b 00 00       	push   $0x4b17
+    24f5:	6a 01                	push   $0x1
+    24f7:	e8 04 18 00 00       	call   3d00 <printf>
+}
+    24fc:	83 c4 10             	add    $0x10,%esp
+    24ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2502:	5b                   	pop    %ebx
+    2503:	5e                   	pop    %esi
+    2504:	5d                   	pop    %ebp
+    2505:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    2506:	50                   	push   %eax
+    2507:	53                   	push   %ebx
+    2508:	68 05 4b 00 00       	push   $0x4b05
+    250d:	6a 01                	push   $0x1
+    250f:	e8 ec 17 00 00       	call   3d00 <printf>
+        exit();
+    2514:	e8 45 16 00 00       	call   3b5e <exit>
+      printf(1, "cannot create bigwrite\n");
+    2519:	83 ec 08             	sub    $0x8,%esp
+    251c:	68 ed 4a 00 00       	push   $0x4aed
+    2521:	6a 01                	push   $0x1
+    2523:	e8 d8 17 00 00       	call   3d00 <printf>
+      exit();
+    2528:	e8 31 16 00 00       	call   3b5e <exit>
+    252d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002530 <bigfile>:
+{
+    2530:	55                   	push   %ebp
+    2531:	89 e5                	mov    %esp,%ebp
+    2533:	57                   	push   %edi
+    2534:	56                   	push   %esi
+    2535:	53                   	push   %ebx
+    2536:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    2539:	68 24 4b 00 00       	push   $0x4b24
+    253e:	6a 01                	push   $0x1
+    2540:	e8 bb 17 00 00       	call   3d00 <printf>
+  unlink("bigfile");
+    2545:	c7 04 24 40 4b 00 00 	movl   $0x4b40,(%esp)
+    254c:	e8 5d 16 00 00       	call   3bae <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    2551:	58                   	pop    %eax
+    2552:	5a                   	pop    %edx
+    2553:	68 02 02 00 00       	push   $0x202
+    2558:	68 40 4b 00 00       	push   $0x4b40
+    255d:	e8 3c 16 00 00       	call   3b9e <open>
+  if(fd < 0){
+    2562:	83 c4 10             	add    $0x10,%esp
+    2565:	85 c0                	test   %eax,%eax
+    2567:	0f 88 5e 01 00 00    	js     26cb <bigfile+0x19b>
+    256d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    256f:	31 db                	xor    %ebx,%ebx
+    2571:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    2578:	83 ec 04             	sub    $0x4,%esp
+    257b:	68 58 02 00 00       	push   $0x258
+    2580:	53                   	push   %ebx
+    2581:	68 c0 89 00 00       	push   $0x89c0
+    2586:	e8 45 14 00 00       	call   39d0 <memset>
+    if(write(fd, buf, 600) != 600){
+    258b:	83 c4 0c             	add    $0xc,%esp
+    258e:	68 58 02 00 00       	push   $0x258
+    2593:	68 c0 89 00 00       	push   $0x89c0
+    2598:	56                   	push   %esi
+    2599:	e8 e0 15 00 00       	call   3b7e <write>
+    259e:	83 c4 10             	add    $0x10,%esp
+    25a1:	3d 58 02 00 00       	cmp    $0x258,%eax
+    25a6:	0f 85 f8 00 00 00    	jne    26a4 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    25ac:	83 c3 01             	add    $0x1,%ebx
+    25af:	83 fb 14             	cmp    $0x14,%ebx
+    25b2:	75 c4                	jne    2578 <bigfile+0x48>
+  close(fd);
+    25b4:	83 ec 0c             	sub    $0xc,%esp
+    25b7:	56                   	push   %esi
+    25b8:	e8 c9 15 00 00       	call   3b86 <close>
+  fd = open("bigfile", 0);
+    25bd:	5e                   	pop    %esi
+    25be:	5f                   	pop    %edi
+    25bf:	6a 00                	push   $0x0
+    25c1:	68 40 4b 00 00       	push   $0x4b40
+    25c6:	e8 d3 15 00 00       	call   3b9e <open>
+  if(fd < 0){
+    25cb:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    25ce:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    25d0:	85 c0                	test   %eax,%eax
+    25d2:	0f 88 e0 00 00 00    	js     26b8 <bigfile+0x188>
+  total = 0;
+    25d8:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    25da:	31 ff                	xor    %edi,%edi
+    25dc:	eb 30                	jmp    260e <bigfile+0xde>
+    25de:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    25e0:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    25e5:	0f 85 91 00 00 00    	jne    267c <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    25eb:	89 fa                	mov    %edi,%edx
+    25ed:	0f be 05 c0 89 00 00 	movsbl 0x89c0,%eax
+    25f4:	d1 fa                	sar    %edx
+    25f6:	39 d0                	cmp    %edx,%eax
+    25f8:	75 6e                	jne    2668 <bigfile+0x138>
+    25fa:	0f be 15 eb 8a 00 00 	movsbl 0x8aeb,%edx
+    2601:	39 d0                	cmp    %edx,%eax
+    2603:	75 63                	jne    2668 <bigfile+0x138>
+    total += cc;
+    2605:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    260b:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    260e:	83 ec 04             	sub    $0x4,%esp
+    2611:	68 2c 01 00 00       	push   $0x12c
+    2616:	68 c0 89 00 00       	push   $0x89c0
+    261b:	56                   	push   %esi
+    261c:	e8 55 15 00 00       	call   3b76 <read>
+    if(cc < 0){
+    2621:	83 c4 10             	add    $0x10,%esp
+    2624:	85 c0                	test   %eax,%eax
+    2626:	78 68                	js     2690 <bigfile+0x160>
+    if(cc == 0)
+    2628:	75 b6                	jne    25e0 <bigfile+0xb0>
+  close(fd);
+    262a:	83 ec 0c             	sub    $0xc,%esp
+    262d:	56                   	push   %esi
+    262e:	e8 53 15 00 00       	call   3b86 <close>
+  if(total != 20*600){
+    2633:	83 c4 10             	add    $0x10,%esp
+    2636:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    263c:	0f 85 9c 00 00 00    	jne    26de <bigfile+0x1ae>
+  unlink("bigfile");
+    2642:	83 ec 0c             	sub    $0xc,%esp
+    2645:	68 40 4b 00 00       	push   $0x4b40
+    264a:	e8 5f 15 00 00       	call   3bae <unlink>
+  printf(1, "bigfile test ok\n");
+    264f:	58                   	pop    %eax
+    2650:	5a                   	pop    %edx
+    2651:	68 cf 4b 00 00       	push   $0x4bcf
+    2656:	6a 01                	push   $0x1
+    2658:	e8 a3 16 00 00       	call   3d00 <printf>
+}
+    265d:	83 c4 10             	add    $0x10,%esp
+    2660:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2663:	5b                   	pop    %ebx
+    2664:	5e                   	pop    %esi
+    2665:	5f                   	pop    %edi
+    2666:	5d                   	pop    %ebp
+    2667:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    2668:	83 ec 08             	sub    $0x8,%esp
+    266b:	68 9c 4b 00 00       	push   $0x4b9c
+    2670:	6a 01                	push   $0x1
+    2672:	e8 89 16 00 00       	call   3d00 <printf>
+      exit();
+    2677:	e8 e2 14 00 00       	call   3b5e <exit>
+      printf(1, "short read bigfile\n");
+    267c:	83 ec 08             	sub    $0x8,%esp
+    267f:	68 88 4b 00 00       	push   $0x4b88
+    2684:	6a 01                	push   $0x1
+    2686:	e8 75 16 00 00       	call   3d00 <printf>
+      exit();
+    268b:	e8 ce 14 00 00       	call   3b5e <exit>
+      printf(1, "read bigfile failed\n");
+    2690:	83 ec 08             	sub    $0x8,%esp
+    2693:	68 73 4b 00 00       	push   $0x4b73
+    2698:	6a 01                	push   $0x1
+    269a:	e8 61 16 00 00       	call   3d00 <printf>
+      exit();
+    269f:	e8 ba 14 00 00       	call   3b5e <exit>
+      printf(1, "write bigfile failed\n");
+    26a4:	83 ec 08             	sub    $0x8,%esp
+    26a7:	68 48 4b 00 00       	push   $0x4b48
+    26ac:	6a 01                	push   $0x1
+    26ae:	e8 4d 16 00 00       	call   3d00 <printf>
+      exit();
+    26b3:	e8 a6 14 00 00       	call   3b5e <exit>
+    printf(1, "cannot open bigfile\n");
+    26b8:	53                   	push   %ebx
+    26b9:	53                   	push   %ebx
+    26ba:	68 5e 4b 00 00       	push   $0x4b5e
+    26bf:	6a 01                	push   $0x1
+    26c1:	e8 3a 16 00 00       	call   3d00 <printf>
+    exit();
+    26c6:	e8 93 14 00 00       	call   3b5e <exit>
+    printf(1, "cannot create bigfile");
+    26cb:	50                   	push   %eax
+    26cc:	50                   	push   %eax
+    26cd:	68 32 4b 00 00       	push   $0x4b32
+    26d2:	6a 01                	push   $0x1
+    26d4:	e8 27 16 00 00       	call   3d00 <printf>
+    exit();
+    26d9:	e8 80 14 00 00       	call   3b5e <exit>
+    printf(1, "read bigfile wrong total\n");
+    26de:	51                   	push   %ecx
+    26df:	51                   	push   %ecx
+    26e0:	68 b5 4b 00 00       	push   $0x4bb5
+    26e5:	6a 01                	push   $0x1
+    26e7:	e8 14 16 00 00       	call   3d00 <printf>
+    exit();
+    26ec:	e8 6d 14 00 00       	call   3b5e <exit>
+    26f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    26f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    26ff:	90                   	nop
+
+00002700 <fourteen>:
+{
+    2700:	55                   	push   %ebp
+    2701:	89 e5                	mov    %esp,%ebp
+    2703:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    2706:	68 e0 4b 00 00       	push   $0x4be0
+    270b:	6a 01                	push   $0x1
+    270d:	e8 ee 15 00 00       	call   3d00 <printf>
+  if(mkdir("12345678901234") != 0){
+    2712:	c7 04 24 1b 4c 00 00 	movl   $0x4c1b,(%esp)
+    2719:	e8 a8 14 00 00       	call   3bc6 <mkdir>
+    271e:	83 c4 10             	add    $0x10,%esp
+    2721:	85 c0                	test   %eax,%eax
+    2723:	0f 85 97 00 00 00    	jne    27c0 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    2729:	83 ec 0c             	sub    $0xc,%esp
+    272c:	68 b0 54 00 00       	push   $0x54b0
+    2731:	e8 90 14 00 00       	call   3bc6 <mkdir>
+    2736:	83 c4 10             	add    $0x10,%esp
+    2739:	85 c0                	test   %eax,%eax
+    273b:	0f 85 de 00 00 00    	jne    281f <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    2741:	83 ec 08             	sub    $0x8,%esp
+    2744:	68 00 02 00 00       	push   $0x200
+    2749:	68 00 55 00 00       	push   $0x5500
+    274e:	e8 4b 14 00 00       	call   3b9e <open>
+  if(fd < 0){
+    2753:	83 c4 10             	add    $0x10,%esp
+    2756:	85 c0                	test   %eax,%eax
+    2758:	0f 88 ae 00 00 00    	js     280c <fourteen+0x10c>
+  close(fd);
+    275e:	83 ec 0c             	sub    $0xc,%esp
+    2761:	50                   	push   %eax
+    2762:	e8 1f 14 00 00       	call   3b86 <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    2767:	58                   	pop    %eax
+    2768:	5a                   	pop    %edx
+    2769:	6a 00                	push   $0x0
+    276b:	68 70 55 00 00       	push   $0x5570
+    2770:	e8 29 14 00 00       	call   3b9e <open>
+  if(fd < 0){
+    2775:	83 c4 10             	add    $0x10,%esp
+    2778:	85 c0                	test   %eax,%eax
+    277a:	78 7d                	js     27f9 <fourteen+0xf9>
+  close(fd);
+    277c:	83 ec 0c             	sub    $0xc,%esp
+    277f:	50                   	push   %eax
+    2780:	e8 01 14 00 00       	call   3b86 <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    2785:	c7 04 24 0c 4c 00 00 	movl   $0x4c0c,(%esp)
+    278c:	e8 35 14 00 00       	call   3bc6 <mkdir>
+    2791:	83 c4 10             	add    $0x10,%esp
+    2794:	85 c0                	test   %eax,%eax
+    2796:	74 4e                	je     27e6 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    2798:	83 ec 0c             	sub    $0xc,%esp
+    279b:	68 0c 56 00 00       	push   $0x560c
+    27a0:	e8 21 14 00 00       	call   3bc6 <mkdir>
+    27a5:	83 c4 10             	add    $0x10,%esp
+    27a8:	85 c0                	test   %eax,%eax
+    27aa:	74 27                	je     27d3 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    27ac:	83 ec 08             	sub    $0x8,%esp
+    27af:	68 2a 4c 00 00       	push   $0x4c2a
+    27b4:	6a 01                	push   $0x1
+    27b6:	e8 45 15 00 00       	call   3d00 <printf>
+}
+    27bb:	83 c4 10             	add    $0x10,%esp
+    27be:	c9                   	leave
+    27bf:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    27c0:	50                   	push   %eax
+    27c1:	50                   	push   %eax
+    27c2:	68 ef 4b 00 00       	push   $0x4bef
+    27c7:	6a 01                	push   $0x1
+    27c9:	e8 32 15 00 00       	call   3d00 <printf>
+    exit();
+    27ce:	e8 8b 13 00 00       	call   3b5e <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    27d3:	50                   	push   %eax
+    27d4:	50                   	push   %eax
+    27d5:	68 2c 56 00 00       	push   $0x562c
+    27da:	6a 01                	push   $0x1
+    27dc:	e8 1f 15 00 00       	call   3d00 <printf>
+    exit();
+    27e1:	e8 78 13 00 00       	call   3b5e <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    27e6:	52                   	push   %edx
+    27e7:	52                   	push   %edx
+    27e8:	68 dc 55 00 00       	push   $0x55dc
+    27ed:	6a 01                	push   $0x1
+    27ef:	e8 0c 15 00 00       	call   3d00 <printf>
+    exit();
+    27f4:	e8 65 13 00 00       	call   3b5e <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    27f9:	51                   	push   %ecx
+    27fa:	51                   	push   %ecx
+    27fb:	68 a0 55 00 00       	push   $0x55a0
+    2800:	6a 01                	push   $0x1
+    2802:	e8 f9 14 00 00       	call   3d00 <printf>
+    exit();
+    2807:	e8 52 13 00 00       	call   3b5e <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    280c:	51                   	push   %ecx
+    280d:	51                   	push   %ecx
+    280e:	68 30 55 00 00       	push   $0x5530
+    2813:	6a 01                	push   $0x1
+    2815:	e8 e6 14 00 00       	call   3d00 <printf>
+    exit();
+    281a:	e8 3f 13 00 00       	call   3b5e <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    281f:	50                   	push   %eax
+    2820:	50                   	push   %eax
+    2821:	68 d0 54 00 00       	push   $0x54d0
+    2826:	6a 01                	push   $0x1
+    2828:	e8 d3 14 00 00       	call   3d00 <printf>
+    exit();
+    282d:	e8 2c 13 00 00       	call   3b5e <exit>
+    2832:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2839:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002840 <rmdot>:
+{
+    2840:	55                   	push   %ebp
+    2841:	89 e5                	mov    %esp,%ebp
+    2843:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    2846:	68 37 4c 00 00       	push   $0x4c37
+    284b:	6a 01                	push   $0x1
+    284d:	e8 ae 14 00 00       	call   3d00 <printf>
+  if(mkdir("dots") != 0){
+    2852:	c7 04 24 43 4c 00 00 	movl   $0x4c43,(%esp)
+    2859:	e8 68 13 00 00       	call   3bc6 <mkdir>
+    285e:	83 c4 10             	add    $0x10,%esp
+    2861:	85 c0                	test   %eax,%eax
+    2863:	0f 85 b0 00 00 00    	jne    2919 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    2869:	83 ec 0c             	sub    $0xc,%esp
+    286c:	68 43 4c 00 00       	push   $0x4c43
+    2871:	e8 58 13 00 00       	call   3bce <chdir>
+    2876:	83 c4 10             	add    $0x10,%esp
+    2879:	85 c0                	test   %eax,%eax
+    287b:	0f 85 1d 01 00 00    	jne    299e <rmdot+0x15e>
+  if(unlink(".") == 0){
+    2881:	83 ec 0c             	sub    $0xc,%esp
+    2884:	68 ee 48 00 00       	push   $0x48ee
+    2889:	e8 20 13 00 00       	call   3bae <unlink>
+    288e:	83 c4 10             	add    $0x10,%esp
+    2891:	85 c0                	test   %eax,%eax
+    2893:	0f 84 f2 00 00 00    	je     298b <rmdot+0x14b>
+  if(unlink("..") == 0){
+    2899:	83 ec 0c             	sub    $0xc,%esp
+    289c:	68 ed 48 00 00       	push   $0x48ed
+    28a1:	e8 08 13 00 00       	call   3bae <unlink>
+    28a6:	83 c4 10             	add    $0x10,%esp
+    28a9:	85 c0                	test   %eax,%eax
+    28ab:	0f 84 c7 00 00 00    	je     2978 <rmdot+0x138>
+  if(chdir("/") != 0){
+    28b1:	83 ec 0c             	sub    $0xc,%esp
+    28b4:	68 c1 40 00 00       	push   $0x40c1
+    28b9:	e8 10 13 00 00       	call   3bce <chdir>
+    28be:	83 c4 10             	add    $0x10,%esp
+    28c1:	85 c0                	test   %eax,%eax
+    28c3:	0f 85 9c 00 00 00    	jne    2965 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    28c9:	83 ec 0c             	sub    $0xc,%esp
+    28cc:	68 8b 4c 00 00       	push   $0x4c8b
+    28d1:	e8 d8 12 00 00       	call   3bae <unlink>
+    28d6:	83 c4 10             	add    $0x10,%esp
+    28d9:	85 c0                	test   %eax,%eax
+    28db:	74 75                	je     2952 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    28dd:	83 ec 0c             	sub    $0xc,%esp
+    28e0:	68 a9 4c 00 00       	push   $0x4ca9
+    28e5:	e8 c4 12 00 00       	call   3bae <unlink>
+    28ea:	83 c4 10             	add    $0x10,%esp
+    28ed:	85 c0                	test   %eax,%eax
+    28ef:	74 4e                	je     293f <rmdot+0xff>
+  if(unlink("dots") != 0){
+    28f1:	83 ec 0c             	sub    $0xc,%esp
+    28f4:	68 43 4c 00 00       	push   $0x4c43
+    28f9:	e8 b0 12 00 00       	call   3bae <unlink>
+    28fe:	83 c4 10             	add    $0x10,%esp
+    2901:	85 c0                	test   %eax,%eax
+    2903:	75 27                	jne    292c <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    2905:	83 ec 08             	sub    $0x8,%esp
+    2908:	68 de 4c 00 00       	push   $0x4cde
+    290d:	6a 01                	push   $0x1
+    290f:	e8 ec 13 00 00       	call   3d00 <printf>
+}
+    2914:	83 c4 10             	add    $0x10,%esp
+    2917:	c9                   	leave
+    2918:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    2919:	50                   	push   %eax
+    291a:	50                   	push   %eax
+    291b:	68 48 4c 00 00       	push   $0x4c48
+    2920:	6a 01                	push   $0x1
+    2922:	e8 d9 13 00 00       	call   3d00 <printf>
+    exit();
+    2927:	e8 32 12 00 00       	call   3b5e <exit>
+    printf(1, "unlink dots failed!\n");
+    292c:	50                   	push   %eax
+    292d:	50                   	push   %eax
+    292e:	68 c9 4c 00 00       	push   $0x4cc9
+    2933:	6a 01                	push   $0x1
+    2935:	e8 c6 13 00 00       	call   3d00 <printf>
+    exit();
+    293a:	e8 1f 12 00 00       	call   3b5e <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    293f:	52                   	push   %edx
+    2940:	52                   	push   %edx
+    2941:	68 b1 4c 00 00       	push   $0x4cb1
+    2946:	6a 01                	push   $0x1
+    2948:	e8 b3 13 00 00       	call   3d00 <printf>
+    exit();
+    294d:	e8 0c 12 00 00       	call   3b5e <exit>
+    printf(1, "unlink dots/. worked!\n");
+    2952:	51                   	push   %ecx
+    2953:	51                   	push   %ecx
+    2954:	68 92 4c 00 00       	push   $0x4c92
+    2959:	6a 01                	push   $0x1
+    295b:	e8 a0 13 00 00       	call   3d00 <printf>
+    exit();
+    2960:	e8 f9 11 00 00       	call   3b5e <exit>
+    printf(1, "chdir / failed\n");
+    2965:	50                   	push   %eax
+    2966:	50                   	push   %eax
+    2967:	68 c3 40 00 00       	push   $0x40c3
+    296c:	6a 01                	push   $0x1
+    296e:	e8 8d 13 00 00       	call   3d00 <printf>
+    exit();
+    2973:	e8 e6 11 00 00       	call   3b5e <exit>
+    printf(1, "rm .. worked!\n");
+    2978:	50                   	push   %eax
+    2979:	50                   	push   %eax
+    297a:	68 7c 4c 00 00       	push   $0x4c7c
+    297f:	6a 01                	push   $0x1
+    2981:	e8 7a 13 00 00       	call   3d00 <printf>
+    exit();
+    2986:	e8 d3 11 00 00       	call   3b5e <exit>
+    printf(1, "rm . worked!\n");
+    298b:	50                   	push   %eax
+    298c:	50                   	push   %eax
+    298d:	68 6e 4c 00 00       	push   $0x4c6e
+    2992:	6a 01                	push   $0x1
+    2994:	e8 67 13 00 00       	call   3d00 <printf>
+    exit();
+    2999:	e8 c0 11 00 00       	call   3b5e <exit>
+    printf(1, "chdir dots failed\n");
+    299e:	50                   	push   %eax
+    299f:	50                   	push   %eax
+    29a0:	68 5b 4c 00 00       	push   $0x4c5b
+    29a5:	6a 01                	push   $0x1
+    29a7:	e8 54 13 00 00       	call   3d00 <printf>
+    exit();
+    29ac:	e8 ad 11 00 00       	call   3b5e <exit>
+    29b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    29b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    29bf:	90                   	nop
+
+000029c0 <dirfile>:
+{
+    29c0:	55                   	push   %ebp
+    29c1:	89 e5                	mov    %esp,%ebp
+    29c3:	53                   	push   %ebx
+    29c4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    29c7:	68 e8 4c 00 00       	push   $0x4ce8
+    29cc:	6a 01                	push   $0x1
+    29ce:	e8 2d 13 00 00       	call   3d00 <printf>
+  fd = open("dirfile", O_CREATE);
+    29d3:	5b                   	pop    %ebx
+    29d4:	58                   	pop    %eax
+    29d5:	68 00 02 00 00       	push   $0x200
+    29da:	68 f5 4c 00 00       	push   $0x4cf5
+    29df:	e8 ba 11 00 00       	call   3b9e <open>
+  if(fd < 0){
+    29e4:	83 c4 10             	add    $0x10,%esp
+    29e7:	85 c0                	test   %eax,%eax
+    29e9:	0f 88 43 01 00 00    	js     2b32 <dirfile+0x172>
+  close(fd);
+    29ef:	83 ec 0c             	sub    $0xc,%esp
+    29f2:	50                   	push   %eax
+    29f3:	e8 8e 11 00 00       	call   3b86 <close>
+  if(chdir("dirfile") == 0){
+    29f8:	c7 04 24 f5 4c 00 00 	movl   $0x4cf5,(%esp)
+    29ff:	e8 ca 11 00 00       	call   3bce <chdir>
+    2a04:	83 c4 10             	add    $0x10,%esp
+    2a07:	85 c0                	test   %eax,%eax
+    2a09:	0f 84 10 01 00 00    	je     2b1f <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    2a0f:	83 ec 08             	sub    $0x8,%esp
+    2a12:	6a 00                	push   $0x0
+    2a14:	68 2e 4d 00 00       	push   $0x4d2e
+    2a19:	e8 80 11 00 00       	call   3b9e <open>
+  if(fd >= 0){
+    2a1e:	83 c4 10             	add    $0x10,%esp
+    2a21:	85 c0                	test   %eax,%eax
+    2a23:	0f 89 e3 00 00 00    	jns    2b0c <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    2a29:	83 ec 08             	sub    $0x8,%esp
+    2a2c:	68 00 02 00 00       	push   $0x200
+    2a31:	68 2e 4d 00 00       	push   $0x4d2e
+    2a36:	e8 63 11 00 00       	call   3b9e <open>
+  if(fd >= 0){
+    2a3b:	83 c4 10             	add    $0x10,%esp
+    2a3e:	85 c0                	test   %eax,%eax
+    2a40:	0f 89 c6 00 00 00    	jns    2b0c <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    2a46:	83 ec 0c             	sub    $0xc,%esp
+    2a49:	68 2e 4d 00 00       	push   $0x4d2e
+    2a4e:	e8 73 11 00 00       	call   3bc6 <mkdir>
+    2a53:	83 c4 10             	add    $0x10,%esp
+    2a56:	85 c0                	test   %eax,%eax
+    2a58:	0f 84 46 01 00 00    	je     2ba4 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    2a5e:	83 ec 0c             	sub    $0xc,%esp
+    2a61:	68 2e 4d 00 00       	push   $0x4d2e
+    2a66:	e8 43 11 00 00       	call   3bae <unlink>
+    2a6b:	83 c4 10             	add    $0x10,%esp
+    2a6e:	85 c0                	test   %eax,%eax
+    2a70:	0f 84 1b 01 00 00    	je     2b91 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    2a76:	83 ec 08             	sub    $0x8,%esp
+    2a79:	68 2e 4d 00 00       	push   $0x4d2e
+    2a7e:	68 92 4d 00 00       	push   $0x4d92
+    2a83:	e8 36 11 00 00       	call   3bbe <link>
+    2a88:	83 c4 10             	add    $0x10,%esp
+    2a8b:	85 c0                	test   %eax,%eax
+    2a8d:	0f 84 eb 00 00 00    	je     2b7e <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    2a93:	83 ec 0c             	sub    $0xc,%esp
+    2a96:	68 f5 4c 00 00       	push   $0x4cf5
+    2a9b:	e8 0e 11 00 00       	call   3bae <unlink>
+    2aa0:	83 c4 10             	add    $0x10,%esp
+    2aa3:	85 c0                	test   %eax,%eax
+    2aa5:	0f 85 c0 00 00 00    	jne    2b6b <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    2aab:	83 ec 08             	sub    $0x8,%esp
+    2aae:	6a 02                	push   $0x2
+    2ab0:	68 ee 48 00 00       	push   $0x48ee
+    2ab5:	e8 e4 10 00 00       	call   3b9e <open>
+  if(fd >= 0){
+    2aba:	83 c4 10             	add    $0x10,%esp
+    2abd:	85 c0                	test   %eax,%eax
+    2abf:	0f 89 93 00 00 00    	jns    2b58 <dirfile+0x198>
+  fd = open(".", 0);
+    2ac5:	83 ec 08             	sub    $0x8,%esp
+    2ac8:	6a 00                	push   $0x0
+    2aca:	68 ee 48 00 00       	push   $0x48ee
+    2acf:	e8 ca 10 00 00       	call   3b9e <open>
+  if(write(fd, "x", 1) > 0){
+    2ad4:	83 c4 0c             	add    $0xc,%esp
+    2ad7:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    2ad9:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    2adb:	68 d1 49 00 00       	push   $0x49d1
+    2ae0:	50                   	push   %eax
+    2ae1:	e8 98 10 00 00       	call   3b7e <write>
+    2ae6:	83 c4 10             	add    $0x10,%esp
+    2ae9:	85 c0                	test   %eax,%eax
+    2aeb:	7f 58                	jg     2b45 <dirfile+0x185>
+  close(fd);
+    2aed:	83 ec 0c             	sub    $0xc,%esp
+    2af0:	53                   	push   %ebx
+    2af1:	e8 90 10 00 00       	call   3b86 <close>
+  printf(1, "dir vs file OK\n");
+    2af6:	58                   	pop    %eax
+    2af7:	5a                   	pop    %edx
+    2af8:	68 c5 4d 00 00       	push   $0x4dc5
+    2afd:	6a 01                	push   $0x1
+    2aff:	e8 fc 11 00 00       	call   3d00 <printf>
+}
+    2b04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2b07:	83 c4 10             	add    $0x10,%esp
+    2b0a:	c9                   	leave
+    2b0b:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    2b0c:	50                   	push   %eax
+    2b0d:	50                   	push   %eax
+    2b0e:	68 39 4d 00 00       	push   $0x4d39
+    2b13:	6a 01                	push   $0x1
+    2b15:	e8 e6 11 00 00       	call   3d00 <printf>
+    exit();
+    2b1a:	e8 3f 10 00 00       	call   3b5e <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    2b1f:	52                   	push   %edx
+    2b20:	52                   	push   %edx
+    2b21:	68 14 4d 00 00       	push   $0x4d14
+    2b26:	6a 01                	push   $0x1
+    2b28:	e8 d3 11 00 00       	call   3d00 <printf>
+    exit();
+    2b2d:	e8 2c 10 00 00       	call   3b5e <exit>
+    printf(1, "create dirfile failed\n");
+    2b32:	51                   	push   %ecx
+    2b33:	51                   	push   %ecx
+    2b34:	68 fd 4c 00 00       	push   $0x4cfd
+    2b39:	6a 01                	push   $0x1
+    2b3b:	e8 c0 11 00 00       	call   3d00 <printf>
+    exit();
+    2b40:	e8 19 10 00 00       	call   3b5e <exit>
+    printf(1, "write . succeeded!\n");
+    2b45:	51                   	push   %ecx
+    2b46:	51                   	push   %ecx
+    2b47:	68 b1 4d 00 00       	push   $0x4db1
+    2b4c:	6a 01                	push   $0x1
+    2b4e:	e8 ad 11 00 00       	call   3d00 <printf>
+    exit();
+    2b53:	e8 06 10 00 00       	call   3b5e <exit>
+    printf(1, "open . for writing succeeded!\n");
+    2b58:	53                   	push   %ebx
+    2b59:	53                   	push   %ebx
+    2b5a:	68 80 56 00 00       	push   $0x5680
+    2b5f:	6a 01                	push   $0x1
+    2b61:	e8 9a 11 00 00       	call   3d00 <printf>
+    exit();
+    2b66:	e8 f3 0f 00 00       	call   3b5e <exit>
+    printf(1, "unlink dirfile failed!\n");
+    2b6b:	50                   	push   %eax
+    2b6c:	50                   	push   %eax
+    2b6d:	68 99 4d 00 00       	push   $0x4d99
+    2b72:	6a 01                	push   $0x1
+    2b74:	e8 87 11 00 00       	call   3d00 <printf>
+    exit();
+    2b79:	e8 e0 0f 00 00       	call   3b5e <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    2b7e:	50                   	push   %eax
+    2b7f:	50                   	push   %eax
+    2b80:	68 60 56 00 00       	push   $0x5660
+    2b85:	6a 01                	push   $0x1
+    2b87:	e8 74 11 00 00       	call   3d00 <printf>
+    exit();
+    2b8c:	e8 cd 0f 00 00       	call   3b5e <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    2b91:	50                   	push   %eax
+    2b92:	50                   	push   %eax
+    2b93:	68 74 4d 00 00       	push   $0x4d74
+    2b98:	6a 01                	push   $0x1
+    2b9a:	e8 61 11 00 00       	call   3d00 <printf>
+    exit();
+    2b9f:	e8 ba 0f 00 00       	call   3b5e <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    2ba4:	50                   	push   %eax
+    2ba5:	50                   	push   %eax
+    2ba6:	68 57 4d 00 00       	push   $0x4d57
+    2bab:	6a 01                	push   $0x1
+    2bad:	e8 4e 11 00 00       	call   3d00 <printf>
+    exit();
+    2bb2:	e8 a7 0f 00 00       	call   3b5e <exit>
+    2bb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2bbe:	66 90                	xchg   %ax,%ax
+
+00002bc0 <iref>:
+{
+    2bc0:	55                   	push   %ebp
+    2bc1:	89 e5                	mov    %esp,%ebp
+    2bc3:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    2bc4:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    2bc9:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    2bcc:	68 d5 4d 00 00       	push   $0x4dd5
+    2bd1:	6a 01                	push   $0x1
+    2bd3:	e8 28 11 00 00       	call   3d00 <printf>
+    2bd8:	83 c4 10             	add    $0x10,%esp
+    2bdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2bdf:	90                   	nop
+    if(mkdir("irefd") != 0){
+    2be0:	83 ec 0c             	sub    $0xc,%esp
+    2be3:	68 e6 4d 00 00       	push   $0x4de6
+    2be8:	e8 d9 0f 00 00       	call   3bc6 <mkdir>
+    2bed:	83 c4 10             	add    $0x10,%esp
+    2bf0:	85 c0                	test   %eax,%eax
+    2bf2:	0f 85 bb 00 00 00    	jne    2cb3 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    2bf8:	83 ec 0c             	sub    $0xc,%esp
+    2bfb:	68 e6 4d 00 00       	push   $0x4de6
+    2c00:	e8 c9 0f 00 00       	call   3bce <chdir>
+    2c05:	83 c4 10             	add    $0x10,%esp
+    2c08:	85 c0                	test   %eax,%eax
+    2c0a:	0f 85 b7 00 00 00    	jne    2cc7 <iref+0x107>
+    mkdir("");
+    2c10:	83 ec 0c             	sub    $0xc,%esp
+    2c13:	68 9b 44 00 00       	push   $0x449b
+    2c18:	e8 a9 0f 00 00       	call   3bc6 <mkdir>
+    link("README", "");
+    2c1d:	59                   	pop    %ecx
+    2c1e:	58                   	pop    %eax
+    2c1f:	68 9b 44 00 00       	push   $0x449b
+    2c24:	68 92 4d 00 00       	push   $0x4d92
+    2c29:	e8 90 0f 00 00       	call   3bbe <link>
+    fd = open("", O_CREATE);
+    2c2e:	58                   	pop    %eax
+    2c2f:	5a                   	pop    %edx
+    2c30:	68 00 02 00 00       	push   $0x200
+    2c35:	68 9b 44 00 00       	push   $0x449b
+    2c3a:	e8 5f 0f 00 00       	call   3b9e <open>
+    if(fd >= 0)
+    2c3f:	83 c4 10             	add    $0x10,%esp
+    2c42:	85 c0                	test   %eax,%eax
+    2c44:	78 0c                	js     2c52 <iref+0x92>
+      close(fd);
+    2c46:	83 ec 0c             	sub    $0xc,%esp
+    2c49:	50                   	push   %eax
+    2c4a:	e8 37 0f 00 00       	call   3b86 <close>
+    2c4f:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    2c52:	83 ec 08             	sub    $0x8,%esp
+    2c55:	68 00 02 00 00       	push   $0x200
+    2c5a:	68 d0 49 00 00       	push   $0x49d0
+    2c5f:	e8 3a 0f 00 00       	call   3b9e <open>
+    if(fd >= 0)
+    2c64:	83 c4 10             	add    $0x10,%esp
+    2c67:	85 c0                	test   %eax,%eax
+    2c69:	78 0c                	js     2c77 <iref+0xb7>
+      close(fd);
+    2c6b:	83 ec 0c             	sub    $0xc,%esp
+    2c6e:	50                   	push   %eax
+    2c6f:	e8 12 0f 00 00       	call   3b86 <close>
+    2c74:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    2c77:	83 ec 0c             	sub    $0xc,%esp
+    2c7a:	68 d0 49 00 00       	push   $0x49d0
+    2c7f:	e8 2a 0f 00 00       	call   3bae <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    2c84:	83 c4 10             	add    $0x10,%esp
+    2c87:	83 eb 01             	sub    $0x1,%ebx
+    2c8a:	0f 85 50 ff ff ff    	jne    2be0 <iref+0x20>
+  chdir("/");
+    2c90:	83 ec 0c             	sub    $0xc,%esp
+    2c93:	68 c1 40 00 00       	push   $0x40c1
+    2c98:	e8 31 0f 00 00       	call   3bce <chdir>
+  printf(1, "empty file name OK\n");
+    2c9d:	58                   	pop    %eax
+    2c9e:	5a                   	pop    %edx
+    2c9f:	68 14 4e 00 00       	push   $0x4e14
+    2ca4:	6a 01                	push   $0x1
+    2ca6:	e8 55 10 00 00       	call   3d00 <printf>
+}
+    2cab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2cae:	83 c4 10             	add    $0x10,%esp
+    2cb1:	c9                   	leave
+    2cb2:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    2cb3:	83 ec 08             	sub    $0x8,%esp
+    2cb6:	68 ec 4d 00 00       	push   $0x4dec
+    2cbb:	6a 01                	push   $0x1
+    2cbd:	e8 3e 10 00 00       	call   3d00 <printf>
+      exit();
+    2cc2:	e8 97 0e 00 00       	call   3b5e <exit>
+      printf(1, "chdir irefd failed\n");
+    2cc7:	83 ec 08             	sub    $0x8,%esp
+    2cca:	68 00 4e 00 00       	push   $0x4e00
+    2ccf:	6a 01                	push   $0x1
+    2cd1:	e8 2a 10 00 00       	call   3d00 <printf>
+      exit();
+    2cd6:	e8 83 0e 00 00       	call   3b5e <exit>
+    2cdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2cdf:	90                   	nop
+
+00002ce0 <forktest>:
+{
+    2ce0:	55                   	push   %ebp
+    2ce1:	89 e5                	mov    %esp,%ebp
+    2ce3:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    2ce4:	31 db                	xor    %ebx,%ebx
+{
+    2ce6:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    2ce9:	68 28 4e 00 00       	push   $0x4e28
+    2cee:	6a 01                	push   $0x1
+    2cf0:	e8 0b 10 00 00       	call   3d00 <printf>
+    2cf5:	83 c4 10             	add    $0x10,%esp
+    2cf8:	eb 13                	jmp    2d0d <forktest+0x2d>
+    2cfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    2d00:	74 4d                	je     2d4f <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    2d02:	83 c3 01             	add    $0x1,%ebx
+    2d05:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    2d0b:	74 6e                	je     2d7b <forktest+0x9b>
+    pid = fork();
+    2d0d:	e8 44 0e 00 00       	call   3b56 <fork>
+    if(pid < 0)
+    2d12:	85 c0                	test   %eax,%eax
+    2d14:	79 ea                	jns    2d00 <forktest+0x20>
+  for(; n > 0; n--){
+    2d16:	85 db                	test   %ebx,%ebx
+    2d18:	74 14                	je     2d2e <forktest+0x4e>
+    2d1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    2d20:	e8 41 0e 00 00       	call   3b66 <wait>
+    2d25:	85 c0                	test   %eax,%eax
+    2d27:	78 2b                	js     2d54 <forktest+0x74>
+  for(; n > 0; n--){
+    2d29:	83 eb 01             	sub    $0x1,%ebx
+    2d2c:	75 f2                	jne    2d20 <forktest+0x40>
+  if(wait() != -1){
+    2d2e:	e8 33 0e 00 00       	call   3b66 <wait>
+    2d33:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2d36:	75 30                	jne    2d68 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    2d38:	83 ec 08             	sub    $0x8,%esp
+    2d3b:	68 5a 4e 00 00       	push   $0x4e5a
+    2d40:	6a 01                	push   $0x1
+    2d42:	e8 b9 0f 00 00       	call   3d00 <printf>
+}
+    2d47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2d4a:	83 c4 10             	add    $0x10,%esp
+    2d4d:	c9                   	leave
+    2d4e:	c3                   	ret
+      exit();
+    2d4f:	e8 0a 0e 00 00       	call   3b5e <exit>
+      printf(1, "wait stopped early\n");
+    2d54:	83 ec 08             	sub    $0x8,%esp
+    2d57:	68 33 4e 00 00       	push   $0x4e33
+    2d5c:	6a 01                	push   $0x1
+    2d5e:	e8 9d 0f 00 00       	call   3d00 <printf>
+      exit();
+    2d63:	e8 f6 0d 00 00       	call   3b5e <exit>
+    printf(1, "wait got too many\n");
+    2d68:	50                   	push   %eax
+    2d69:	50                   	push   %eax
+    2d6a:	68 47 4e 00 00       	push   $0x4e47
+    2d6f:	6a 01                	push   $0x1
+    2d71:	e8 8a 0f 00 00       	call   3d00 <printf>
+    exit();
+    2d76:	e8 e3 0d 00 00       	call   3b5e <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    2d7b:	52                   	push   %edx
+    2d7c:	52                   	push   %edx
+    2d7d:	68 a0 56 00 00       	push   $0x56a0
+    2d82:	6a 01                	push   $0x1
+    2d84:	e8 77 0f 00 00       	call   3d00 <printf>
+    exit();
+    2d89:	e8 d0 0d 00 00       	call   3b5e <exit>
+    2d8e:	66 90                	xchg   %ax,%ax
+
+00002d90 <sbrktest>:
+{
+    2d90:	55                   	push   %ebp
+    2d91:	89 e5                	mov    %esp,%ebp
+    2d93:	57                   	push   %edi
+  for(i = 0; i < 5000; i++){
+    2d94:	31 ff                	xor    %edi,%edi
+{
+    2d96:	56                   	push   %esi
+    2d97:	53                   	push   %ebx
+    2d98:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    2d9b:	68 68 4e 00 00       	push   $0x4e68
+    2da0:	ff 35 4c 62 00 00    	push   0x624c
+    2da6:	e8 55 0f 00 00       	call   3d00 <printf>
+  oldbrk = sbrk(0);
+    2dab:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2db2:	e8 2f 0e 00 00       	call   3be6 <sbrk>
+    2db7:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    2dba:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2dc1:	e8 20 0e 00 00       	call   3be6 <sbrk>
+    2dc6:	83 c4 10             	add    $0x10,%esp
+    2dc9:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 5000; i++){
+    2dcb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2dcf:	90                   	nop
+    b = sbrk(1);
+    2dd0:	83 ec 0c             	sub    $0xc,%esp
+    2dd3:	6a 01                	push   $0x1
+    2dd5:	e8 0c 0e 00 00       	call   3be6 <sbrk>
+    if(b != a){
+    2dda:	83 c4 10             	add    $0x10,%esp
+    2ddd:	39 c6                	cmp    %eax,%esi
+    2ddf:	0f 85 d1 03 00 00    	jne    31b6 <sbrktest+0x426>
+  for(i = 0; i < 5000; i++){
+    2de5:	83 c7 01             	add    $0x1,%edi
+    *b = 1;
+    2de8:	c6 06 01             	movb   $0x1,(%esi)
+    a = b + 1;
+    2deb:	83 c6 01             	add    $0x1,%esi
+  for(i = 0; i < 5000; i++){
+    2dee:	81 ff 88 13 00 00    	cmp    $0x1388,%edi
+    2df4:	75 da                	jne    2dd0 <sbrktest+0x40>
+  pid = fork();
+    2df6:	89 c3                	mov    %eax,%ebx
+    2df8:	e8 59 0d 00 00       	call   3b56 <fork>
+    2dfd:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    2dff:	85 c0                	test   %eax,%eax
+    2e01:	0f 88 60 04 00 00    	js     3267 <sbrktest+0x4d7>
+  c = sbrk(1);
+    2e07:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    2e0a:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    2e0d:	6a 01                	push   $0x1
+    2e0f:	e8 d2 0d 00 00       	call   3be6 <sbrk>
+  c = sbrk(1);
+    2e14:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2e1b:	e8 c6 0d 00 00       	call   3be6 <sbrk>
+  if(c != a + 1){
+    2e20:	83 c4 10             	add    $0x10,%esp
+    2e23:	39 c3                	cmp    %eax,%ebx
+    2e25:	0f 85 c8 04 00 00    	jne    32f3 <sbrktest+0x563>
+  if(pid == 0)
+    2e2b:	85 f6                	test   %esi,%esi
+    2e2d:	0f 84 bb 04 00 00    	je     32ee <sbrktest+0x55e>
+  wait();
+    2e33:	e8 2e 0d 00 00       	call   3b66 <wait>
+  a = sbrk(0);
+    2e38:	83 ec 0c             	sub    $0xc,%esp
+    2e3b:	6a 00                	push   $0x0
+    2e3d:	e8 a4 0d 00 00       	call   3be6 <sbrk>
+    2e42:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    2e44:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    2e49:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    2e4b:	89 04 24             	mov    %eax,(%esp)
+    2e4e:	e8 93 0d 00 00       	call   3be6 <sbrk>
+  if (p != a) {
+    2e53:	83 c4 10             	add    $0x10,%esp
+    2e56:	39 c3                	cmp    %eax,%ebx
+    2e58:	0f 85 da 03 00 00    	jne    3238 <sbrktest+0x4a8>
+  a = sbrk(0);
+    2e5e:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    2e61:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    2e68:	6a 00                	push   $0x0
+    2e6a:	e8 77 0d 00 00       	call   3be6 <sbrk>
+  c = sbrk(-4096);
+    2e6f:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    2e76:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    2e78:	e8 69 0d 00 00       	call   3be6 <sbrk>
+  if(c == (char*)0xffffffff){
+    2e7d:	83 c4 10             	add    $0x10,%esp
+    2e80:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2e83:	0f 84 af 04 00 00    	je     3338 <sbrktest+0x5a8>
+  c = sbrk(0);
+    2e89:	83 ec 0c             	sub    $0xc,%esp
+    2e8c:	6a 00                	push   $0x0
+    2e8e:	e8 53 0d 00 00       	call   3be6 <sbrk>
+  if(c != a - 4096){
+    2e93:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    2e99:	83 c4 10             	add    $0x10,%esp
+    2e9c:	39 d0                	cmp    %edx,%eax
+    2e9e:	0f 85 7d 04 00 00    	jne    3321 <sbrktest+0x591>
+  a = sbrk(0);
+    2ea4:	83 ec 0c             	sub    $0xc,%esp
+    2ea7:	6a 00                	push   $0x0
+    2ea9:	e8 38 0d 00 00       	call   3be6 <sbrk>
+  c = sbrk(4096);
+    2eae:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    2eb5:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    2eb7:	e8 2a 0d 00 00       	call   3be6 <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    2ebc:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    2ebf:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    2ec1:	39 c3                	cmp    %eax,%ebx
+    2ec3:	0f 85 41 04 00 00    	jne    330a <sbrktest+0x57a>
+    2ec9:	83 ec 0c             	sub    $0xc,%esp
+    2ecc:	6a 00                	push   $0x0
+    2ece:	e8 13 0d 00 00       	call   3be6 <sbrk>
+    2ed3:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    2ed9:	83 c4 10             	add    $0x10,%esp
+    2edc:	39 c2                	cmp    %eax,%edx
+    2ede:	0f 85 26 04 00 00    	jne    330a <sbrktest+0x57a>
+  if(*lastaddr == 99){
+    2ee4:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    2eeb:	0f 84 1d 03 00 00    	je     320e <sbrktest+0x47e>
+  a = sbrk(0);
+    2ef1:	83 ec 0c             	sub    $0xc,%esp
+    2ef4:	6a 00                	push   $0x0
+    2ef6:	e8 eb 0c 00 00       	call   3be6 <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    2efb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    2f02:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    2f04:	e8 dd 0c 00 00       	call   3be6 <sbrk>
+    2f09:	89 c2                	mov    %eax,%edx
+    2f0b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    2f0e:	29 d0                	sub    %edx,%eax
+    2f10:	89 04 24             	mov    %eax,(%esp)
+    2f13:	e8 ce 0c 00 00       	call   3be6 <sbrk>
+  if(c != a){
+    2f18:	83 c4 10             	add    $0x10,%esp
+    2f1b:	39 c3                	cmp    %eax,%ebx
+    2f1d:	0f 85 5b 03 00 00    	jne    327e <sbrktest+0x4ee>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    2f23:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    2f28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2f2f:	90                   	nop
+    ppid = getpid();
+    2f30:	e8 a9 0c 00 00       	call   3bde <getpid>
+    2f35:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    2f37:	e8 1a 0c 00 00       	call   3b56 <fork>
+    if(pid < 0){
+    2f3c:	85 c0                	test   %eax,%eax
+    2f3e:	0f 88 b2 02 00 00    	js     31f6 <sbrktest+0x466>
+    if(pid == 0){
+    2f44:	0f 84 8a 02 00 00    	je     31d4 <sbrktest+0x444>
+    wait();
+    2f4a:	e8 17 0c 00 00       	call   3b66 <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    2f4f:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    2f55:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    2f5b:	75 d3                	jne    2f30 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    2f5d:	83 ec 0c             	sub    $0xc,%esp
+    2f60:	8d 45 b0             	lea    -0x50(%ebp),%eax
+    2f63:	50                   	push   %eax
+    2f64:	e8 05 0c 00 00       	call   3b6e <pipe>
+    2f69:	83 c4 10             	add    $0x10,%esp
+    2f6c:	85 c0                	test   %eax,%eax
+    2f6e:	0f 85 b1 02 00 00    	jne    3225 <sbrktest+0x495>
+    2f74:	8d 75 c0             	lea    -0x40(%ebp),%esi
+    2f77:	8d 5d e8             	lea    -0x18(%ebp),%ebx
+    2f7a:	89 f7                	mov    %esi,%edi
+    2f7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    2f80:	e8 d1 0b 00 00       	call   3b56 <fork>
+    2f85:	89 07                	mov    %eax,(%edi)
+    2f87:	85 c0                	test   %eax,%eax
+    2f89:	0f 84 4d 01 00 00    	je     30dc <sbrktest+0x34c>
+    if(pids[i] != -1)
+    2f8f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2f92:	74 14                	je     2fa8 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    2f94:	83 ec 04             	sub    $0x4,%esp
+    2f97:	8d 45 af             	lea    -0x51(%ebp),%eax
+    2f9a:	6a 01                	push   $0x1
+    2f9c:	50                   	push   %eax
+    2f9d:	ff 75 b0             	push   -0x50(%ebp)
+    2fa0:	e8 d1 0b 00 00       	call   3b76 <read>
+    2fa5:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    2fa8:	83 c7 04             	add    $0x4,%edi
+    2fab:	39 df                	cmp    %ebx,%edi
+    2fad:	75 d1                	jne    2f80 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    2faf:	83 ec 0c             	sub    $0xc,%esp
+    2fb2:	68 00 10 00 00       	push   $0x1000
+    2fb7:	e8 2a 0c 00 00       	call   3be6 <sbrk>
+    2fbc:	89 75 a0             	mov    %esi,-0x60(%ebp)
+    2fbf:	83 c4 10             	add    $0x10,%esp
+    2fc2:	89 c7                	mov    %eax,%edi
+    2fc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    2fc8:	8b 06                	mov    (%esi),%eax
+    2fca:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2fcd:	74 11                	je     2fe0 <sbrktest+0x250>
+    kill(pids[i]);
+    2fcf:	83 ec 0c             	sub    $0xc,%esp
+    2fd2:	50                   	push   %eax
+    2fd3:	e8 b6 0b 00 00       	call   3b8e <kill>
+    wait();
+    2fd8:	e8 89 0b 00 00       	call   3b66 <wait>
+    2fdd:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    2fe0:	83 c6 04             	add    $0x4,%esi
+    2fe3:	39 de                	cmp    %ebx,%esi
+    2fe5:	75 e1                	jne    2fc8 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    2fe7:	8b 75 a0             	mov    -0x60(%ebp),%esi
+    2fea:	83 ff ff             	cmp    $0xffffffff,%edi
+    2fed:	0f 84 e4 02 00 00    	je     32d7 <sbrktest+0x547>
+  if(sbrk(0) > oldbrk)
+    2ff3:	83 ec 0c             	sub    $0xc,%esp
+    2ff6:	6a 00                	push   $0x0
+    2ff8:	e8 e9 0b 00 00       	call   3be6 <sbrk>
+    2ffd:	83 c4 10             	add    $0x10,%esp
+    3000:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    3003:	0f 82 19 01 00 00    	jb     3122 <sbrktest+0x392>
+  if(pipe(fds) != 0 || pipe(hold) != 0){
+    3009:	83 ec 0c             	sub    $0xc,%esp
+    300c:	8d 45 b0             	lea    -0x50(%ebp),%eax
+    300f:	50                   	push   %eax
+    3010:	e8 59 0b 00 00       	call   3b6e <pipe>
+    3015:	83 c4 10             	add    $0x10,%esp
+    3018:	85 c0                	test   %eax,%eax
+    301a:	0f 85 05 02 00 00    	jne    3225 <sbrktest+0x495>
+    3020:	83 ec 0c             	sub    $0xc,%esp
+    3023:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    3026:	50                   	push   %eax
+    3027:	e8 42 0b 00 00       	call   3b6e <pipe>
+    302c:	83 c4 10             	add    $0x10,%esp
+    302f:	85 c0                	test   %eax,%eax
+    3031:	0f 85 ee 01 00 00    	jne    3225 <sbrktest+0x495>
+    3037:	8d 5e 10             	lea    0x10(%esi),%ebx
+    303a:	89 f7                	mov    %esi,%edi
+    if((pids[i] = fork()) == 0){
+    303c:	e8 15 0b 00 00       	call   3b56 <fork>
+    3041:	89 07                	mov    %eax,(%edi)
+    3043:	85 c0                	test   %eax,%eax
+    3045:	0f 84 f8 00 00 00    	je     3143 <sbrktest+0x3b3>
+  for(i = 0; i < 4; i++){
+    304b:	83 c7 04             	add    $0x4,%edi
+    304e:	39 fb                	cmp    %edi,%ebx
+    3050:	75 ea                	jne    303c <sbrktest+0x2ac>
+  close(hold[0]);
+    3052:	83 ec 0c             	sub    $0xc,%esp
+    3055:	ff 75 b8             	push   -0x48(%ebp)
+    if(pids[i] < 0 || read(fds[0], &scratch, 1) != 1){
+    3058:	8d 7d af             	lea    -0x51(%ebp),%edi
+  close(hold[0]);
+    305b:	e8 26 0b 00 00       	call   3b86 <close>
+    3060:	83 c4 10             	add    $0x10,%esp
+    if(pids[i] < 0 || read(fds[0], &scratch, 1) != 1){
+    3063:	8b 06                	mov    (%esi),%eax
+    3065:	85 c0                	test   %eax,%eax
+    3067:	0f 88 e2 01 00 00    	js     324f <sbrktest+0x4bf>
+    306d:	83 ec 04             	sub    $0x4,%esp
+    3070:	6a 01                	push   $0x1
+    3072:	57                   	push   %edi
+    3073:	ff 75 b0             	push   -0x50(%ebp)
+    3076:	e8 fb 0a 00 00       	call   3b76 <read>
+    307b:	83 c4 10             	add    $0x10,%esp
+    307e:	83 f8 01             	cmp    $0x1,%eax
+    3081:	0f 85 c8 01 00 00    	jne    324f <sbrktest+0x4bf>
+  for(i = 0; i < 4; i++){
+    3087:	83 c6 04             	add    $0x4,%esi
+    308a:	39 f3                	cmp    %esi,%ebx
+    308c:	75 d5                	jne    3063 <sbrktest+0x2d3>
+  close(hold[1]);
+    308e:	83 ec 0c             	sub    $0xc,%esp
+    3091:	ff 75 bc             	push   -0x44(%ebp)
+    3094:	e8 ed 0a 00 00       	call   3b86 <close>
+  close(fds[0]);
+    3099:	58                   	pop    %eax
+    309a:	ff 75 b0             	push   -0x50(%ebp)
+    309d:	e8 e4 0a 00 00       	call   3b86 <close>
+  close(fds[1]);
+    30a2:	5a                   	pop    %edx
+    30a3:	ff 75 b4             	push   -0x4c(%ebp)
+    30a6:	e8 db 0a 00 00       	call   3b86 <close>
+    wait();
+    30ab:	e8 b6 0a 00 00       	call   3b66 <wait>
+    30b0:	e8 b1 0a 00 00       	call   3b66 <wait>
+    30b5:	e8 ac 0a 00 00       	call   3b66 <wait>
+    30ba:	e8 a7 0a 00 00       	call   3b66 <wait>
+  printf(stdout, "sbrk test OK\n");
+    30bf:	59                   	pop    %ecx
+    30c0:	5b                   	pop    %ebx
+    30c1:	68 53 4f 00 00       	push   $0x4f53
+    30c6:	ff 35 4c 62 00 00    	push   0x624c
+    30cc:	e8 2f 0c 00 00       	call   3d00 <printf>
+}
+    30d1:	83 c4 10             	add    $0x10,%esp
+    30d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    30d7:	5b                   	pop    %ebx
+    30d8:	5e                   	pop    %esi
+    30d9:	5f                   	pop    %edi
+    30da:	5d                   	pop    %ebp
+    30db:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    30dc:	83 ec 0c             	sub    $0xc,%esp
+    30df:	6a 00                	push   $0x0
+    30e1:	e8 00 0b 00 00       	call   3be6 <sbrk>
+    30e6:	89 c2                	mov    %eax,%edx
+    30e8:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    30ed:	29 d0                	sub    %edx,%eax
+    30ef:	89 04 24             	mov    %eax,(%esp)
+    30f2:	e8 ef 0a 00 00       	call   3be6 <sbrk>
+      write(fds[1], "x", 1);
+    30f7:	83 c4 0c             	add    $0xc,%esp
+    30fa:	6a 01                	push   $0x1
+    30fc:	68 d1 49 00 00       	push   $0x49d1
+    3101:	ff 75 b4             	push   -0x4c(%ebp)
+    3104:	e8 75 0a 00 00       	call   3b7e <write>
+    3109:	83 c4 10             	add    $0x10,%esp
+    310c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      for(;;) sleep(1000);
+    3110:	83 ec 0c             	sub    $0xc,%esp
+    3113:	68 e8 03 00 00       	push   $0x3e8
+    3118:	e8 d1 0a 00 00       	call   3bee <sleep>
+    311d:	83 c4 10             	add    $0x10,%esp
+    3120:	eb ee                	jmp    3110 <sbrktest+0x380>
+    sbrk(-(sbrk(0) - oldbrk));
+    3122:	83 ec 0c             	sub    $0xc,%esp
+    3125:	6a 00                	push   $0x0
+    3127:	e8 ba 0a 00 00       	call   3be6 <sbrk>
+    312c:	89 c2                	mov    %eax,%edx
+    312e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3131:	29 d0                	sub    %edx,%eax
+    3133:	89 04 24             	mov    %eax,(%esp)
+    3136:	e8 ab 0a 00 00       	call   3be6 <sbrk>
+    313b:	83 c4 10             	add    $0x10,%esp
+    313e:	e9 c6 fe ff ff       	jmp    3009 <sbrktest+0x279>
+      close(hold[1]);
+    3143:	83 ec 0c             	sub    $0xc,%esp
+    3146:	ff 75 bc             	push   -0x44(%ebp)
+    3149:	e8 38 0a 00 00       	call   3b86 <close>
+      a = sbrk(0);
+    314e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3155:	e8 8c 0a 00 00       	call   3be6 <sbrk>
+    315a:	89 c3                	mov    %eax,%ebx
+      amt = BIG - (uint)a;
+    315c:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3161:	29 d8                	sub    %ebx,%eax
+      if(sbrk(amt) != a){
+    3163:	89 04 24             	mov    %eax,(%esp)
+      amt = BIG - (uint)a;
+    3166:	89 c6                	mov    %eax,%esi
+      if(sbrk(amt) != a){
+    3168:	e8 79 0a 00 00       	call   3be6 <sbrk>
+    316d:	83 c4 10             	add    $0x10,%esp
+    3170:	39 c3                	cmp    %eax,%ebx
+    3172:	0f 85 48 01 00 00    	jne    32c0 <sbrktest+0x530>
+      for(p = a; p < a + amt; p += 1024*1024){
+    3178:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+    317b:	39 c3                	cmp    %eax,%ebx
+    317d:	72 1a                	jb     3199 <sbrktest+0x409>
+    317f:	e9 14 01 00 00       	jmp    3298 <sbrktest+0x508>
+    3184:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        *p = 1;
+    3188:	c6 03 01             	movb   $0x1,(%ebx)
+      for(p = a; p < a + amt; p += 1024*1024){
+    318b:	81 c3 00 00 10 00    	add    $0x100000,%ebx
+    3191:	39 c3                	cmp    %eax,%ebx
+    3193:	0f 83 ff 00 00 00    	jae    3298 <sbrktest+0x508>
+        if(*p != 0){
+    3199:	80 3b 00             	cmpb   $0x0,(%ebx)
+    319c:	74 ea                	je     3188 <sbrktest+0x3f8>
+          printf(stdout, "sparse heap not zero\n");
+    319e:	83 ec 08             	sub    $0x8,%esp
+    31a1:	68 24 4f 00 00       	push   $0x4f24
+    31a6:	ff 35 4c 62 00 00    	push   0x624c
+    31ac:	e8 4f 0b 00 00       	call   3d00 <printf>
+          exit();
+    31b1:	e8 a8 09 00 00       	call   3b5e <exit>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    31b6:	83 ec 0c             	sub    $0xc,%esp
+    31b9:	50                   	push   %eax
+    31ba:	56                   	push   %esi
+    31bb:	57                   	push   %edi
+    31bc:	68 73 4e 00 00       	push   $0x4e73
+    31c1:	ff 35 4c 62 00 00    	push   0x624c
+    31c7:	e8 34 0b 00 00       	call   3d00 <printf>
+      exit();
+    31cc:	83 c4 20             	add    $0x20,%esp
+    31cf:	e8 8a 09 00 00       	call   3b5e <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    31d4:	0f be 03             	movsbl (%ebx),%eax
+    31d7:	50                   	push   %eax
+    31d8:	53                   	push   %ebx
+    31d9:	68 dc 4e 00 00       	push   $0x4edc
+    31de:	ff 35 4c 62 00 00    	push   0x624c
+    31e4:	e8 17 0b 00 00       	call   3d00 <printf>
+      kill(ppid);
+    31e9:	89 34 24             	mov    %esi,(%esp)
+    31ec:	e8 9d 09 00 00       	call   3b8e <kill>
+      exit();
+    31f1:	e8 68 09 00 00       	call   3b5e <exit>
+      printf(stdout, "fork failed\n");
+    31f6:	83 ec 08             	sub    $0x8,%esp
+    31f9:	68 fc 4f 00 00       	push   $0x4ffc
+    31fe:	ff 35 4c 62 00 00    	push   0x624c
+    3204:	e8 f7 0a 00 00       	call   3d00 <printf>
+      exit();
+    3209:	e8 50 09 00 00       	call   3b5e <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    320e:	50                   	push   %eax
+    320f:	50                   	push   %eax
+    3210:	68 64 57 00 00       	push   $0x5764
+    3215:	ff 35 4c 62 00 00    	push   0x624c
+    321b:	e8 e0 0a 00 00       	call   3d00 <printf>
+    exit();
+    3220:	e8 39 09 00 00       	call   3b5e <exit>
+    printf(1, "pipe() failed\n");
+    3225:	50                   	push   %eax
+    3226:	50                   	push   %eax
+    3227:	68 b1 43 00 00       	push   $0x43b1
+    322c:	6a 01                	push   $0x1
+    322e:	e8 cd 0a 00 00       	call   3d00 <printf>
+    exit();
+    3233:	e8 26 09 00 00       	call   3b5e <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    3238:	51                   	push   %ecx
+    3239:	51                   	push   %ecx
+    323a:	68 c4 56 00 00       	push   $0x56c4
+    323f:	ff 35 4c 62 00 00    	push   0x624c
+    3245:	e8 b6 0a 00 00       	call   3d00 <printf>
+    exit();
+    324a:	e8 0f 09 00 00       	call   3b5e <exit>
+      printf(stdout, "sparse heap test failed\n");
+    324f:	83 ec 08             	sub    $0x8,%esp
+    3252:	68 3a 4f 00 00       	push   $0x4f3a
+    3257:	ff 35 4c 62 00 00    	push   0x624c
+    325d:	e8 9e 0a 00 00       	call   3d00 <printf>
+      exit();
+    3262:	e8 f7 08 00 00       	call   3b5e <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    3267:	56                   	push   %esi
+    3268:	56                   	push   %esi
+    3269:	68 8e 4e 00 00       	push   $0x4e8e
+    326e:	ff 35 4c 62 00 00    	push   0x624c
+    3274:	e8 87 0a 00 00       	call   3d00 <printf>
+    exit();
+    3279:	e8 e0 08 00 00       	call   3b5e <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    327e:	50                   	push   %eax
+    327f:	53                   	push   %ebx
+    3280:	68 94 57 00 00       	push   $0x5794
+    3285:	ff 35 4c 62 00 00    	push   0x624c
+    328b:	e8 70 0a 00 00       	call   3d00 <printf>
+    exit();
+    3290:	e8 c9 08 00 00       	call   3b5e <exit>
+    3295:	8d 76 00             	lea    0x0(%esi),%esi
+      write(fds[1], "x", 1);
+    3298:	83 ec 04             	sub    $0x4,%esp
+    329b:	6a 01                	push   $0x1
+    329d:	68 d1 49 00 00       	push   $0x49d1
+    32a2:	ff 75 b4             	push   -0x4c(%ebp)
+    32a5:	e8 d4 08 00 00       	call   3b7e <write>
+      read(hold[0], &scratch, 1);  // keep the heap until the parent is done
+    32aa:	83 c4 0c             	add    $0xc,%esp
+    32ad:	8d 45 af             	lea    -0x51(%ebp),%eax
+    32b0:	6a 01                	push   $0x1
+    32b2:	50                   	push   %eax
+    32b3:	ff 75 b8             	push   -0x48(%ebp)
+    32b6:	e8 bb 08 00 00       	call   3b76 <read>
+      exit();
+    32bb:	e8 9e 08 00 00       	call   3b5e <exit>
+        printf(stdout, "sparse sbrk failed\n");
+    32c0:	50                   	push   %eax
+    32c1:	50                   	push   %eax
+    32c2:	68 10 4f 00 00       	push   $0x4f10
+    32c7:	ff 35 4c 62 00 00    	push   0x624c
+    32cd:	e8 2e 0a 00 00       	call   3d00 <printf>
+        exit();
+    32d2:	e8 87 08 00 00       	call   3b5e <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    32d7:	50                   	push   %eax
+    32d8:	50                   	push   %eax
+    32d9:	68 f5 4e 00 00       	push   $0x4ef5
+    32de:	ff 35 4c 62 00 00    	push   0x624c
+    32e4:	e8 17 0a 00 00       	call   3d00 <printf>
+    exit();
+    32e9:	e8 70 08 00 00       	call   3b5e <exit>
+    exit();
+    32ee:	e8 6b 08 00 00       	call   3b5e <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    32f3:	53                   	push   %ebx
+    32f4:	53                   	push   %ebx
+    32f5:	68 a5 4e 00 00       	push   $0x4ea5
+    32fa:	ff 35 4c 62 00 00    	push   0x624c
+    3300:	e8 fb 09 00 00       	call   3d00 <printf>
+    exit();
+    3305:	e8 54 08 00 00       	call   3b5e <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    330a:	56                   	push   %esi
+    330b:	53                   	push   %ebx
+    330c:	68 3c 57 00 00       	push   $0x573c
+    3311:	ff 35 4c 62 00 00    	push   0x624c
+    3317:	e8 e4 09 00 00       	call   3d00 <printf>
+    exit();
+    331c:	e8 3d 08 00 00       	call   3b5e <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    3321:	50                   	push   %eax
+    3322:	53                   	push   %ebx
+    3323:	68 04 57 00 00       	push   $0x5704
+    3328:	ff 35 4c 62 00 00    	push   0x624c
+    332e:	e8 cd 09 00 00       	call   3d00 <printf>
+    exit();
+    3333:	e8 26 08 00 00       	call   3b5e <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    3338:	52                   	push   %edx
+    3339:	52                   	push   %edx
+    333a:	68 c1 4e 00 00       	push   $0x4ec1
+    333f:	ff 35 4c 62 00 00    	push   0x624c
+    3345:	e8 b6 09 00 00       	call   3d00 <printf>
+    exit();
+    334a:	e8 0f 08 00 00       	call   3b5e <exit>
+    334f:	90                   	nop
+
+00003350 <validateint>:
+}
+    3350:	c3                   	ret
+    3351:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3358:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    335f:	90                   	nop
+
+00003360 <validatetest>:
+{
+    3360:	55                   	push   %ebp
+    3361:	89 e5                	mov    %esp,%ebp
+    3363:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3364:	31 f6                	xor    %esi,%esi
+{
+    3366:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    3367:	83 ec 08             	sub    $0x8,%esp
+    336a:	68 61 4f 00 00       	push   $0x4f61
+    336f:	ff 35 4c 62 00 00    	push   0x624c
+    3375:	e8 86 09 00 00       	call   3d00 <printf>
+    337a:	83 c4 10             	add    $0x10,%esp
+    337d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    3380:	e8 d1 07 00 00       	call   3b56 <fork>
+    3385:	89 c3                	mov    %eax,%ebx
+    3387:	85 c0                	test   %eax,%eax
+    3389:	74 63                	je     33ee <validatetest+0x8e>
+    sleep(0);
+    338b:	83 ec 0c             	sub    $0xc,%esp
+    338e:	6a 00                	push   $0x0
+    3390:	e8 59 08 00 00       	call   3bee <sleep>
+    sleep(0);
+    3395:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    339c:	e8 4d 08 00 00       	call   3bee <sleep>
+    kill(pid);
+    33a1:	89 1c 24             	mov    %ebx,(%esp)
+    33a4:	e8 e5 07 00 00       	call   3b8e <kill>
+    wait();
+    33a9:	e8 b8 07 00 00       	call   3b66 <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    33ae:	58                   	pop    %eax
+    33af:	5a                   	pop    %edx
+    33b0:	56                   	push   %esi
+    33b1:	68 70 4f 00 00       	push   $0x4f70
+    33b6:	e8 03 08 00 00       	call   3bbe <link>
+    33bb:	83 c4 10             	add    $0x10,%esp
+    33be:	83 f8 ff             	cmp    $0xffffffff,%eax
+    33c1:	75 30                	jne    33f3 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    33c3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    33c9:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    33cf:	75 af                	jne    3380 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    33d1:	83 ec 08             	sub    $0x8,%esp
+    33d4:	68 94 4f 00 00       	push   $0x4f94
+    33d9:	ff 35 4c 62 00 00    	push   0x624c
+    33df:	e8 1c 09 00 00       	call   3d00 <printf>
+}
+    33e4:	83 c4 10             	add    $0x10,%esp
+    33e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    33ea:	5b                   	pop    %ebx
+    33eb:	5e                   	pop    %esi
+    33ec:	5d                   	pop    %ebp
+    33ed:	c3                   	ret
+      exit();
+    33ee:	e8 6b 07 00 00       	call   3b5e <exit>
+      printf(stdout, "link should not succeed\n");
+    33f3:	83 ec 08             	sub    $0x8,%esp
+    33f6:	68 7b 4f 00 00       	push   $0x4f7b
+    33fb:	ff 35 4c 62 00 00    	push   0x624c
+    3401:	e8 fa 08 00 00       	call   3d00 <printf>
+      exit();
+    3406:	e8 53 07 00 00       	call   3b5e <exit>
+    340b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    340f:	90                   	nop
+
+00003410 <bsstest>:
+{
+    3410:	55                   	push   %ebp
+    3411:	89 e5                	mov    %esp,%ebp
+    3413:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    3416:	68 a1 4f 00 00       	push   $0x4fa1
+    341b:	ff 35 4c 62 00 00    	push   0x624c
+    3421:	e8 da 08 00 00       	call   3d00 <printf>
+    3426:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    3429:	31 c0                	xor    %eax,%eax
+    342b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    342f:	90                   	nop
+    if(uninit[i] != '\0'){
+    3430:	80 b8 a0 62 00 00 00 	cmpb   $0x0,0x62a0(%eax)
+    3437:	75 22                	jne    345b <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    3439:	83 c0 01             	add    $0x1,%eax
+    343c:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    3441:	75 ed                	jne    3430 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    3443:	83 ec 08             	sub    $0x8,%esp
+    3446:	68 bc 4f 00 00       	push   $0x4fbc
+    344b:	ff 35 4c 62 00 00    	push   0x624c
+    3451:	e8 aa 08 00 00       	call   3d00 <printf>
+}
+    3456:	83 c4 10             	add    $0x10,%esp
+    3459:	c9                   	leave
+    345a:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    345b:	83 ec 08             	sub    $0x8,%esp
+    345e:	68 ab 4f 00 00       	push   $0x4fab
+    3463:	ff 35 4c 62 00 00    	push   0x624c
+    3469:	e8 92 08 00 00       	call   3d00 <printf>
+      exit();
+    346e:	e8 eb 06 00 00       	call   3b5e <exit>
+    3473:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    347a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003480 <bigargtest>:
+{
+    3480:	55                   	push   %ebp
+    3481:	89 e5                	mov    %esp,%ebp
+    3483:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    3486:	68 c9 4f 00 00       	push   $0x4fc9
+    348b:	e8 1e 07 00 00       	call   3bae <unlink>
+  pid = fork();
+    3490:	e8 c1 06 00 00       	call   3b56 <fork>
+  if(pid == 0){
+    3495:	83 c4 10             	add    $0x10,%esp
+    3498:	85 c0                	test   %eax,%eax
+    349a:	74 44                	je     34e0 <bigargtest+0x60>
+  } else if(pid < 0){
+    349c:	0f 88 c3 00 00 00    	js     3565 <bigargtest+0xe5>
+  wait();
+    34a2:	e8 bf 06 00 00       	call   3b66 <wait>
+  fd = open("bigarg-ok", 0);
+    34a7:	83 ec 08             	sub    $0x8,%esp
+    34aa:	6a 00                	push   $0x0
+    34ac:	68 c9 4f 00 00       	push   $0x4fc9
+    34b1:	e8 e8 06 00 00       	call   3b9e <open>
+  if(fd < 0){
+    34b6:	83 c4 10             	add    $0x10,%esp
+    34b9:	85 c0                	test   %eax,%eax
+    34bb:	0f 88 8d 00 00 00    	js     354e <bigargtest+0xce>
+  close(fd);
+    34c1:	83 ec 0c             	sub    $0xc,%esp
+    34c4:	50                   	push   %eax
+    34c5:	e8 bc 06 00 00       	call   3b86 <close>
+  unlink("bigarg-ok");
+    34ca:	c7 04 24 c9 4f 00 00 	movl   $0x4fc9,(%esp)
+    34d1:	e8 d8 06 00 00       	call   3bae <unlink>
+}
+    34d6:	83 c4 10             	add    $0x10,%esp
+    34d9:	c9                   	leave
+    34da:	c3                   	ret
+    34db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    34df:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    34e0:	c7 04 85 c0 a9 00 00 	movl   $0x57b8,0xa9c0(,%eax,4)
+    34e7:	b8 57 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    34eb:	83 c0 01             	add    $0x1,%eax
+    34ee:	83 f8 1f             	cmp    $0x1f,%eax
+    34f1:	75 ed                	jne    34e0 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    34f3:	31 c9                	xor    %ecx,%ecx
+    34f5:	89 0d 3c aa 00 00    	mov    %ecx,0xaa3c
+    printf(stdout, "bigarg test\n");
+    34fb:	50                   	push   %eax
+    34fc:	50                   	push   %eax
+    34fd:	68 d3 4f 00 00       	push   $0x4fd3
+    3502:	ff 35 4c 62 00 00    	push   0x624c
+    3508:	e8 f3 07 00 00       	call   3d00 <printf>
+    exec("echo", args);
+    350d:	58                   	pop    %eax
+    350e:	5a                   	pop    %edx
+    350f:	68 c0 a9 00 00       	push   $0xa9c0
+    3514:	68 5d 41 00 00       	push   $0x415d
+    3519:	e8 78 06 00 00       	call   3b96 <exec>
+    printf(stdout, "bigarg test ok\n");
+    351e:	59                   	pop    %ecx
+    351f:	58                   	pop    %eax
+    3520:	68 e0 4f 00 00       	push   $0x4fe0
+    3525:	ff 35 4c 62 00 00    	push   0x624c
+    352b:	e8 d0 07 00 00       	call   3d00 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    3530:	58                   	pop    %eax
+    3531:	5a                   	pop    %edx
+    3532:	68 00 02 00 00       	push   $0x200
+    3537:	68 c9 4f 00 00       	push   $0x4fc9
+    353c:	e8 5d 06 00 00       	call   3b9e <open>
+    close(fd);
+    3541:	89 04 24             	mov    %eax,(%esp)
+    3544:	e8 3d 06 00 00       	call   3b86 <close>
+    exit();
+    3549:	e8 10 06 00 00       	call   3b5e <exit>
+    printf(stdout, "bigarg test failed!\n");
+    354e:	50                   	push   %eax
+    354f:	50                   	push   %eax
+    3550:	68 09 50 00 00       	push   $0x5009
+    3555:	ff 35 4c 62 00 00    	push   0x624c
+    355b:	e8 a0 07 00 00       	call   3d00 <printf>
+    exit();
+    3560:	e8 f9 05 00 00       	call   3b5e <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    3565:	52                   	push   %edx
+    3566:	52                   	push   %edx
+    3567:	68 f0 4f 00 00       	push   $0x4ff0
+    356c:	ff 35 4c 62 00 00    	push   0x624c
+    3572:	e8 89 07 00 00       	call   3d00 <printf>
+    exit();
+    3577:	e8 e2 05 00 00       	call   3b5e <exit>
+    357c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003580 <fsfull>:
+{
+    3580:	55                   	push   %ebp
+    3581:	89 e5                	mov    %esp,%ebp
+    3583:	57                   	push   %edi
+    3584:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    3585:	31 f6                	xor    %esi,%esi
+{
+    3587:	53                   	push   %ebx
+    3588:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    358b:	68 1e 50 00 00       	push   $0x501e
+    3590:	6a 01                	push   $0x1
+    3592:	e8 69 07 00 00       	call   3d00 <printf>
+    3597:	83 c4 10             	add    $0x10,%esp
+    359a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    35a0:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    35a5:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    35aa:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    35ad:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    35b1:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    35b3:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    35b7:	c1 ea 06             	shr    $0x6,%edx
+    35ba:	8d 42 30             	lea    0x30(%edx),%eax
+    35bd:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    35c0:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    35c6:	89 f2                	mov    %esi,%edx
+    35c8:	29 c2                	sub    %eax,%edx
+    35ca:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    35cf:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    35d1:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    35d6:	c1 ea 05             	shr    $0x5,%edx
+    35d9:	83 c2 30             	add    $0x30,%edx
+    35dc:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    35df:	f7 e6                	mul    %esi
+    35e1:	c1 ea 05             	shr    $0x5,%edx
+    35e4:	6b c2 64             	imul   $0x64,%edx,%eax
+    35e7:	89 f2                	mov    %esi,%edx
+    35e9:	29 c2                	sub    %eax,%edx
+    35eb:	89 d0                	mov    %edx,%eax
+    35ed:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    35ef:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    35f1:	c1 ea 03             	shr    $0x3,%edx
+    35f4:	83 c2 30             	add    $0x30,%edx
+    35f7:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    35fa:	f7 e1                	mul    %ecx
+    35fc:	89 f0                	mov    %esi,%eax
+    35fe:	c1 ea 03             	shr    $0x3,%edx
+    3601:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    3604:	01 d2                	add    %edx,%edx
+    3606:	29 d0                	sub    %edx,%eax
+    3608:	83 c0 30             	add    $0x30,%eax
+    360b:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    360e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3611:	50                   	push   %eax
+    3612:	68 2b 50 00 00       	push   $0x502b
+    3617:	6a 01                	push   $0x1
+    3619:	e8 e2 06 00 00       	call   3d00 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    361e:	58                   	pop    %eax
+    361f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3622:	5a                   	pop    %edx
+    3623:	68 02 02 00 00       	push   $0x202
+    3628:	50                   	push   %eax
+    3629:	e8 70 05 00 00       	call   3b9e <open>
+    if(fd < 0){
+    362e:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    3631:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    3633:	85 c0                	test   %eax,%eax
+    3635:	78 4f                	js     3686 <fsfull+0x106>
+    int total = 0;
+    3637:	31 db                	xor    %ebx,%ebx
+    3639:	eb 07                	jmp    3642 <fsfull+0xc2>
+    363b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    363f:	90                   	nop
+      total += cc;
+    3640:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    3642:	83 ec 04             	sub    $0x4,%esp
+    3645:	68 00 02 00 00       	push   $0x200
+    364a:	68 c0 89 00 00       	push   $0x89c0
+    364f:	57                   	push   %edi
+    3650:	e8 29 05 00 00       	call   3b7e <write>
+      if(cc < 512)
+    3655:	83 c4 10             	add    $0x10,%esp
+    3658:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    365d:	7f e1                	jg     3640 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    365f:	83 ec 04             	sub    $0x4,%esp
+    3662:	53                   	push   %ebx
+    3663:	68 47 50 00 00       	push   $0x5047
+    3668:	6a 01                	push   $0x1
+    366a:	e8 91 06 00 00       	call   3d00 <printf>
+    close(fd);
+    366f:	89 3c 24             	mov    %edi,(%esp)
+    3672:	e8 0f 05 00 00       	call   3b86 <close>
+    if(total == 0)
+    3677:	83 c4 10             	add    $0x10,%esp
+    367a:	85 db                	test   %ebx,%ebx
+    367c:	74 1e                	je     369c <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    367e:	83 c6 01             	add    $0x1,%esi
+    3681:	e9 1a ff ff ff       	jmp    35a0 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    3686:	83 ec 04             	sub    $0x4,%esp
+    3689:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    368c:	50                   	push   %eax
+    368d:	68 37 50 00 00       	push   $0x5037
+    3692:	6a 01                	push   $0x1
+    3694:	e8 67 06 00 00       	call   3d00 <printf>
+      break;
+    3699:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    369c:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    36a1:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    36a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    36ad:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    36b0:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    36b2:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    36b5:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    36b9:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    36bb:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    36bf:	c1 ea 06             	shr    $0x6,%edx
+    36c2:	8d 42 30             	lea    0x30(%edx),%eax
+    36c5:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    36c8:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    36ce:	89 f2                	mov    %esi,%edx
+    36d0:	29 c2                	sub    %eax,%edx
+    36d2:	89 d0                	mov    %edx,%eax
+    36d4:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    36d6:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    36d8:	c1 ea 05             	shr    $0x5,%edx
+    36db:	83 c2 30             	add    $0x30,%edx
+    36de:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    36e1:	f7 e3                	mul    %ebx
+    36e3:	c1 ea 05             	shr    $0x5,%edx
+    36e6:	6b ca 64             	imul   $0x64,%edx,%ecx
+    36e9:	89 f2                	mov    %esi,%edx
+    36eb:	29 ca                	sub    %ecx,%edx
+    36ed:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    36f2:	89 d0                	mov    %edx,%eax
+    36f4:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    36f6:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    36f8:	c1 ea 03             	shr    $0x3,%edx
+    36fb:	83 c2 30             	add    $0x30,%edx
+    36fe:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3701:	f7 e1                	mul    %ecx
+    3703:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    3705:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    3708:	c1 ea 03             	shr    $0x3,%edx
+    370b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    370e:	01 d2                	add    %edx,%edx
+    3710:	29 d0                	sub    %edx,%eax
+    3712:	83 c0 30             	add    $0x30,%eax
+    3715:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    3718:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    371b:	50                   	push   %eax
+    371c:	e8 8d 04 00 00       	call   3bae <unlink>
+  while(nfiles >= 0){
+    3721:	83 c4 10             	add    $0x10,%esp
+    3724:	83 fe ff             	cmp    $0xffffffff,%esi
+    3727:	75 87                	jne    36b0 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    3729:	83 ec 08             	sub    $0x8,%esp
+    372c:	68 57 50 00 00       	push   $0x5057
+    3731:	6a 01                	push   $0x1
+    3733:	e8 c8 05 00 00       	call   3d00 <printf>
+}
+    3738:	83 c4 10             	add    $0x10,%esp
+    373b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    373e:	5b                   	pop    %ebx
+    373f:	5e                   	pop    %esi
+    3740:	5f                   	pop    %edi
+    3741:	5d                   	pop    %ebp
+    3742:	c3                   	ret
+    3743:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    374a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003750 <uio>:
+{
+    3750:	55                   	push   %ebp
+    3751:	89 e5                	mov    %esp,%ebp
+    3753:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    3756:	68 6d 50 00 00       	push   $0x506d
+    375b:	6a 01                	push   $0x1
+    375d:	e8 9e 05 00 00       	call   3d00 <printf>
+  pid = fork();
+    3762:	e8 ef 03 00 00       	call   3b56 <fork>
+  if(pid == 0){
+    3767:	83 c4 10             	add    $0x10,%esp
+    376a:	85 c0                	test   %eax,%eax
+    376c:	74 1b                	je     3789 <uio+0x39>
+  } else if(pid < 0){
+    376e:	78 3d                	js     37ad <uio+0x5d>
+  wait();
+    3770:	e8 f1 03 00 00       	call   3b66 <wait>
+  printf(1, "uio test done\n");
+    3775:	83 ec 08             	sub    $0x8,%esp
+    3778:	68 77 50 00 00       	push   $0x5077
+    377d:	6a 01                	push   $0x1
+    377f:	e8 7c 05 00 00       	call   3d00 <printf>
+}
+    3784:	83 c4 10             	add    $0x10,%esp
+    3787:	c9                   	leave
+    3788:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    3789:	b8 09 00 00 00       	mov    $0x9,%eax
+    378e:	ba 70 00 00 00       	mov    $0x70,%edx
+    3793:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    3794:	ba 71 00 00 00       	mov    $0x71,%edx
+    3799:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    379a:	52                   	push   %edx
+    379b:	52                   	push   %edx
+    379c:	68 98 58 00 00       	push   $0x5898
+    37a1:	6a 01                	push   $0x1
+    37a3:	e8 58 05 00 00       	call   3d00 <printf>
+    exit();
+    37a8:	e8 b1 03 00 00       	call   3b5e <exit>
+    printf (1, "fork failed\n");
+    37ad:	50                   	push   %eax
+    37ae:	50                   	push   %eax
+    37af:	68 fc 4f 00 00       	push   $0x4ffc
+    37b4:	6a 01                	push   $0x1
+    37b6:	e8 45 05 00 00       	call   3d00 <printf>
+    exit();
+    37bb:	e8 9e 03 00 00       	call   3b5e <exit>
+
+000037c0 <argptest>:
+{
+    37c0:	55                   	push   %ebp
+    37c1:	89 e5                	mov    %esp,%ebp
+    37c3:	53                   	push   %ebx
+    37c4:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    37c7:	6a 00                	push   $0x0
+    37c9:	68 86 50 00 00       	push   $0x5086
+    37ce:	e8 cb 03 00 00       	call   3b9e <open>
+  if (fd < 0) {
+    37d3:	83 c4 10             	add    $0x10,%esp
+    37d6:	85 c0                	test   %eax,%eax
+    37d8:	78 39                	js     3813 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    37da:	83 ec 0c             	sub    $0xc,%esp
+    37dd:	89 c3                	mov    %eax,%ebx
+    37df:	6a 00                	push   $0x0
+    37e1:	e8 00 04 00 00       	call   3be6 <sbrk>
+    37e6:	83 c4 0c             	add    $0xc,%esp
+    37e9:	83 e8 01             	sub    $0x1,%eax
+    37ec:	6a ff                	push   $0xffffffff
+    37ee:	50                   	push   %eax
+    37ef:	53                   	push   %ebx
+    37f0:	e8 81 03 00 00       	call   3b76 <read>
+  close(fd);
+    37f5:	89 1c 24             	mov    %ebx,(%esp)
+    37f8:	e8 89 03 00 00       	call   3b86 <close>
+  printf(1, "arg test passed\n");
+    37fd:	58                   	pop    %eax
+    37fe:	5a                   	pop    %edx
+    37ff:	68 98 50 00 00       	push   $0x5098
+    3804:	6a 01                	push   $0x1
+    3806:	e8 f5 04 00 00       	call   3d00 <printf>
+}
+    380b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    380e:	83 c4 10             	add    $0x10,%esp
+    3811:	c9                   	leave
+    3812:	c3                   	ret
+    printf(2, "open failed\n");
+    3813:	51                   	push   %ecx
+    3814:	51                   	push   %ecx
+    3815:	68 8b 50 00 00       	push   $0x508b
+    381a:	6a 02                	push   $0x2
+    381c:	e8 df 04 00 00       	call   3d00 <printf>
+    exit();
+    3821:	e8 38 03 00 00       	call   3b5e <exit>
+    3826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    382d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003830 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    3830:	69 05 48 62 00 00 0d 	imul   $0x19660d,0x6248,%eax
+    3837:	66 19 00 
+    383a:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    383f:	a3 48 62 00 00       	mov    %eax,0x6248
+}
+    3844:	c3                   	ret
+    3845:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    384c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003850 <threadtest>:
+{
+    3850:	55                   	push   %ebp
+    3851:	89 e5                	mov    %esp,%ebp
+    3853:	56                   	push   %esi
+    3854:	53                   	push   %ebx
+    3855:	8d 75 f8             	lea    -0x8(%ebp),%esi
+    3858:	8d 5d e8             	lea    -0x18(%ebp),%ebx
+    385b:	83 ec 18             	sub    $0x18,%esp
+  printf(stdout, "thread test\n");
+    385e:	68 a9 50 00 00       	push   $0x50a9
+    3863:	ff 35 4c 62 00 00    	push   0x624c
+    3869:	e8 92 04 00 00       	call   3d00 <printf>
+  lock_init(&tlock);
+    386e:	c7 04 24 80 62 00 00 	movl   $0x6280,(%esp)
+    3875:	e8 76 01 00 00       	call   39f0 <lock_init>
+  for(i = 0; i < 4; i++){
+    387a:	83 c4 10             	add    $0x10,%esp
+    if(thread_create(threadinc, &pids[i]) < 0){
+    387d:	83 ec 08             	sub    $0x8,%esp
+    pids[i] = 0;
+    3880:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    if(thread_create(threadinc, &pids[i]) < 0){
+    3886:	53                   	push   %ebx
+    3887:	68 20 01 00 00       	push   $0x120
+    388c:	e8 9f 01 00 00       	call   3a30 <thread_create>
+    3891:	83 c4 10             	add    $0x10,%esp
+    3894:	85 c0                	test   %eax,%eax
+    3896:	0f 88 b3 00 00 00    	js     394f <threadtest+0xff>
+  for(i = 0; i < 4; i++){
+    389c:	83 c3 04             	add    $0x4,%ebx
+    389f:	39 f3                	cmp    %esi,%ebx
+    38a1:	75 da                	jne    387d <threadtest+0x2d>
+  if(wait() != -1){
+    38a3:	e8 be 02 00 00       	call   3b66 <wait>
+    38a8:	83 f8 ff             	cmp    $0xffffffff,%eax
+    38ab:	0f 85 b6 00 00 00    	jne    3967 <threadtest+0x117>
+    38b1:	bb 04 00 00 00       	mov    $0x4,%ebx
+    if(thread_join() < 0){
+    38b6:	e8 45 02 00 00       	call   3b00 <thread_join>
+    38bb:	85 c0                	test   %eax,%eax
+    38bd:	78 78                	js     3937 <threadtest+0xe7>
+  for(i = 0; i < 4; i++){
+    38bf:	83 eb 01             	sub    $0x1,%ebx
+    38c2:	75 f2                	jne    38b6 <threadtest+0x66>
+  if(thread_join() != -1){
+    38c4:	e8 37 02 00 00       	call   3b00 <thread_join>
+    38c9:	83 f8 ff             	cmp    $0xffffffff,%eax
+    38cc:	0f 85 c3 00 00 00    	jne    3995 <threadtest+0x145>
+  if(tcount != 4000){
+    38d2:	a1 84 62 00 00       	mov    0x6284,%eax
+    38d7:	3d a0 0f 00 00       	cmp    $0xfa0,%eax
+    38dc:	0f 85 9c 00 00 00    	jne    397e <threadtest+0x12e>
+  for(i = 0; i < 4; i++){
+    38e2:	31 db                	xor    %ebx,%ebx
+    if(pids[i] == 0 || pids[i] == getpid()){
+    38e4:	8b 74 9d e8          	mov    -0x18(%ebp,%ebx,4),%esi
+    38e8:	85 f6                	test   %esi,%esi
+    38ea:	74 32                	je     391e <threadtest+0xce>
+    38ec:	e8 ed 02 00 00       	call   3bde <getpid>
+    38f1:	39 c6                	cmp    %eax,%esi
+    38f3:	74 25                	je     391a <threadtest+0xca>
+  for(i = 0; i < 4; i++){
+    38f5:	83 c3 01             	add    $0x1,%ebx
+    38f8:	83 fb 04             	cmp    $0x4,%ebx
+    38fb:	75 e7                	jne    38e4 <threadtest+0x94>
+  printf(stdout, "thread test ok\n");
+    38fd:	83 ec 08             	sub    $0x8,%esp
+    3900:	68 2e 51 00 00       	push   $0x512e
+    3905:	ff 35 4c 62 00 00    	push   0x624c
+    390b:	e8 f0 03 00 00       	call   3d00 <printf>
+}
+    3910:	83 c4 10             	add    $0x10,%esp
+    3913:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3916:	5b                   	pop    %ebx
+    3917:	5e                   	pop    %esi
+    3918:	5d                   	pop    %ebp
+    3919:	c3                   	ret
+      printf(stdout, "thread test: bad pid %d\n", pids[i]);
+    391a:	8b 74 9d e8          	mov    -0x18(%ebp,%ebx,4),%esi
+    391e:	83 ec 04             	sub    $0x4,%esp
+    3921:	56                   	push   %esi
+    3922:	68 15 51 00 00       	push   $0x5115
+    3927:	ff 35 4c 62 00 00    	push   0x624c
+    392d:	e8 ce 03 00 00       	call   3d00 <printf>
+      exit();
+    3932:	e8 27 02 00 00       	call   3b5e <exit>
+      printf(stdout, "thread_join failed\n");
+    3937:	83 ec 08             	sub    $0x8,%esp
+    393a:	68 e4 50 00 00       	push   $0x50e4
+    393f:	ff 35 4c 62 00 00    	push   0x624c
+    3945:	e8 b6 03 00 00       	call   3d00 <printf>
+      exit();
+    394a:	e8 0f 02 00 00       	call   3b5e <exit>
+      printf(stdout, "thread_create failed\n");
+    394f:	83 ec 08             	sub    $0x8,%esp
+    3952:	68 b6 50 00 00       	push   $0x50b6
+    3957:	ff 35 4c 62 00 00    	push   0x624c
+    395d:	e8 9e 03 00 00       	call   3d00 <printf>
+      exit();
+    3962:	e8 f7 01 00 00       	call   3b5e <exit>
+    printf(stdout, "wait returned a thread\n");
+    3967:	53                   	push   %ebx
+    3968:	53                   	push   %ebx
+    3969:	68 cc 50 00 00       	push   $0x50cc
+    396e:	ff 35 4c 62 00 00    	push   0x624c
+    3974:	e8 87 03 00 00       	call   3d00 <printf>
+    exit();
+    3979:	e8 e0 01 00 00       	call   3b5e <exit>
+    printf(stdout, "thread test: count %d, want 4000\n", tcount);
+    397e:	52                   	push   %edx
+    397f:	50                   	push   %eax
+    3980:	68 bc 58 00 00       	push   $0x58bc
+    3985:	ff 35 4c 62 00 00    	push   0x624c
+    398b:	e8 70 03 00 00       	call   3d00 <printf>
+    exit();
+    3990:	e8 c9 01 00 00       	call   3b5e <exit>
+    printf(stdout, "thread_join with no threads\n");
+    3995:	51                   	push   %ecx
+    3996:	51                   	push   %ecx
+    3997:	68 f8 50 00 00       	push   $0x50f8
+    399c:	ff 35 4c 62 00 00    	push   0x624c
+    39a2:	e8 59 03 00 00       	call   3d00 <printf>
+    exit();
+    39a7:	e8 b2 01 00 00       	call   3b5e <exit>
+    39ac:	66 90                	xchg   %ax,%ax
+    39ae:	66 90                	xchg   %ax,%ax
+
+000039b0 <threadstart>:
+static lock_t stacklock;
+static char *freestacks;  // linked through their first word
+
+static void
+threadstart(void *fn, void *arg)
+{
+    39b0:	55                   	push   %ebp
+    39b1:	89 e5                	mov    %esp,%ebp
+    39b3:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+    39b6:	ff 75 0c             	push   0xc(%ebp)
+    39b9:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+    39bc:	e8 9d 01 00 00       	call   3b5e <exit>
+    39c1:	66 90                	xchg   %ax,%ax
+    39c3:	66 90                	xchg   %ax,%ax
+    39c5:	66 90                	xchg   %ax,%ax
+    39c7:	66 90                	xchg   %ax,%ax
+    39c9:	66 90                	xchg   %ax,%ax
+    39cb:	66 90                	xchg   %ax,%ax
+    39cd:	66 90                	xchg   %ax,%ax
+    39cf:	90                   	nop
+
+000039d0 <memset>:
+{
+    39d0:	55                   	push   %ebp
+    39d1:	89 e5                	mov    %esp,%ebp
+    39d3:	57                   	push   %edi
+    39d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    39d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    39da:	8b 45 0c             	mov    0xc(%ebp),%eax
+    39dd:	89 d7                	mov    %edx,%edi
+    39df:	fc                   	cld
+    39e0:	f3 aa                	rep stos %al,%es:(%edi)
+}
+    39e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    39e5:	89 d0                	mov    %edx,%eax
+    39e7:	c9                   	leave
+    39e8:	c3                   	ret
+    39e9:	66 90                	xchg   %ax,%ax
+    39eb:	66 90                	xchg   %ax,%ax
+    39ed:	66 90                	xchg   %ax,%ax
+    39ef:	90                   	nop
+
+000039f0 <lock_init>:
+{
+    39f0:	55                   	push   %ebp
+    39f1:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    39f3:	8b 45 08             	mov    0x8(%ebp),%eax
+    39f6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    39fc:	5d                   	pop    %ebp
+    39fd:	c3                   	ret
+    39fe:	66 90                	xchg   %ax,%ax
+
+00003a00 <lock_acquire>:
+{
+    3a00:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    3a01:	b9 01 00 00 00       	mov    $0x1,%ecx
+    3a06:	89 e5                	mov    %esp,%ebp
+    3a08:	8b 55 08             	mov    0x8(%ebp),%edx
+    3a0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3a0f:	90                   	nop
+    3a10:	89 c8                	mov    %ecx,%eax
+    3a12:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    3a15:	85 c0                	test   %eax,%eax
+    3a17:	75 f7                	jne    3a10 <lock_acquire+0x10>
+}
+    3a19:	5d                   	pop    %ebp
+    3a1a:	c3                   	ret
+    3a1b:	66 90                	xchg   %ax,%ax
+    3a1d:	66 90                	xchg   %ax,%ax
+    3a1f:	90                   	nop
+
+00003a20 <lock_release>:
+{
+    3a20:	55                   	push   %ebp
+    3a21:	31 c0                	xor    %eax,%eax
+    3a23:	89 e5                	mov    %esp,%ebp
+    3a25:	8b 55 08             	mov    0x8(%ebp),%edx
+    3a28:	f0 87 02             	lock xchg %eax,(%edx)
+}
+    3a2b:	5d                   	pop    %ebp
+    3a2c:	c3                   	ret
+    3a2d:	66 90                	xchg   %ax,%ax
+    3a2f:	90                   	nop
+
+00003a30 <thread_create>:
+}
+
+// Start a thread running fn(arg).  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    3a30:	55                   	push   %ebp
+    3a31:	ba 01 00 00 00       	mov    $0x1,%edx
+    3a36:	89 e5                	mov    %esp,%ebp
+    3a38:	53                   	push   %ebx
+    3a39:	83 ec 04             	sub    $0x4,%esp
+    3a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3a40:	89 d0                	mov    %edx,%eax
+    3a42:	f0 87 05 44 aa 00 00 	lock xchg %eax,0xaa44
+  while(xchg(&lk->locked, 1) != 0)
+    3a49:	85 c0                	test   %eax,%eax
+    3a4b:	75 f3                	jne    3a40 <thread_create+0x10>
+  char *stack;
+  int pid;
+
+  lock_acquire(&stacklock);
+  if((stack = freestacks) != 0)
+    3a4d:	8b 1d 40 aa 00 00    	mov    0xaa40,%ebx
+    3a53:	85 db                	test   %ebx,%ebx
+    3a55:	74 71                	je     3ac8 <thread_create+0x98>
+    freestacks = *(char**)stack;
+    3a57:	8b 13                	mov    (%ebx),%edx
+    3a59:	89 15 40 aa 00 00    	mov    %edx,0xaa40
+    3a5f:	f0 87 05 44 aa 00 00 	lock xchg %eax,0xaa44
+  lock_release(&stacklock);
+  if(stack == 0 && (stack = sbrk(TSTACK)) == (char*)-1)
+    return -1;
+  if((pid = clone(threadstart, fn, arg, stack)) < 0){
+    3a66:	53                   	push   %ebx
+    3a67:	ff 75 0c             	push   0xc(%ebp)
+    3a6a:	ff 75 08             	push   0x8(%ebp)
+    3a6d:	68 b0 39 00 00       	push   $0x39b0
+    3a72:	e8 a7 01 00 00       	call   3c1e <clone>
+    3a77:	83 c4 10             	add    $0x10,%esp
+    3a7a:	89 c2                	mov    %eax,%edx
+    3a7c:	85 c0                	test   %eax,%eax
+    3a7e:	78 10                	js     3a90 <thread_create+0x60>
+    *(char**)stack = freestacks;
+    freestacks = stack;
+    lock_release(&stacklock);
+  }
+  return pid;
+}
+    3a80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3a83:	89 d0                	mov    %edx,%eax
+    3a85:	c9                   	leave
+    3a86:	c3                   	ret
+    3a87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3a8e:	66 90                	xchg   %ax,%ax
+    3a90:	b9 01 00 00 00       	mov    $0x1,%ecx
+    3a95:	8d 76 00             	lea    0x0(%esi),%esi
+    3a98:	89 c8                	mov    %ecx,%eax
+    3a9a:	f0 87 05 44 aa 00 00 	lock xchg %eax,0xaa44
+  while(xchg(&lk->locked, 1) != 0)
+    3aa1:	85 c0                	test   %eax,%eax
+    3aa3:	75 f3                	jne    3a98 <thread_create+0x68>
+    *(char**)stack = freestacks;
+    3aa5:	8b 0d 40 aa 00 00    	mov    0xaa40,%ecx
+    freestacks = stack;
+    3aab:	89 1d 40 aa 00 00    	mov    %ebx,0xaa40
+    *(char**)stack = freestacks;
+    3ab1:	89 0b                	mov    %ecx,(%ebx)
+    3ab3:	f0 87 05 44 aa 00 00 	lock xchg %eax,0xaa44
+}
+    3aba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3abd:	89 d0                	mov    %edx,%eax
+    3abf:	c9                   	leave
+    3ac0:	c3                   	ret
+    3ac1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3ac8:	89 d8                	mov    %ebx,%eax
+    3aca:	f0 87 05 44 aa 00 00 	lock xchg %eax,0xaa44
+  if(stack == 0 && (stack = sbrk(TSTACK)) == (char*)-1)
+    3ad1:	83 ec 0c             	sub    $0xc,%esp
+    3ad4:	68 00 10 00 00       	push   $0x1000
+    3ad9:	e8 08 01 00 00       	call   3be6 <sbrk>
+    3ade:	83 c4 10             	add    $0x10,%esp
+    3ae1:	89 c3                	mov    %eax,%ebx
+    3ae3:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3ae6:	0f 85 7a ff ff ff    	jne    3a66 <thread_create+0x36>
+    return -1;
+    3aec:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    3af1:	eb 8d                	jmp    3a80 <thread_create+0x50>
+    3af3:	66 90                	xchg   %ax,%ax
+    3af5:	66 90                	xchg   %ax,%ax
+    3af7:	66 90                	xchg   %ax,%ax
+    3af9:	66 90                	xchg   %ax,%ax
+    3afb:	66 90                	xchg   %ax,%ax
+    3afd:	66 90                	xchg   %ax,%ax
+    3aff:	90                   	nop
+
+00003b00 <thread_join>:
+
+// Wait for a thread started by thread_create() to finish.
+// Returns its pid, or -1 if there are none.
+int
+thread_join(void)
+{
+    3b00:	55                   	push   %ebp
+    3b01:	89 e5                	mov    %esp,%ebp
+    3b03:	53                   	push   %ebx
+  char *stack;
+  int pid;
+
+  if((pid = join((void**)&stack)) < 0)
+    3b04:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    3b07:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join((void**)&stack)) < 0)
+    3b0a:	50                   	push   %eax
+    3b0b:	e8 16 01 00 00       	call   3c26 <join>
+    3b10:	83 c4 10             	add    $0x10,%esp
+    3b13:	85 c0                	test   %eax,%eax
+    3b15:	78 38                	js     3b4f <thread_join+0x4f>
+    3b17:	89 c1                	mov    %eax,%ecx
+    3b19:	ba 01 00 00 00       	mov    $0x1,%edx
+    3b1e:	66 90                	xchg   %ax,%ax
+    3b20:	89 d0                	mov    %edx,%eax
+    3b22:	f0 87 05 44 aa 00 00 	lock xchg %eax,0xaa44
+  while(xchg(&lk->locked, 1) != 0)
+    3b29:	85 c0                	test   %eax,%eax
+    3b2b:	75 f3                	jne    3b20 <thread_join+0x20>
+    return -1;
+  lock_acquire(&stacklock);
+  *(char**)stack = freestacks;
+    3b2d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    3b30:	8b 1d 40 aa 00 00    	mov    0xaa40,%ebx
+    3b36:	89 1a                	mov    %ebx,(%edx)
+  freestacks = stack;
+    3b38:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    3b3b:	89 15 40 aa 00 00    	mov    %edx,0xaa40
+    3b41:	f0 87 05 44 aa 00 00 	lock xchg %eax,0xaa44
+  lock_release(&stacklock);
+  return pid;
+}
+    3b48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3b4b:	89 c8                	mov    %ecx,%eax
+    3b4d:	c9                   	leave
+    3b4e:	c3                   	ret
+    return -1;
+    3b4f:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+    3b54:	eb f2                	jmp    3b48 <thread_join+0x48>
+
+00003b56 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    3b56:	b8 01 00 00 00       	mov    $0x1,%eax
+    3b5b:	cd 40                	int    $0x40
+    3b5d:	c3                   	ret
+
+00003b5e <exit>:
+SYSCALL(exit)
+    3b5e:	b8 02 00 00 00       	mov    $0x2,%eax
+    3b63:	cd 40                	int    $0x40
+    3b65:	c3                   	ret
+
+00003b66 <wait>:
+SYSCALL(wait)
+    3b66:	b8 03 00 00 00       	mov    $0x3,%eax
+    3b6b:	cd 40                	int    $0x40
+    3b6d:	c3                   	ret
+
+00003b6e <pipe>:
+SYSCALL(pipe)
+    3b6e:	b8 04 00 00 00       	mov    $0x4,%eax
+    3b73:	cd 40                	int    $0x40
+    3b75:	c3                   	ret
+
+00003b76 <read>:
+SYSCALL(read)
+    3b76:	b8 05 00 00 00       	mov    $0x5,%eax
+    3b7b:	cd 40                	int    $0x40
+    3b7d:	c3                   	ret
+
+00003b7e <write>:
+SYSCALL(write)
+    3b7e:	b8 10 00 00 00       	mov    $0x10,%eax
+    3b83:	cd 40                	int    $0x40
+    3b85:	c3                   	ret
+
+00003b86 <close>:
+SYSCALL(close)
+    3b86:	b8 15 00 00 00       	mov    $0x15,%eax
+    3b8b:	cd 40                	int    $0x40
+    3b8d:	c3                   	ret
+
+00003b8e <kill>:
+SYSCALL(kill)
+    3b8e:	b8 06 00 00 00       	mov    $0x6,%eax
+    3b93:	cd 40                	int    $0x40
+    3b95:	c3                   	ret
+
+00003b96 <exec>:
+SYSCALL(exec)
+    3b96:	b8 07 00 00 00       	mov    $0x7,%eax
+    3b9b:	cd 40                	int    $0x40
+    3b9d:	c3                   	ret
+
+00003b9e <open>:
+SYSCALL(open)
+    3b9e:	b8 0f 00 00 00       	mov    $0xf,%eax
+    3ba3:	cd 40                	int    $0x40
+    3ba5:	c3                   	ret
+
+00003ba6 <mknod>:
+SYSCALL(mknod)
+    3ba6:	b8 11 00 00 00       	mov    $0x11,%eax
+    3bab:	cd 40                	int    $0x40
+    3bad:	c3                   	ret
+
+00003bae <unlink>:
+SYSCALL(unlink)
+    3bae:	b8 12 00 00 00       	mov    $0x12,%eax
+    3bb3:	cd 40                	int    $0x40
+    3bb5:	c3                   	ret
+
+00003bb6 <fstat>:
+SYSCALL(fstat)
+    3bb6:	b8 08 00 00 00       	mov    $0x8,%eax
+    3bbb:	cd 40                	int    $0x40
+    3bbd:	c3                   	ret
+
+00003bbe <link>:
+SYSCALL(link)
+    3bbe:	b8 13 00 00 00       	mov    $0x13,%eax
+    3bc3:	cd 40                	int    $0x40
+    3bc5:	c3                   	ret
+
+00003bc6 <mkdir>:
+SYSCALL(mkdir)
+    3bc6:	b8 14 00 00 00       	mov    $0x14,%eax
+    3bcb:	cd 40                	int    $0x40
+    3bcd:	c3                   	ret
+
+00003bce <chdir>:
+SYSCALL(chdir)
+    3bce:	b8 09 00 00 00       	mov    $0x9,%eax
+    3bd3:	cd 40                	int    $0x40
+    3bd5:	c3                   	ret
+
+00003bd6 <dup>:
+SYSCALL(dup)
+    3bd6:	b8 0a 00 00 00       	mov    $0xa,%eax
+    3bdb:	cd 40                	int    $0x40
+    3bdd:	c3                   	ret
+
+00003bde <getpid>:
+SYSCALL(getpid)
+    3bde:	b8 0b 00 00 00       	mov    $0xb,%eax
+    3be3:	cd 40                	int    $0x40
+    3be5:	c3                   	ret
+
+00003be6 <sbrk>:
+SYSCALL(sbrk)
+    3be6:	b8 0c 00 00 00       	mov    $0xc,%eax
+    3beb:	cd 40                	int    $0x40
+    3bed:	c3                   	ret
+
+00003bee <sleep>:
+SYSCALL(sleep)
+    3bee:	b8 0d 00 00 00       	mov    $0xd,%eax
+    3bf3:	cd 40                	int    $0x40
+    3bf5:	c3                   	ret
+
+00003bf6 <uptime>:
+SYSCALL(uptime)
+    3bf6:	b8 0e 00 00 00       	mov    $0xe,%eax
+    3bfb:	cd 40                	int    $0x40
+    3bfd:	c3                   	ret
+
+00003bfe <setpriority>:
+SYSCALL(setpriority)
+    3bfe:	b8 16 00 00 00       	mov    $0x16,%eax
+    3c03:	cd 40                	int    $0x40
+    3c05:	c3                   	ret
+
+00003c06 <settickets>:
+SYSCALL(settickets)
+    3c06:	b8 17 00 00 00       	mov    $0x17,%eax
+    3c0b:	cd 40                	int    $0x40
+    3c0d:	c3                   	ret
+
+00003c0e <getpinfo>:
+SYSCALL(getpinfo)
+    3c0e:	b8 18 00 00 00       	mov    $0x18,%eax
+    3c13:	cd 40                	int    $0x40
+    3c15:	c3                   	ret
+
+00003c16 <nanosleep>:
+SYSCALL(nanosleep)
+    3c16:	b8 19 00 00 00       	mov    $0x19,%eax
+    3c1b:	cd 40                	int    $0x40
+    3c1d:	c3                   	ret
+
+00003c1e <clone>:
+SYSCALL(clone)
+    3c1e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    3c23:	cd 40                	int    $0x40
+    3c25:	c3                   	ret
+
+00003c26 <join>:
+SYSCALL(join)
+    3c26:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    3c2b:	cd 40                	int    $0x40
+    3c2d:	c3                   	ret
+
+00003c2e <futex_wait>:
+SYSCALL(futex_wait)
+    3c2e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    3c33:	cd 40                	int    $0x40
+    3c35:	c3                   	ret
+
+00003c36 <futex_wake>:
+SYSCALL(futex_wake)
+    3c36:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    3c3b:	cd 40                	int    $0x40
+    3c3d:	c3                   	ret
+
+00003c3e <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+    3c3e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    3c43:	cd 40                	int    $0x40
+    3c45:	c3                   	ret
+
+00003c46 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+    3c46:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    3c4b:	cd 40                	int    $0x40
+    3c4d:	c3                   	ret
+
+00003c4e <iostat>:
+SYSCALL(iostat)
+    3c4e:	b8 20 00 00 00       	mov    $0x20,%eax
+    3c53:	cd 40                	int    $0x40
+    3c55:	c3                   	ret
+    3c56:	66 90                	xchg   %ax,%ax
+    3c58:	66 90                	xchg   %ax,%ax
+    3c5a:	66 90                	xchg   %ax,%ax
+    3c5c:	66 90                	xchg   %ax,%ax
+    3c5e:	66 90                	xchg   %ax,%ax
+
+00003c60 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    3c60:	55                   	push   %ebp
+    3c61:	89 e5                	mov    %esp,%ebp
+    3c63:	57                   	push   %edi
+    3c64:	56                   	push   %esi
+    3c65:	53                   	push   %ebx
+    3c66:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    3c68:	89 d1                	mov    %edx,%ecx
+{
+    3c6a:	83 ec 3c             	sub    $0x3c,%esp
+    3c6d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    3c70:	85 d2                	test   %edx,%edx
+    3c72:	0f 89 80 00 00 00    	jns    3cf8 <printint+0x98>
+    3c78:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    3c7c:	74 7a                	je     3cf8 <printint+0x98>
+    x = -xx;
+    3c7e:	f7 d9                	neg    %ecx
+    neg = 1;
+    3c80:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    3c85:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    3c88:	31 f6                	xor    %esi,%esi
+    3c8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    3c90:	89 c8                	mov    %ecx,%eax
+    3c92:	31 d2                	xor    %edx,%edx
+    3c94:	89 f7                	mov    %esi,%edi
+    3c96:	f7 f3                	div    %ebx
+    3c98:	8d 76 01             	lea    0x1(%esi),%esi
+    3c9b:	0f b6 92 6c 59 00 00 	movzbl 0x596c(%edx),%edx
+    3ca2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    3ca6:	89 ca                	mov    %ecx,%edx
+    3ca8:	89 c1                	mov    %eax,%ecx
+    3caa:	39 da                	cmp    %ebx,%edx
+    3cac:	73 e2                	jae    3c90 <printint+0x30>
+  if(neg)
+    3cae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    3cb1:	85 c0                	test   %eax,%eax
+    3cb3:	74 07                	je     3cbc <printint+0x5c>
+    buf[i++] = '-';
+    3cb5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    3cba:	89 f7                	mov    %esi,%edi
+    3cbc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    3cbf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    3cc2:	01 df                	add    %ebx,%edi
+    3cc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    3cc8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    3ccb:	83 ec 04             	sub    $0x4,%esp
+    3cce:	88 45 d7             	mov    %al,-0x29(%ebp)
+    3cd1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    3cd4:	6a 01                	push   $0x1
+    3cd6:	50                   	push   %eax
+    3cd7:	56                   	push   %esi
+    3cd8:	e8 a1 fe ff ff       	call   3b7e <write>
+  while(--i >= 0)
+    3cdd:	89 f8                	mov    %edi,%eax
+    3cdf:	83 c4 10             	add    $0x10,%esp
+    3ce2:	83 ef 01             	sub    $0x1,%edi
+    3ce5:	39 d8                	cmp    %ebx,%eax
+    3ce7:	75 df                	jne    3cc8 <printint+0x68>
+}
+    3ce9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3cec:	5b                   	pop    %ebx
+    3ced:	5e                   	pop    %esi
+    3cee:	5f                   	pop    %edi
+    3cef:	5d                   	pop    %ebp
+    3cf0:	c3                   	ret
+    3cf1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    3cf8:	31 c0                	xor    %eax,%eax
+    3cfa:	eb 89                	jmp    3c85 <printint+0x25>
+    3cfc:	66 90                	xchg   %ax,%ax
+    3cfe:	66 90                	xchg   %ax,%ax
+
+00003d00 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    3d00:	55                   	push   %ebp
+    3d01:	89 e5                	mov    %esp,%ebp
+    3d03:	57                   	push   %edi
+    3d04:	56                   	push   %esi
+    3d05:	53                   	push   %ebx
+    3d06:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    3d09:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    3d0c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    3d0f:	0f b6 1e             	movzbl (%esi),%ebx
+    3d12:	83 c6 01             	add    $0x1,%esi
+    3d15:	84 db                	test   %bl,%bl
+    3d17:	74 67                	je     3d80 <printf+0x80>
+    3d19:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    3d1c:	31 d2                	xor    %edx,%edx
+    3d1e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    3d21:	eb 34                	jmp    3d57 <printf+0x57>
+    3d23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3d27:	90                   	nop
+    3d28:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    3d2b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    3d30:	83 f8 25             	cmp    $0x25,%eax
+    3d33:	74 18                	je     3d4d <printf+0x4d>
+  write(fd, &c, 1);
+    3d35:	83 ec 04             	sub    $0x4,%esp
+    3d38:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    3d3b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    3d3e:	6a 01                	push   $0x1
+    3d40:	50                   	push   %eax
+    3d41:	57                   	push   %edi
+    3d42:	e8 37 fe ff ff       	call   3b7e <write>
+    3d47:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    3d4a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    3d4d:	0f b6 1e             	movzbl (%esi),%ebx
+    3d50:	83 c6 01             	add    $0x1,%esi
+    3d53:	84 db                	test   %bl,%bl
+    3d55:	74 29                	je     3d80 <printf+0x80>
+    c = fmt[i] & 0xff;
+    3d57:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    3d5a:	85 d2                	test   %edx,%edx
+    3d5c:	74 ca                	je     3d28 <printf+0x28>
+      }
+    } else if(state == '%'){
+    3d5e:	83 fa 25             	cmp    $0x25,%edx
+    3d61:	75 ea                	jne    3d4d <printf+0x4d>
+      if(c == 'd'){
+    3d63:	83 f8 25             	cmp    $0x25,%eax
+    3d66:	0f 84 24 01 00 00    	je     3e90 <printf+0x190>
+    3d6c:	83 e8 63             	sub    $0x63,%eax
+    3d6f:	83 f8 15             	cmp    $0x15,%eax
+    3d72:	77 1c                	ja     3d90 <printf+0x90>
+    3d74:	ff 24 85 14 59 00 00 	jmp    *0x5914(,%eax,4)
+    3d7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3d7f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    3d80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3d83:	5b                   	pop    %ebx
+    3d84:	5e                   	pop    %esi
+    3d85:	5f                   	pop    %edi
+    3d86:	5d                   	pop    %ebp
+    3d87:	c3                   	ret
+    3d88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3d8f:	90                   	nop
+  write(fd, &c, 1);
+    3d90:	83 ec 04             	sub    $0x4,%esp
+    3d93:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    3d96:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    3d9a:	6a 01                	push   $0x1
+    3d9c:	52                   	push   %edx
+    3d9d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    3da0:	57                   	push   %edi
+    3da1:	e8 d8 fd ff ff       	call   3b7e <write>
+    3da6:	83 c4 0c             	add    $0xc,%esp
+    3da9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    3dac:	6a 01                	push   $0x1
+    3dae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    3db1:	52                   	push   %edx
+    3db2:	57                   	push   %edi
+    3db3:	e8 c6 fd ff ff       	call   3b7e <write>
+        putc(fd, c);
+    3db8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3dbb:	31 d2                	xor    %edx,%edx
+    3dbd:	eb 8e                	jmp    3d4d <printf+0x4d>
+    3dbf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    3dc0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    3dc3:	83 ec 0c             	sub    $0xc,%esp
+    3dc6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    3dcb:	8b 13                	mov    (%ebx),%edx
+    3dcd:	6a 00                	push   $0x0
+    3dcf:	89 f8                	mov    %edi,%eax
+        ap++;
+    3dd1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    3dd4:	e8 87 fe ff ff       	call   3c60 <printint>
+        ap++;
+    3dd9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    3ddc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3ddf:	31 d2                	xor    %edx,%edx
+    3de1:	e9 67 ff ff ff       	jmp    3d4d <printf+0x4d>
+    3de6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3ded:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    3df0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    3df3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    3df5:	83 c0 04             	add    $0x4,%eax
+    3df8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    3dfb:	85 db                	test   %ebx,%ebx
+    3dfd:	0f 84 9d 00 00 00    	je     3ea0 <printf+0x1a0>
+        while(*s != 0){
+    3e03:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    3e06:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    3e08:	84 c0                	test   %al,%al
+    3e0a:	0f 84 3d ff ff ff    	je     3d4d <printf+0x4d>
+    3e10:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    3e13:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    3e16:	89 de                	mov    %ebx,%esi
+    3e18:	89 d3                	mov    %edx,%ebx
+    3e1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    3e20:	83 ec 04             	sub    $0x4,%esp
+    3e23:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    3e26:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    3e29:	6a 01                	push   $0x1
+    3e2b:	53                   	push   %ebx
+    3e2c:	57                   	push   %edi
+    3e2d:	e8 4c fd ff ff       	call   3b7e <write>
+        while(*s != 0){
+    3e32:	0f b6 06             	movzbl (%esi),%eax
+    3e35:	83 c4 10             	add    $0x10,%esp
+    3e38:	84 c0                	test   %al,%al
+    3e3a:	75 e4                	jne    3e20 <printf+0x120>
+      state = 0;
+    3e3c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    3e3f:	31 d2                	xor    %edx,%edx
+    3e41:	e9 07 ff ff ff       	jmp    3d4d <printf+0x4d>
+    3e46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e4d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    3e50:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    3e53:	83 ec 0c             	sub    $0xc,%esp
+    3e56:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    3e5b:	8b 13                	mov    (%ebx),%edx
+    3e5d:	6a 01                	push   $0x1
+    3e5f:	e9 6b ff ff ff       	jmp    3dcf <printf+0xcf>
+    3e64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    3e68:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    3e6b:	83 ec 04             	sub    $0x4,%esp
+    3e6e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    3e71:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    3e73:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    3e76:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    3e79:	6a 01                	push   $0x1
+    3e7b:	52                   	push   %edx
+    3e7c:	57                   	push   %edi
+    3e7d:	e8 fc fc ff ff       	call   3b7e <write>
+        ap++;
+    3e82:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    3e85:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3e88:	31 d2                	xor    %edx,%edx
+    3e8a:	e9 be fe ff ff       	jmp    3d4d <printf+0x4d>
+    3e8f:	90                   	nop
+  write(fd, &c, 1);
+    3e90:	83 ec 04             	sub    $0x4,%esp
+    3e93:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    3e96:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    3e99:	6a 01                	push   $0x1
+    3e9b:	e9 11 ff ff ff       	jmp    3db1 <printf+0xb1>
+    3ea0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    3ea5:	bb 0a 59 00 00       	mov    $0x590a,%ebx
+    3eaa:	e9 61 ff ff ff       	jmp    3e10 <printf+0x110>
+    3eaf:	90                   	nop
+
+00003eb0 <freeblock>:
+static Header *freep;
+static lock_t lock;  // for programs using threads
+
+static void
+freeblock(void *ap)
+{
+    3eb0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    3eb1:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+    3eb4:	89 e5                	mov    %esp,%ebp
+    3eb6:	57                   	push   %edi
+    3eb7:	56                   	push   %esi
+    3eb8:	53                   	push   %ebx
+    3eb9:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    3ebb:	a1 4c aa 00 00       	mov    0xaa4c,%eax
+    3ec0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    3ec2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    3ec4:	39 ca                	cmp    %ecx,%edx
+    3ec6:	73 30                	jae    3ef8 <freeblock+0x48>
+    3ec8:	39 c1                	cmp    %eax,%ecx
+    3eca:	72 04                	jb     3ed0 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    3ecc:	39 c2                	cmp    %eax,%edx
+    3ece:	72 f0                	jb     3ec0 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    3ed0:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    3ed3:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    3ed6:	39 f8                	cmp    %edi,%eax
+    3ed8:	74 26                	je     3f00 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    3eda:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    3edd:	8b 42 04             	mov    0x4(%edx),%eax
+    3ee0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    3ee3:	39 f1                	cmp    %esi,%ecx
+    3ee5:	74 30                	je     3f17 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    3ee7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    3ee9:	5b                   	pop    %ebx
+  freep = p;
+    3eea:	89 15 4c aa 00 00    	mov    %edx,0xaa4c
+}
+    3ef0:	5e                   	pop    %esi
+    3ef1:	5f                   	pop    %edi
+    3ef2:	5d                   	pop    %ebp
+    3ef3:	c3                   	ret
+    3ef4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    3ef8:	39 c1                	cmp    %eax,%ecx
+    3efa:	72 d0                	jb     3ecc <freeblock+0x1c>
+    3efc:	eb c2                	jmp    3ec0 <freeblock+0x10>
+    3efe:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+    3f00:	03 70 04             	add    0x4(%eax),%esi
+    3f03:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    3f06:	8b 02                	mov    (%edx),%eax
+    3f08:	8b 00                	mov    (%eax),%eax
+    3f0a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    3f0d:	8b 42 04             	mov    0x4(%edx),%eax
+    3f10:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    3f13:	39 f1                	cmp    %esi,%ecx
+    3f15:	75 d0                	jne    3ee7 <freeblock+0x37>
+    p->s.size += bp->s.size;
+    3f17:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    3f1a:	89 15 4c aa 00 00    	mov    %edx,0xaa4c
+    p->s.size += bp->s.size;
+    3f20:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    3f23:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    3f26:	89 0a                	mov    %ecx,(%edx)
+}
+    3f28:	5b                   	pop    %ebx
+    3f29:	5e                   	pop    %esi
+    3f2a:	5f                   	pop    %edi
+    3f2b:	5d                   	pop    %ebp
+    3f2c:	c3                   	ret
+    3f2d:	66 90                	xchg   %ax,%ax
+    3f2f:	90                   	nop
+
+00003f30 <free>:
+
+void
+free(void *ap)
+{
+    3f30:	55                   	push   %ebp
+    3f31:	89 e5                	mov    %esp,%ebp
+    3f33:	53                   	push   %ebx
+    3f34:	83 ec 10             	sub    $0x10,%esp
+    3f37:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lock_acquire(&lock);
+    3f3a:	68 48 aa 00 00       	push   $0xaa48
+    3f3f:	e8 bc fa ff ff       	call   3a00 <lock_acquire>
+  freeblock(ap);
+    3f44:	89 d8                	mov    %ebx,%eax
+    3f46:	e8 65 ff ff ff       	call   3eb0 <freeblock>
+  lock_release(&lock);
+    3f4b:	c7 45 08 48 aa 00 00 	movl   $0xaa48,0x8(%ebp)
+}
+    3f52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  lock_release(&lock);
+    3f55:	83 c4 10             	add    $0x10,%esp
+}
+    3f58:	c9                   	leave
+  lock_release(&lock);
+    3f59:	e9 c2 fa ff ff       	jmp    3a20 <lock_release>
+    3f5e:	66 90                	xchg   %ax,%ax
+
+00003f60 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    3f60:	55                   	push   %ebp
+    3f61:	89 e5                	mov    %esp,%ebp
+    3f63:	57                   	push   %edi
+    3f64:	56                   	push   %esi
+    3f65:	53                   	push   %ebx
+    3f66:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    3f69:	8b 45 08             	mov    0x8(%ebp),%eax
+  lock_acquire(&lock);
+    3f6c:	68 48 aa 00 00       	push   $0xaa48
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    3f71:	8d 48 07             	lea    0x7(%eax),%ecx
+    3f74:	c1 e9 03             	shr    $0x3,%ecx
+    3f77:	8d 71 01             	lea    0x1(%ecx),%esi
+  lock_acquire(&lock);
+    3f7a:	e8 81 fa ff ff       	call   3a00 <lock_acquire>
+  if((prevp = freep) == 0){
+    3f7f:	8b 15 4c aa 00 00    	mov    0xaa4c,%edx
+    3f85:	83 c4 10             	add    $0x10,%esp
+    3f88:	85 d2                	test   %edx,%edx
+    3f8a:	0f 84 b0 00 00 00    	je     4040 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    3f90:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    3f92:	8b 47 04             	mov    0x4(%edi),%eax
+    3f95:	39 f0                	cmp    %esi,%eax
+    3f97:	73 6f                	jae    4008 <malloc+0xa8>
+  if(nu < 4096)
+    3f99:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    3f9e:	39 de                	cmp    %ebx,%esi
+    3fa0:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    3fa3:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+    3faa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    3fad:	eb 0a                	jmp    3fb9 <malloc+0x59>
+    3faf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    3fb0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    3fb2:	8b 47 04             	mov    0x4(%edi),%eax
+    3fb5:	39 f0                	cmp    %esi,%eax
+    3fb7:	73 4f                	jae    4008 <malloc+0xa8>
+      }
+      freep = prevp;
+      lock_release(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    3fb9:	89 fa                	mov    %edi,%edx
+    3fbb:	39 3d 4c aa 00 00    	cmp    %edi,0xaa4c
+    3fc1:	75 ed                	jne    3fb0 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+    3fc3:	83 ec 0c             	sub    $0xc,%esp
+    3fc6:	ff 75 e4             	push   -0x1c(%ebp)
+    3fc9:	e8 18 fc ff ff       	call   3be6 <sbrk>
+  if(p == (char*)-1)
+    3fce:	83 c4 10             	add    $0x10,%esp
+    3fd1:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3fd4:	74 15                	je     3feb <malloc+0x8b>
+  hp->s.size = nu;
+    3fd6:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+    3fd9:	83 c0 08             	add    $0x8,%eax
+    3fdc:	e8 cf fe ff ff       	call   3eb0 <freeblock>
+  return freep;
+    3fe1:	8b 15 4c aa 00 00    	mov    0xaa4c,%edx
+      if((p = morecore(nunits)) == 0){
+    3fe7:	85 d2                	test   %edx,%edx
+    3fe9:	75 c5                	jne    3fb0 <malloc+0x50>
+        lock_release(&lock);
+    3feb:	83 ec 0c             	sub    $0xc,%esp
+    3fee:	68 48 aa 00 00       	push   $0xaa48
+    3ff3:	e8 28 fa ff ff       	call   3a20 <lock_release>
+        return 0;
+    3ff8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+    3ffb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    3ffe:	31 c0                	xor    %eax,%eax
+}
+    4000:	5b                   	pop    %ebx
+    4001:	5e                   	pop    %esi
+    4002:	5f                   	pop    %edi
+    4003:	5d                   	pop    %ebp
+    4004:	c3                   	ret
+    4005:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    4008:	39 c6                	cmp    %eax,%esi
+    400a:	74 64                	je     4070 <malloc+0x110>
+        p->s.size -= nunits;
+    400c:	29 f0                	sub    %esi,%eax
+    400e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+    4011:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+    4014:	89 77 04             	mov    %esi,0x4(%edi)
+      lock_release(&lock);
+    4017:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+    401a:	89 15 4c aa 00 00    	mov    %edx,0xaa4c
+      lock_release(&lock);
+    4020:	68 48 aa 00 00       	push   $0xaa48
+    4025:	e8 f6 f9 ff ff       	call   3a20 <lock_release>
+      return (void*)(p + 1);
+    402a:	83 c4 10             	add    $0x10,%esp
+}
+    402d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    4030:	8d 47 08             	lea    0x8(%edi),%eax
+}
+    4033:	5b                   	pop    %ebx
+    4034:	5e                   	pop    %esi
+    4035:	5f                   	pop    %edi
+    4036:	5d                   	pop    %ebp
+    4037:	c3                   	ret
+    4038:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    403f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+    4040:	c7 05 4c aa 00 00 50 	movl   $0xaa50,0xaa4c
+    4047:	aa 00 00 
+    base.s.size = 0;
+    404a:	bf 50 aa 00 00       	mov    $0xaa50,%edi
+    base.s.ptr = freep = prevp = &base;
+    404f:	c7 05 50 aa 00 00 50 	movl   $0xaa50,0xaa50
+    4056:	aa 00 00 
+    base.s.size = 0;
+    4059:	c7 05 54 aa 00 00 00 	movl   $0x0,0xaa54
+    4060:	00 00 00 
+    if(p->s.size >= nunits){
+    4063:	e9 31 ff ff ff       	jmp    3f99 <malloc+0x39>
+    4068:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    406f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    4070:	8b 07                	mov    (%edi),%eax
+    4072:	89 02                	mov    %eax,(%edx)
+    4074:	eb a1                	jmp    4017 <malloc+0xb7>
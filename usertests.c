@@ -434,7 +434,9 @@ mem(void)
   ppid = getpid();
   if((pid = fork()) == 0){
     m1 = 0;
-    while((m2 = malloc(10001)) != 0){
+    // sbrk() is lazy, so malloc() does not fail when memory
+    // runs out; a touch does, and kills.  Stop at 32MB.
+    while(sbrk(0) < (char*)(32*1024*1024) && (m2 = malloc(10001)) != 0){
       *(char**)m2 = m1;
       m1 = m2;
     }
@@ -1347,7 +1349,7 @@ iref(void)
 
   printf(1, "empty file name\n");
 
-  // the 50 is NINODE
+  // the 50 was NINODE, the size of the old static inode table
   for(i = 0; i < 50 + 1; i++){
     if(mkdir("irefd") != 0){
       printf(1, "mkdir irefd failed\n");
@@ -1414,7 +1416,7 @@ forktest(void)
 void
 sbrktest(void)
 {
-  int fds[2], pid, pids[10], ppid;
+  int fds[2], hold[2], pid, pids[10], ppid;
   char *a, *b, *c, *lastaddr, *oldbrk, *p, scratch;
   uint amt;
 
@@ -1543,6 +1545,46 @@ sbrktest(void)
   if(sbrk(0) > oldbrk)
     sbrk(-(sbrk(0) - oldbrk));
 
+  // can four processes hold sparse heaps that add up to more
+  // than physical memory, touching only one page per megabyte?
+  if(pipe(fds) != 0 || pipe(hold) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  for(i = 0; i < 4; i++){
+    if((pids[i] = fork()) == 0){
+      close(hold[1]);
+      a = sbrk(0);
+      amt = BIG - (uint)a;
+      if(sbrk(amt) != a){
+        printf(stdout, "sparse sbrk failed\n");
+        exit();
+      }
+      for(p = a; p < a + amt; p += 1024*1024){
+        if(*p != 0){
+          printf(stdout, "sparse heap not zero\n");
+          exit();
+        }
+        *p = 1;
+      }
+      write(fds[1], "x", 1);
+      read(hold[0], &scratch, 1);  // keep the heap until the parent is done
+      exit();
+    }
+  }
+  close(hold[0]);
+  for(i = 0; i < 4; i++){
+    if(pids[i] < 0 || read(fds[0], &scratch, 1) != 1){
+      printf(stdout, "sparse heap test failed\n");
+      exit();
+    }
+  }
+  close(hold[1]);
+  close(fds[0]);
+  close(fds[1]);
+  for(i = 0; i < 4; i++)
+    wait();
+
   printf(stdout, "sbrk test OK\n");
 }
 
@@ -1745,6 +1787,65 @@ rand()
   return randstate;
 }
 
+// do threads share memory, and are they joined rather than
+// waited for?
+int tcount;
+lock_t tlock;
+
+void
+threadinc(void *arg)
+{
+  int i;
+
+  for(i = 0; i < 1000; i++){
+    lock_acquire(&tlock);
+    tcount++;
+    lock_release(&tlock);
+  }
+  *(int*)arg = getpid();
+}
+
+void
+threadtest(void)
+{
+  int i, pids[4];
+
+  printf(stdout, "thread test\n");
+  lock_init(&tlock);
+  for(i = 0; i < 4; i++){
+    pids[i] = 0;
+    if(thread_create(threadinc, &pids[i]) < 0){
+      printf(stdout, "thread_create failed\n");
+      exit();
+    }
+  }
+  if(wait() != -1){
+    printf(stdout, "wait returned a thread\n");
+    exit();
+  }
+  for(i = 0; i < 4; i++){
+    if(thread_join() < 0){
+      printf(stdout, "thread_join failed\n");
+      exit();
+    }
+  }
+  if(thread_join() != -1){
+    printf(stdout, "thread_join with no threads\n");
+    exit();
+  }
+  if(tcount != 4000){
+    printf(stdout, "thread test: count %d, want 4000\n", tcount);
+    exit();
+  }
+  for(i = 0; i < 4; i++){
+    if(pids[i] == 0 || pids[i] == getpid()){
+      printf(stdout, "thread test: bad pid %d\n", pids[i]);
+      exit();
+    }
+  }
+  printf(stdout, "thread test ok\n");
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -1793,6 +1894,7 @@ main(int argc, char *argv[])
   dirfile();
   iref();
   forktest();
+  threadtest();
   bigdir(); // slow
 
   uio();
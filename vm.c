@@ -6,11 +6,12 @@
 #include "mmu.h"
 #include "proc.h"
 #include "elf.h"
-#include "buddy.h"
+#include "traps.h"
 #include <stddef.h>
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
+static char *junk;  // for junkfault() when memory runs out
 
 // Set up CPU's kernel segment descriptors.
 // Run once on entry on each CPU.
@@ -44,10 +45,9 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   if(*pde & PTE_P){
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)buddy_alloc(PGSIZE)) == 0)
-      return 0;
     // Make sure all those PTE_P bits are zero.
-    memset(pgtab, 0, PGSIZE);
+    if(!alloc || (pgtab = (pte_t*)kalloc_zeroed()) == 0)
+      return 0;
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table
     // entries, if necessary.
@@ -87,6 +87,12 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 // page protection bits prevent user code from using the kernel's
 // mappings.
 //
+// kvmalloc() builds the kernel part once, in kpgdir, mapping
+// with 4MB (PTE_PS) pages wherever alignment and permissions
+// allow.  setupkvm() copies kpgdir's kernel page directory
+// entries into each new page table, so every process shares the
+// kernel's page tables and freevm() must leave them alone.
+//
 // setupkvm() and exec() set up every page table like this:
 //
 //   0..KERNBASE: user memory (text+data+stack+heap), mapped to
@@ -116,23 +122,44 @@ static struct kmap {
  { (void*)DEVSPACE, DEVSPACE,      0,         PTE_W}, // more devices
 };
 
-// Set up kernel part of a page table. 
+// Like mappages, but use a 4MB page for each 4MB-aligned
+// stretch of the range.  Only for building kpgdir.
+static int
+mapkernel(pde_t *pgdir, uint va, uint size, uint pa, int perm)
+{
+  uint n;
+
+  while(size > 0){
+    if(va % PGSIZE_PS == 0 && pa % PGSIZE_PS == 0 && size >= PGSIZE_PS){
+      if(pgdir[PDX(va)] & PTE_P)
+        panic("remap");
+      pgdir[PDX(va)] = pa | perm | PTE_P | PTE_PS;
+      n = PGSIZE_PS;
+    } else {
+      // Map 4KB pages up to the next 4MB boundary.
+      n = PGSIZE_PS - va % PGSIZE_PS;
+      if(n > size)
+        n = size;
+      if(mappages(pgdir, (void*)va, n, pa, perm) < 0)
+        return -1;
+    }
+    va += n;
+    pa += n;
+    size -= n;
+  }
+  return 0;
+}
+
+// Set up kernel part of a page table.
+pde_t*
 setupkvm(void)
 {
   pde_t *pgdir;
-  struct kmap *k;
 
-  if((pgdir = (pde_t*)buddy_alloc(PGSIZE)) == 0)
+  if((pgdir = (pde_t*)kalloc_zeroed()) == 0)
     return NULL;
-  memset(pgdir, 0, PGSIZE);
-  if (P2V(PHYSTOP) > (void*)DEVSPACE)
-    panic("PHYSTOP too high");
-  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
-    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
-                (uint)k->phys_start, k->perm) < 0) {
-      freevm(pgdir);
-      return NULL;
-    }
+  memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+          (NPDENTRIES - PDX(KERNBASE)) * sizeof(pde_t));
   return pgdir;
 }
 
@@ -141,8 +168,21 @@ setupkvm(void)
 void
 kvmalloc(void)
 {
-  kpgdir = setupkvm();
-  switchkvm();
+  struct kmap *k;
+
+  if((kpgdir = (pde_t*)kalloc_zeroed()) == 0)
+    panic("kvmalloc");
+  if (P2V(PHYSTOP) > (void*)DEVSPACE)
+    panic("PHYSTOP too high");
+  // The kernel half is the same in every page table, so its
+  // TLB entries can be global and survive switchuvm().
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+    if(mapkernel(kpgdir, (uint)k->virt, k->phys_end - k->phys_start,
+                 (uint)k->phys_start, k->perm | PTE_G) < 0)
+      panic("kvmalloc: out of memory");
+  lcr3(V2P(kpgdir));
+  if((junk = kalloc_zeroed()) == 0)
+    panic("kvmalloc: out of memory");
 }
 
 // Switch h/w page table register to the kernel-only page table,
@@ -150,7 +190,10 @@ kvmalloc(void)
 void
 switchkvm(void)
 {
+  pushcli();
+  mycpu()->pgdir = 0;
   lcr3(V2P(kpgdir));   // switch to the kernel page table
+  popcli();
 }
 
 // Switch TSS and h/w page table to correspond to process p.
@@ -174,10 +217,78 @@ switchuvm(struct proc *p)
   // forbids I/O instructions (e.g., inb and outb) from user space
   mycpu()->ts.iomb = (ushort) 0xFFFF;
   ltr(SEG_TSS << 3);
-  lcr3(V2P(p->pgdir));  // switch to process's address space
+  // Threads of one process share a page table; switching
+  // between them keeps the TLB.
+  if(mycpu()->pgdir != p->pgdir){
+    mycpu()->pgdir = p->pgdir;
+    lcr3(V2P(p->pgdir));  // switch to process's address space
+  }
   popcli();
 }
 
+//PAGEBREAK!
+// TLB shootdown.  Threads sharing a page table may be running
+// on several CPUs at once, each with its own TLB caching
+// mappings from that page table.  After making a mapping less
+// permissive, or pointing it at a different page, the kernel
+// must flush them all before relying on the change.
+// Each CPU records the user page table it has loaded in
+// cpu->pgdir, so only CPUs that could hold stale entries are
+// interrupted.
+
+// Flush the TLB of every other CPU that has pgdir loaded, and
+// wait until they have.  The caller has updated the page table.
+// Two CPUs can never be waiting for each other here: both
+// would have to have loaded the other's page table.
+static void
+shootdown(pde_t *pgdir)
+{
+  struct cpu *c;
+  uint req[NCPU];
+  int i, me, sent[NCPU];
+
+  pushcli();
+  me = cpuid();
+  __sync_synchronize();  // page table writes before reading c->pgdir
+  for(i = 0; i < ncpu; i++){
+    c = &cpus[i];
+    sent[i] = i != me && c->pgdir == pgdir;
+    if(sent[i]){
+      req[i] = __sync_add_and_fetch(&c->tlbreq, 1);
+      lapicsend(c->apicid, T_IRQ0 + IRQ_TLB);
+    }
+  }
+  for(i = 0; i < ncpu; i++)
+    if(sent[i])
+      while((int)(cpus[i].tlbdone - req[i]) < 0)
+        ;
+  popcli();
+}
+
+// Flush pgdir's user mappings from every TLB that may hold them.
+static void
+tlbflush(pde_t *pgdir)
+{
+  pushcli();
+  if(mycpu()->pgdir == pgdir)
+    lcr3(V2P(pgdir));
+  shootdown(pgdir);
+  popcli();
+}
+
+// Interrupt from shootdown().  Every request made before
+// tlbreq is read here is covered by the flush after it.
+void
+tlbintr(void)
+{
+  struct cpu *c = mycpu();
+  uint req;
+
+  req = c->tlbreq;
+  lcr3(rcr3());
+  c->tlbdone = req;
+}
+
 // Load the initcode into address 0 of pgdir.
 // sz must be less than a page.
 void
@@ -187,36 +298,11 @@ inituvm(pde_t *pgdir, char *init, uint sz)
 
   if(sz >= PGSIZE)
     panic("inituvm: more than a page");
-  mem = buddy_alloc(PGSIZE);
-  memset(mem, 0, PGSIZE);
+  mem = kalloc_zeroed();
   mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
   memmove(mem, init, sz);
 }
 
-// Load a program segment into pgdir.  addr must be page-aligned
-// and the pages from addr to addr+sz must already be mapped.
-int
-loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
-{
-  uint i, pa, n;
-  pte_t *pte;
-
-  if((uint) addr % PGSIZE != 0)
-    panic("loaduvm: addr must be page aligned");
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
-      panic("loaduvm: address should exist");
-    pa = PTE_ADDR(*pte);
-    if(sz - i < PGSIZE)
-      n = sz - i;
-    else
-      n = PGSIZE;
-    if(readi(ip, P2V(pa), offset+i, n) != n)
-      return -1;
-  }
-  return 0;
-}
-
 // Allocate page tables and physical memory to grow process from oldsz to
 // newsz, which need not be page aligned.  Returns new size or 0 on error.
 int
@@ -232,13 +318,12 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 
   a = PGROUNDUP(oldsz);
   for(; a < newsz; a += PGSIZE){
-    mem = buddy_alloc(PGSIZE);
+    mem = kalloc_zeroed();
     if(mem == 0){
       cprintf("allocuvm out of memory\n");
       deallocuvm(pgdir, newsz, oldsz);
       return 0;
     }
-    memset(mem, 0, PGSIZE);
     if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
       cprintf("allocuvm out of memory (2)\n");
       deallocuvm(pgdir, newsz, oldsz);
@@ -258,16 +343,32 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 {
   pte_t *pte;
   uint a, pa;
+  int n;
 
   if(newsz >= oldsz)
     return oldsz;
 
-  a = PGROUNDUP(newsz);
-  for(; a  < oldsz; a += PGSIZE){
+  // Unmap the pages, leaving their addresses in the PTEs, and
+  // free them only once no TLB can reach them any more.
+  n = 0;
+  for(a = PGROUNDUP(newsz); a < oldsz; a += PGSIZE){
     pte = walkpgdir(pgdir, (char*)a, 0);
     if(!pte)
       a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
     else if((*pte & PTE_P) != 0){
+      *pte &= ~PTE_P;
+      n++;
+    }
+  }
+  if(n == 0)
+    return newsz;
+  tlbflush(pgdir);
+
+  for(a = PGROUNDUP(newsz); a  < oldsz; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+    else if(*pte != 0){
       pa = PTE_ADDR(*pte);
       if(pa == 0)
         panic("kfree");
@@ -280,7 +381,7 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 }
 
 // Free a page table and all the physical memory pages
-// in the user part.
+// in the user part.  The kernel part belongs to kpgdir.
 void
 freevm(pde_t *pgdir)
 {
@@ -289,7 +390,7 @@ freevm(pde_t *pgdir)
   if(pgdir == 0)
     panic("freevm: no pgdir");
   deallocuvm(pgdir, KERNBASE, 0);
-  for(i = 0; i < NPDENTRIES; i++){
+  for(i = 0; i < PDX(KERNBASE); i++){
     if(pgdir[i] & PTE_P){
       char * v = P2V(PTE_ADDR(pgdir[i]));
       kfree(v);
@@ -312,39 +413,296 @@ clearpteu(pde_t *pgdir, char *uva)
 }
 
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child.  The child shares the parent's pages:
+// writable pages become read-only and PTE_COW in both page
+// tables, and cowfault() copies one when either side writes it.
+// pgdir must be the current page table, locked with uvmlock().
 pde_t*
 copyuvm(pde_t *pgdir, uint sz)
 {
   pde_t *d;
   pte_t *pte;
   uint pa, i, flags;
-  char *mem;
 
   if((d = setupkvm()) == 0)
     return 0;
   for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
+    // Heap pages not touched yet have nothing to share.
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
     if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
+      continue;
+    if(*pte & PTE_W)
+      *pte = (*pte & ~PTE_W) | PTE_COW;
     pa = PTE_ADDR(*pte);
     flags = PTE_FLAGS(*pte);
-    if((mem = buddy_alloc(PGSIZE)) == 0)
-      goto bad;
-    memmove(mem, (char*)P2V(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
-      kfree(mem);
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
       goto bad;
-    }
+    kincref(P2V(pa));
   }
+  tlbflush(pgdir);  // flush the parent's stale writable TLB entries
   return d;
 
 bad:
+  tlbflush(pgdir);
   freevm(d);
   return 0;
 }
 
+// Handle a write to a copy-on-write page at user address va.
+// Gives pgdir a private, writable copy of the page, or takes
+// over the page if no other page table maps it any more.
+// Returns 0 on success, -1 if va is not a copy-on-write page
+// or memory is exhausted.
+static int
+cowfault(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  char *mem, *old;
+
+  if(va >= KERNBASE)
+    return -1;
+  if((pte = walkpgdir(pgdir, (char*)va, 0)) == 0)
+    return -1;
+  if((*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+    return -1;
+  old = P2V(PTE_ADDR(*pte));
+  if(krefcnt(old) > 1){
+    if((mem = kalloc()) == 0)
+      return -1;
+    memmove(mem, old, PGSIZE);
+    *pte = V2P(mem) | (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+    invlpg((char*)PGROUNDDOWN(va));
+    shootdown(pgdir);  // other threads must not read the old page
+    kfree(old);
+  } else {
+    // Another thread's TLB may still map it read-only; see fault().
+    *pte = (*pte & ~PTE_COW) | PTE_W;
+    invlpg((char*)PGROUNDDOWN(va));
+  }
+  return 0;
+}
+
+// Handle the first touch of user address va in a process of
+// size sz whose heap grows lazily (see growproc): map a zeroed
+// page there.  Returns 0 on success, -1 if va is outside the
+// process or already mapped, or memory is exhausted.
+static int
+lazyfault(pde_t *pgdir, uint va, uint sz)
+{
+  pte_t *pte;
+  char *mem;
+
+  if(va >= sz || va >= KERNBASE)
+    return -1;
+  va = PGROUNDDOWN(va);
+  if((pte = walkpgdir(pgdir, (char*)va, 0)) != 0 && (*pte & PTE_P))
+    return -1;
+  if((mem = kalloc_zeroed()) == 0){
+    cprintf("lazyfault: out of memory\n");
+    return -1;
+  }
+  if(mappages(pgdir, (char*)va, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Handle the first touch of user address va if it lies in one
+// of p's program segments: read the page in from the executable.
+// Pages that lie wholly within the file come from the page cache
+// and are shared copy-on-write with every other process running
+// the same executable; the rest are private.
+// May sleep, so the kernel must not fault on such a page while
+// holding a spinlock (see prefault).  Caller holds uvmlock(p),
+// which is dropped while the executable is locked and read:
+// fileread() holds an inode lock while it copies to user memory,
+// and a fault there takes uvmlock.  Returns 0 on success, -1 if
+// va is not in a segment below p->sz or the page cannot be read.
+static int
+segfault(struct proc *p, uint va)
+{
+  struct pseg *s;
+  pte_t *pte;
+  char *mem;
+  uint a, n;
+  int perm;
+
+  if(va >= p->sz)  // sbrk() may have shrunk the segment
+    return -1;
+  va = PGROUNDDOWN(va);
+  for(s = p->seg; s < &p->seg[NPSEG]; s++)
+    if(s->ip && va >= s->va && va < s->va + s->memsz)
+      break;
+  if(s == &p->seg[NPSEG])
+    return -1;
+  if((pte = walkpgdir(p->pgdir, (char*)va, 0)) != 0 && (*pte & PTE_P))
+    return -1;
+
+  a = va - s->va;
+  uvmunlock(p);
+  ilock(s->ip);
+  if(a + PGSIZE <= s->filesz){
+    mem = pcget(s->ip, s->off + a);
+    perm = PTE_U|PTE_COW;
+  } else {
+    if((mem = kalloc_zeroed()) != 0 && a < s->filesz){
+      n = s->filesz - a;
+      if(readi(s->ip, mem, s->off + a, n) != n){
+        kfree(mem);
+        mem = 0;
+      }
+    }
+    perm = PTE_W|PTE_U;
+  }
+  iunlock(s->ip);
+  uvmlock(p);
+  if(mem == 0)
+    return -1;
+
+  // Another thread may have faulted the page in, or shrunk the
+  // address space, meanwhile.
+  if((pte = walkpgdir(p->pgdir, (char*)va, 0)) != 0 && (*pte & PTE_P)){
+    kfree(mem);
+    return 0;
+  }
+  if(va >= p->sz){
+    kfree(mem);
+    return -1;
+  }
+  if(mappages(p->pgdir, (char*)va, PGSIZE, V2P(mem), perm) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Resolve a page fault at user address va in process p:
+// copy-on-write, paging in from the executable, or lazy heap
+// allocation.  A fault on a page that is already present and
+// writable comes from a stale TLB entry: another thread
+// resolved it first.  Caller holds uvmlock(p), though
+// segfault() drops it for a while.
+static int
+fault(struct proc *p, uint va)
+{
+  pte_t *pte;
+
+  pte = walkpgdir(p->pgdir, (char*)va, 0);
+  if(va < KERNBASE && pte && (*pte & (PTE_P|PTE_U|PTE_W)) == (PTE_P|PTE_U|PTE_W)){
+    invlpg((char*)PGROUNDDOWN(va));
+    return 0;
+  }
+  if(cowfault(p->pgdir, va) == 0)
+    return 0;
+  if(segfault(p, va) == 0)
+    return 0;
+  return lazyfault(p->pgdir, va, p->sz);
+}
+
+// Resolve a page fault at user address va in process p.
+// Returns 0 if resolved, -1 if the access is bad.
+int
+pagefault(struct proc *p, uint va)
+{
+  int r;
+
+  uvmlock(p);
+  r = fault(p, va);
+  uvmunlock(p);
+  return r;
+}
+
+// The kernel touched user address va during one of p's system
+// calls and pagefault() could not resolve it: memory ran out
+// breaking copy-on-write, say.  Map a page of junk there, a
+// fresh one if possible, so that the kernel can finish the
+// system call; the caller kills p.
+// Returns -1 if va is not a user address.
+int
+junkfault(struct proc *p, uint va)
+{
+  pte_t *pte;
+  char *mem, *old;
+
+  if(va >= KERNBASE)
+    return -1;
+  va = PGROUNDDOWN(va);
+  if((mem = kalloc_zeroed()) == 0){
+    mem = junk;
+    kincref(mem);
+  }
+  uvmlock(p);
+  if((pte = walkpgdir(p->pgdir, (char*)va, 0)) != 0 && (*pte & PTE_P)){
+    old = P2V(PTE_ADDR(*pte));
+    *pte = V2P(mem) | PTE_P | PTE_W | PTE_U;
+    tlbflush(p->pgdir);
+    kfree(old);
+  } else if(mappages(p->pgdir, (char*)va, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+    uvmunlock(p);
+    kfree(mem);
+    return -1;
+  }
+  uvmunlock(p);
+  return 0;
+}
+
+// Make the user pages covering [va, va+n) present, and private
+// if write is set, so that system calls do not usually fault
+// on them.  The kernel still never touches user memory while
+// holding a spinlock: a sibling thread's fork() can make the
+// pages copy-on-write again, and resolving that sleeps on
+// uvmlock and waits for other CPUs in shootdown().
+// Returns 0 on success, -1 if the memory cannot be provided.
+int
+prefault(struct proc *p, uint va, uint n, int write)
+{
+  uint a;
+  pte_t *pte;
+  int r;
+
+  r = 0;
+  uvmlock(p);
+  for(a = PGROUNDDOWN(va); a < va + n; a += PGSIZE){
+    pte = walkpgdir(p->pgdir, (char*)a, 0);
+    if(pte && (*pte & PTE_P) && !(write && (*pte & PTE_COW)))
+      continue;
+    if(fault(p, a) < 0){
+      r = -1;
+      break;
+    }
+  }
+  uvmunlock(p);
+  return r;
+}
+
+// Count the user pages below sz that are present in pgdir and
+// shared with other page tables or the page cache, and those
+// that are private.  For procdump(); takes no locks.
+void
+uvmcount(pde_t *pgdir, uint sz, int *shared, int *private)
+{
+  pte_t *pte;
+  uint a;
+
+  *shared = *private = 0;
+  for(a = 0; a < sz; a += PGSIZE){
+    if((pte = walkpgdir(pgdir, (char*)a, 0)) == 0){
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
+    if(!(*pte & PTE_P))
+      continue;
+    if(krefcnt(P2V(PTE_ADDR(*pte))) > 1)
+      (*shared)++;
+    else
+      (*private)++;
+  }
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
@@ -353,7 +711,7 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
@@ -363,15 +721,23 @@ uva2ka(pde_t *pgdir, char *uva)
 // Copy len bytes from p to user address va in page table pgdir.
 // Most useful when pgdir is not the current page table.
 // uva2ka ensures this only works for PTE_U pages.
+// If threads may be using pgdir, the caller holds their
+// uvmlock: breaking copy-on-write may shoot down their TLBs.
 int
 copyout(pde_t *pgdir, uint va, void *p, uint len)
 {
   char *buf, *pa0;
   uint n, va0;
+  pte_t *pte;
 
   buf = (char*)p;
   while(len > 0){
     va0 = (uint)PGROUNDDOWN(va);
+    // Writes through the kernel mapping do not fault,
+    // so break copy-on-write sharing by hand.
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if(pte && (*pte & PTE_COW) && cowfault(pgdir, va0) < 0)
+      return -1;
     pa0 = uva2ka(pgdir, (char*)va0);
     if(pa0 == 0)
       return -1;
@@ -0,0 +1,1101 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%d %d %d %s\n", j->l, j->w, j->c, name);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 28             	sub    $0x28,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	8b 51 04             	mov    0x4(%ecx),%edx
+    count(&jobs[0]);
+    report(&jobs[0], "");
+    exit();
+  }
+
+  for(i = 1; i < argc; i += n){
+  19:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%ebp)
+{
+  20:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  23:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  if(argc <= 1){
+  26:	83 f8 01             	cmp    $0x1,%eax
+  29:	0f 8e 93 01 00 00    	jle    1c2 <main+0x1c2>
+  2f:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  32:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  35:	bb 60 0a 00 00       	mov    $0xa60,%ebx
+    nthread = 0;
+  3a:	31 ff                	xor    %edi,%edi
+    for(n = 0; n < NTHREAD && i+n < argc; n++){
+  3c:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  for(i = 1; i < argc; i += n){
+  3f:	89 de                	mov    %ebx,%esi
+  41:	29 d0                	sub    %edx,%eax
+  43:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  46:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  49:	8d 04 90             	lea    (%eax,%edx,4),%eax
+  4c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for(n = 0; n < NTHREAD && i+n < argc; n++){
+  4f:	31 c0                	xor    %eax,%eax
+  51:	89 c3                	mov    %eax,%ebx
+  53:	eb 1f                	jmp    74 <main+0x74>
+  55:	8d 76 00             	lea    0x0(%esi),%esi
+  58:	83 c3 01             	add    $0x1,%ebx
+      if((jobs[n].fd = open(argv[i+n], 0)) < 0)
+        break;
+      if(thread_create(count, &jobs[n]) >= 0)
+        nthread++;
+  5b:	83 c7 01             	add    $0x1,%edi
+    for(n = 0; n < NTHREAD && i+n < argc; n++){
+  5e:	83 fb 08             	cmp    $0x8,%ebx
+  61:	74 57                	je     ba <main+0xba>
+  63:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  66:	81 c6 14 02 00 00    	add    $0x214,%esi
+  6c:	39 c3                	cmp    %eax,%ebx
+  6e:	0f 84 0c 01 00 00    	je     180 <main+0x180>
+      if((jobs[n].fd = open(argv[i+n], 0)) < 0)
+  74:	83 ec 08             	sub    $0x8,%esp
+  77:	6a 00                	push   $0x0
+  79:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  7c:	ff 34 98             	push   (%eax,%ebx,4)
+  7f:	e8 6a 04 00 00       	call   4ee <open>
+  84:	83 c4 10             	add    $0x10,%esp
+  87:	89 06                	mov    %eax,(%esi)
+  89:	85 c0                	test   %eax,%eax
+  8b:	0f 88 ef 00 00 00    	js     180 <main+0x180>
+      if(thread_create(count, &jobs[n]) >= 0)
+  91:	83 ec 08             	sub    $0x8,%esp
+  94:	56                   	push   %esi
+  95:	68 00 02 00 00       	push   $0x200
+  9a:	e8 e1 02 00 00       	call   380 <thread_create>
+  9f:	83 c4 10             	add    $0x10,%esp
+  a2:	85 c0                	test   %eax,%eax
+  a4:	79 b2                	jns    58 <main+0x58>
+      else
+        count(&jobs[n]);
+  a6:	83 ec 0c             	sub    $0xc,%esp
+    for(n = 0; n < NTHREAD && i+n < argc; n++){
+  a9:	83 c3 01             	add    $0x1,%ebx
+        count(&jobs[n]);
+  ac:	56                   	push   %esi
+  ad:	e8 4e 01 00 00       	call   200 <count>
+  b2:	83 c4 10             	add    $0x10,%esp
+    for(n = 0; n < NTHREAD && i+n < argc; n++){
+  b5:	83 fb 08             	cmp    $0x8,%ebx
+  b8:	75 a9                	jne    63 <main+0x63>
+    }
+    while(nthread-- > 0)
+  ba:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  bd:	8d 77 ff             	lea    -0x1(%edi),%esi
+  c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  c3:	85 ff                	test   %edi,%edi
+  c5:	74 1e                	je     e5 <main+0xe5>
+  c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ce:	66 90                	xchg   %ax,%ax
+      thread_join();
+  d0:	e8 7b 03 00 00       	call   450 <thread_join>
+    while(nthread-- > 0)
+  d5:	83 ee 01             	sub    $0x1,%esi
+  d8:	73 f6                	jae    d0 <main+0xd0>
+    for(k = 0; k < n; k++){
+  da:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  dd:	85 f6                	test   %esi,%esi
+  df:	0f 84 bb 00 00 00    	je     1a0 <main+0x1a0>
+  e5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  e8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  eb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  ee:	01 c1                	add    %eax,%ecx
+  f0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  f3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  f6:	8d 34 88             	lea    (%eax,%ecx,4),%esi
+  f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(j->err){
+ 100:	8b 4b 10             	mov    0x10(%ebx),%ecx
+      report(&jobs[k], argv[i+k]);
+ 103:	8b 07                	mov    (%edi),%eax
+  if(j->err){
+ 105:	85 c9                	test   %ecx,%ecx
+ 107:	0f 85 e0 00 00 00    	jne    1ed <main+0x1ed>
+  printf(1, "%d %d %d %s\n", j->l, j->w, j->c, name);
+ 10d:	83 ec 08             	sub    $0x8,%esp
+    for(k = 0; k < n; k++){
+ 110:	83 c7 04             	add    $0x4,%edi
+ 113:	81 c3 14 02 00 00    	add    $0x214,%ebx
+  printf(1, "%d %d %d %s\n", j->l, j->w, j->c, name);
+ 119:	50                   	push   %eax
+ 11a:	ff b3 f8 fd ff ff    	push   -0x208(%ebx)
+ 120:	ff b3 f4 fd ff ff    	push   -0x20c(%ebx)
+ 126:	ff b3 f0 fd ff ff    	push   -0x210(%ebx)
+ 12c:	68 16 08 00 00       	push   $0x816
+ 131:	6a 01                	push   $0x1
+ 133:	e8 18 05 00 00       	call   650 <printf>
+      close(jobs[k].fd);
+ 138:	83 c4 14             	add    $0x14,%esp
+ 13b:	ff b3 ec fd ff ff    	push   -0x214(%ebx)
+ 141:	e8 90 03 00 00       	call   4d6 <close>
+    for(k = 0; k < n; k++){
+ 146:	83 c4 10             	add    $0x10,%esp
+ 149:	39 f7                	cmp    %esi,%edi
+ 14b:	75 b3                	jne    100 <main+0x100>
+    }
+    if(n < NTHREAD && i+n < argc){
+ 14d:	83 7d e0 08          	cmpl   $0x8,-0x20(%ebp)
+ 151:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 154:	74 12                	je     168 <main+0x168>
+ 156:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 159:	39 c1                	cmp    %eax,%ecx
+ 15b:	7c 4d                	jl     1aa <main+0x1aa>
+      printf(1, "wc: cannot open %s\n", argv[i+n]);
+      exit();
+    }
+  }
+  exit();
+ 15d:	e8 4c 03 00 00       	call   4ae <exit>
+ 162:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 1; i < argc; i += n){
+ 168:	83 45 dc 08          	addl   $0x8,-0x24(%ebp)
+ 16c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 16f:	39 45 d8             	cmp    %eax,-0x28(%ebp)
+ 172:	0f 8f b7 fe ff ff    	jg     2f <main+0x2f>
+ 178:	eb e3                	jmp    15d <main+0x15d>
+ 17a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 180:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+    while(nthread-- > 0)
+ 183:	8d 77 ff             	lea    -0x1(%edi),%esi
+ 186:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 189:	85 ff                	test   %edi,%edi
+ 18b:	0f 85 3f ff ff ff    	jne    d0 <main+0xd0>
+ 191:	e9 44 ff ff ff       	jmp    da <main+0xda>
+ 196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19d:	8d 76 00             	lea    0x0(%esi),%esi
+ 1a0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+    if(n < NTHREAD && i+n < argc){
+ 1a3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 1a6:	39 c1                	cmp    %eax,%ecx
+ 1a8:	7d b3                	jge    15d <main+0x15d>
+      printf(1, "wc: cannot open %s\n", argv[i+n]);
+ 1aa:	50                   	push   %eax
+ 1ab:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 1ae:	ff 34 88             	push   (%eax,%ecx,4)
+ 1b1:	68 23 08 00 00       	push   $0x823
+ 1b6:	6a 01                	push   $0x1
+ 1b8:	e8 93 04 00 00       	call   650 <printf>
+      exit();
+ 1bd:	e8 ec 02 00 00       	call   4ae <exit>
+    count(&jobs[0]);
+ 1c2:	83 ec 0c             	sub    $0xc,%esp
+    jobs[0].fd = 0;
+ 1c5:	31 ff                	xor    %edi,%edi
+    count(&jobs[0]);
+ 1c7:	68 60 0a 00 00       	push   $0xa60
+    jobs[0].fd = 0;
+ 1cc:	89 3d 60 0a 00 00    	mov    %edi,0xa60
+    count(&jobs[0]);
+ 1d2:	e8 29 00 00 00       	call   200 <count>
+    report(&jobs[0], "");
+ 1d7:	58                   	pop    %eax
+ 1d8:	5a                   	pop    %edx
+ 1d9:	68 15 08 00 00       	push   $0x815
+ 1de:	68 60 0a 00 00       	push   $0xa60
+ 1e3:	e8 e8 00 00 00       	call   2d0 <report>
+    exit();
+ 1e8:	e8 c1 02 00 00       	call   4ae <exit>
+    printf(1, "wc: read error\n");
+ 1ed:	52                   	push   %edx
+ 1ee:	52                   	push   %edx
+ 1ef:	68 06 08 00 00       	push   $0x806
+ 1f4:	6a 01                	push   $0x1
+ 1f6:	e8 55 04 00 00       	call   650 <printf>
+    exit();
+ 1fb:	e8 ae 02 00 00       	call   4ae <exit>
+
+00000200 <count>:
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	57                   	push   %edi
+ 204:	56                   	push   %esi
+  inword = 0;
+ 205:	31 f6                	xor    %esi,%esi
+{
+ 207:	53                   	push   %ebx
+  l = w = c = 0;
+ 208:	31 db                	xor    %ebx,%ebx
+{
+ 20a:	83 ec 2c             	sub    $0x2c,%esp
+  while((n = read(j->fd, j->buf, sizeof(j->buf))) > 0){
+ 20d:	8b 45 08             	mov    0x8(%ebp),%eax
+  l = w = c = 0;
+ 210:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 217:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  while((n = read(j->fd, j->buf, sizeof(j->buf))) > 0){
+ 21e:	83 c0 14             	add    $0x14,%eax
+ 221:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 224:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 228:	83 ec 04             	sub    $0x4,%esp
+ 22b:	68 00 02 00 00       	push   $0x200
+ 230:	ff 75 e0             	push   -0x20(%ebp)
+ 233:	8b 45 08             	mov    0x8(%ebp),%eax
+ 236:	ff 30                	push   (%eax)
+ 238:	e8 89 02 00 00       	call   4c6 <read>
+ 23d:	83 c4 10             	add    $0x10,%esp
+ 240:	89 c1                	mov    %eax,%ecx
+ 242:	85 c0                	test   %eax,%eax
+ 244:	7e 6a                	jle    2b0 <count+0xb0>
+ 246:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 249:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+ 24c:	89 c7                	mov    %eax,%edi
+ 24e:	01 c8                	add    %ecx,%eax
+ 250:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 253:	eb 0f                	jmp    264 <count+0x64>
+ 255:	8d 76 00             	lea    0x0(%esi),%esi
+        inword = 0;
+ 258:	31 f6                	xor    %esi,%esi
+    for(i=0; i<n; i++){
+ 25a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 25d:	83 c7 01             	add    $0x1,%edi
+ 260:	39 c7                	cmp    %eax,%edi
+ 262:	74 3c                	je     2a0 <count+0xa0>
+      if(j->buf[i] == '\n')
+ 264:	0f be 07             	movsbl (%edi),%eax
+        l++;
+ 267:	31 c9                	xor    %ecx,%ecx
+ 269:	3c 0a                	cmp    $0xa,%al
+ 26b:	0f 94 c1             	sete   %cl
+      if(strchr(" \r\t\n\v", j->buf[i]))
+ 26e:	83 ec 08             	sub    $0x8,%esp
+ 271:	50                   	push   %eax
+        l++;
+ 272:	01 cb                	add    %ecx,%ebx
+      if(strchr(" \r\t\n\v", j->buf[i]))
+ 274:	68 00 08 00 00       	push   $0x800
+ 279:	e8 c2 00 00 00       	call   340 <strchr>
+ 27e:	83 c4 10             	add    $0x10,%esp
+ 281:	85 c0                	test   %eax,%eax
+ 283:	75 d3                	jne    258 <count+0x58>
+      else if(!inword){
+ 285:	85 f6                	test   %esi,%esi
+ 287:	75 d1                	jne    25a <count+0x5a>
+    for(i=0; i<n; i++){
+ 289:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 28c:	83 c7 01             	add    $0x1,%edi
+        w++;
+ 28f:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+        inword = 1;
+ 293:	be 01 00 00 00       	mov    $0x1,%esi
+    for(i=0; i<n; i++){
+ 298:	39 c7                	cmp    %eax,%edi
+ 29a:	75 c8                	jne    264 <count+0x64>
+ 29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      c++;
+ 2a0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+ 2a3:	01 4d d4             	add    %ecx,-0x2c(%ebp)
+ 2a6:	eb 80                	jmp    228 <count+0x28>
+ 2a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+  j->l = l;
+ 2b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  j->w = w;
+ 2b3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  j->err = n < 0;
+ 2b6:	c1 e9 1f             	shr    $0x1f,%ecx
+  j->w = w;
+ 2b9:	89 50 08             	mov    %edx,0x8(%eax)
+  j->c = c;
+ 2bc:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  j->l = l;
+ 2bf:	89 58 04             	mov    %ebx,0x4(%eax)
+  j->c = c;
+ 2c2:	89 50 0c             	mov    %edx,0xc(%eax)
+  j->err = n < 0;
+ 2c5:	89 48 10             	mov    %ecx,0x10(%eax)
+}
+ 2c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2cb:	5b                   	pop    %ebx
+ 2cc:	5e                   	pop    %esi
+ 2cd:	5f                   	pop    %edi
+ 2ce:	5d                   	pop    %ebp
+ 2cf:	c3                   	ret
+
+000002d0 <report>:
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	83 ec 08             	sub    $0x8,%esp
+ 2d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(j->err){
+ 2d9:	8b 50 10             	mov    0x10(%eax),%edx
+ 2dc:	85 d2                	test   %edx,%edx
+ 2de:	75 20                	jne    300 <report+0x30>
+  printf(1, "%d %d %d %s\n", j->l, j->w, j->c, name);
+ 2e0:	83 ec 08             	sub    $0x8,%esp
+ 2e3:	ff 75 0c             	push   0xc(%ebp)
+ 2e6:	ff 70 0c             	push   0xc(%eax)
+ 2e9:	ff 70 08             	push   0x8(%eax)
+ 2ec:	ff 70 04             	push   0x4(%eax)
+ 2ef:	68 16 08 00 00       	push   $0x816
+ 2f4:	6a 01                	push   $0x1
+ 2f6:	e8 55 03 00 00       	call   650 <printf>
+}
+ 2fb:	83 c4 20             	add    $0x20,%esp
+ 2fe:	c9                   	leave
+ 2ff:	c3                   	ret
+    printf(1, "wc: read error\n");
+ 300:	50                   	push   %eax
+ 301:	50                   	push   %eax
+ 302:	68 06 08 00 00       	push   $0x806
+ 307:	6a 01                	push   $0x1
+ 309:	e8 42 03 00 00       	call   650 <printf>
+    exit();
+ 30e:	e8 9b 01 00 00       	call   4ae <exit>
+ 313:	66 90                	xchg   %ax,%ax
+ 315:	66 90                	xchg   %ax,%ax
+ 317:	66 90                	xchg   %ax,%ax
+ 319:	66 90                	xchg   %ax,%ax
+ 31b:	66 90                	xchg   %ax,%ax
+ 31d:	66 90                	xchg   %ax,%ax
+ 31f:	90                   	nop
+
+00000320 <threadstart>:
+static lock_t stacklock;
+static char *freestacks;  // linked through their first word
+
+static void
+threadstart(void *fn, void *arg)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+ 326:	ff 75 0c             	push   0xc(%ebp)
+ 329:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+ 32c:	e8 7d 01 00 00       	call   4ae <exit>
+ 331:	66 90                	xchg   %ax,%ax
+ 333:	66 90                	xchg   %ax,%ax
+ 335:	66 90                	xchg   %ax,%ax
+ 337:	66 90                	xchg   %ax,%ax
+ 339:	66 90                	xchg   %ax,%ax
+ 33b:	66 90                	xchg   %ax,%ax
+ 33d:	66 90                	xchg   %ax,%ax
+ 33f:	90                   	nop
+
+00000340 <strchr>:
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	8b 45 08             	mov    0x8(%ebp),%eax
+ 346:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 34a:	0f b6 10             	movzbl (%eax),%edx
+ 34d:	84 d2                	test   %dl,%dl
+ 34f:	75 12                	jne    363 <strchr+0x23>
+ 351:	eb 1d                	jmp    370 <strchr+0x30>
+ 353:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 357:	90                   	nop
+ 358:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 35c:	83 c0 01             	add    $0x1,%eax
+ 35f:	84 d2                	test   %dl,%dl
+ 361:	74 0d                	je     370 <strchr+0x30>
+    if(*s == c)
+ 363:	38 d1                	cmp    %dl,%cl
+ 365:	75 f1                	jne    358 <strchr+0x18>
+}
+ 367:	5d                   	pop    %ebp
+ 368:	c3                   	ret
+ 369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 370:	31 c0                	xor    %eax,%eax
+}
+ 372:	5d                   	pop    %ebp
+ 373:	c3                   	ret
+ 374:	66 90                	xchg   %ax,%ax
+ 376:	66 90                	xchg   %ax,%ax
+ 378:	66 90                	xchg   %ax,%ax
+ 37a:	66 90                	xchg   %ax,%ax
+ 37c:	66 90                	xchg   %ax,%ax
+ 37e:	66 90                	xchg   %ax,%ax
+
+00000380 <thread_create>:
+}
+
+// Start a thread running fn(arg).  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ 380:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 381:	ba 01 00 00 00       	mov    $0x1,%edx
+ 386:	89 e5                	mov    %esp,%ebp
+ 388:	53                   	push   %ebx
+ 389:	83 ec 04             	sub    $0x4,%esp
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 390:	89 d0                	mov    %edx,%eax
+ 392:	f0 87 05 04 1b 00 00 	lock xchg %eax,0x1b04
+  while(xchg(&lk->locked, 1) != 0)
+ 399:	85 c0                	test   %eax,%eax
+ 39b:	75 f3                	jne    390 <thread_create+0x10>
+  char *stack;
+  int pid;
+
+  lock_acquire(&stacklock);
+  if((stack = freestacks) != 0)
+ 39d:	8b 1d 00 1b 00 00    	mov    0x1b00,%ebx
+ 3a3:	85 db                	test   %ebx,%ebx
+ 3a5:	74 71                	je     418 <thread_create+0x98>
+    freestacks = *(char**)stack;
+ 3a7:	8b 13                	mov    (%ebx),%edx
+ 3a9:	89 15 00 1b 00 00    	mov    %edx,0x1b00
+ 3af:	f0 87 05 04 1b 00 00 	lock xchg %eax,0x1b04
+  lock_release(&stacklock);
+  if(stack == 0 && (stack = sbrk(TSTACK)) == (char*)-1)
+    return -1;
+  if((pid = clone(threadstart, fn, arg, stack)) < 0){
+ 3b6:	53                   	push   %ebx
+ 3b7:	ff 75 0c             	push   0xc(%ebp)
+ 3ba:	ff 75 08             	push   0x8(%ebp)
+ 3bd:	68 20 03 00 00       	push   $0x320
+ 3c2:	e8 a7 01 00 00       	call   56e <clone>
+ 3c7:	83 c4 10             	add    $0x10,%esp
+ 3ca:	89 c2                	mov    %eax,%edx
+ 3cc:	85 c0                	test   %eax,%eax
+ 3ce:	78 10                	js     3e0 <thread_create+0x60>
+    *(char**)stack = freestacks;
+    freestacks = stack;
+    lock_release(&stacklock);
+  }
+  return pid;
+}
+ 3d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3d3:	89 d0                	mov    %edx,%eax
+ 3d5:	c9                   	leave
+ 3d6:	c3                   	ret
+ 3d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3de:	66 90                	xchg   %ax,%ax
+ 3e0:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 3e5:	8d 76 00             	lea    0x0(%esi),%esi
+ 3e8:	89 c8                	mov    %ecx,%eax
+ 3ea:	f0 87 05 04 1b 00 00 	lock xchg %eax,0x1b04
+  while(xchg(&lk->locked, 1) != 0)
+ 3f1:	85 c0                	test   %eax,%eax
+ 3f3:	75 f3                	jne    3e8 <thread_create+0x68>
+    *(char**)stack = freestacks;
+ 3f5:	8b 0d 00 1b 00 00    	mov    0x1b00,%ecx
+    freestacks = stack;
+ 3fb:	89 1d 00 1b 00 00    	mov    %ebx,0x1b00
+    *(char**)stack = freestacks;
+ 401:	89 0b                	mov    %ecx,(%ebx)
+ 403:	f0 87 05 04 1b 00 00 	lock xchg %eax,0x1b04
+}
+ 40a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 40d:	89 d0                	mov    %edx,%eax
+ 40f:	c9                   	leave
+ 410:	c3                   	ret
+ 411:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 418:	89 d8                	mov    %ebx,%eax
+ 41a:	f0 87 05 04 1b 00 00 	lock xchg %eax,0x1b04
+  if(stack == 0 && (stack = sbrk(TSTACK)) == (char*)-1)
+ 421:	83 ec 0c             	sub    $0xc,%esp
+ 424:	68 00 10 00 00       	push   $0x1000
+ 429:	e8 08 01 00 00       	call   536 <sbrk>
+ 42e:	83 c4 10             	add    $0x10,%esp
+ 431:	89 c3                	mov    %eax,%ebx
+ 433:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 436:	0f 85 7a ff ff ff    	jne    3b6 <thread_create+0x36>
+    return -1;
+ 43c:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+ 441:	eb 8d                	jmp    3d0 <thread_create+0x50>
+ 443:	66 90                	xchg   %ax,%ax
+ 445:	66 90                	xchg   %ax,%ax
+ 447:	66 90                	xchg   %ax,%ax
+ 449:	66 90                	xchg   %ax,%ax
+ 44b:	66 90                	xchg   %ax,%ax
+ 44d:	66 90                	xchg   %ax,%ax
+ 44f:	90                   	nop
+
+00000450 <thread_join>:
+
+// Wait for a thread started by thread_create() to finish.
+// Returns its pid, or -1 if there are none.
+int
+thread_join(void)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	53                   	push   %ebx
+  char *stack;
+  int pid;
+
+  if((pid = join((void**)&stack)) < 0)
+ 454:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ 457:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join((void**)&stack)) < 0)
+ 45a:	50                   	push   %eax
+ 45b:	e8 16 01 00 00       	call   576 <join>
+ 460:	83 c4 10             	add    $0x10,%esp
+ 463:	85 c0                	test   %eax,%eax
+ 465:	78 38                	js     49f <thread_join+0x4f>
+ 467:	89 c1                	mov    %eax,%ecx
+ 469:	ba 01 00 00 00       	mov    $0x1,%edx
+ 46e:	66 90                	xchg   %ax,%ax
+ 470:	89 d0                	mov    %edx,%eax
+ 472:	f0 87 05 04 1b 00 00 	lock xchg %eax,0x1b04
+  while(xchg(&lk->locked, 1) != 0)
+ 479:	85 c0                	test   %eax,%eax
+ 47b:	75 f3                	jne    470 <thread_join+0x20>
+    return -1;
+  lock_acquire(&stacklock);
+  *(char**)stack = freestacks;
+ 47d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 480:	8b 1d 00 1b 00 00    	mov    0x1b00,%ebx
+ 486:	89 1a                	mov    %ebx,(%edx)
+  freestacks = stack;
+ 488:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 48b:	89 15 00 1b 00 00    	mov    %edx,0x1b00
+ 491:	f0 87 05 04 1b 00 00 	lock xchg %eax,0x1b04
+  lock_release(&stacklock);
+  return pid;
+}
+ 498:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 49b:	89 c8                	mov    %ecx,%eax
+ 49d:	c9                   	leave
+ 49e:	c3                   	ret
+    return -1;
+ 49f:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ 4a4:	eb f2                	jmp    498 <thread_join+0x48>
+
+000004a6 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4a6:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4ab:	cd 40                	int    $0x40
+ 4ad:	c3                   	ret
+
+000004ae <exit>:
+SYSCALL(exit)
+ 4ae:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4b3:	cd 40                	int    $0x40
+ 4b5:	c3                   	ret
+
+000004b6 <wait>:
+SYSCALL(wait)
+ 4b6:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4bb:	cd 40                	int    $0x40
+ 4bd:	c3                   	ret
+
+000004be <pipe>:
+SYSCALL(pipe)
+ 4be:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4c3:	cd 40                	int    $0x40
+ 4c5:	c3                   	ret
+
+000004c6 <read>:
+SYSCALL(read)
+ 4c6:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4cb:	cd 40                	int    $0x40
+ 4cd:	c3                   	ret
+
+000004ce <write>:
+SYSCALL(write)
+ 4ce:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4d3:	cd 40                	int    $0x40
+ 4d5:	c3                   	ret
+
+000004d6 <close>:
+SYSCALL(close)
+ 4d6:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4db:	cd 40                	int    $0x40
+ 4dd:	c3                   	ret
+
+000004de <kill>:
+SYSCALL(kill)
+ 4de:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4e3:	cd 40                	int    $0x40
+ 4e5:	c3                   	ret
+
+000004e6 <exec>:
+SYSCALL(exec)
+ 4e6:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4eb:	cd 40                	int    $0x40
+ 4ed:	c3                   	ret
+
+000004ee <open>:
+SYSCALL(open)
+ 4ee:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4f3:	cd 40                	int    $0x40
+ 4f5:	c3                   	ret
+
+000004f6 <mknod>:
+SYSCALL(mknod)
+ 4f6:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4fb:	cd 40                	int    $0x40
+ 4fd:	c3                   	ret
+
+000004fe <unlink>:
+SYSCALL(unlink)
+ 4fe:	b8 12 00 00 00       	mov    $0x12,%eax
+ 503:	cd 40                	int    $0x40
+ 505:	c3                   	ret
+
+00000506 <fstat>:
+SYSCALL(fstat)
+ 506:	b8 08 00 00 00       	mov    $0x8,%eax
+ 50b:	cd 40                	int    $0x40
+ 50d:	c3                   	ret
+
+0000050e <link>:
+SYSCALL(link)
+ 50e:	b8 13 00 00 00       	mov    $0x13,%eax
+ 513:	cd 40                	int    $0x40
+ 515:	c3                   	ret
+
+00000516 <mkdir>:
+SYSCALL(mkdir)
+ 516:	b8 14 00 00 00       	mov    $0x14,%eax
+ 51b:	cd 40                	int    $0x40
+ 51d:	c3                   	ret
+
+0000051e <chdir>:
+SYSCALL(chdir)
+ 51e:	b8 09 00 00 00       	mov    $0x9,%eax
+ 523:	cd 40                	int    $0x40
+ 525:	c3                   	ret
+
+00000526 <dup>:
+SYSCALL(dup)
+ 526:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 52b:	cd 40                	int    $0x40
+ 52d:	c3                   	ret
+
+0000052e <getpid>:
+SYSCALL(getpid)
+ 52e:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 533:	cd 40                	int    $0x40
+ 535:	c3                   	ret
+
+00000536 <sbrk>:
+SYSCALL(sbrk)
+ 536:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 53b:	cd 40                	int    $0x40
+ 53d:	c3                   	ret
+
+0000053e <sleep>:
+SYSCALL(sleep)
+ 53e:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 543:	cd 40                	int    $0x40
+ 545:	c3                   	ret
+
+00000546 <uptime>:
+SYSCALL(uptime)
+ 546:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 54b:	cd 40                	int    $0x40
+ 54d:	c3                   	ret
+
+0000054e <setpriority>:
+SYSCALL(setpriority)
+ 54e:	b8 16 00 00 00       	mov    $0x16,%eax
+ 553:	cd 40                	int    $0x40
+ 555:	c3                   	ret
+
+00000556 <settickets>:
+SYSCALL(settickets)
+ 556:	b8 17 00 00 00       	mov    $0x17,%eax
+ 55b:	cd 40                	int    $0x40
+ 55d:	c3                   	ret
+
+0000055e <getpinfo>:
+SYSCALL(getpinfo)
+ 55e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 563:	cd 40                	int    $0x40
+ 565:	c3                   	ret
+
+00000566 <nanosleep>:
+SYSCALL(nanosleep)
+ 566:	b8 19 00 00 00       	mov    $0x19,%eax
+ 56b:	cd 40                	int    $0x40
+ 56d:	c3                   	ret
+
+0000056e <clone>:
+SYSCALL(clone)
+ 56e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 573:	cd 40                	int    $0x40
+ 575:	c3                   	ret
+
+00000576 <join>:
+SYSCALL(join)
+ 576:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 57b:	cd 40                	int    $0x40
+ 57d:	c3                   	ret
+
+0000057e <futex_wait>:
+SYSCALL(futex_wait)
+ 57e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 583:	cd 40                	int    $0x40
+ 585:	c3                   	ret
+
+00000586 <futex_wake>:
+SYSCALL(futex_wake)
+ 586:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 58b:	cd 40                	int    $0x40
+ 58d:	c3                   	ret
+
+0000058e <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 58e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 593:	cd 40                	int    $0x40
+ 595:	c3                   	ret
+
+00000596 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 596:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 59b:	cd 40                	int    $0x40
+ 59d:	c3                   	ret
+
+0000059e <iostat>:
+SYSCALL(iostat)
+ 59e:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5a3:	cd 40                	int    $0x40
+ 5a5:	c3                   	ret
+ 5a6:	66 90                	xchg   %ax,%ax
+ 5a8:	66 90                	xchg   %ax,%ax
+ 5aa:	66 90                	xchg   %ax,%ax
+ 5ac:	66 90                	xchg   %ax,%ax
+ 5ae:	66 90                	xchg   %ax,%ax
+
+000005b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	53                   	push   %ebx
+ 5b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5b8:	89 d1                	mov    %edx,%ecx
+{
+ 5ba:	83 ec 3c             	sub    $0x3c,%esp
+ 5bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5c0:	85 d2                	test   %edx,%edx
+ 5c2:	0f 89 80 00 00 00    	jns    648 <printint+0x98>
+ 5c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5cc:	74 7a                	je     648 <printint+0x98>
+    x = -xx;
+ 5ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5d8:	31 f6                	xor    %esi,%esi
+ 5da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5e0:	89 c8                	mov    %ecx,%eax
+ 5e2:	31 d2                	xor    %edx,%edx
+ 5e4:	89 f7                	mov    %esi,%edi
+ 5e6:	f7 f3                	div    %ebx
+ 5e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5eb:	0f b6 92 98 08 00 00 	movzbl 0x898(%edx),%edx
+ 5f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5f6:	89 ca                	mov    %ecx,%edx
+ 5f8:	89 c1                	mov    %eax,%ecx
+ 5fa:	39 da                	cmp    %ebx,%edx
+ 5fc:	73 e2                	jae    5e0 <printint+0x30>
+  if(neg)
+ 5fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 601:	85 c0                	test   %eax,%eax
+ 603:	74 07                	je     60c <printint+0x5c>
+    buf[i++] = '-';
+ 605:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 60a:	89 f7                	mov    %esi,%edi
+ 60c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 60f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 612:	01 df                	add    %ebx,%edi
+ 614:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 618:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 61b:	83 ec 04             	sub    $0x4,%esp
+ 61e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 621:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 624:	6a 01                	push   $0x1
+ 626:	50                   	push   %eax
+ 627:	56                   	push   %esi
+ 628:	e8 a1 fe ff ff       	call   4ce <write>
+  while(--i >= 0)
+ 62d:	89 f8                	mov    %edi,%eax
+ 62f:	83 c4 10             	add    $0x10,%esp
+ 632:	83 ef 01             	sub    $0x1,%edi
+ 635:	39 d8                	cmp    %ebx,%eax
+ 637:	75 df                	jne    618 <printint+0x68>
+}
+ 639:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 63c:	5b                   	pop    %ebx
+ 63d:	5e                   	pop    %esi
+ 63e:	5f                   	pop    %edi
+ 63f:	5d                   	pop    %ebp
+ 640:	c3                   	ret
+ 641:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 648:	31 c0                	xor    %eax,%eax
+ 64a:	eb 89                	jmp    5d5 <printint+0x25>
+ 64c:	66 90                	xchg   %ax,%ax
+ 64e:	66 90                	xchg   %ax,%ax
+
+00000650 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	57                   	push   %edi
+ 654:	56                   	push   %esi
+ 655:	53                   	push   %ebx
+ 656:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 659:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 65c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 65f:	0f b6 1e             	movzbl (%esi),%ebx
+ 662:	83 c6 01             	add    $0x1,%esi
+ 665:	84 db                	test   %bl,%bl
+ 667:	74 67                	je     6d0 <printf+0x80>
+ 669:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 66c:	31 d2                	xor    %edx,%edx
+ 66e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 671:	eb 34                	jmp    6a7 <printf+0x57>
+ 673:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 677:	90                   	nop
+ 678:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 67b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 680:	83 f8 25             	cmp    $0x25,%eax
+ 683:	74 18                	je     69d <printf+0x4d>
+  write(fd, &c, 1);
+ 685:	83 ec 04             	sub    $0x4,%esp
+ 688:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 68b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 68e:	6a 01                	push   $0x1
+ 690:	50                   	push   %eax
+ 691:	57                   	push   %edi
+ 692:	e8 37 fe ff ff       	call   4ce <write>
+ 697:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 69a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 69d:	0f b6 1e             	movzbl (%esi),%ebx
+ 6a0:	83 c6 01             	add    $0x1,%esi
+ 6a3:	84 db                	test   %bl,%bl
+ 6a5:	74 29                	je     6d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6aa:	85 d2                	test   %edx,%edx
+ 6ac:	74 ca                	je     678 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6ae:	83 fa 25             	cmp    $0x25,%edx
+ 6b1:	75 ea                	jne    69d <printf+0x4d>
+      if(c == 'd'){
+ 6b3:	83 f8 25             	cmp    $0x25,%eax
+ 6b6:	0f 84 24 01 00 00    	je     7e0 <printf+0x190>
+ 6bc:	83 e8 63             	sub    $0x63,%eax
+ 6bf:	83 f8 15             	cmp    $0x15,%eax
+ 6c2:	77 1c                	ja     6e0 <printf+0x90>
+ 6c4:	ff 24 85 40 08 00 00 	jmp    *0x840(,%eax,4)
+ 6cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6d3:	5b                   	pop    %ebx
+ 6d4:	5e                   	pop    %esi
+ 6d5:	5f                   	pop    %edi
+ 6d6:	5d                   	pop    %ebp
+ 6d7:	c3                   	ret
+ 6d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6df:	90                   	nop
+  write(fd, &c, 1);
+ 6e0:	83 ec 04             	sub    $0x4,%esp
+ 6e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6ea:	6a 01                	push   $0x1
+ 6ec:	52                   	push   %edx
+ 6ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6f0:	57                   	push   %edi
+ 6f1:	e8 d8 fd ff ff       	call   4ce <write>
+ 6f6:	83 c4 0c             	add    $0xc,%esp
+ 6f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6fc:	6a 01                	push   $0x1
+ 6fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 701:	52                   	push   %edx
+ 702:	57                   	push   %edi
+ 703:	e8 c6 fd ff ff       	call   4ce <write>
+        putc(fd, c);
+ 708:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 70b:	31 d2                	xor    %edx,%edx
+ 70d:	eb 8e                	jmp    69d <printf+0x4d>
+ 70f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 710:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 713:	83 ec 0c             	sub    $0xc,%esp
+ 716:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 71b:	8b 13                	mov    (%ebx),%edx
+ 71d:	6a 00                	push   $0x0
+ 71f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 721:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 724:	e8 87 fe ff ff       	call   5b0 <printint>
+        ap++;
+ 729:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 72c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 72f:	31 d2                	xor    %edx,%edx
+ 731:	e9 67 ff ff ff       	jmp    69d <printf+0x4d>
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 740:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 743:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 745:	83 c0 04             	add    $0x4,%eax
+ 748:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 74b:	85 db                	test   %ebx,%ebx
+ 74d:	0f 84 9d 00 00 00    	je     7f0 <printf+0x1a0>
+        while(*s != 0){
+ 753:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 756:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 758:	84 c0                	test   %al,%al
+ 75a:	0f 84 3d ff ff ff    	je     69d <printf+0x4d>
+ 760:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 763:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 766:	89 de                	mov    %ebx,%esi
+ 768:	89 d3                	mov    %edx,%ebx
+ 76a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 770:	83 ec 04             	sub    $0x4,%esp
+ 773:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 776:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 779:	6a 01                	push   $0x1
+ 77b:	53                   	push   %ebx
+ 77c:	57                   	push   %edi
+ 77d:	e8 4c fd ff ff       	call   4ce <write>
+        while(*s != 0){
+ 782:	0f b6 06             	movzbl (%esi),%eax
+ 785:	83 c4 10             	add    $0x10,%esp
+ 788:	84 c0                	test   %al,%al
+ 78a:	75 e4                	jne    770 <printf+0x120>
+      state = 0;
+ 78c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 78f:	31 d2                	xor    %edx,%edx
+ 791:	e9 07 ff ff ff       	jmp    69d <printf+0x4d>
+ 796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7a3:	83 ec 0c             	sub    $0xc,%esp
+ 7a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7ab:	8b 13                	mov    (%ebx),%edx
+ 7ad:	6a 01                	push   $0x1
+ 7af:	e9 6b ff ff ff       	jmp    71f <printf+0xcf>
+ 7b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7bb:	83 ec 04             	sub    $0x4,%esp
+ 7be:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7c1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7c3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7c9:	6a 01                	push   $0x1
+ 7cb:	52                   	push   %edx
+ 7cc:	57                   	push   %edi
+ 7cd:	e8 fc fc ff ff       	call   4ce <write>
+        ap++;
+ 7d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7d5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7d8:	31 d2                	xor    %edx,%edx
+ 7da:	e9 be fe ff ff       	jmp    69d <printf+0x4d>
+ 7df:	90                   	nop
+  write(fd, &c, 1);
+ 7e0:	83 ec 04             	sub    $0x4,%esp
+ 7e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7e6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7e9:	6a 01                	push   $0x1
+ 7eb:	e9 11 ff ff ff       	jmp    701 <printf+0xb1>
+ 7f0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7f5:	bb 37 08 00 00       	mov    $0x837,%ebx
+ 7fa:	e9 61 ff ff ff       	jmp    760 <printf+0x110>
@@ -2,22 +2,35 @@
 #include "stat.h"
 #include "user.h"
 
-char buf[512];
+// Each file named is counted by a thread of its own, up to
+// NTHREAD at a time; the counts come out in the order of the
+// files.
+#define NTHREAD 8
+
+struct job {
+  int fd;
+  int l, w, c;
+  int err;
+  char buf[512];
+};
+
+struct job jobs[NTHREAD];
 
 void
-wc(int fd, char *name)
+count(void *arg)
 {
+  struct job *j = arg;
   int i, n;
   int l, w, c, inword;
 
   l = w = c = 0;
   inword = 0;
-  while((n = read(fd, buf, sizeof(buf))) > 0){
+  while((n = read(j->fd, j->buf, sizeof(j->buf))) > 0){
     for(i=0; i<n; i++){
       c++;
-      if(buf[i] == '\n')
+      if(j->buf[i] == '\n')
         l++;
-      if(strchr(" \r\t\n\v", buf[i]))
+      if(strchr(" \r\t\n\v", j->buf[i]))
         inword = 0;
       else if(!inword){
         w++;
@@ -25,30 +38,54 @@ wc(int fd, char *name)
       }
     }
   }
-  if(n < 0){
+  j->l = l;
+  j->w = w;
+  j->c = c;
+  j->err = n < 0;
+}
+
+void
+report(struct job *j, char *name)
+{
+  if(j->err){
     printf(1, "wc: read error\n");
     exit();
   }
-  printf(1, "%d %d %d %s\n", l, w, c, name);
+  printf(1, "%d %d %d %s\n", j->l, j->w, j->c, name);
 }
 
 int
 main(int argc, char *argv[])
 {
-  int fd, i;
+  int i, k, n, nthread;
 
   if(argc <= 1){
-    wc(0, "");
+    jobs[0].fd = 0;
+    count(&jobs[0]);
+    report(&jobs[0], "");
     exit();
   }
 
-  for(i = 1; i < argc; i++){
-    if((fd = open(argv[i], 0)) < 0){
-      printf(1, "wc: cannot open %s\n", argv[i]);
+  for(i = 1; i < argc; i += n){
+    nthread = 0;
+    for(n = 0; n < NTHREAD && i+n < argc; n++){
+      if((jobs[n].fd = open(argv[i+n], 0)) < 0)
+        break;
+      if(thread_create(count, &jobs[n]) >= 0)
+        nthread++;
+      else
+        count(&jobs[n]);
+    }
+    while(nthread-- > 0)
+      thread_join();
+    for(k = 0; k < n; k++){
+      report(&jobs[k], argv[i+k]);
+      close(jobs[k].fd);
+    }
+    if(n < NTHREAD && i+n < argc){
+      printf(1, "wc: cannot open %s\n", argv[i+n]);
       exit();
     }
-    wc(fd, argv[i]);
-    close(fd);
   }
   exit();
 }
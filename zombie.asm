@@ -0,0 +1,239 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 16 00 00 00       	call   2c <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 a0 00 00 00       	call   c4 <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 08 00 00 00       	call   34 <exit>
+
+0000002c <fork>:
+  char *stack;
+  int pid;
+
+  lock_acquire(&stacklock);
+  if((stack = freestacks) != 0)
+    freestacks = *(char**)stack;
+  2c:	b8 01 00 00 00       	mov    $0x1,%eax
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+  31:	cd 40                	int    $0x40
+  33:	c3                   	ret
+
+00000034 <exit>:
+  34:	b8 02 00 00 00       	mov    $0x2,%eax
+  lock_release(&stacklock);
+  if(stack == 0 && (stack = sbrk(TSTACK)) == (char*)-1)
+    return -1;
+  if((pid = clone(threadstart, fn, arg, stack)) < 0){
+  39:	cd 40                	int    $0x40
+  3b:	c3                   	ret
+
+0000003c <wait>:
+  3c:	b8 03 00 00 00       	mov    $0x3,%eax
+  41:	cd 40                	int    $0x40
+  43:	c3                   	ret
+
+00000044 <pipe>:
+  44:	b8 04 00 00 00       	mov    $0x4,%eax
+  49:	cd 40                	int    $0x40
+  4b:	c3                   	ret
+
+0000004c <read>:
+  4c:	b8 05 00 00 00       	mov    $0x5,%eax
+    *(char**)stack = freestacks;
+    freestacks = stack;
+    lock_release(&stacklock);
+  }
+  return pid;
+}
+  51:	cd 40                	int    $0x40
+  53:	c3                   	ret
+
+00000054 <write>:
+  54:	b8 10 00 00 00       	mov    $0x10,%eax
+  59:	cd 40                	int    $0x40
+  5b:	c3                   	ret
+
+0000005c <close>:
+  5c:	b8 15 00 00 00       	mov    $0x15,%eax
+  61:	cd 40                	int    $0x40
+  63:	c3                   	ret
+
+00000064 <kill>:
+  64:	b8 06 00 00 00       	mov    $0x6,%eax
+  69:	cd 40                	int    $0x40
+  6b:	c3                   	ret
+
+0000006c <exec>:
+  6c:	b8 07 00 00 00       	mov    $0x7,%eax
+  while(xchg(&lk->locked, 1) != 0)
+  71:	cd 40                	int    $0x40
+  73:	c3                   	ret
+
+00000074 <open>:
+  74:	b8 0f 00 00 00       	mov    $0xf,%eax
+    *(char**)stack = freestacks;
+  79:	cd 40                	int    $0x40
+    freestacks = stack;
+  7b:	c3                   	ret
+
+0000007c <mknod>:
+  7c:	b8 11 00 00 00       	mov    $0x11,%eax
+    *(char**)stack = freestacks;
+  81:	cd 40                	int    $0x40
+  83:	c3                   	ret
+
+00000084 <unlink>:
+  84:	b8 12 00 00 00       	mov    $0x12,%eax
+  89:	cd 40                	int    $0x40
+}
+  8b:	c3                   	ret
+
+0000008c <fstat>:
+  8c:	b8 08 00 00 00       	mov    $0x8,%eax
+  91:	cd 40                	int    $0x40
+  93:	c3                   	ret
+
+00000094 <link>:
+  94:	b8 13 00 00 00       	mov    $0x13,%eax
+  99:	cd 40                	int    $0x40
+  9b:	c3                   	ret
+
+0000009c <mkdir>:
+  9c:	b8 14 00 00 00       	mov    $0x14,%eax
+  if(stack == 0 && (stack = sbrk(TSTACK)) == (char*)-1)
+  a1:	cd 40                	int    $0x40
+  a3:	c3                   	ret
+
+000000a4 <chdir>:
+  a4:	b8 09 00 00 00       	mov    $0x9,%eax
+  a9:	cd 40                	int    $0x40
+  ab:	c3                   	ret
+
+000000ac <dup>:
+  ac:	b8 0a 00 00 00       	mov    $0xa,%eax
+  b1:	cd 40                	int    $0x40
+  b3:	c3                   	ret
+
+000000b4 <getpid>:
+  b4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  b9:	cd 40                	int    $0x40
+  bb:	c3                   	ret
+
+000000bc <sbrk>:
+    return -1;
+  bc:	b8 0c 00 00 00       	mov    $0xc,%eax
+  c1:	cd 40                	int    $0x40
+SYSCALL(link)
+SYSCALL(mkdir)
+SYSCALL(chdir)
+SYSCALL(dup)
+SYSCALL(getpid)
+SYSCALL(sbrk)
+  c3:	c3                   	ret
+
+000000c4 <sleep>:
+SYSCALL(sleep)
+  c4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  c9:	cd 40                	int    $0x40
+  cb:	c3                   	ret
+
+000000cc <uptime>:
+SYSCALL(uptime)
+  cc:	b8 0e 00 00 00       	mov    $0xe,%eax
+  d1:	cd 40                	int    $0x40
+  d3:	c3                   	ret
+
+000000d4 <setpriority>:
+SYSCALL(setpriority)
+  d4:	b8 16 00 00 00       	mov    $0x16,%eax
+  d9:	cd 40                	int    $0x40
+  db:	c3                   	ret
+
+000000dc <settickets>:
+SYSCALL(settickets)
+  dc:	b8 17 00 00 00       	mov    $0x17,%eax
+  e1:	cd 40                	int    $0x40
+  e3:	c3                   	ret
+
+000000e4 <getpinfo>:
+SYSCALL(getpinfo)
+  e4:	b8 18 00 00 00       	mov    $0x18,%eax
+  e9:	cd 40                	int    $0x40
+  eb:	c3                   	ret
+
+000000ec <nanosleep>:
+SYSCALL(nanosleep)
+  ec:	b8 19 00 00 00       	mov    $0x19,%eax
+  f1:	cd 40                	int    $0x40
+  f3:	c3                   	ret
+
+000000f4 <clone>:
+SYSCALL(clone)
+  f4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  f9:	cd 40                	int    $0x40
+  fb:	c3                   	ret
+
+000000fc <join>:
+SYSCALL(join)
+  fc:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 101:	cd 40                	int    $0x40
+ 103:	c3                   	ret
+
+00000104 <futex_wait>:
+SYSCALL(futex_wait)
+ 104:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 109:	cd 40                	int    $0x40
+ 10b:	c3                   	ret
+
+0000010c <futex_wake>:
+SYSCALL(futex_wake)
+ 10c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 111:	cd 40                	int    $0x40
+ 113:	c3                   	ret
+
+00000114 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 114:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 119:	cd 40                	int    $0x40
+ 11b:	c3                   	ret
+
+0000011c <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 11c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 121:	cd 40                	int    $0x40
+ 123:	c3                   	ret
+
+00000124 <iostat>:
+SYSCALL(iostat)
+ 124:	b8 20 00 00 00       	mov    $0x20,%eax
+ 129:	cd 40                	int    $0x40
+ 12b:	c3                   	ret